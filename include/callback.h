@@ -27,6 +27,16 @@
 typedef Bitu (*CallBack_Handler)(void);
 extern CallBack_Handler CallBack_Handlers[];
 
+/* A leaf handler serves the cheap requests of a callback without leaving the cpu core.
+   It must not run the machine (CALLBACK_Idle, CALLBACK_RunRealInt...) and returns false
+   to let the core exit and call the full handler instead. */
+typedef bool (*CallBack_LeafHandler)(void);
+extern CallBack_LeafHandler CallBack_Leaves[];
+
+/* Calls of each callback, and how many of them were served inside the core */
+extern Bit64u CallBack_Calls[];
+extern Bit64u CallBack_LeafCalls[];
+
 enum { CB_RETN,CB_RETF,CB_RETF8,CB_IRET,CB_IRETD,CB_IRET_STI,CB_IRET_EOI_PIC1,
 		CB_IRQ0,CB_IRQ1,CB_IRQ9,CB_IRQ12,CB_IRQ12_RET,CB_IRQ6_PCJR,CB_MOUSE,
 		CB_INT29,CB_INT16,CB_HOOKABLE,CB_TDE_IRET,CB_IPXESR,CB_IPXESR_RET,
@@ -68,6 +78,19 @@ Bitu CALLBACK_Setup(Bitu callback,CallBack_Handler handler,Bitu type,PhysPt addr
 const char* CALLBACK_GetDescription(Bitu callback);
 bool CALLBACK_Free(Bitu callback);
 
+/* Setting up a callback clears its leaf handler, so install it afterwards */
+void CALLBACK_SetLeaf(Bitu callback,CallBack_LeafHandler leaf);
+
+/* Called by the cores on a callback instruction with the flags filled and eip saved,
+   cs:ip has to be reloaded when it returns true */
+static INLINE bool CALLBACK_RunLeaf(Bitu callback) {
+	if (GCC_UNLIKELY(callback>=CB_MAX) || !CallBack_Leaves[callback]) return false;
+	if (!(*CallBack_Leaves[callback])()) return false;
+	CallBack_Calls[callback]++;
+	CallBack_LeafCalls[callback]++;
+	return true;
+}
+
 void CALLBACK_SCF(bool val);
 void CALLBACK_SZF(bool val);
 void CALLBACK_SIF(bool val);
@@ -50,6 +50,10 @@ extern bool DosboxWindowIsFocused;
 extern Bitu cycle_count;
 extern Bitu debugCallback;
 
+// Core fuzzer, compares the cpu cores with the normal core on random code
+typedef void (*FUZZ_Print)(char const* format,...);
+Bitu FUZZ_Cores(Bitu cases,Bit32u & seed,FUZZ_Print print);
+
 #ifdef C_HEAVY_DEBUG
 bool DEBUG_HeavyIsBreakpoint(void);
 void DEBUG_HeavyWriteLogInstruction(void);
@@ -115,6 +119,7 @@ public:
 	static CBreakpoint*		FindPhysBreakpoint(Bit16u seg, Bit32u off, bool once);
 	static CBreakpoint*		FindOtherActiveBreakpoint(PhysPt adr, CBreakpoint* skip);
 	static bool				IsBreakpoint(Bit16u seg, Bit32u off);
+	static bool				HasActiveBreakpoint(PhysPt adr);
 	static bool				DeleteBreakpoint(Bit16u seg, Bit32u off);
 	static bool				DeleteByIndex(Bit16u index);
 	static void				DeleteAll(void);
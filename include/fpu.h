@@ -66,6 +66,12 @@ typedef struct {
     Bit32u d2;
 } FPU_P_Reg;
 
+/* A register in the x87 80-bit format, used by the softfloat mode */
+typedef struct {
+	Bit64u		mant;		// Significand with the explicit integer bit
+	Bit16u		exp;		// Sign and biased exponent
+} FPU_Ext;
+
 enum FPU_Tag {
 	TAG_Valid = 0,
 	TAG_Zero  = 1,
@@ -83,11 +89,13 @@ enum FPU_Round {
 typedef struct {
 	FPU_Reg		regs[9];
 	FPU_P_Reg	p_regs[9];
+	FPU_Ext		regs_80[9];
 	FPU_Tag		tags[9];
 	Bit16u		cw,cw_mask_all;
 	Bit16u		sw;
 	Bit32u		top;
 	FPU_Round	round;
+	bool		softfloat;	// Registers live in regs_80 with full x87 precision
 } FPU_rec;
 
 
@@ -107,6 +115,7 @@ extern FPU_rec fpu;
 
 Bit16u FPU_GetTag(void);
 void FPU_FLDCW(PhysPt addr);
+void FPU_LoadHostImage(HostPt image,Bitu cw);
 
 static INLINE void FPU_SetTag(Bit16u tag){
 	for(Bitu i=0;i<8;i++)
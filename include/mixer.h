@@ -101,6 +101,10 @@ MixerChannel * MIXER_AddChannel(MIXER_Handler handler,Bitu freq,const char * nam
 MixerChannel * MIXER_FindChannel(const char * name);
 /* Find the device you want to delete with findchannel "delchan gets deleted" */
 void MIXER_DelChannel(MixerChannel* delchan); 
+/* Samples waiting for the audio callback, relative to the maximum the mixer buffers */
+float MIXER_GetBufferFill(void);
+/* Running count of audio callbacks that ran out of samples */
+Bitu MIXER_GetUnderruns(void);
 
 /* Object to maintain a mixerchannel; As all objects it registers itself with create
  * and removes itself when destroyed. */
@@ -0,0 +1,307 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOSBOX_MMX_H
+#define DOSBOX_MMX_H
+
+#ifndef DOSBOX_FPU_H
+#include "fpu.h"
+#endif
+
+#if C_FPU
+
+/* Packed operations map onto the host SSE2 unit when the compiler targets it */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define C_MMX_SSE2 1
+#include <emmintrin.h>
+#else
+#define C_MMX_SSE2 0
+#endif
+
+typedef union {
+	Bit64u q;
+	Bit32u ud[2];
+	Bit32s sd[2];
+	Bit16u uw[4];
+	Bit16s sw[4];
+	Bit8u ub[8];
+	Bit8s sb[8];
+} MMX_Reg;
+
+/* Index of lane i counted from the least significant end */
+#ifndef WORDS_BIGENDIAN
+#define MMX_B(i) (i)
+#define MMX_W(i) (i)
+#define MMX_D(i) (i)
+#else
+#define MMX_B(i) (7-(i))
+#define MMX_W(i) (3-(i))
+#define MMX_D(i) (1-(i))
+#endif
+
+/* The MMX registers alias the significands of the physical FPU registers */
+struct MMX_Block {
+	Bit64u * regs[8];
+	Bit16u * exps[8];		// Set to all ones by a write, like the real thing
+	Bit16u no_exp;			// Written instead when the FPU keeps its registers as doubles
+	void (* sync)(void);	// Set while a core keeps the FPU registers elsewhere, moves them back here
+};
+
+extern MMX_Block mmx;
+
+typedef Bit64u (* MMX_Op)(Bit64u dest,Bit64u src);
+
+/* Called by every MMX instruction before it touches the registers */
+static INLINE void MMX_Sync(void) {
+	if (GCC_UNLIKELY(mmx.sync!=0)) mmx.sync();
+}
+
+/* Every MMX instruction except EMMS empties the stack top and marks all registers valid */
+static INLINE void MMX_Enter(void) {
+	TOP=0;
+	for (Bitu i=0;i<8;i++) fpu.tags[i]=TAG_Valid;
+}
+
+static INLINE void MMX_EMMS(void) {
+	for (Bitu i=0;i<8;i++) fpu.tags[i]=TAG_Empty;
+}
+
+static INLINE Bit64u MMX_Load(Bitu reg) {
+	return *mmx.regs[reg];
+}
+
+static INLINE void MMX_Store(Bitu reg,Bit64u val) {
+	*mmx.regs[reg]=val;
+	*mmx.exps[reg]=0xffff;
+}
+
+static INLINE Bit8s MMX_SatSB(Bits val) {
+	return (Bit8s)(val>0x7f ? 0x7f : (val<-0x80 ? -0x80 : val));
+}
+
+static INLINE Bit8u MMX_SatUB(Bits val) {
+	return (Bit8u)(val>0xff ? 0xff : (val<0 ? 0 : val));
+}
+
+static INLINE Bit16s MMX_SatSW(Bits val) {
+	return (Bit16s)(val>0x7fff ? 0x7fff : (val<-0x8000 ? -0x8000 : val));
+}
+
+static INLINE Bit16u MMX_SatUW(Bits val) {
+	return (Bit16u)(val>0xffff ? 0xffff : (val<0 ? 0 : val));
+}
+
+static INLINE Bit64u MMX_MOVQ(Bit64u /*d*/,Bit64u s) { return s; }
+
+/* Logical operations work on the whole quadword */
+static INLINE Bit64u MMX_PAND(Bit64u d,Bit64u s) { return d&s; }
+static INLINE Bit64u MMX_PANDN(Bit64u d,Bit64u s) { return (~d)&s; }
+static INLINE Bit64u MMX_POR(Bit64u d,Bit64u s) { return d|s; }
+static INLINE Bit64u MMX_PXOR(Bit64u d,Bit64u s) { return d^s; }
+
+#if C_MMX_SSE2
+
+static INLINE __m128i MMX_ToSSE(Bit64u q) {
+	return _mm_loadl_epi64((const __m128i *)&q);
+}
+
+static INLINE Bit64u MMX_FromSSE(__m128i x) {
+	Bit64u q;
+	_mm_storel_epi64((__m128i *)&q,x);
+	return q;
+}
+
+#define MMX_SSE2_OP(name,intrin)											\
+	static INLINE Bit64u MMX_##name(Bit64u d,Bit64u s) {					\
+		return MMX_FromSSE(intrin(MMX_ToSSE(d),MMX_ToSSE(s)));				\
+	}
+
+MMX_SSE2_OP(PADDB,_mm_add_epi8)
+MMX_SSE2_OP(PADDW,_mm_add_epi16)
+MMX_SSE2_OP(PADDD,_mm_add_epi32)
+MMX_SSE2_OP(PADDSB,_mm_adds_epi8)
+MMX_SSE2_OP(PADDSW,_mm_adds_epi16)
+MMX_SSE2_OP(PADDUSB,_mm_adds_epu8)
+MMX_SSE2_OP(PADDUSW,_mm_adds_epu16)
+MMX_SSE2_OP(PSUBB,_mm_sub_epi8)
+MMX_SSE2_OP(PSUBW,_mm_sub_epi16)
+MMX_SSE2_OP(PSUBD,_mm_sub_epi32)
+MMX_SSE2_OP(PSUBSB,_mm_subs_epi8)
+MMX_SSE2_OP(PSUBSW,_mm_subs_epi16)
+MMX_SSE2_OP(PSUBUSB,_mm_subs_epu8)
+MMX_SSE2_OP(PSUBUSW,_mm_subs_epu16)
+MMX_SSE2_OP(PCMPEQB,_mm_cmpeq_epi8)
+MMX_SSE2_OP(PCMPEQW,_mm_cmpeq_epi16)
+MMX_SSE2_OP(PCMPEQD,_mm_cmpeq_epi32)
+MMX_SSE2_OP(PCMPGTB,_mm_cmpgt_epi8)
+MMX_SSE2_OP(PCMPGTW,_mm_cmpgt_epi16)
+MMX_SSE2_OP(PCMPGTD,_mm_cmpgt_epi32)
+MMX_SSE2_OP(PMULLW,_mm_mullo_epi16)
+MMX_SSE2_OP(PMULHW,_mm_mulhi_epi16)
+MMX_SSE2_OP(PMADDWD,_mm_madd_epi16)
+/* The shift count is the whole source quadword, too large counts clear or sign fill */
+MMX_SSE2_OP(PSLLW,_mm_sll_epi16)
+MMX_SSE2_OP(PSLLD,_mm_sll_epi32)
+MMX_SSE2_OP(PSLLQ,_mm_sll_epi64)
+MMX_SSE2_OP(PSRLW,_mm_srl_epi16)
+MMX_SSE2_OP(PSRLD,_mm_srl_epi32)
+MMX_SSE2_OP(PSRLQ,_mm_srl_epi64)
+MMX_SSE2_OP(PSRAW,_mm_sra_epi16)
+MMX_SSE2_OP(PSRAD,_mm_sra_epi32)
+
+/* The low halves of the operands interleave, the high halves end up in the upper quadword */
+#define MMX_UNPACK(low,high,intrin)											\
+	static INLINE Bit64u MMX_##low(Bit64u d,Bit64u s) {						\
+		return MMX_FromSSE(intrin(MMX_ToSSE(d),MMX_ToSSE(s)));				\
+	}																		\
+	static INLINE Bit64u MMX_##high(Bit64u d,Bit64u s) {						\
+		return MMX_FromSSE(_mm_srli_si128(intrin(MMX_ToSSE(d),MMX_ToSSE(s)),8));	\
+	}
+
+/* Both operands are packed from a single register holding the destination then the source */
+#define MMX_PACK(name,intrin)												\
+	static INLINE Bit64u MMX_##name(Bit64u d,Bit64u s) {					\
+		__m128i x=_mm_unpacklo_epi64(MMX_ToSSE(d),MMX_ToSSE(s));			\
+		return MMX_FromSSE(intrin(x,x));									\
+	}
+
+#else
+
+#define MMX_LANE_OP(name,lane,count,expr)									\
+	static INLINE Bit64u MMX_##name(Bit64u d,Bit64u s) {					\
+		MMX_Reg a,b;a.q=d;b.q=s;											\
+		for (Bitu i=0;i<count;i++) a.lane[i]=expr;							\
+		return a.q;															\
+	}
+
+MMX_LANE_OP(PADDB,ub,8,a.ub[i]+b.ub[i])
+MMX_LANE_OP(PADDW,uw,4,a.uw[i]+b.uw[i])
+MMX_LANE_OP(PADDD,ud,2,a.ud[i]+b.ud[i])
+MMX_LANE_OP(PADDSB,sb,8,MMX_SatSB((Bits)a.sb[i]+b.sb[i]))
+MMX_LANE_OP(PADDSW,sw,4,MMX_SatSW((Bits)a.sw[i]+b.sw[i]))
+MMX_LANE_OP(PADDUSB,ub,8,MMX_SatUB((Bits)a.ub[i]+b.ub[i]))
+MMX_LANE_OP(PADDUSW,uw,4,MMX_SatUW((Bits)a.uw[i]+b.uw[i]))
+MMX_LANE_OP(PSUBB,ub,8,a.ub[i]-b.ub[i])
+MMX_LANE_OP(PSUBW,uw,4,a.uw[i]-b.uw[i])
+MMX_LANE_OP(PSUBD,ud,2,a.ud[i]-b.ud[i])
+MMX_LANE_OP(PSUBSB,sb,8,MMX_SatSB((Bits)a.sb[i]-b.sb[i]))
+MMX_LANE_OP(PSUBSW,sw,4,MMX_SatSW((Bits)a.sw[i]-b.sw[i]))
+MMX_LANE_OP(PSUBUSB,ub,8,MMX_SatUB((Bits)a.ub[i]-b.ub[i]))
+MMX_LANE_OP(PSUBUSW,uw,4,MMX_SatUW((Bits)a.uw[i]-b.uw[i]))
+MMX_LANE_OP(PCMPEQB,ub,8,(a.ub[i]==b.ub[i]) ? 0xff : 0)
+MMX_LANE_OP(PCMPEQW,uw,4,(a.uw[i]==b.uw[i]) ? 0xffff : 0)
+MMX_LANE_OP(PCMPEQD,ud,2,(a.ud[i]==b.ud[i]) ? 0xffffffff : 0)
+MMX_LANE_OP(PCMPGTB,ub,8,(a.sb[i]>b.sb[i]) ? 0xff : 0)
+MMX_LANE_OP(PCMPGTW,uw,4,(a.sw[i]>b.sw[i]) ? 0xffff : 0)
+MMX_LANE_OP(PCMPGTD,ud,2,(a.sd[i]>b.sd[i]) ? 0xffffffff : 0)
+MMX_LANE_OP(PMULLW,uw,4,(Bit16u)((Bit32u)a.uw[i]*b.uw[i]))
+MMX_LANE_OP(PMULHW,uw,4,(Bit16u)(((Bit32s)a.sw[i]*b.sw[i])>>16))
+
+static INLINE Bit64u MMX_PMADDWD(Bit64u d,Bit64u s) {
+	MMX_Reg a,b,r;a.q=d;b.q=s;
+	for (Bitu i=0;i<2;i++) {
+		/* Only -0x8000 squared twice overflows, it wraps like the real thing */
+		r.ud[MMX_D(i)]=(Bit32u)((Bit32s)a.sw[MMX_W(2*i)]*b.sw[MMX_W(2*i)])+
+			(Bit32u)((Bit32s)a.sw[MMX_W(2*i+1)]*b.sw[MMX_W(2*i+1)]);
+	}
+	return r.q;
+}
+
+/* The shift count is the whole source quadword, too large counts clear or sign fill */
+MMX_LANE_OP(PSLLW,uw,4,(s>15) ? 0 : (Bit16u)(a.uw[i]<<s))
+MMX_LANE_OP(PSLLD,ud,2,(s>31) ? 0 : (Bit32u)(a.ud[i]<<s))
+MMX_LANE_OP(PSRLW,uw,4,(s>15) ? 0 : (Bit16u)(a.uw[i]>>s))
+MMX_LANE_OP(PSRLD,ud,2,(s>31) ? 0 : (Bit32u)(a.ud[i]>>s))
+MMX_LANE_OP(PSRAW,sw,4,(Bit16s)(a.sw[i]>>((s>15) ? 15 : s)))
+MMX_LANE_OP(PSRAD,sd,2,(Bit32s)(a.sd[i]>>((s>31) ? 31 : s)))
+
+static INLINE Bit64u MMX_PSLLQ(Bit64u d,Bit64u s) {
+	return (s>63) ? 0 : (d<<s);
+}
+
+static INLINE Bit64u MMX_PSRLQ(Bit64u d,Bit64u s) {
+	return (s>63) ? 0 : (d>>s);
+}
+
+/* Interleave the lanes of one half of the destination and the source */
+#define MMX_LANE_UNPACK(name,lane,count,index,half)							\
+	static INLINE Bit64u MMX_##name(Bit64u d,Bit64u s) {					\
+		MMX_Reg a,b,r;a.q=d;b.q=s;											\
+		for (Bitu i=0;i<count/2;i++) {										\
+			r.lane[index(2*i)]=a.lane[index(half+i)];						\
+			r.lane[index(2*i+1)]=b.lane[index(half+i)];						\
+		}																	\
+		return r.q;															\
+	}
+
+#define MMX_UNPACK(low,high,lane,count,index)								\
+	MMX_LANE_UNPACK(low,lane,count,index,0)									\
+	MMX_LANE_UNPACK(high,lane,count,index,count/2)
+
+/* The destination lanes narrow into the low half, the source lanes into the high half */
+#define MMX_PACK(name,in,in_index,out,out_index,count,sat)				\
+	static INLINE Bit64u MMX_##name(Bit64u d,Bit64u s) {					\
+		MMX_Reg a,b,r;a.q=d;b.q=s;											\
+		for (Bitu i=0;i<count;i++) {										\
+			r.out[out_index(i)]=sat(a.in[in_index(i)]);						\
+			r.out[out_index(i+count)]=sat(b.in[in_index(i)]);				\
+		}																	\
+		return r.q;															\
+	}
+
+#endif
+
+#if C_MMX_SSE2
+MMX_UNPACK(PUNPCKLBW,PUNPCKHBW,_mm_unpacklo_epi8)
+MMX_UNPACK(PUNPCKLWD,PUNPCKHWD,_mm_unpacklo_epi16)
+MMX_UNPACK(PUNPCKLDQ,PUNPCKHDQ,_mm_unpacklo_epi32)
+MMX_PACK(PACKSSWB,_mm_packs_epi16)
+MMX_PACK(PACKSSDW,_mm_packs_epi32)
+MMX_PACK(PACKUSWB,_mm_packus_epi16)
+#else
+MMX_UNPACK(PUNPCKLBW,PUNPCKHBW,ub,8,MMX_B)
+MMX_UNPACK(PUNPCKLWD,PUNPCKHWD,uw,4,MMX_W)
+MMX_UNPACK(PUNPCKLDQ,PUNPCKHDQ,ud,2,MMX_D)
+MMX_PACK(PACKSSWB,sw,MMX_W,sb,MMX_B,4,MMX_SatSB)
+MMX_PACK(PACKSSDW,sd,MMX_D,sw,MMX_W,2,MMX_SatSW)
+MMX_PACK(PACKUSWB,sw,MMX_W,ub,MMX_B,4,MMX_SatUB)
+#endif
+
+/* The 'op mm,mm/m64' instructions indexed by their opcode byte minus 0x60, movq
+   takes the register form of 0x7f with swapped operands */
+static MMX_Op const MMX_Ops[0xa0] = {
+	/* 0x60 */ MMX_PUNPCKLBW,MMX_PUNPCKLWD,MMX_PUNPCKLDQ,MMX_PACKSSWB,MMX_PCMPGTB,MMX_PCMPGTW,MMX_PCMPGTD,MMX_PACKUSWB,
+	/* 0x68 */ MMX_PUNPCKHBW,MMX_PUNPCKHWD,MMX_PUNPCKHDQ,MMX_PACKSSDW,0,0,0,MMX_MOVQ,
+	/* 0x70 */ 0,0,0,0,MMX_PCMPEQB,MMX_PCMPEQW,MMX_PCMPEQD,0,
+	/* 0x78 */ 0,0,0,0,0,0,0,MMX_MOVQ,
+	/* 0x80 */ 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	/* 0x90 */ 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	/* 0xa0 */ 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	/* 0xb0 */ 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	/* 0xc0 */ 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	/* 0xd0 */ 0,MMX_PSRLW,MMX_PSRLD,MMX_PSRLQ,0,MMX_PMULLW,0,0,
+	/* 0xd8 */ MMX_PSUBUSB,MMX_PSUBUSW,0,MMX_PAND,MMX_PADDUSB,MMX_PADDUSW,0,MMX_PANDN,
+	/* 0xe0 */ 0,MMX_PSRAW,MMX_PSRAD,0,0,MMX_PMULHW,0,0,
+	/* 0xe8 */ MMX_PSUBSB,MMX_PSUBSW,0,MMX_POR,MMX_PADDSB,MMX_PADDSW,0,MMX_PXOR,
+	/* 0xf0 */ 0,MMX_PSLLW,MMX_PSLLD,MMX_PSLLQ,0,MMX_PMADDWD,0,0,
+	/* 0xf8 */ MMX_PSUBB,MMX_PSUBW,MMX_PSUBD,0,MMX_PADDB,MMX_PADDW,MMX_PADDD,0
+};
+
+#endif
+
+#endif
@@ -30,6 +30,12 @@
 // disable this to reduce the size of the TLB
 // NOTE: does not work with the dynamic core (dynrec is fine)
 #define USE_FULL_TLB
+// split the full TLB into banks that are only allocated once a page
+// of their linear address range is linked, disable this (or define
+// PAGING_FLAT_TLB) for one flat table
+#if !defined(PAGING_FLAT_TLB)
+#define USE_BANKED_TLB
+#endif
 
 class PageDirectory;
 
@@ -38,7 +44,16 @@ class PageDirectory;
 
 #if defined(USE_FULL_TLB)
 #define TLB_SIZE		(1024*1024)
+#if defined(USE_BANKED_TLB)
+#define TLB_BANK_SHIFT	12			// 4096 pages (16 MB of linear memory) per bank
+#else
+#define TLB_BANK_SHIFT	20			// a single bank holding the whole TLB
+#endif
+#define TLB_BANK_SIZE	(1 << TLB_BANK_SHIFT)
+#define TLB_BANK_MASK	(TLB_BANK_SIZE-1)
+#define TLB_DIR_SIZE	(TLB_SIZE >> TLB_BANK_SHIFT)
 #else
+#undef USE_BANKED_TLB
 #define TLB_SIZE		65536	// This must a power of 2 and greater then LINK_START
 #define BANK_SHIFT		28
 #define BANK_MASK		0xffff // always the same as TLB_SIZE-1?
@@ -54,8 +69,8 @@ class PageDirectory;
 
 #define LINK_START	((1024+64)/4)			//Start right after the HMA
 
-//Allow 128 mb of memory to be linked
-#define PAGING_LINKS (128*1024/4)
+//Allow all of the 4 gb linear address space to be linked
+#define PAGING_LINKS (4096*1024/4)
 
 class PageHandler {
 public:
@@ -139,7 +154,15 @@ union X86PageEntry {
 	X86_PageEntryBlock block;
 };
 
-#if !defined(USE_FULL_TLB)
+#if defined(USE_FULL_TLB)
+typedef struct {
+	HostPt read[TLB_BANK_SIZE];
+	HostPt write[TLB_BANK_SIZE];
+	PageHandler * readhandler[TLB_BANK_SIZE];
+	PageHandler * writehandler[TLB_BANK_SIZE];
+	Bit32u	phys_page[TLB_BANK_SIZE];
+} tlb_bank;
+#else
 typedef struct {
 	HostPt read;
 	HostPt write;
@@ -156,14 +179,10 @@ struct PagingBlock {
 		Bitu page;
 		PhysPt addr;
 	} base;
-#if defined(USE_FULL_TLB)
-	struct {
-		HostPt read[TLB_SIZE];
-		HostPt write[TLB_SIZE];
-		PageHandler * readhandler[TLB_SIZE];
-		PageHandler * writehandler[TLB_SIZE];
-		Bit32u	phys_page[TLB_SIZE];
-	} tlb;
+#if defined(USE_BANKED_TLB)
+	tlb_bank * tlb_dir[TLB_DIR_SIZE];	// unallocated banks point to a shared bank of unlinked pages
+#elif defined(USE_FULL_TLB)
+	tlb_bank tlb;
 #else
 	tlb_entry tlbh[TLB_SIZE];
 	tlb_entry *tlbh_banks[TLB_BANKS];
@@ -196,26 +215,36 @@ bool mem_unalignedwrited_checked(PhysPt address,Bit32u val);
 
 #if defined(USE_FULL_TLB)
 
+#if defined(USE_BANKED_TLB)
+static INLINE tlb_bank *get_tlb_bank(PhysPt address) {
+	return paging.tlb_dir[address>>(12+TLB_BANK_SHIFT)];
+}
+#else
+static INLINE tlb_bank *get_tlb_bank(PhysPt /*address*/) {
+	return &paging.tlb;
+}
+#endif
+
 static INLINE HostPt get_tlb_read(PhysPt address) {
-	return paging.tlb.read[address>>12];
+	return get_tlb_bank(address)->read[(address>>12)&TLB_BANK_MASK];
 }
 static INLINE HostPt get_tlb_write(PhysPt address) {
-	return paging.tlb.write[address>>12];
+	return get_tlb_bank(address)->write[(address>>12)&TLB_BANK_MASK];
 }
 static INLINE PageHandler* get_tlb_readhandler(PhysPt address) {
-	return paging.tlb.readhandler[address>>12];
+	return get_tlb_bank(address)->readhandler[(address>>12)&TLB_BANK_MASK];
 }
 static INLINE PageHandler* get_tlb_writehandler(PhysPt address) {
-	return paging.tlb.writehandler[address>>12];
+	return get_tlb_bank(address)->writehandler[(address>>12)&TLB_BANK_MASK];
 }
 
 /* Use these helper functions to access linear addresses in readX/writeX functions */
 static INLINE PhysPt PAGING_GetPhysicalPage(PhysPt linePage) {
-	return (paging.tlb.phys_page[linePage>>12]<<12);
+	return (get_tlb_bank(linePage)->phys_page[(linePage>>12)&TLB_BANK_MASK]<<12);
 }
 
 static INLINE PhysPt PAGING_GetPhysicalAddress(PhysPt linAddr) {
-	return (paging.tlb.phys_page[linAddr>>12]<<12)|(linAddr&0xfff);
+	return (get_tlb_bank(linAddr)->phys_page[(linAddr>>12)&TLB_BANK_MASK]<<12)|(linAddr&0xfff);
 }
 
 #else
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOSBOX_PERF_STATS_H
+#define DOSBOX_PERF_STATS_H
+
+#ifndef DOSBOX_DOSBOX_H
+#include "dosbox.h"
+#endif
+
+/* Timers and counters for the performance window, compiled out of release builds */
+#ifndef C_PERF_STATS
+#ifdef NDEBUG
+#define C_PERF_STATS 0
+#else
+#define C_PERF_STATS 1
+#endif
+#endif
+
+enum PerfTimer {
+	PERF_TIMER_OTHER,			// Everything outside of a scope (main loop, callbacks...)
+	PERF_TIMER_CPU,
+	PERF_TIMER_PIC,
+	PERF_TIMER_VGA,
+	PERF_TIMER_MIXER,
+	PERF_TIMER_GUI,
+	PERF_TIMER_IDLE,
+	PERF_TIMER_MIXER_CALLBACK,	// Audio thread, overlaps with the others
+	PERF_TIMER_MAX
+};
+
+enum PerfCounter {
+	PERF_COUNTER_TICKS,			// Emulated milliseconds
+	PERF_COUNTER_CYCLES,		// Emulated cycles
+	PERF_COUNTER_CACHE_HIT,
+	PERF_COUNTER_CACHE_MISS,
+	PERF_COUNTER_CACHE_FLUSH,	// The code cache wrapped around
+	PERF_COUNTER_CACHE_EVICT,	// Cold blocks overwritten by new code
+	PERF_COUNTER_CACHE_KEPT,	// Blocks that ran since the last wrap and were skipped
+	PERF_COUNTER_CACHE_TRACE,	// Hot blocks translated again as traces
+	PERF_COUNTER_TARGET_HIT,	// Indirect branches that continued in the code cache
+	PERF_COUNTER_TARGET_MISS,	// Indirect branches that returned to the core
+	PERF_COUNTER_TLB_FILL,		// Pages linked through the page tables while paging
+	PERF_COUNTER_TLB_RESTORE,	// Pages relinked from a saved page directory on a CR3 switch
+	PERF_COUNTER_XMS_MOVED,		// Bytes copied by XMS move requests
+	PERF_COUNTER_EMS_MOVED,		// Bytes copied or exchanged by EMS move requests
+	PERF_COUNTER_EMS_MAPPED,	// EMS pages mapped into the page frame or a segment
+	PERF_COUNTER_MAX
+};
+
+struct PerfStats_t {
+	PerfTimer active;
+	Bit64u last;
+	Bit64u timers[PERF_TIMER_MAX];		// In host performance counter units
+	Bit64u counters[PERF_COUNTER_MAX];
+};
+
+#if C_PERF_STATS
+#include "SDL.h"
+
+extern PerfStats_t perf_stats;
+
+/* Copy the stats gathered since the last call and start a new frame */
+void PERF_TakeSnapshot(PerfStats_t & snapshot);
+
+static INLINE Bit64u PERF_GetTime(void) {
+	return SDL_GetPerformanceCounter();
+}
+
+/* Scopes are exclusive: time spent in a nested scope is not charged to its parent */
+static INLINE void PERF_SwitchTimer(PerfTimer timer) {
+	Bit64u now = PERF_GetTime();
+	perf_stats.timers[perf_stats.active] += now - perf_stats.last;
+	perf_stats.last = now;
+	perf_stats.active = timer;
+}
+
+class PerfScope {
+public:
+	PerfScope(PerfTimer timer) : parent(perf_stats.active) { PERF_SwitchTimer(timer); }
+	~PerfScope() { PERF_SwitchTimer(parent); }
+private:
+	PerfTimer parent;
+};
+
+/* For code running outside of the emulation thread */
+class PerfAsyncScope {
+public:
+	PerfAsyncScope(PerfTimer _timer) : timer(_timer), start(PERF_GetTime()) {}
+	~PerfAsyncScope() { perf_stats.timers[timer] += PERF_GetTime() - start; }
+private:
+	PerfTimer timer;
+	Bit64u start;
+};
+
+#define PERF_SCOPE(timer) PerfScope perf_scope(timer)
+#define PERF_ASYNC_SCOPE(timer) PerfAsyncScope perf_async_scope(timer)
+#define PERF_COUNT(counter,amount) perf_stats.counters[counter] += (amount)
+
+#else
+
+#define PERF_SCOPE(timer)
+#define PERF_ASYNC_SCOPE(timer)
+#define PERF_COUNT(counter,amount)
+
+#endif
+
+#endif
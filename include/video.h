@@ -53,6 +53,7 @@ struct GFX_PalEntry {
 #define GFX_HARDWARE	0x2000
 
 #define GFX_CAN_RANDOM	0x4000		//If the interface can also do random access surface
+#define GFX_SHADER		0x8000		//If the interface scales the native frame itself with shaders
 
 void ProcessEvents(void);
 void Debug_UpdateAndDraw(bool forceUpdate = false);
@@ -31,6 +31,9 @@
 */
 
 CallBack_Handler CallBack_Handlers[CB_MAX];
+CallBack_LeafHandler CallBack_Leaves[CB_MAX];
+Bit64u CallBack_Calls[CB_MAX];
+Bit64u CallBack_LeafCalls[CB_MAX];
 char* CallBack_Description[CB_MAX];
 
 static Bitu call_stop,call_idle,call_default;
@@ -54,6 +57,12 @@ Bitu CALLBACK_Allocate(void) {
 
 void CALLBACK_DeAllocate(Bitu in) {
 	CallBack_Handlers[in]=&illegal_handler;
+	CallBack_Leaves[in]=0;
+}
+
+void CALLBACK_SetLeaf(Bitu callback,CallBack_LeafHandler leaf) {
+	if (callback>=CB_MAX) return;
+	CallBack_Leaves[callback]=leaf;
 }
 
 
@@ -510,6 +519,7 @@ bool CALLBACK_Setup(Bitu callback,CallBack_Handler handler,Bitu type,const char*
 	if (callback>=CB_MAX) return false;
 	CALLBACK_SetupExtra(callback,type,CALLBACK_PhysPointer(callback)+0,(handler!=NULL));
 	CallBack_Handlers[callback]=handler;
+	CallBack_Leaves[callback]=0;
 	CALLBACK_SetDescription(callback,descr);
 	return true;
 }
@@ -519,6 +529,7 @@ Bitu CALLBACK_Setup(Bitu callback,CallBack_Handler handler,Bitu type,PhysPt addr
 	Bitu csize=CALLBACK_SetupExtra(callback,type,addr,(handler!=NULL));
 	if (csize>0) {
 		CallBack_Handlers[callback]=handler;
+		CallBack_Leaves[callback]=0;
 		CALLBACK_SetDescription(callback,descr);
 	}
 	return csize;
@@ -580,6 +591,7 @@ void CALLBACK_HandlerObject::Allocate(CallBack_Handler handler,const char* descr
 		m_callback=CALLBACK_Allocate();
 		CALLBACK_SetDescription(m_callback,description);
 		CallBack_Handlers[m_callback]=handler;
+		CallBack_Leaves[m_callback]=0;
 	} else E_Exit("Callback handler object already installed");
 }
 
@@ -595,6 +607,9 @@ void CALLBACK_Init(Section* /*sec*/) {
 	Bitu i;
 	for (i=0;i<CB_MAX;i++) {
 		CallBack_Handlers[i]=&illegal_handler;
+		CallBack_Leaves[i]=0;
+		CallBack_Calls[i]=0;
+		CallBack_LeafCalls[i]=0;
 	}
 
 	/* Setup the Stop Handler */
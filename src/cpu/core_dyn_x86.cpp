@@ -50,6 +50,8 @@
 #include "paging.h"
 #include "inout.h"
 #include "fpu.h"
+#include "mmx.h"
+#include "perf_stats.h"
 
 #define CACHE_MAXSIZE	(4096*3)
 #define CACHE_TOTAL		(1024*1024*8)
@@ -175,6 +177,7 @@ static struct {
 	Bit32u		state_used;
 	Bit32u		cw,host_cw;
 	Bit8u		temp_state[128];
+	Bit32u		drop_blocks;	// The translated code still runs the fpu on the host
 } dyn_dh_fpu;
 
 
@@ -256,10 +259,27 @@ static void dyn_restoreregister(DynReg * src_reg, DynReg * dst_reg) {
 }
 #endif
 
+#if C_FPU
+/* MMX instructions go to the normal core, which works on the emulated fpu.
+   Hand the host fpu state over to it for good and retranslate without dh_fpu */
+static void dyn_dh_fpu_mmx(void) {
+	if (cpudecoder!=&CPU_Core_Dyn_X86_Run && cpudecoder!=&CPU_Core_Dyn_X86_Trap_Run) return;
+	if (dyn_dh_fpu.state_used) DH_FPU_SAVE_REINIT
+	FPU_LoadHostImage((HostPt)dyn_dh_fpu.state,dyn_dh_fpu.cw);
+	dyn_dh_fpu.dh_fpu_enabled=false;
+	dyn_dh_fpu.drop_blocks=true;
+	mmx.sync=0;
+}
+#endif
+
 
 Bits CPU_Core_Dyn_X86_Run(void) {
 	/* Determine the linear address of CS:EIP */
 restart_core:
+	if (GCC_UNLIKELY(dyn_dh_fpu.drop_blocks)) {
+		dyn_dh_fpu.drop_blocks=false;
+		cache_reset();
+	}
 	PhysPt ip_point=SegPhys(cs)+reg_eip;
 #if C_DEBUG
 #if C_HEAVY_DEBUG
@@ -278,6 +298,7 @@ restart_core:
 	/* Find correct Dynamic Block to run */
 	CacheBlock * block=chandler->FindCacheBlock(ip_point&4095);
 	if (!block) {
+		PERF_COUNT(PERF_COUNTER_CACHE_MISS,1);
 		if (!chandler->invalidation_map || (chandler->invalidation_map[ip_point&4095]<4)) {
 			block=CreateCacheBlock(chandler,ip_point,32);
 		} else {
@@ -292,7 +313,7 @@ restart_core:
 			CPU_CycleLeft+=old_cycles;
 			return nc_retcode; 
 		}
-	}
+	} else PERF_COUNT(PERF_COUNTER_CACHE_HIT,1);
 run_block:
 	cache.block.running=0;
 	BlockReturn ret=gen_runcode(block->cache.start);
@@ -453,6 +474,10 @@ void CPU_Core_Dyn_X86_Init(void) {
 	dyn_dh_fpu.dh_fpu_enabled=true;
 	dyn_dh_fpu.state_used=false;
 	dyn_dh_fpu.cw=0x37f;
+	dyn_dh_fpu.drop_blocks=false;
+#if C_FPU
+	mmx.sync=&dyn_dh_fpu_mmx;
+#endif
 #if defined (_MSC_VER)
 	__asm {
 	__asm	finit
@@ -488,6 +513,9 @@ void CPU_Core_Dyn_X86_Cache_Reset(void) {
 
 void CPU_Core_Dyn_X86_SetFPUMode(bool dh_fpu) {
 	dyn_dh_fpu.dh_fpu_enabled=dh_fpu;
+#if C_FPU
+	mmx.sync=dh_fpu ? &dyn_dh_fpu_mmx : 0;
+#endif
 }
 
 Bit32u fpu_state[32];
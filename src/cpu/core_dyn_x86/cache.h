@@ -446,6 +446,7 @@ static void cache_closeblock(void) {
 	/* Advance the active block pointer */
 	if (!block->cache.next) {
 //		LOG_MSG("Cache full restarting");
+		PERF_COUNT(PERF_COUNTER_CACHE_FLUSH,1);
 		cache.block.active=cache.block.first;
 	} else {
 		cache.block.active=block->cache.next;
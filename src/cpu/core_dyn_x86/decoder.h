@@ -495,6 +495,49 @@ static void dyn_read_intro(DynReg * addr,bool release_addr=true) {
 	cache_addw(0xc18b);		// mov eax,ecx
 }
 
+// eax=paging.tlb.read[eax], eax holds the linear page, clobbers edx
+static void dyn_read_tlb(void) {
+#if defined(USE_BANKED_TLB)
+	cache_addw(0xd08b);		// mov edx,eax
+	cache_addw(0xe8c1);		// shr eax,TLB_BANK_SHIFT
+	cache_addb(TLB_BANK_SHIFT);
+	cache_addw(0xe281);		// and edx,TLB_BANK_MASK
+	cache_addd(TLB_BANK_MASK);
+	cache_addw(0x048b);		// mov eax,paging.tlb_dir[eax*TYPE Bit32u]
+	cache_addb(0x85);
+	cache_addd((Bit32u)(&paging.tlb_dir[0]));
+	cache_addw(0x048b);		// mov eax,[eax+edx*TYPE Bit32u] (tlb_bank.read)
+	cache_addb(0x90);
+#else
+	cache_addw(0x048b);		// mov eax,paging.tlb.read[eax*TYPE Bit32u]
+	cache_addb(0x85);
+	cache_addd((Bit32u)(&paging.tlb.read[0]));
+#endif
+}
+
+// ecx=paging.tlb.write[ecx], ecx holds the linear page
+static void dyn_write_tlb(void) {
+#if defined(USE_BANKED_TLB)
+	cache_addb(0x52);		// push edx
+	cache_addw(0xd18b);		// mov edx,ecx
+	cache_addw(0xe9c1);		// shr ecx,TLB_BANK_SHIFT
+	cache_addb(TLB_BANK_SHIFT);
+	cache_addw(0xe281);		// and edx,TLB_BANK_MASK
+	cache_addd(TLB_BANK_MASK);
+	cache_addw(0x0c8b);		// mov ecx,paging.tlb_dir[ecx*TYPE Bit32u]
+	cache_addb(0x8d);
+	cache_addd((Bit32u)(&paging.tlb_dir[0]));
+	cache_addw(0x8c8b);		// mov ecx,[ecx+edx*TYPE Bit32u+offsetof(tlb_bank,write)]
+	cache_addb(0x91);
+	cache_addd((Bit32u)offsetof(tlb_bank,write));
+	cache_addb(0x5a);		// pop edx
+#else
+	cache_addw(0x0c8b);		// mov ecx,paging.tlb.write[ecx*TYPE Bit32u]
+	cache_addb(0x8d);
+	cache_addd((Bit32u)(&paging.tlb.write[0]));
+#endif
+}
+
 bool mem_readb_checked_dcx86(PhysPt address) {
 	return get_tlb_readhandler(address)->readb_checked(address, (Bit8u*)(&core_dyn.readdata));
 }
@@ -504,9 +547,7 @@ static void dyn_read_byte(DynReg * addr,DynReg * dst,Bitu high) {
 
 	cache_addw(0xe8c1);		// shr eax,0x0c
 	cache_addb(0x0c);
-	cache_addw(0x048b);		// mov eax,paging.tlb.read[eax*TYPE Bit32u]
-	cache_addb(0x85);
-	cache_addd((Bit32u)(&paging.tlb.read[0]));
+	dyn_read_tlb();			// mov eax,paging.tlb.read[eax*TYPE Bit32u]
 	cache_addw(0xc085);		// test eax,eax
 	Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -542,9 +583,7 @@ static void dyn_read_byte_release(DynReg * addr,DynReg * dst,Bitu high) {
 
 	cache_addw(0xe8c1);		// shr eax,0x0c
 	cache_addb(0x0c);
-	cache_addw(0x048b);		// mov eax,paging.tlb.read[eax*TYPE Bit32u]
-	cache_addb(0x85);
-	cache_addd((Bit32u)(&paging.tlb.read[0]));
+	dyn_read_tlb();			// mov eax,paging.tlb.read[eax*TYPE Bit32u]
 	cache_addw(0xc085);		// test eax,eax
 	Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -597,9 +636,7 @@ static void dyn_read_word(DynReg * addr,DynReg * dst,bool dword) {
 		Bit8u* jb_loc2=gen_create_branch(BR_B);
 		cache_addw(0xe8c1);		// shr eax,0x0a
 		cache_addb(0x0a);
-		cache_addw(0x048b);		// mov eax,paging.tlb.read[eax*TYPE Bit32u]
-		cache_addb(0x85);
-		cache_addd((Bit32u)(&paging.tlb.read[0]));
+		dyn_read_tlb();			// mov eax,paging.tlb.read[eax*TYPE Bit32u]
 		cache_addw(0xc085);		// test eax,eax
 		Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -643,9 +680,7 @@ static void dyn_read_word_release(DynReg * addr,DynReg * dst,bool dword) {
 		Bit8u* jb_loc2=gen_create_branch(BR_B);
 		cache_addw(0xe8c1);		// shr eax,0x0a
 		cache_addb(0x0a);
-		cache_addw(0x048b);		// mov eax,paging.tlb.read[eax*TYPE Bit32u]
-		cache_addb(0x85);
-		cache_addd((Bit32u)(&paging.tlb.read[0]));
+		dyn_read_tlb();			// mov eax,paging.tlb.read[eax*TYPE Bit32u]
 		cache_addw(0xc085);		// test eax,eax
 		Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -716,9 +751,7 @@ static void dyn_write_byte(DynReg * addr,DynReg * val,bool high) {
 	GenReg * genreg=FindDynReg(val);
 	cache_addw(0xe9c1);		// shr ecx,0x0c
 	cache_addb(0x0c);
-	cache_addw(0x0c8b);		// mov ecx,paging.tlb.read[ecx*TYPE Bit32u]
-	cache_addb(0x8d);
-	cache_addd((Bit32u)(&paging.tlb.write[0]));
+	dyn_write_tlb();		// mov ecx,paging.tlb.write[ecx*TYPE Bit32u]
 	cache_addw(0xc985);		// test ecx,ecx
 	Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -755,9 +788,7 @@ static void dyn_write_byte_release(DynReg * addr,DynReg * val,bool high) {
 	GenReg * genreg=FindDynReg(val);
 	cache_addw(0xe9c1);		// shr ecx,0x0c
 	cache_addb(0x0c);
-	cache_addw(0x0c8b);		// mov ecx,paging.tlb.read[ecx*TYPE Bit32u]
-	cache_addb(0x8d);
-	cache_addd((Bit32u)(&paging.tlb.write[0]));
+	dyn_write_tlb();		// mov ecx,paging.tlb.write[ecx*TYPE Bit32u]
 	cache_addw(0xc985);		// test ecx,ecx
 	Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -799,9 +830,7 @@ static void dyn_write_word(DynReg * addr,DynReg * val,bool dword) {
 		Bit8u* jb_loc2=gen_create_branch(BR_B);
 		cache_addw(0xe9c1);		// shr ecx,0x0a
 		cache_addb(0x0a);
-		cache_addw(0x0c8b);		// mov ecx,paging.tlb.read[ecx*TYPE Bit32u]
-		cache_addb(0x8d);
-		cache_addd((Bit32u)(&paging.tlb.write[0]));
+		dyn_write_tlb();		// mov ecx,paging.tlb.write[ecx*TYPE Bit32u]
 		cache_addw(0xc985);		// test ecx,ecx
 		Bit8u* je_loc=gen_create_branch(BR_Z);
 
@@ -848,9 +877,7 @@ static void dyn_write_word_release(DynReg * addr,DynReg * val,bool dword) {
 		Bit8u* jb_loc2=gen_create_branch(BR_B);
 		cache_addw(0xe9c1);		// shr ecx,0x0a
 		cache_addb(0x0a);
-		cache_addw(0x0c8b);		// mov ecx,paging.tlb.read[ecx*TYPE Bit32u]
-		cache_addb(0x8d);
-		cache_addd((Bit32u)(&paging.tlb.write[0]));
+		dyn_write_tlb();		// mov ecx,paging.tlb.write[ecx*TYPE Bit32u]
 		cache_addw(0xc985);		// test ecx,ecx
 		Bit8u* je_loc=gen_create_branch(BR_Z);
 
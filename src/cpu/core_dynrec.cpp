@@ -51,6 +51,7 @@
 #include "inout.h"
 #include "lazyflags.h"
 #include "pic.h"
+#include "perf_stats.h"
 
 #define CACHE_MAXSIZE	(4096*2)
 #define CACHE_TOTAL		(1024*1024*8)
@@ -60,6 +61,8 @@
 #define DYN_HASH_SHIFT	(4)
 #define DYN_PAGE_HASH	(4096>>DYN_HASH_SHIFT)
 #define DYN_LINKS		(16)
+#define DYN_TRACE_RUNS	(1000)		// runs after which a block is retranslated as a trace
+#define DYN_TRACE_OPCODES	(48)
 
 
 //#define DYN_LOG 1 //Turn Logging on.
@@ -109,6 +112,9 @@ enum BlockReturn {
 	BR_Opcode,
 #if (C_DEBUG)
 	BR_OpcodeFull,
+#endif
+#if (C_HEAVY_DEBUG)
+	BR_Breakpoint,
 #endif
 	BR_Iret,
 	BR_CallBack,
@@ -160,6 +166,10 @@ CacheBlockDynRec * LinkBlocks(BlockReturn ret) {
 	Bitu temp_ip=SegPhys(cs)+reg_eip;
 	CodePageHandlerDynRec * temp_handler=(CodePageHandlerDynRec *)get_tlb_readhandler(temp_ip);
 	if (temp_handler->flags & PFLAG_HASCODE) {
+#if C_HEAVY_DEBUG
+		// don't link into a breakpoint, the core checks it before running the block
+		if (CBreakpoint::HasActiveBreakpoint(temp_ip)) return NULL;
+#endif
 		// see if the target is an already translated block
 		block=temp_handler->FindCacheBlock(temp_ip & 4095);
 		if (!block) return NULL;
@@ -205,11 +215,12 @@ Bits CPU_Core_Dynrec_Run(void) {
 		// find correct Dynamic Block to run
 		CacheBlockDynRec * block=chandler->FindCacheBlock(ip_point&4095);
 		if (!block) {
+			PERF_COUNT(PERF_COUNTER_CACHE_MISS,1);
 			// no block found, thus translate the instruction stream
 			// unless the instruction is known to be modified
 			if (!chandler->invalidation_map || (chandler->invalidation_map[ip_point&4095]<4)) {
 				// translate up to 32 instructions
-				block=CreateCacheBlock(chandler,ip_point,32);
+				block=CreateCacheBlock(chandler,ip_point,32,false);
 			} else {
 				// let the normal core handle this instruction to avoid zero-sized blocks
 				Bitu old_cycles=CPU_Cycles;
@@ -222,6 +233,20 @@ Bits CPU_Core_Dynrec_Run(void) {
 				CPU_CycleLeft+=old_cycles;
 				return nc_retcode;
 			}
+		} else {
+			PERF_COUNT(PERF_COUNTER_CACHE_HIT,1);
+			// a block that ran often is translated again, this time continuing
+			// after conditional branches whose fall-through path ran before
+			if (GCC_UNLIKELY(block->trace_runs<=0) && !block->trace) {
+				if (chandler->invalidation_map) {
+					// the page modifies its own code, keep the normal block
+					block->trace_runs=DYN_TRACE_RUNS;
+				} else {
+					PERF_COUNT(PERF_COUNTER_CACHE_TRACE,1);
+					block->Clear();
+					block=CreateCacheBlock(chandler,ip_point,DYN_TRACE_OPCODES,true);
+				}
+			}
 		}
 
 run_block:
@@ -291,6 +316,12 @@ run_block:
 			return CPU_Core_Full_Run();
 #endif
 
+#if (C_HEAVY_DEBUG)
+		case BR_Breakpoint:
+			// stopped at a breakpoint inside of the block
+			return debugCallback;
+#endif
+
 		case BR_Link1:
 		case BR_Link2:
 			block=LinkBlocks(ret);
@@ -331,8 +362,62 @@ void CPU_Core_Dynrec_Cache_Init(bool enable_cache) {
 	cache_init(enable_cache);
 }
 
+void CPU_Core_Dynrec_Cache_SetSize(Bitu megabytes) {
+	// only used before the cache memory is allocated
+	if (cache_code_start_ptr!=NULL) return;
+#if defined(DRC_CACHE_MAX_MB)
+	if (megabytes>DRC_CACHE_MAX_MB) {
+		LOG_MSG("DYNREC: Code cache limited to %d MB, the reach of direct block links",DRC_CACHE_MAX_MB);
+		megabytes=DRC_CACHE_MAX_MB;
+	}
+#endif
+	cache_total=megabytes*1024*1024;
+	// keep the same number of blocks per megabyte
+	cache_block_count=(cache_total/CACHE_TOTAL)*CACHE_BLOCKS;
+	if (cache_block_count<CACHE_BLOCKS) cache_block_count=CACHE_BLOCKS;
+}
+
 void CPU_Core_Dynrec_Cache_Close(void) {
 	cache_close();
 }
 
+#if C_HEAVY_DEBUG
+// a breakpoint was set or removed, retranslate only the blocks containing it
+void CPU_Core_Dynrec_InvalidateBreakpoint(PhysPt address) {
+	if (!cache_initialized) return;
+	Bitu page=address>>12;
+	if (!PAGING_MakePhysPage(page)) return;
+	PageHandler * handler=MEM_GetPageHandler(page);
+	if (handler->flags & PFLAG_HASCODE) {
+		((CodePageHandlerDynRec *)handler)->InvalidateRange(address&4095,address&4095);
+	}
+}
+#endif
+
+#if C_DEBUG
+// the debugger is about to change the memory of a physical page behind the
+// back of the page handlers, throw away all the code translated from it
+void CPU_Core_Dynrec_ReleasePage(Bitu phys_page) {
+	if (!cache_initialized) return;
+	PageHandler * handler=MEM_GetPageHandler(phys_page);
+	if (handler->flags & PFLAG_HASCODE) {
+		((CodePageHandlerDynRec *)handler)->ClearRelease();
+	}
+}
+#endif
+
+#if C_DEBUG
+// for the benchmark of the tests: keep the guest registers in host registers
+// (DRC_USE_REGS_CACHE) in the blocks translated from now on or access them in
+// cpu_regs, returns the accesses to guest registers in memory generated so far
+Bitu CPU_Core_Dynrec_RegsCache(bool enable) {
+#ifdef DRC_USE_REGS_CACHE
+	regs_cache.disabled=!enable;
+	return regs_cache.memory;
+#else
+	return 0;
+#endif
+}
+#endif
+
 #endif
@@ -18,6 +18,7 @@
 
 
 class CodePageHandlerDynRec;	// forward
+static void cache_link_branch(Bit8u * branch,Bit8u * target);	// forward
 
 // basic cache block representation
 class CacheBlockDynRec {
@@ -30,6 +31,7 @@ public:
 		link[index].to=toblock;
 		link[index].next=toblock->link[index].from;	// set target block
 		toblock->link[index].from=this;				// remember who links me
+		cache_link_branch(link[index].branch,toblock->cache.start);
 	}
 	struct {
 		Bit16u start,end;		// where in the page is the original code
@@ -53,8 +55,12 @@ public:
 		CacheBlockDynRec * to;		// this block can transfer control to the to-block
 		CacheBlockDynRec * next;
 		CacheBlockDynRec * from;	// the from-block can transfer control to this block
+		Bit8u * branch;				// direct jump to the to-block in the code (if any)
 	} link[2];	// maximum two links (conditional jumps)
 	CacheBlockDynRec * crossblock;
+	Bit32u usage;		// incremented by the block code on each run, cleared when the cache wraps past it
+	bool trace;			// translated as a trace that continues after conditional branches
+	Bit32s trace_runs;	// counted down by the block code on each run, the block becomes a trace at 0
 };
 
 static struct {
@@ -63,6 +69,7 @@ static struct {
 		CacheBlockDynRec * active;		// the current cache block
 		CacheBlockDynRec * free;		// pointer to the free list
 		CacheBlockDynRec * running;		// the last block that was entered for execution
+		CacheBlockDynRec * target;		// where the last indirect branch continues
 	} block;
 	Bit8u * pos;		// position in the cache block
 	CodePageHandlerDynRec * free_pages;		// pointer to the free list
@@ -78,6 +85,19 @@ static Bit8u * cache_code_link_blocks=NULL;
 
 static CacheBlockDynRec * cache_blocks=NULL;
 static CacheBlockDynRec link_blocks[2];		// default linking (specially marked)
+static CacheBlockDynRec core_block;			// returns to the core, used by indirect branches
+
+// direct mapped cache of indirect branch targets (linear address -> block),
+// entries are validated against the page handler when they are used
+#define TARGET_CACHE_SIZE 1024
+static struct {
+	PhysPt ip;
+	CacheBlockDynRec * block;
+} cache_targets[TARGET_CACHE_SIZE];
+
+// size of the code cache and number of cache blocks, fixed once the cache is allocated
+static Bitu cache_total=CACHE_TOTAL;
+static Bitu cache_block_count=CACHE_BLOCKS;
 
 
 // the CodePageHandlerDynRec class provides access to the contained
@@ -423,6 +443,7 @@ void CacheBlockDynRec::Clear(void) {
 			// clear the next-link and let the block point to the standard linkcode
 			fromlink->link[ind].next=0;
 			fromlink->link[ind].to=&link_blocks[ind];
+			cache_link_branch(fromlink->link[ind].branch,0);
 
 			fromlink=nextlink;
 		}
@@ -459,13 +480,48 @@ void CacheBlockDynRec::Clear(void) {
 }
 
 
+// the block that follows when filling the cache, wraps around at the end
+static CacheBlockDynRec * cache_nextblock(CacheBlockDynRec * block) {
+	if (!block->cache.next || (block->cache.next->cache.start>(cache_code_start_ptr + cache_total - CACHE_MAXSIZE))) {
+//		LOG_MSG("Cache full restarting");
+		PERF_COUNT(PERF_COUNTER_CACHE_FLUSH,1);
+		return cache.block.first;
+	}
+	return block->cache.next;
+}
+
+// find the cache block that would be overwritten first by a new block
+// starting at block, or NULL if all of them are unused or cold
+static CacheBlockDynRec * cache_findhotblock(CacheBlockDynRec * block) {
+	Bitu size=0;
+	while (block) {
+		if (block->page.handler && block->usage) return block;
+		size+=block->cache.size;
+		if (size>=CACHE_MAXSIZE) break;
+		block=block->cache.next;
+	}
+	return NULL;
+}
+
 static CacheBlockDynRec * cache_openblock(void) {
+	// blocks that ran since the last time the cache went past them get
+	// a second chance, only cold ones are overwritten. This terminates
+	// as every skipped block has its usage cleared.
+	CacheBlockDynRec * hotblock;
+	while ((hotblock=cache_findhotblock(cache.block.active))!=NULL) {
+		hotblock->usage=0;
+		PERF_COUNT(PERF_COUNTER_CACHE_KEPT,1);
+		cache.block.active=cache_nextblock(hotblock);
+	}
+
 	CacheBlockDynRec * block=cache.block.active;
 	// check for enough space in this block
 	Bitu size=block->cache.size;
 	CacheBlockDynRec * nextblock=block->cache.next;
-	if (block->page.handler) 
+	if (block->page.handler) {
+		PERF_COUNT(PERF_COUNTER_CACHE_EVICT,1);
 		block->Clear();
+	}
 	// block size must be at least CACHE_MAXSIZE
 	while (size<CACHE_MAXSIZE) {
 		if (!nextblock)
@@ -473,8 +529,10 @@ static CacheBlockDynRec * cache_openblock(void) {
 		// merge blocks
 		size+=nextblock->cache.size;
 		CacheBlockDynRec * tempblock=nextblock->cache.next;
-		if (nextblock->page.handler) 
+		if (nextblock->page.handler) {
+			PERF_COUNT(PERF_COUNTER_CACHE_EVICT,1);
 			nextblock->Clear();
+		}
 		// block is free now
 		cache_addunusedblock(nextblock);
 		nextblock=tempblock;
@@ -483,6 +541,9 @@ skipresize:
 	// adjust parameters and open this block
 	block->cache.size=size;
 	block->cache.next=nextblock;
+	block->usage=0;
+	block->link[0].branch=0;
+	block->link[1].branch=0;
 	cache.pos=block->cache.start;
 	return block;
 }
@@ -518,12 +579,7 @@ static void cache_closeblock(void) {
 		}
 	}
 	// advance the active block pointer
-	if (!block->cache.next || (block->cache.next->cache.start>(cache_code_start_ptr + CACHE_TOTAL - CACHE_MAXSIZE))) {
-//		LOG_MSG("Cache full restarting");
-		cache.block.active=cache.block.first;
-	} else {
-		cache.block.active=block->cache.next;
-	}
+	cache.block.active=cache_nextblock(block);
 }
 
 
@@ -572,12 +628,12 @@ static void cache_init(bool enable) {
 		cache_initialized = true;
 		if (cache_blocks == NULL) {
 			// allocate the cache blocks memory
-			cache_blocks=(CacheBlockDynRec*)malloc(CACHE_BLOCKS*sizeof(CacheBlockDynRec));
+			cache_blocks=(CacheBlockDynRec*)malloc(cache_block_count*sizeof(CacheBlockDynRec));
 			if(!cache_blocks) E_Exit("Allocating cache_blocks has failed");
-			memset(cache_blocks,0,sizeof(CacheBlockDynRec)*CACHE_BLOCKS);
+			memset(cache_blocks,0,sizeof(CacheBlockDynRec)*cache_block_count);
 			cache.block.free=&cache_blocks[0];
 			// initialize the cache blocks
-			for (i=0;i<CACHE_BLOCKS-1;i++) {
+			for (i=0;i<(Bits)cache_block_count-1;i++) {
 				cache_blocks[i].link[0].to=(CacheBlockDynRec *)1;
 				cache_blocks[i].link[1].to=(CacheBlockDynRec *)1;
 				cache_blocks[i].cache.next=&cache_blocks[i+1];
@@ -586,12 +642,12 @@ static void cache_init(bool enable) {
 		if (cache_code_start_ptr==NULL) {
 			// allocate the code cache memory
 #if defined (WIN32)
-			cache_code_start_ptr=(Bit8u*)VirtualAlloc(0,CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP,
+			cache_code_start_ptr=(Bit8u*)VirtualAlloc(0,cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP,
 				MEM_COMMIT,PAGE_EXECUTE_READWRITE);
 			if (!cache_code_start_ptr)
-				cache_code_start_ptr=(Bit8u*)malloc(CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+				cache_code_start_ptr=(Bit8u*)malloc(cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #else
-			cache_code_start_ptr=(Bit8u*)malloc(CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+			cache_code_start_ptr=(Bit8u*)malloc(cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #endif
 			if(!cache_code_start_ptr) E_Exit("Allocating dynamic cache failed");
 
@@ -602,14 +658,14 @@ static void cache_init(bool enable) {
 			cache_code=cache_code+PAGESIZE_TEMP;
 
 #if (C_HAVE_MPROTECT)
-			if(mprotect(cache_code_link_blocks,CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP,PROT_WRITE|PROT_READ|PROT_EXEC))
+			if(mprotect(cache_code_link_blocks,cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP,PROT_WRITE|PROT_READ|PROT_EXEC))
 				LOG_MSG("Setting execute permission on the code cache has failed");
 #endif
 			CacheBlockDynRec * block=cache_getblock();
 			cache.block.first=block;
 			cache.block.active=block;
 			block->cache.start=&cache_code[0];
-			block->cache.size=CACHE_TOTAL;
+			block->cache.size=cache_total;
 			block->cache.next=0;						// last block in the list
 		}
 		// setup the default blocks for block linkage returns
@@ -627,6 +683,12 @@ static void cache_init(bool enable) {
 //		link_blocks[1].cache.start=cache.pos;
 		dyn_run_code();
 
+		// indirect branches without a known target return to the core
+		cache.pos=(Bit8u*)(((Bitu)cache.pos+31) & ~31);
+		core_block.cache.start=cache.pos;
+		cache.block.target=&core_block;
+		dyn_return(BR_Normal,false);
+
 		cache.free_pages=0;
 		cache.last_page=0;
 		cache.used_pages=0;
@@ -23,6 +23,7 @@
 #include "decoder_opcodes.h"
 
 #include "dyn_fpu.h"
+#include "dyn_mmx.h"
 
 /*
 	The function CreateCacheBlock translates the instruction stream
@@ -31,7 +32,7 @@
 	instruction is encountered.
 */
 
-static CacheBlockDynRec * CreateCacheBlock(CodePageHandlerDynRec * codepage,PhysPt start,Bitu max_opcodes) {
+static CacheBlockDynRec * CreateCacheBlock(CodePageHandlerDynRec * codepage,PhysPt start,Bitu max_opcodes,bool trace) {
 	// initialize a load of variables
 	decode.code_start=start;
 	decode.code=start;
@@ -42,13 +43,22 @@ static CacheBlockDynRec * CreateCacheBlock(CodePageHandlerDynRec * codepage,Phys
 	decode.page.first=start >> 12;
 	decode.active_block=decode.block=cache_openblock();
 	decode.block->page.start=(Bit16u)decode.page.index;
+	decode.block->trace=trace;
+	decode.block->trace_runs=DYN_TRACE_RUNS;
+	decode.trace=trace;
 	codepage->AddCacheBlock(decode.block);
 
 	InitFlagsOptimization();
+	decode.flags_type=t_UNKNOWN;
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_open_block();
+#endif
 
 	// every codeblock that is run sets cache.block.running to itself
 	// so the block linking knows the last executed block
 	gen_mov_direct_ptr(&cache.block.running,(DRC_PTR_SIZE_IM)decode.block);
+	// count the runs so the block is kept when the cache wraps around
+	gen_add_direct_word(&decode.block->usage,1,true);
 
 	// start with the cycles check
 	gen_mov_word_to_reg(FC_RETOP,&CPU_Cycles,true);
@@ -56,8 +66,21 @@ static CacheBlockDynRec * CreateCacheBlock(CodePageHandlerDynRec * codepage,Phys
 	save_info_dynrec[used_save_info_dynrec].type=cycle_check;
 	used_save_info_dynrec++;
 
+	// count the runs towards a trace, linked entries included, and
+	// return to the core for the retranslation when they are used up
+	if (!trace) {
+		gen_sub_direct_word(&decode.block->trace_runs,1,true);
+		gen_mov_word_to_reg(FC_RETOP,&decode.block->trace_runs,true);
+		save_info_dynrec[used_save_info_dynrec].branch_pos=gen_create_branch_long_leqzero(FC_RETOP);
+		save_info_dynrec[used_save_info_dynrec].type=trace_check;
+		used_save_info_dynrec++;
+	}
+
 	decode.cycles=0;
 	while (max_opcodes--) {
+		// a trace is longer than a normal block, end it while the cache
+		// block still has room for the next instruction and the block end
+		if (decode.trace && (Bitu)(cache.pos-decode.block->cache.start)>CACHE_MAXSIZE/2) break;
 		// Init prefixes
 		decode.big_addr=cpu.code.big;
 		decode.big_op=cpu.code.big;
@@ -65,7 +88,14 @@ static CacheBlockDynRec * CreateCacheBlock(CodePageHandlerDynRec * codepage,Phys
 		decode.seg_prefix_used=false;
 		decode.rep=REP_NONE;
 		decode.cycles++;
+		// the lazy flags type is only known right behind the instruction that set it
+		if (decode.flags_op!=decode.op_start) decode.flags_type=t_UNKNOWN;
 		decode.op_start=decode.code;
+#if C_HEAVY_DEBUG
+		// a block starting at a breakpoint is checked by the core before it is run
+		if (decode.code!=decode.code_start && CBreakpoint::HasActiveBreakpoint(decode.code))
+			dyn_check_breakpoint();
+#endif
 restart_prefix:
 		Bitu opcode;
 		if (!decode.page.invmap) opcode=decode_fetchb();
@@ -193,10 +223,12 @@ restart_prefix:
 
 				// short conditional jumps
 				case 0x80:case 0x81:case 0x82:case 0x83:case 0x84:case 0x85:case 0x86:case 0x87:	
-				case 0x88:case 0x89:case 0x8a:case 0x8b:case 0x8c:case 0x8d:case 0x8e:case 0x8f:	
-					dyn_branched_exit((BranchTypes)(dual_code&0xf),
-						decode.big_op ? (Bit32s)decode_fetchd() : (Bit16s)decode_fetchw());
+				case 0x88:case 0x89:case 0x8a:case 0x8b:case 0x8c:case 0x8d:case 0x8e:case 0x8f: {
+					Bit32s eip_add=decode.big_op ? (Bit32s)decode_fetchd() : (Bit16s)decode_fetchw();
+					if (dyn_trace_branch((BranchTypes)(dual_code&0xf),eip_add)) break;
+					dyn_branched_exit((BranchTypes)(dual_code&0xf),eip_add);
 					goto finish_block;
+				}
 
 				// conditional byte set instructions
 /*				case 0x90:case 0x91:case 0x92:case 0x93:case 0x94:case 0x95:case 0x96:case 0x97:	
@@ -240,6 +272,30 @@ restart_prefix:
 				case 0xbe:dyn_movx_ev_gb(true);break;
 				case 0xbf:dyn_movx_ev_gw(true);break;
 
+#ifdef CPU_FPU
+				// mmx instructions
+				case 0x60:case 0x61:case 0x62:case 0x63:case 0x64:case 0x65:case 0x66:case 0x67:
+				case 0x68:case 0x69:case 0x6a:case 0x6b:case 0x6f:case 0x74:case 0x75:case 0x76:case 0x7f:
+				case 0xd1:case 0xd2:case 0xd3:case 0xd5:case 0xd8:case 0xd9:case 0xdb:case 0xdc:case 0xdd:case 0xdf:
+				case 0xe1:case 0xe2:case 0xe5:case 0xe8:case 0xe9:case 0xeb:case 0xec:case 0xed:case 0xef:
+				case 0xf1:case 0xf2:case 0xf3:case 0xf5:case 0xf8:case 0xf9:case 0xfa:case 0xfc:case 0xfd:case 0xfe:
+					if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+					dyn_mmx_pq_qq(dual_code);
+					break;
+				case 0x6e:case 0x7e:
+					if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+					dyn_mmx_movd(dual_code==0x6e);
+					break;
+				case 0x71:case 0x72:case 0x73:
+					if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+					if (!dyn_mmx_shift_imm(dual_code)) goto illegalopcode;
+					break;
+				case 0x77:
+					if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+					gen_call_function_raw((void *)&dyn_mmx_emms);
+					break;
+#endif
+
 				default:
 #if DYN_LOG
 //					LOG_MSG("Unhandled dual opcode 0F%02X",dual_code);
@@ -296,9 +352,12 @@ restart_prefix:
 
 		// short conditional jumps
 		case 0x70:case 0x71:case 0x72:case 0x73:case 0x74:case 0x75:case 0x76:case 0x77:	
-		case 0x78:case 0x79:case 0x7a:case 0x7b:case 0x7c:case 0x7d:case 0x7e:case 0x7f:	
-			dyn_branched_exit((BranchTypes)(opcode&0xf),(Bit8s)decode_fetchb());	
+		case 0x78:case 0x79:case 0x7a:case 0x7b:case 0x7c:case 0x7d:case 0x7e:case 0x7f: {
+			Bit32s eip_add=(Bit8s)decode_fetchb();
+			if (dyn_trace_branch((BranchTypes)(opcode&0xf),eip_add)) break;
+			dyn_branched_exit((BranchTypes)(opcode&0xf),eip_add);
 			goto finish_block;
+		}
 
 		// 'op []/reg8,imm8'
 		case 0x80:
@@ -327,7 +386,11 @@ restart_prefix:
 		case 0x8c:dyn_mov_ev_seg();break;
 
 		// load effective address
-		case 0x8d:dyn_lea();break;
+		case 0x8d:
+			dyn_get_modrm();
+			if (GCC_UNLIKELY(decode.modrm.mod==3)) goto illegalopcode;
+			dyn_lea();
+			break;
 
 		// move a value from memory or a 16bit register into a segment register
 		case 0x8e:dyn_mov_seg_ev();break;
@@ -589,12 +652,12 @@ restart_prefix:
 	// link to next block because the maximum number of opcodes has been reached
 	dyn_set_eip_end();
 	dyn_reduce_cycles();
-	gen_jmp_ptr(&decode.block->link[0].to,offsetof(CacheBlockDynRec,cache.start));
+	dyn_jmp_link(0);
 	dyn_closeblock();
     goto finish_block;
 core_close_block:
 	dyn_reduce_cycles();
-	dyn_return(BR_Normal);
+	dyn_branch_indirect();
 	dyn_closeblock();
 	goto finish_block;
 illegalopcode:
@@ -101,8 +101,11 @@ static struct DynDecode {
 	bool big_addr;			// address modifier
 	REP_Type rep;			// current repeat prefix
 	Bitu cycles;			// number cycles used by currently translated code
+	bool trace;				// continue after conditional branches (see dyn_trace_branch)
 	bool seg_prefix_used;	// segment overridden
 	Bit8u seg_prefix;		// segment prefix (if seg_prefix_used==true)
+	PhysPt flags_op;		// instruction that set the lazy flags of flags_type
+	Bitu flags_type;		// t_UNKNOWN unless set by the instruction before
 
 	// block that contains the first instruction translated
 	CacheBlockDynRec * block;
@@ -498,6 +501,15 @@ static INLINE void dyn_set_eip_end(HostReg reg,Bit32u imm=0) {
 
 
 
+// the next helper call neither reads nor changes the guest registers (memory
+// accesses, lazy flags), a backend that keeps them in host registers within
+// a block (DRC_USE_REGS_CACHE) doesn't have to write them back for it
+static INLINE void dyn_call_keeps_regs(void) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_keep_next_call();
+#endif
+}
+
 // the following functions generate function calls
 // parameters are loaded by generating code using gen_load_param_ which
 // is architecture dependent
@@ -597,7 +609,11 @@ static DRC_PTR_SIZE_IM INLINE gen_call_function_mm(void * func,Bitu op1,Bitu op2
 
 
 
-enum save_info_type {db_exception, cycle_check, string_break};
+enum save_info_type {db_exception, cycle_check, string_break, trace_check
+#if C_HEAVY_DEBUG
+	, breakpoint_check
+#endif
+};
 
 
 // function that is called on exceptions
@@ -609,6 +625,62 @@ static BlockReturn DynRunException(Bit32u eip_add,Bit32u cycle_sub) {
 	return BR_Normal;
 }
 
+#if C_HEAVY_DEBUG
+// function that is called at instructions with an active breakpoint,
+// eip and cycles are only adjusted if the debugger stops there
+static bool DynCheckBreakpoint(Bit32u eip_add,Bit32u cycle_sub) {
+	Bit32u old_eip=reg_eip;
+	reg_eip+=eip_add;
+	if (!DEBUG_HeavyIsBreakpoint()) {
+		reg_eip=old_eip;
+		return false;
+	}
+	CPU_Cycles-=cycle_sub;
+	return true;
+}
+#endif
+
+// function that is called at the end of a block that was left through an
+// indirect branch, finds the block at cs:eip so the generated code can jump
+// there directly instead of returning to the core for the lookup
+static void DynFindTarget(void) {
+	PhysPt ip=SegPhys(cs)+reg_eip;
+	cache.block.target=&core_block;
+	// same checks as for the block linking, unmapped pages have no code
+	CodePageHandlerDynRec * handler=(CodePageHandlerDynRec *)get_tlb_readhandler(ip);
+	if (!(handler->flags & PFLAG_HASCODE)) {
+		PERF_COUNT(PERF_COUNTER_TARGET_MISS,1);
+		return;
+	}
+#if C_HEAVY_DEBUG
+	// the core checks the breakpoint before running the block
+	if (CBreakpoint::HasActiveBreakpoint(ip)) return;
+#endif
+	Bitu index=(ip^(ip>>10))&(TARGET_CACHE_SIZE-1);
+	CacheBlockDynRec * block=cache_targets[index].block;
+	// the block may have been cleared or reused since it was entered here
+	if (!block || cache_targets[index].ip!=ip || block->page.handler!=handler ||
+		!block->hash.index || block->page.start!=(ip&4095)) {
+		block=handler->FindCacheBlock(ip&4095);
+		if (!block) {
+			PERF_COUNT(PERF_COUNTER_TARGET_MISS,1);
+			return;
+		}
+		cache_targets[index].ip=ip;
+		cache_targets[index].block=block;
+	}
+	PERF_COUNT(PERF_COUNTER_TARGET_HIT,1);
+	cache.block.target=block;
+}
+
+// function that is called at a callback instruction, runs the leaf handler
+// of the callback so the block can continue in the cache instead of
+// returning to the core, returns zero if the full handler is needed
+static Bit32u DynRunLeafCallback(void) {
+	FillFlags();
+	return CALLBACK_RunLeaf(core_dynrec.callback) ? 1 : 0;
+}
+
 
 // array with information about code that is generated at the
 // end of a cache block because it is rarely reached (like exceptions)
@@ -630,6 +702,12 @@ static void dyn_return(BlockReturn retcode,bool ret_exception=false) {
 	gen_return_function();
 }
 
+// leave the block through an indirect branch, cs:eip has been set already
+static void dyn_branch_indirect(void) {
+	gen_call_function_raw((void*)&DynFindTarget);
+	gen_jmp_ptr(&cache.block.target,offsetof(CacheBlockDynRec,cache.start));
+}
+
 static void dyn_run_code(void) {
 	gen_run_code();
 	gen_return_function();
@@ -652,11 +730,21 @@ static void dyn_fill_blocks(void) {
 				// cycles are <=0 so exit the core
 				dyn_return(BR_Cycles);
 				break;
+			case trace_check:
+				// nothing ran yet, the core translates the block again as a trace
+				dyn_return(BR_Normal);
+				break;
 			case string_break:
 				// interrupt looped string instruction, can be continued later
 				gen_add_direct_word(&reg_eip,save_info_dynrec[sct].eip_change,decode.big_op);
 				dyn_return(BR_Cycles);
 				break;
+#if C_HEAVY_DEBUG
+			case breakpoint_check:
+				// the debugger stopped at a breakpoint inside the block
+				dyn_return(BR_Breakpoint);
+				break;
+#endif
 		}
 	}
 	used_save_info_dynrec=0;
@@ -671,6 +759,22 @@ static void dyn_closeblock(void) {
 	cache_block_closing(decode.block->cache.start,decode.block->cache.size);
 }
 
+// point the direct jump of a link at the code of the linked block, a zero
+// target lets the link go through link[].to (to the link return code) again
+static void cache_link_branch(Bit8u * branch,Bit8u * target) {
+#ifdef DRC_USE_DIRECT_LINKS
+	if (branch) gen_fill_link_branch(branch,target);
+#endif
+}
+
+// jump to the block linked at index, see CacheBlockDynRec::LinkTo()
+static void dyn_jmp_link(Bitu index) {
+#ifdef DRC_USE_DIRECT_LINKS
+	decode.block->link[index].branch=gen_create_link_branch();
+#endif
+	gen_jmp_ptr(&decode.block->link[index].to,offsetof(CacheBlockDynRec,cache.start));
+}
+
 
 // add a check that can branch to the exception handling
 static void dyn_check_exception(HostReg reg) {
@@ -755,22 +859,37 @@ bool DRC_CALL_CONV mem_writed_checked_drc(PhysPt address,Bit32u val) {
 
 // read a byte from a given address and store it in reg_dst
 static void dyn_read_byte(HostReg reg_addr,HostReg reg_dst) {
+#ifdef DRC_USE_TLB_READ
+	DRC_PTR_SIZE_IM tlb_done=gen_read_tlb_fast(reg_dst,reg_addr,1);
+#endif
 	gen_mov_regs(FC_OP1,reg_addr);
+	dyn_call_keeps_regs();
 	gen_call_function_raw((void *)&mem_readb_checked_drc);
 	dyn_check_exception(FC_RETOP);
 	gen_mov_byte_to_reg_low(reg_dst,&core_dynrec.readdata);
+#ifdef DRC_USE_TLB_READ
+	gen_fill_branch_long(tlb_done);
+#endif
 }
 static void dyn_read_byte_canuseword(HostReg reg_addr,HostReg reg_dst) {
+#ifdef DRC_USE_TLB_READ
+	DRC_PTR_SIZE_IM tlb_done=gen_read_tlb_fast(reg_dst,reg_addr,1);
+#endif
 	gen_mov_regs(FC_OP1,reg_addr);
+	dyn_call_keeps_regs();
 	gen_call_function_raw((void *)&mem_readb_checked_drc);
 	dyn_check_exception(FC_RETOP);
 	gen_mov_byte_to_reg_low_canuseword(reg_dst,&core_dynrec.readdata);
+#ifdef DRC_USE_TLB_READ
+	gen_fill_branch_long(tlb_done);
+#endif
 }
 
 // write a byte from reg_val into the memory given by the address
 static void dyn_write_byte(HostReg reg_addr,HostReg reg_val) {
 	gen_mov_regs(FC_OP2,reg_val);
 	gen_mov_regs(FC_OP1,reg_addr);
+	dyn_call_keeps_regs();
 	gen_call_function_raw((void *)&mem_writeb_checked_drc);
 	dyn_check_exception(FC_RETOP);
 }
@@ -778,11 +897,18 @@ static void dyn_write_byte(HostReg reg_addr,HostReg reg_val) {
 // read a 32bit (dword=true) or 16bit (dword=false) value
 // from a given address and store it in reg_dst
 static void dyn_read_word(HostReg reg_addr,HostReg reg_dst,bool dword) {
+#ifdef DRC_USE_TLB_READ
+	DRC_PTR_SIZE_IM tlb_done=gen_read_tlb_fast(reg_dst,reg_addr,dword?4:2);
+#endif
 	gen_mov_regs(FC_OP1,reg_addr);
+	dyn_call_keeps_regs();
 	if (dword) gen_call_function_raw((void *)&mem_readd_checked_drc);
 	else gen_call_function_raw((void *)&mem_readw_checked_drc);
 	dyn_check_exception(FC_RETOP);
 	gen_mov_word_to_reg(reg_dst,&core_dynrec.readdata,dword);
+#ifdef DRC_USE_TLB_READ
+	gen_fill_branch_long(tlb_done);
+#endif
 }
 
 // write a 32bit (dword=true) or 16bit (dword=false) value
@@ -791,6 +917,7 @@ static void dyn_write_word(HostReg reg_addr,HostReg reg_val,bool dword) {
 //	if (!dword) gen_extend_word(false,reg_val);
 	gen_mov_regs(FC_OP2,reg_val);
 	gen_mov_regs(FC_OP1,reg_addr);
+	dyn_call_keeps_regs();
 	if (dword) gen_call_function_raw((void *)&mem_writed_checked_drc);
 	else gen_call_function_raw((void *)&mem_writew_checked_drc);
 	dyn_check_exception(FC_RETOP);
@@ -1197,12 +1324,13 @@ static void gen_restore_reg(HostReg reg,HostReg dest_reg) {
 // they try to find out if a function can be replaced by another
 // one that does not generate any flags at all
 
+#define MF_FUNCTIONS_MAX 64
 static Bitu mf_functions_num=0;
 static struct {
 	Bit8u* pos;
 	void* fct_ptr;
 	Bitu ftype;
-} mf_functions[64];
+} mf_functions[MF_FUNCTIONS_MAX];
 
 static void InitFlagsOptimization(void) {
 	mf_functions_num=0;
@@ -1240,6 +1368,8 @@ static void InvalidateFlags(void* current_simple_function,Bitu flags_type) {
 // this function can be replaced by a simpler one as well
 static void InvalidateFlagsPartially(void* current_simple_function,Bitu flags_type) {
 #ifdef DRC_FLAGS_INVALIDATION
+	// a full queue only means this function keeps generating its flags
+	if (mf_functions_num>=MF_FUNCTIONS_MAX) return;
 	mf_functions[mf_functions_num].pos=cache.pos;
 	mf_functions[mf_functions_num].fct_ptr=current_simple_function;
 	mf_functions[mf_functions_num].ftype=flags_type;
@@ -1252,6 +1382,7 @@ static void InvalidateFlagsPartially(void* current_simple_function,Bitu flags_ty
 // this function can be replaced by a simpler one as well
 static void InvalidateFlagsPartially(void* current_simple_function,DRC_PTR_SIZE_IM cpos,Bitu flags_type) {
 #ifdef DRC_FLAGS_INVALIDATION
+	if (mf_functions_num>=MF_FUNCTIONS_MAX) return;
 	mf_functions[mf_functions_num].pos=(Bit8u*)cpos;
 	mf_functions[mf_functions_num].fct_ptr=current_simple_function;
 	mf_functions[mf_functions_num].ftype=flags_type;
@@ -1265,3 +1396,18 @@ static void AcquireFlags(Bitu flags_mask) {
 	mf_functions_num=0;
 #endif
 }
+
+#if C_HEAVY_DEBUG
+// call out to the debugger before the current instruction, only emitted
+// for instructions that had an active breakpoint when the block was created
+static void dyn_check_breakpoint(void) {
+	// the flags have to be valid when the debugger shows them
+	AcquireFlags(FMASK_TEST);
+	Bit32u eip_change=decode.op_start-decode.code_start;
+	if (!cpu.code.big) eip_change&=0xffff;
+	gen_call_function_II((void *)&DynCheckBreakpoint,eip_change,decode.cycles-1);
+	save_info_dynrec[used_save_info_dynrec].branch_pos=gen_create_branch_long_nonzero(FC_RETOP,false);
+	save_info_dynrec[used_save_info_dynrec].type=breakpoint_check;
+	used_save_info_dynrec++;
+}
+#endif
@@ -392,7 +392,6 @@ static void dyn_mov_ev_seg(void) {
 
 
 static void dyn_lea(void) {
-	dyn_get_modrm();
 	dyn_fill_ea(FC_ADDR,false);
 	MOV_REG_WORD_FROM_HOST_REG(FC_ADDR,decode.modrm.reg,decode.big_op);
 }
@@ -623,20 +622,20 @@ static void dyn_grp2_eb(grp2_types type) {
 	switch (type) {
 	case grp2_1:
 		gen_mov_byte_to_reg_low_imm_canuseword(FC_OP2,1);
-		dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg);
+		dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg,true);
 		break;
 	case grp2_imm: {
 		Bit8u imm=decode_fetchb();
 		if (imm) {
 			gen_mov_byte_to_reg_low_imm_canuseword(FC_OP2,imm&0x1f);
-			dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg);
+			dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg,(imm&0x1f)!=0);
 		} else return;
 		}
 		break;
 	case grp2_cl:
 		MOV_REG_BYTE_TO_HOST_REG_LOW_CANUSEWORD(FC_OP2,DRC_REG_ECX,0);
 		gen_and_imm(FC_OP2,0x1f);
-		dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg);
+		dyn_shift_byte_gencall((ShiftOps)decode.modrm.reg,false);
 		break;
 	}
 	if (decode.modrm.mod<3) {
@@ -659,27 +658,27 @@ static void dyn_grp2_ev(grp2_types type) {
 	switch (type) {
 	case grp2_1:
 		gen_mov_byte_to_reg_low_imm_canuseword(FC_OP2,1);
-		dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op);
+		dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op,true);
 		break;
 	case grp2_imm: {
 		Bitu val;
 		if (decode_fetchb_imm(val)) {
 			gen_mov_byte_to_reg_low_canuseword(FC_OP2,(void*)val);
 			gen_and_imm(FC_OP2,0x1f);
-			dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op);
+			dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op,false);
 			break;
 		}
 		Bit8u imm=(Bit8u)val;
 		if (imm) {
 			gen_mov_byte_to_reg_low_imm_canuseword(FC_OP2,imm&0x1f);
-			dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op);
+			dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op,(imm&0x1f)!=0);
 		} else return;
 		}
 		break;
 	case grp2_cl:
 		MOV_REG_BYTE_TO_HOST_REG_LOW_CANUSEWORD(FC_OP2,DRC_REG_ECX,0);
 		gen_and_imm(FC_OP2,0x1f);
-		dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op);
+		dyn_shift_word_gencall((ShiftOps)decode.modrm.reg,decode.big_op,false);
 		break;
 	}
 	if (decode.modrm.mod<3) {
@@ -702,6 +701,7 @@ static void dyn_grp3_eb(void) {
 	}
 	switch (decode.modrm.reg) {
 	case 0x0:	// test eb,ib
+	case 0x1:	// test eb,ib (undocumented)
 		gen_mov_byte_to_reg_low_imm_canuseword(FC_OP2,decode_fetchb());
 		dyn_dop_byte_gencall(DOP_TEST);
 		return;
@@ -718,10 +718,12 @@ static void dyn_grp3_eb(void) {
 		gen_call_function_raw((void*)&dynrec_imul_byte);
 		return;
 	case 0x6:	// div Eb
+		AcquireFlags(FMASK_TEST);	// the divide error pushes them
 		gen_call_function_raw((void*)&dynrec_div_byte);
 		dyn_check_exception(FC_RETOP);
 		return;
 	case 0x7:	// idiv Eb
+		AcquireFlags(FMASK_TEST);
 		gen_call_function_raw((void*)&dynrec_idiv_byte);
 		dyn_check_exception(FC_RETOP);
 		return;
@@ -746,6 +748,7 @@ static void dyn_grp3_ev(void) {
 	}
 	switch (decode.modrm.reg) {
 	case 0x0:	// test ev,iv
+	case 0x1:	// test ev,iv (undocumented)
 		if (decode.big_op) gen_mov_dword_to_reg_imm(FC_OP2,decode_fetchd());
 		else gen_mov_word_to_reg_imm(FC_OP2,decode_fetchw());
 		dyn_dop_word_gencall(DOP_TEST,decode.big_op);
@@ -765,11 +768,13 @@ static void dyn_grp3_ev(void) {
 		else gen_call_function_raw((void*)&dynrec_imul_word);
 		return;
 	case 0x6:	// div Eb
+		AcquireFlags(FMASK_TEST);	// the divide error pushes them
 		if (decode.big_op) gen_call_function_raw((void*)&dynrec_div_dword);
 		else gen_call_function_raw((void*)&dynrec_div_word);
 		dyn_check_exception(FC_RETOP);
 		return;
 	case 0x7:	// idiv Eb
+		AcquireFlags(FMASK_TEST);
 		if (decode.big_op) gen_call_function_raw((void*)&dynrec_idiv_dword);
 		else gen_call_function_raw((void*)&dynrec_idiv_word);
 		dyn_check_exception(FC_RETOP);
@@ -804,12 +809,19 @@ static bool dyn_grp4_eb(void) {
 		}
 		break;
 	case 0x7:		//CALBACK Iw
-		gen_mov_direct_dword(&core_dynrec.callback,decode_fetchw());
-		dyn_set_eip_end();
-		dyn_reduce_cycles();
-		dyn_return(BR_CallBack);
-		dyn_closeblock();
-		return true;
+		{
+			gen_mov_direct_dword(&core_dynrec.callback,decode_fetchw());
+			dyn_set_eip_end();
+			dyn_reduce_cycles();
+			gen_call_function_raw((void *)&DynRunLeafCallback);
+			DRC_PTR_SIZE_IM no_leaf=gen_create_branch_on_zero(FC_RETOP,true);
+			// served by the leaf handler, which may have changed cs:eip
+			dyn_branch_indirect();
+			gen_fill_branch(no_leaf);
+			dyn_return(BR_CallBack);
+			dyn_closeblock();
+			return true;
+		}
 	default:
 		IllegalOptionDynrec("dyn_grp4_eb");
 		break;
@@ -1080,15 +1092,16 @@ static void dyn_cwd(void) {
 
 static void dyn_sahf(void) {
 	MOV_REG_WORD16_TO_HOST_REG(FC_OP1,DRC_REG_EAX);
+	// OF is kept so the flags before are still needed
+	AcquireFlags(FLAG_OF);
 	gen_call_function_raw((void *)&dynrec_sahf);
-	InvalidateFlags();
 }
 
 
 static void dyn_exit_link(Bits eip_change) {
 	gen_add_direct_word(&reg_eip,(decode.code-decode.code_start)+eip_change,decode.big_op);
 	dyn_reduce_cycles();
-	gen_jmp_ptr(&decode.block->link[0].to,offsetof(CacheBlockDynRec,cache.start));
+	dyn_jmp_link(0);
 	dyn_closeblock();
 }
 
@@ -1102,15 +1115,44 @@ static void dyn_branched_exit(BranchTypes btype,Bit32s eip_add) {
 
  	// Branch not taken
 	gen_add_direct_word(&reg_eip,eip_base,decode.big_op);
- 	gen_jmp_ptr(&decode.block->link[0].to,offsetof(CacheBlockDynRec,cache.start));
+ 	dyn_jmp_link(0);
  	gen_fill_branch(data);
 
  	// Branch taken
 	gen_add_direct_word(&reg_eip,eip_base+eip_add,decode.big_op);
- 	gen_jmp_ptr(&decode.block->link[1].to,offsetof(CacheBlockDynRec,cache.start));
+ 	dyn_jmp_link(1);
  	dyn_closeblock();
 }
 
+// inside of a trace a forward conditional branch whose fall-through path
+// already ran as a block of its own does not end the block, only the taken
+// path leaves it (through the indirect branch lookup)
+static bool dyn_trace_branch(BranchTypes btype,Bit32s eip_add) {
+	if (!decode.trace || (eip_add<=0)) return false;
+	// keep enough room in the cache block for the rest of the trace
+	if ((Bitu)(cache.pos-decode.block->cache.start)>CACHE_MAXSIZE/2) return false;
+	if (decode.page.index>=4096) return false;
+	CacheBlockDynRec * next=decode.page.code->FindCacheBlock(decode.page.index);
+	if (!next || (!next->trace && next->trace_runs>=DYN_TRACE_RUNS)) return false;
+
+	Bitu eip_base=decode.code-decode.code_start;
+	dyn_reduce_cycles();
+	decode.cycles=0;
+	// the taken path needs the flags as well
+	AcquireFlags(FMASK_TEST);
+
+	dyn_branchflag_to_reg(btype);
+	DRC_PTR_SIZE_IM data=gen_create_branch_on_zero(FC_RETOP,true);
+
+	// Branch taken
+	gen_add_direct_word(&reg_eip,eip_base+eip_add,decode.big_op);
+	dyn_branch_indirect();
+	gen_fill_branch(data);
+
+	// Branch not taken, continue with the next instruction
+	return true;
+}
+
 /*
 static void dyn_set_byte_on_condition(BranchTypes btype) {
 	dyn_get_modrm();
@@ -1156,7 +1198,7 @@ static void dyn_loop(LoopTypes type) {
 		break;
 	}
 	gen_add_direct_word(&reg_eip,eip_base+eip_add,true);
-	gen_jmp_ptr(&decode.block->link[0].to,offsetof(CacheBlockDynRec,cache.start));
+	dyn_jmp_link(0);
 	if (branch1) {
 		gen_fill_branch(branch1);
 		MOV_REG_WORD_TO_HOST_REG(FC_OP1,DRC_REG_ECX,decode.big_addr);
@@ -1166,7 +1208,7 @@ static void dyn_loop(LoopTypes type) {
 	// Branch taken
 	gen_fill_branch(branch2);
 	gen_add_direct_word(&reg_eip,eip_base,decode.big_op);
-	gen_jmp_ptr(&decode.block->link[1].to,offsetof(CacheBlockDynRec,cache.start));
+	dyn_jmp_link(1);
 	dyn_closeblock();
 }
 
@@ -1182,7 +1224,7 @@ static void dyn_ret_near(Bitu bytes) {
 	gen_mov_word_from_reg(FC_RETOP,decode.big_op?(void*)(&reg_eip):(void*)(&reg_ip),true);
 
 	if (bytes) gen_add_direct_word(&reg_esp,bytes,true);
-	dyn_return(BR_Normal);
+	dyn_branch_indirect();
 	dyn_closeblock();
 }
 
@@ -1198,7 +1240,7 @@ static void dyn_call_near_imm(void) {
 	gen_mov_word_from_reg(FC_OP1,decode.big_op?(void*)(&reg_eip):(void*)(&reg_ip),decode.big_op);
 
 	dyn_reduce_cycles();
-	gen_jmp_ptr(&decode.block->link[0].to,offsetof(CacheBlockDynRec,cache.start));
+	dyn_jmp_link(0);
 	dyn_closeblock();
 }
 
@@ -1206,7 +1248,7 @@ static void dyn_ret_far(Bitu bytes) {
 	dyn_reduce_cycles();
 	dyn_set_eip_last_end(FC_RETOP);
 	gen_call_function_IIR((void*)&CPU_RET,decode.big_op,bytes,FC_RETOP);
-	dyn_return(BR_Normal);
+	dyn_branch_indirect();
 	dyn_closeblock();
 }
 
@@ -1217,7 +1259,7 @@ static void dyn_call_far_imm(void) {
 	dyn_reduce_cycles();
 	dyn_set_eip_last_end(FC_RETOP);
 	gen_call_function_IIIR((void*)&CPU_CALL,decode.big_op,sel,off,FC_RETOP);
-	dyn_return(BR_Normal);
+	dyn_branch_indirect();
 	dyn_closeblock();
 }
 
@@ -1228,7 +1270,7 @@ static void dyn_jmp_far_imm(void) {
 	dyn_reduce_cycles();
 	dyn_set_eip_last_end(FC_RETOP);
 	gen_call_function_IIIR((void*)&CPU_JMP,decode.big_op,sel,off,FC_RETOP);
-	dyn_return(BR_Normal);
+	dyn_branch_indirect();
 	dyn_closeblock();
 }
 
@@ -53,91 +53,106 @@ static void FPU_FFREE(Bitu st) {
 #endif
 
 
-static INLINE void dyn_fpu_top() {
-	gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-	gen_add_imm(FC_OP2,decode.modrm.rm);
-	gen_and_imm(FC_OP2,7);
-	gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
+/* Stack relative handlers for the recompiler. The STi index is a constant of the
+   translated instruction and TOP is only read inside the handler, so a block never
+   loads TOP itself and the pushes and pops don't need calls of their own */
+#define DYN_FPU_ARITH_REG(op)															\
+static void FPU_##op##_ST_STi(Bitu sti) { FPU_##op(TOP,STV(sti)); }						\
+static void FPU_##op##_STi_ST(Bitu sti) { FPU_##op(STV(sti),TOP); }						\
+static void FPU_##op##P_STi_ST(Bitu sti) { FPU_##op(STV(sti),TOP); FPU_FPOP(); }
+
+DYN_FPU_ARITH_REG(FADD)
+DYN_FPU_ARITH_REG(FMUL)
+DYN_FPU_ARITH_REG(FSUB)
+DYN_FPU_ARITH_REG(FSUBR)
+DYN_FPU_ARITH_REG(FDIV)
+DYN_FPU_ARITH_REG(FDIVR)
+
+static void FPU_FCOM_ST_STi(Bitu sti) { FPU_FCOM(TOP,STV(sti)); }
+static void FPU_FCOMP_ST_STi(Bitu sti) { FPU_FCOM(TOP,STV(sti)); FPU_FPOP(); }
+static void FPU_FCOMPP(void) { FPU_FCOM(TOP,STV(1)); FPU_FPOP(); FPU_FPOP(); }
+static void FPU_FUCOM_ST_STi(Bitu sti) { FPU_FUCOM(TOP,STV(sti)); }
+static void FPU_FUCOMP_ST_STi(Bitu sti) { FPU_FUCOM(TOP,STV(sti)); FPU_FPOP(); }
+static void FPU_FUCOMPP(void) { FPU_FUCOM(TOP,STV(1)); FPU_FPOP(); FPU_FPOP(); }
+
+static void FPU_FLD_STi(Bitu sti) {
+	Bitu reg = STV(sti);
+	FPU_PREP_PUSH();
+	FPU_FST(reg,TOP);
 }
+static void FPU_FXCH_STi(Bitu sti) { FPU_FXCH(TOP,STV(sti)); }
+static void FPU_FST_STi(Bitu sti) { FPU_FST(TOP,STV(sti)); }
+static void FPU_FSTP_STi(Bitu sti) { FPU_FST(TOP,STV(sti)); FPU_FPOP(); }
+static void FPU_FFREE_STi(Bitu sti) { FPU_FFREE(STV(sti)); }
+static void FPU_FFREEP_STi(Bitu sti) { FPU_FFREE(STV(sti)); FPU_FPOP(); }
+
+/* The memory operand goes through the scratch register 8 like in the normal core */
+#define DYN_FPU_ARITH_MEM(type)															\
+static void FPU_FADD_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FADD(TOP,8); }		\
+static void FPU_FMUL_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FMUL(TOP,8); }		\
+static void FPU_FCOM_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FCOM(TOP,8); }		\
+static void FPU_FCOMP_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FCOM(TOP,8); FPU_FPOP(); }	\
+static void FPU_FSUB_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FSUB(TOP,8); }		\
+static void FPU_FSUBR_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FSUBR(TOP,8); }	\
+static void FPU_FDIV_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FDIV(TOP,8); }		\
+static void FPU_FDIVR_##type(PhysPt addr) { FPU_FLD_##type(addr,8); FPU_FDIVR(TOP,8); }	\
+static void (* const dyn_fpu_arith_##type[8])(PhysPt) = {								\
+	FPU_FADD_##type,FPU_FMUL_##type,FPU_FCOM_##type,FPU_FCOMP_##type,					\
+	FPU_FSUB_##type,FPU_FSUBR_##type,FPU_FDIV_##type,FPU_FDIVR_##type					\
+};
+
+DYN_FPU_ARITH_MEM(F32)
+DYN_FPU_ARITH_MEM(F64)
+DYN_FPU_ARITH_MEM(I32)
+DYN_FPU_ARITH_MEM(I16)
+
+static void FPU_FLD_F32_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_F32(addr,TOP); }
+static void FPU_FLD_F64_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_F64(addr,TOP); }
+static void FPU_FLD_F80_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_F80(addr); }
+static void FPU_FLD_I16_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_I16(addr,TOP); }
+static void FPU_FLD_I32_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_I32(addr,TOP); }
+static void FPU_FLD_I64_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FLD_I64(addr,TOP); }
+static void FPU_FBLD_PUSH(PhysPt addr) { FPU_PREP_PUSH(); FPU_FBLD(addr,TOP); }
+
+static void FPU_FSTP_F32(PhysPt addr) { FPU_FST_F32(addr); FPU_FPOP(); }
+static void FPU_FSTP_F64(PhysPt addr) { FPU_FST_F64(addr); FPU_FPOP(); }
+static void FPU_FSTP_F80(PhysPt addr) { FPU_FST_F80(addr); FPU_FPOP(); }
+static void FPU_FSTP_I16(PhysPt addr) { FPU_FST_I16(addr); FPU_FPOP(); }
+static void FPU_FSTP_I32(PhysPt addr) { FPU_FST_I32(addr); FPU_FPOP(); }
+static void FPU_FSTP_I64(PhysPt addr) { FPU_FST_I64(addr); FPU_FPOP(); }
+static void FPU_FBSTP(PhysPt addr) { FPU_FBST(addr); FPU_FPOP(); }
+
+static void (* const dyn_fpu_arith_st_sti[8])(Bitu) = {
+	FPU_FADD_ST_STi,FPU_FMUL_ST_STi,FPU_FCOM_ST_STi,FPU_FCOMP_ST_STi,
+	FPU_FSUB_ST_STi,FPU_FSUBR_ST_STi,FPU_FDIV_ST_STi,FPU_FDIVR_ST_STi
+};
 
-static INLINE void dyn_fpu_top_swapped() {
-	gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-	gen_add_imm(FC_OP1,decode.modrm.rm);
-	gen_and_imm(FC_OP1,7);
-	gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
+static void (* const dyn_fpu_arith_sti_st[8])(Bitu) = {
+	FPU_FADD_STi_ST,FPU_FMUL_STi_ST,FPU_FCOM_ST_STi,FPU_FCOMP_ST_STi,
+	FPU_FSUBR_STi_ST,FPU_FSUB_STi_ST,FPU_FDIVR_STi_ST,FPU_FDIV_STi_ST
+};
+
+// FCOMP5 in the third slot, FCOMPP is handled by the decoder
+static void (* const dyn_fpu_arith_sti_st_pop[8])(Bitu) = {
+	FPU_FADDP_STi_ST,FPU_FMULP_STi_ST,FPU_FCOMP_ST_STi,FPU_FCOMP_ST_STi,
+	FPU_FSUBRP_STi_ST,FPU_FSUBP_STi_ST,FPU_FDIVRP_STi_ST,FPU_FDIVP_STi_ST
+};
+
+static INLINE void dyn_fpu_sti(void (*handler)(Bitu)) {
+	gen_call_function_I((void*)handler,decode.modrm.rm);
 }
 
-static void dyn_eatree() {
-	Bitu group=(decode.modrm.val >> 3) & 7;
-	switch (group){
-	case 0x00:		// FADD ST,STi
-		gen_call_function_R((void*)&FPU_FADD_EA,FC_OP1);
-		break;
-	case 0x01:		// FMUL  ST,STi
-		gen_call_function_R((void*)&FPU_FMUL_EA,FC_OP1);
-		break;
-	case 0x02:		// FCOM  STi
-		gen_call_function_R((void*)&FPU_FCOM_EA,FC_OP1);
-		break;
-	case 0x03:		// FCOMP STi
-		gen_call_function_R((void*)&FPU_FCOM_EA,FC_OP1);
-		gen_call_function_raw((void*)&FPU_FPOP);
-		break;
-	case 0x04:		// FSUB  ST,STi
-		gen_call_function_R((void*)&FPU_FSUB_EA,FC_OP1);
-		break;	
-	case 0x05:		// FSUBR ST,STi
-		gen_call_function_R((void*)&FPU_FSUBR_EA,FC_OP1);
-		break;
-	case 0x06:		// FDIV  ST,STi
-		gen_call_function_R((void*)&FPU_FDIV_EA,FC_OP1);
-		break;
-	case 0x07:		// FDIVR ST,STi
-		gen_call_function_R((void*)&FPU_FDIVR_EA,FC_OP1);
-		break;
-	default:
-		break;
-	}
+static INLINE void dyn_fpu_ea(void (*handler)(PhysPt)) {
+	dyn_fill_ea(FC_ADDR);
+	gen_call_function_R((void*)handler,FC_ADDR);
 }
 
 static void dyn_fpu_esc0(){
 	dyn_get_modrm(); 
 	if (decode.modrm.val >= 0xc0) { 
-		dyn_fpu_top();
-		switch (decode.modrm.reg){
-		case 0x00:		//FADD ST,STi
-			gen_call_function_RR((void*)&FPU_FADD,FC_OP1,FC_OP2);
-			break;
-		case 0x01:		// FMUL  ST,STi
-			gen_call_function_RR((void*)&FPU_FMUL,FC_OP1,FC_OP2);
-			break;
-		case 0x02:		// FCOM  STi
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			break;
-		case 0x03:		// FCOMP STi
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
-			break;
-		case 0x04:		// FSUB  ST,STi
-			gen_call_function_RR((void*)&FPU_FSUB,FC_OP1,FC_OP2);
-			break;	
-		case 0x05:		// FSUBR ST,STi
-			gen_call_function_RR((void*)&FPU_FSUBR,FC_OP1,FC_OP2);
-			break;
-		case 0x06:		// FDIV  ST,STi
-			gen_call_function_RR((void*)&FPU_FDIV,FC_OP1,FC_OP2);
-			break;
-		case 0x07:		// FDIVR ST,STi
-			gen_call_function_RR((void*)&FPU_FDIVR,FC_OP1,FC_OP2);
-			break;
-		default:
-			break;
-		}
+		dyn_fpu_sti(dyn_fpu_arith_st_sti[decode.modrm.reg]);
 	} else { 
-		dyn_fill_ea(FC_ADDR);
-		gen_call_function_R((void*)&FPU_FLD_F32_EA,FC_ADDR); 
-		gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-		dyn_eatree();
+		dyn_fpu_ea(dyn_fpu_arith_F32[decode.modrm.reg]);
 	}
 }
 
@@ -147,26 +162,16 @@ static void dyn_fpu_esc1(){
 	if (decode.modrm.val >= 0xc0) { 
 		switch (decode.modrm.reg){
 		case 0x00: /* FLD STi */
-			gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-			gen_add_imm(FC_OP1,decode.modrm.rm);
-			gen_and_imm(FC_OP1,7);
-			gen_protect_reg(FC_OP1);
-			gen_call_function_raw((void*)&FPU_PREP_PUSH); 
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_restore_reg(FC_OP1);
-			gen_call_function_RR((void*)&FPU_FST,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FLD_STi);
 			break;
 		case 0x01: /* FXCH STi */
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FXCH,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FXCH_STi);
 			break;
 		case 0x02: /* FNOP */
 			gen_call_function_raw((void*)&FPU_FNOP);
 			break;
 		case 0x03: /* FSTP STi */
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FST,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_sti(FPU_FSTP_STi);
 			break;   
 		case 0x04:
 			switch(decode.modrm.rm){
@@ -289,22 +294,16 @@ static void dyn_fpu_esc1(){
 	} else {
 		switch(decode.modrm.reg){
 		case 0x00: /* FLD float*/
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1);
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FLD_F32,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FLD_F32_PUSH);
 			break;
 		case 0x01: /* UNKNOWN */
 			LOG(LOG_FPU,LOG_WARN)("ESC EA 1:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
 			break;
 		case 0x02: /* FST float*/
-			dyn_fill_ea(FC_ADDR);
-			gen_call_function_R((void*)&FPU_FST_F32,FC_ADDR);
+			dyn_fpu_ea(FPU_FST_F32);
 			break;
 		case 0x03: /* FSTP float*/
-			dyn_fill_ea(FC_ADDR);
-			gen_call_function_R((void*)&FPU_FST_F32,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_F32);
 			break;
 		case 0x04: /* FLDENV */
 			dyn_fill_ea(FC_ADDR);
@@ -336,13 +335,7 @@ static void dyn_fpu_esc2(){
 		case 0x05:
 			switch(decode.modrm.rm){
 			case 0x01:		/* FUCOMPP */
-				gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-				gen_add_imm(FC_OP2,1);
-				gen_and_imm(FC_OP2,7);
-				gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-				gen_call_function_RR((void *)&FPU_FUCOM,FC_OP1,FC_OP2);
-				gen_call_function_raw((void *)&FPU_FPOP);
-				gen_call_function_raw((void *)&FPU_FPOP);
+				gen_call_function_raw((void *)&FPU_FUCOMPP);
 				break;
 			default:
 				LOG(LOG_FPU,LOG_WARN)("ESC 2:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm); 
@@ -354,10 +347,7 @@ static void dyn_fpu_esc2(){
 			break;
 		}
 	} else {
-		dyn_fill_ea(FC_ADDR);
-		gen_call_function_R((void*)&FPU_FLD_I32_EA,FC_ADDR); 
-		gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-		dyn_eatree();
+		dyn_fpu_ea(dyn_fpu_arith_I32[decode.modrm.reg]);
 	}
 }
 
@@ -392,32 +382,22 @@ static void dyn_fpu_esc3(){
 	} else {
 		switch(decode.modrm.reg){
 		case 0x00:	/* FILD */
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1); 
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FLD_I32,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FLD_I32_PUSH);
 			break;
 		case 0x01:	/* FISTTP */
 			LOG(LOG_FPU,LOG_WARN)("ESC 3 EA:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
 			break;
 		case 0x02:	/* FIST */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_I32,FC_ADDR);
+			dyn_fpu_ea(FPU_FST_I32);
 			break;
 		case 0x03:	/* FISTP */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_I32,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_I32);
 			break;
 		case 0x05:	/* FLD 80 Bits Real */
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FLD_F80,FC_ADDR);
+			dyn_fpu_ea(FPU_FLD_F80_PUSH);
 			break;
 		case 0x07:	/* FSTP 80 Bits Real */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_F80,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_F80);
 			break;
 		default:
 			LOG(LOG_FPU,LOG_WARN)("ESC 3 EA:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
@@ -428,75 +408,33 @@ static void dyn_fpu_esc3(){
 static void dyn_fpu_esc4(){
 	dyn_get_modrm();  
 	if (decode.modrm.val >= 0xc0) { 
-		switch(decode.modrm.reg){
-		case 0x00:	/* FADD STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FADD,FC_OP1,FC_OP2);
-			break;
-		case 0x01:	/* FMUL STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FMUL,FC_OP1,FC_OP2);
-			break;
-		case 0x02:  /* FCOM*/
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			break;
-		case 0x03:  /* FCOMP*/
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
-			break;
-		case 0x04:  /* FSUBR STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FSUBR,FC_OP1,FC_OP2);
-			break;
-		case 0x05:  /* FSUB  STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FSUB,FC_OP1,FC_OP2);
-			break;
-		case 0x06:  /* FDIVR STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FDIVR,FC_OP1,FC_OP2);
-			break;
-		case 0x07:  /* FDIV STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FDIV,FC_OP1,FC_OP2);
-			break;
-		default:
-			break;
-		}
+		dyn_fpu_sti(dyn_fpu_arith_sti_st[decode.modrm.reg]);
 	} else { 
-		dyn_fill_ea(FC_ADDR);
-		gen_call_function_R((void*)&FPU_FLD_F64_EA,FC_ADDR); 
-		gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-		dyn_eatree();
+		dyn_fpu_ea(dyn_fpu_arith_F64[decode.modrm.reg]);
 	}
 }
 
 static void dyn_fpu_esc5(){
 	dyn_get_modrm();  
 	if (decode.modrm.val >= 0xc0) { 
-		dyn_fpu_top();
 		switch(decode.modrm.reg){
 		case 0x00: /* FFREE STi */
-			gen_call_function_R((void*)&FPU_FFREE,FC_OP2);
+			dyn_fpu_sti(FPU_FFREE_STi);
 			break;
 		case 0x01: /* FXCH STi*/
-			gen_call_function_RR((void*)&FPU_FXCH,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FXCH_STi);
 			break;
 		case 0x02: /* FST STi */
-			gen_call_function_RR((void*)&FPU_FST,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FST_STi);
 			break;
 		case 0x03:  /* FSTP STi*/
-			gen_call_function_RR((void*)&FPU_FST,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_sti(FPU_FSTP_STi);
 			break;
 		case 0x04:	/* FUCOM STi */
-			gen_call_function_RR((void*)&FPU_FUCOM,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FUCOM_ST_STi);
 			break;
 		case 0x05:	/*FUCOMP STi */
-			gen_call_function_RR((void*)&FPU_FUCOM,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_sti(FPU_FUCOMP_ST_STi);
 			break;
 		default:
 			LOG(LOG_FPU,LOG_WARN)("ESC 5:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
@@ -505,22 +443,16 @@ static void dyn_fpu_esc5(){
 	} else {
 		switch(decode.modrm.reg){
 		case 0x00:  /* FLD double real*/
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1); 
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FLD_F64,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FLD_F64_PUSH);
 			break;
 		case 0x01:  /* FISTTP longint*/
 			LOG(LOG_FPU,LOG_WARN)("ESC 5 EA:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
 			break;
 		case 0x02:   /* FST double real*/
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_F64,FC_ADDR);
+			dyn_fpu_ea(FPU_FST_F64);
 			break;
 		case 0x03:	/* FSTP double real*/
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_F64,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_F64);
 			break;
 		case 0x04:	/* FRSTOR */
 			dyn_fill_ea(FC_ADDR); 
@@ -546,56 +478,15 @@ static void dyn_fpu_esc5(){
 static void dyn_fpu_esc6(){
 	dyn_get_modrm();  
 	if (decode.modrm.val >= 0xc0) { 
-		switch(decode.modrm.reg){
-		case 0x00:	/*FADDP STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FADD,FC_OP1,FC_OP2);
-			break;
-		case 0x01:	/* FMULP STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FMUL,FC_OP1,FC_OP2);
-			break;
-		case 0x02:  /* FCOMP5*/
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			break;	/* TODO IS THIS ALLRIGHT ????????? */
-		case 0x03:  /*FCOMPP*/
+		if (decode.modrm.reg == 0x03) {		/*FCOMPP*/
 			if(decode.modrm.rm != 1) {
 				LOG(LOG_FPU,LOG_WARN)("ESC 6:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
 				return;
 			}
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_add_imm(FC_OP2,1);
-			gen_and_imm(FC_OP2,7);
-			gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FCOM,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP); /* extra pop at the bottom*/
-			break;
-		case 0x04:  /* FSUBRP STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FSUBR,FC_OP1,FC_OP2);
-			break;
-		case 0x05:  /* FSUBP  STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FSUB,FC_OP1,FC_OP2);
-			break;
-		case 0x06:	/* FDIVRP STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FDIVR,FC_OP1,FC_OP2);
-			break;
-		case 0x07:  /* FDIVP STi,ST*/
-			dyn_fpu_top_swapped();
-			gen_call_function_RR((void*)&FPU_FDIV,FC_OP1,FC_OP2);
-			break;
-		default:
-			break;
-		}
-		gen_call_function_raw((void*)&FPU_FPOP);		
+			gen_call_function_raw((void*)&FPU_FCOMPP);
+		} else dyn_fpu_sti(dyn_fpu_arith_sti_st_pop[decode.modrm.reg]);
 	} else {
-		dyn_fill_ea(FC_ADDR);
-		gen_call_function_R((void*)&FPU_FLD_I16_EA,FC_ADDR); 
-		gen_mov_word_to_reg(FC_OP1,(void*)(&TOP),true);
-		dyn_eatree();
+		dyn_fpu_ea(dyn_fpu_arith_I16[decode.modrm.reg]);
 	}
 }
 
@@ -604,19 +495,14 @@ static void dyn_fpu_esc7(){
 	if (decode.modrm.val >= 0xc0) { 
 		switch (decode.modrm.reg){
 		case 0x00: /* FFREEP STi */
-			dyn_fpu_top();
-			gen_call_function_R((void*)&FPU_FFREE,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_sti(FPU_FFREEP_STi);
 			break;
 		case 0x01: /* FXCH STi*/
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FXCH,FC_OP1,FC_OP2);
+			dyn_fpu_sti(FPU_FXCH_STi);
 			break;
 		case 0x02:  /* FSTP STi*/
 		case 0x03:  /* FSTP STi*/
-			dyn_fpu_top();
-			gen_call_function_RR((void*)&FPU_FST,FC_OP1,FC_OP2);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_sti(FPU_FSTP_STi);
 			break;
 		case 0x04:
 			switch(decode.modrm.rm){
@@ -638,44 +524,28 @@ static void dyn_fpu_esc7(){
 	} else {
 		switch(decode.modrm.reg){
 		case 0x00:  /* FILD Bit16s */
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1); 
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FLD_I16,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FLD_I16_PUSH);
 			break;
 		case 0x01:
 			LOG(LOG_FPU,LOG_WARN)("ESC 7 EA:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
 			break;
 		case 0x02:   /* FIST Bit16s */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_I16,FC_ADDR);
+			dyn_fpu_ea(FPU_FST_I16);
 			break;
 		case 0x03:	/* FISTP Bit16s */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_I16,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_I16);
 			break;
 		case 0x04:   /* FBLD packed BCD */
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1);
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FBLD,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FBLD_PUSH);
 			break;
 		case 0x05:  /* FILD Bit64s */
-			gen_call_function_raw((void*)&FPU_PREP_PUSH);
-			dyn_fill_ea(FC_OP1);
-			gen_mov_word_to_reg(FC_OP2,(void*)(&TOP),true);
-			gen_call_function_RR((void*)&FPU_FLD_I64,FC_OP1,FC_OP2);
+			dyn_fpu_ea(FPU_FLD_I64_PUSH);
 			break;
 		case 0x06:	/* FBSTP packed BCD */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FBST,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FBSTP);
 			break;
 		case 0x07:  /* FISTP Bit64s */
-			dyn_fill_ea(FC_ADDR); 
-			gen_call_function_R((void*)&FPU_FST_I64,FC_ADDR);
-			gen_call_function_raw((void*)&FPU_FPOP);
+			dyn_fpu_ea(FPU_FSTP_I64);
 			break;
 		default:
 			LOG(LOG_FPU,LOG_WARN)("ESC 7 EA:Unhandled group %d subfunction %d",decode.modrm.reg,decode.modrm.rm);
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+
+
+#include "dosbox.h"
+#if C_FPU
+
+#include "mem.h"
+#include "mmx.h"
+
+
+// the immediates hold the opcode byte above the register numbers
+
+static void dyn_mmx_op_reg(Bitu code) {
+	Bitu dest=(code>>3)&7;
+	MMX_Enter();
+	MMX_Store(dest,MMX_Ops[(code>>6)-0x60](MMX_Load(dest),MMX_Load(code&7)));
+}
+
+static void dyn_mmx_op_mem(PhysPt addr,Bitu code) {
+	Bit64u src=(Bit64u)mem_readd(addr) | ((Bit64u)mem_readd(addr+4) << 32);
+	Bitu dest=code&7;
+	MMX_Enter();
+	MMX_Store(dest,MMX_Ops[(code>>3)-0x60](MMX_Load(dest),src));
+}
+
+static void dyn_mmx_op_imm(Bitu code,Bitu imm) {
+	Bitu dest=code&7;
+	MMX_Enter();
+	MMX_Store(dest,MMX_Ops[(code>>3)-0x60](MMX_Load(dest),imm));
+}
+
+static void dyn_mmx_movd_from_reg(Bitu code) {
+	MMX_Enter();
+	MMX_Store((code>>3)&7,reg_32(code&7));
+}
+
+static void dyn_mmx_movd_from_mem(PhysPt addr,Bitu reg) {
+	Bit32u val=mem_readd(addr);
+	MMX_Enter();
+	MMX_Store(reg,val);
+}
+
+static void dyn_mmx_movd_to_reg(Bitu code) {
+	MMX_Enter();
+	reg_32(code&7)=(Bit32u)MMX_Load((code>>3)&7);
+}
+
+static void dyn_mmx_movd_to_mem(PhysPt addr,Bitu reg) {
+	MMX_Enter();
+	mem_writed(addr,(Bit32u)MMX_Load(reg));
+}
+
+static void dyn_mmx_movq_to_mem(PhysPt addr,Bitu reg) {
+	MMX_Enter();
+	Bit64u val=MMX_Load(reg);
+	mem_writed(addr,(Bit32u)val);
+	mem_writed(addr+4,(Bit32u)(val >> 32));
+}
+
+static void dyn_mmx_emms(void) {
+	MMX_EMMS();
+}
+
+
+// 'op mm,mm/m64', the register form of movq mm/m64,mm swaps the operands
+static void dyn_mmx_pq_qq(Bitu opcode) {
+	dyn_get_modrm();
+	Bitu dest=decode.modrm.reg;
+	Bitu src=decode.modrm.rm;
+	if (decode.modrm.mod==3) {
+		if (opcode==0x7f) {
+			dest=decode.modrm.rm;
+			src=decode.modrm.reg;
+		}
+		gen_call_function_I((void *)&dyn_mmx_op_reg,(opcode<<6)|(dest<<3)|src);
+	} else {
+		dyn_fill_ea(FC_ADDR);
+		if (opcode==0x7f) gen_call_function_RI((void *)&dyn_mmx_movq_to_mem,FC_ADDR,dest);
+		else gen_call_function_RI((void *)&dyn_mmx_op_mem,FC_ADDR,(opcode<<3)|dest);
+	}
+}
+
+// 'movd mm,r/m32' and 'movd r/m32,mm'
+static void dyn_mmx_movd(bool to_mmx) {
+	dyn_get_modrm();
+	if (decode.modrm.mod==3) {
+		gen_call_function_I(to_mmx ? (void *)&dyn_mmx_movd_from_reg : (void *)&dyn_mmx_movd_to_reg,
+			(decode.modrm.reg<<3)|decode.modrm.rm);
+	} else {
+		dyn_fill_ea(FC_ADDR);
+		gen_call_function_RI(to_mmx ? (void *)&dyn_mmx_movd_from_mem : (void *)&dyn_mmx_movd_to_mem,
+			FC_ADDR,decode.modrm.reg);
+	}
+}
+
+// shift groups 0x71-0x73 'op mm,imm8', returns false for an invalid encoding
+static bool dyn_mmx_shift_imm(Bitu opcode) {
+	dyn_get_modrm();
+	if (decode.modrm.mod!=3) return false;
+	Bitu shift;
+	switch (decode.modrm.reg) {
+		case 0x02:shift=0xd0;break;		// psrl
+		case 0x04:shift=0xe0;break;		// psra
+		case 0x06:shift=0xf0;break;		// psll
+		default:return false;
+	}
+	shift+=opcode-0x70;
+	if (!MMX_Ops[shift-0x60]) return false;
+	gen_call_function_II((void *)&dyn_mmx_op_imm,(shift<<3)|decode.modrm.rm,decode_fetchb());
+	return true;
+}
+
+#endif
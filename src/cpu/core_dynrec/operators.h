@@ -391,44 +391,61 @@ static void DRC_CALL_CONV dynrec_test_dword_simple(Bit32u op1,Bit32u op2) {
 }
 
 
+// remember the lazy flags the current instruction sets, a conditional branch
+// right behind it can test them directly (see dyn_branchflag_to_reg)
+static void dyn_set_flags_type(Bitu flags_type) {
+	decode.flags_op=decode.op_start;
+	decode.flags_type=flags_type;
+}
+
 static void dyn_dop_byte_gencall(DualOps op) {
+	dyn_call_keeps_regs();
 	switch (op) {
 		case DOP_ADD:
 			InvalidateFlags((void*)&dynrec_add_byte_simple,t_ADDb);
+			dyn_set_flags_type(t_ADDb);
 			gen_call_function_raw((void*)&dynrec_add_byte);
 			break;
 		case DOP_ADC:
 			AcquireFlags(FLAG_CF);
 			InvalidateFlagsPartially((void*)&dynrec_adc_byte_simple,t_ADCb);
+			dyn_set_flags_type(t_ADCb);
 			gen_call_function_raw((void*)&dynrec_adc_byte);
 			break;
 		case DOP_SUB:
 			InvalidateFlags((void*)&dynrec_sub_byte_simple,t_SUBb);
+			dyn_set_flags_type(t_SUBb);
 			gen_call_function_raw((void*)&dynrec_sub_byte);
 			break;
 		case DOP_SBB:
 			AcquireFlags(FLAG_CF);
 			InvalidateFlagsPartially((void*)&dynrec_sbb_byte_simple,t_SBBb);
+			dyn_set_flags_type(t_SBBb);
 			gen_call_function_raw((void*)&dynrec_sbb_byte);
 			break;
 		case DOP_CMP:
 			InvalidateFlags((void*)&dynrec_cmp_byte_simple,t_CMPb);
+			dyn_set_flags_type(t_CMPb);
 			gen_call_function_raw((void*)&dynrec_cmp_byte);
 			break;
 		case DOP_XOR:
 			InvalidateFlags((void*)&dynrec_xor_byte_simple,t_XORb);
+			dyn_set_flags_type(t_XORb);
 			gen_call_function_raw((void*)&dynrec_xor_byte);
 			break;
 		case DOP_AND:
 			InvalidateFlags((void*)&dynrec_and_byte_simple,t_ANDb);
+			dyn_set_flags_type(t_ANDb);
 			gen_call_function_raw((void*)&dynrec_and_byte);
 			break;
 		case DOP_OR:
 			InvalidateFlags((void*)&dynrec_or_byte_simple,t_ORb);
+			dyn_set_flags_type(t_ORb);
 			gen_call_function_raw((void*)&dynrec_or_byte);
 			break;
 		case DOP_TEST:
 			InvalidateFlags((void*)&dynrec_test_byte_simple,t_TESTb);
+			dyn_set_flags_type(t_TESTb);
 			gen_call_function_raw((void*)&dynrec_test_byte);
 			break;
 		default: IllegalOptionDynrec("dyn_dop_byte_gencall");
@@ -436,44 +453,54 @@ static void dyn_dop_byte_gencall(DualOps op) {
 }
 
 static void dyn_dop_word_gencall(DualOps op,bool dword) {
+	dyn_call_keeps_regs();
 	if (dword) {
 		switch (op) {
 			case DOP_ADD:
 				InvalidateFlags((void*)&dynrec_add_dword_simple,t_ADDd);
+				dyn_set_flags_type(t_ADDd);
 				gen_call_function_raw((void*)&dynrec_add_dword);
 				break;
 			case DOP_ADC:
 				AcquireFlags(FLAG_CF);
 				InvalidateFlagsPartially((void*)&dynrec_adc_dword_simple,t_ADCd);
+				dyn_set_flags_type(t_ADCd);
 				gen_call_function_raw((void*)&dynrec_adc_dword);
 				break;
 			case DOP_SUB:
 				InvalidateFlags((void*)&dynrec_sub_dword_simple,t_SUBd);
+				dyn_set_flags_type(t_SUBd);
 				gen_call_function_raw((void*)&dynrec_sub_dword);
 				break;
 			case DOP_SBB:
 				AcquireFlags(FLAG_CF);
 				InvalidateFlagsPartially((void*)&dynrec_sbb_dword_simple,t_SBBd);
+				dyn_set_flags_type(t_SBBd);
 				gen_call_function_raw((void*)&dynrec_sbb_dword);
 				break;
 			case DOP_CMP:
 				InvalidateFlags((void*)&dynrec_cmp_dword_simple,t_CMPd);
+				dyn_set_flags_type(t_CMPd);
 				gen_call_function_raw((void*)&dynrec_cmp_dword);
 				break;
 			case DOP_XOR:
 				InvalidateFlags((void*)&dynrec_xor_dword_simple,t_XORd);
+				dyn_set_flags_type(t_XORd);
 				gen_call_function_raw((void*)&dynrec_xor_dword);
 				break;
 			case DOP_AND:
 				InvalidateFlags((void*)&dynrec_and_dword_simple,t_ANDd);
+				dyn_set_flags_type(t_ANDd);
 				gen_call_function_raw((void*)&dynrec_and_dword);
 				break;
 			case DOP_OR:
 				InvalidateFlags((void*)&dynrec_or_dword_simple,t_ORd);
+				dyn_set_flags_type(t_ORd);
 				gen_call_function_raw((void*)&dynrec_or_dword);
 				break;
 			case DOP_TEST:
 				InvalidateFlags((void*)&dynrec_test_dword_simple,t_TESTd);
+				dyn_set_flags_type(t_TESTd);
 				gen_call_function_raw((void*)&dynrec_test_dword);
 				break;
 			default: IllegalOptionDynrec("dyn_dop_dword_gencall");
@@ -482,40 +509,49 @@ static void dyn_dop_word_gencall(DualOps op,bool dword) {
 		switch (op) {
 			case DOP_ADD:
 				InvalidateFlags((void*)&dynrec_add_word_simple,t_ADDw);
+				dyn_set_flags_type(t_ADDw);
 				gen_call_function_raw((void*)&dynrec_add_word);
 				break;
 			case DOP_ADC:
 				AcquireFlags(FLAG_CF);
 				InvalidateFlagsPartially((void*)&dynrec_adc_word_simple,t_ADCw);
+				dyn_set_flags_type(t_ADCw);
 				gen_call_function_raw((void*)&dynrec_adc_word);
 				break;
 			case DOP_SUB:
 				InvalidateFlags((void*)&dynrec_sub_word_simple,t_SUBw);
+				dyn_set_flags_type(t_SUBw);
 				gen_call_function_raw((void*)&dynrec_sub_word);
 				break;
 			case DOP_SBB:
 				AcquireFlags(FLAG_CF);
 				InvalidateFlagsPartially((void*)&dynrec_sbb_word_simple,t_SBBw);
+				dyn_set_flags_type(t_SBBw);
 				gen_call_function_raw((void*)&dynrec_sbb_word);
 				break;
 			case DOP_CMP:
 				InvalidateFlags((void*)&dynrec_cmp_word_simple,t_CMPw);
+				dyn_set_flags_type(t_CMPw);
 				gen_call_function_raw((void*)&dynrec_cmp_word);
 				break;
 			case DOP_XOR:
 				InvalidateFlags((void*)&dynrec_xor_word_simple,t_XORw);
+				dyn_set_flags_type(t_XORw);
 				gen_call_function_raw((void*)&dynrec_xor_word);
 				break;
 			case DOP_AND:
 				InvalidateFlags((void*)&dynrec_and_word_simple,t_ANDw);
+				dyn_set_flags_type(t_ANDw);
 				gen_call_function_raw((void*)&dynrec_and_word);
 				break;
 			case DOP_OR:
 				InvalidateFlags((void*)&dynrec_or_word_simple,t_ORw);
+				dyn_set_flags_type(t_ORw);
 				gen_call_function_raw((void*)&dynrec_or_word);
 				break;
 			case DOP_TEST:
 				InvalidateFlags((void*)&dynrec_test_word_simple,t_TESTw);
+				dyn_set_flags_type(t_TESTw);
 				gen_call_function_raw((void*)&dynrec_test_word);
 				break;
 			default: IllegalOptionDynrec("dyn_dop_word_gencall");
@@ -664,6 +700,7 @@ static Bit32u DRC_CALL_CONV dynrec_neg_dword_simple(Bit32u op) {
 
 
 static void dyn_sop_byte_gencall(SingleOps op) {
+	dyn_call_keeps_regs();
 	switch (op) {
 		case SOP_INC:
 			InvalidateFlagsPartially((void*)&dynrec_inc_byte_simple,t_INCb);
@@ -685,6 +722,7 @@ static void dyn_sop_byte_gencall(SingleOps op) {
 }
 
 static void dyn_sop_word_gencall(SingleOps op,bool dword) {
+	dyn_call_keeps_regs();
 	if (dword) {
 		switch (op) {
 			case SOP_INC:
@@ -1111,7 +1149,15 @@ static Bit32u DRC_CALL_CONV dynrec_sar_dword_simple(Bit32u op1,Bit8u op2) {
 	else return op1 >> op2;
 }
 
-static void dyn_shift_byte_gencall(ShiftOps op) {
+// shifts by a count that is known to be non-zero define all condition flags,
+// a count taken from cl or from memory might be zero and keep the flags
+static void InvalidateFlagsShift(void* current_simple_function,Bitu flags_type,bool count_nonzero) {
+	if (count_nonzero) InvalidateFlags(current_simple_function,flags_type);
+	else InvalidateFlagsPartially(current_simple_function,flags_type);
+}
+
+static void dyn_shift_byte_gencall(ShiftOps op,bool count_nonzero) {
+	dyn_call_keeps_regs();
 	switch (op) {
 		case SHIFT_ROL:
 			InvalidateFlagsPartially((void*)&dynrec_rol_byte_simple,t_ROLb);
@@ -1131,22 +1177,23 @@ static void dyn_shift_byte_gencall(ShiftOps op) {
 			break;
 		case SHIFT_SHL:
 		case SHIFT_SAL:
-			InvalidateFlagsPartially((void*)&dynrec_shl_byte_simple,t_SHLb);
+			InvalidateFlagsShift((void*)&dynrec_shl_byte_simple,t_SHLb,count_nonzero);
 			gen_call_function_raw((void*)&dynrec_shl_byte);
 			break;
 		case SHIFT_SHR:
-			InvalidateFlagsPartially((void*)&dynrec_shr_byte_simple,t_SHRb);
+			InvalidateFlagsShift((void*)&dynrec_shr_byte_simple,t_SHRb,count_nonzero);
 			gen_call_function_raw((void*)&dynrec_shr_byte);
 			break;
 		case SHIFT_SAR:
-			InvalidateFlagsPartially((void*)&dynrec_sar_byte_simple,t_SARb);
+			InvalidateFlagsShift((void*)&dynrec_sar_byte_simple,t_SARb,count_nonzero);
 			gen_call_function_raw((void*)&dynrec_sar_byte);
 			break;
 		default: IllegalOptionDynrec("dyn_shift_byte_gencall");
 	}
 }
 
-static void dyn_shift_word_gencall(ShiftOps op,bool dword) {
+static void dyn_shift_word_gencall(ShiftOps op,bool dword,bool count_nonzero) {
+	dyn_call_keeps_regs();
 	if (dword) {
 		switch (op) {
 			case SHIFT_ROL:
@@ -1167,15 +1214,15 @@ static void dyn_shift_word_gencall(ShiftOps op,bool dword) {
 				break;
 			case SHIFT_SHL:
 			case SHIFT_SAL:
-				InvalidateFlagsPartially((void*)&dynrec_shl_dword_simple,t_SHLd);
+				InvalidateFlagsShift((void*)&dynrec_shl_dword_simple,t_SHLd,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_shl_dword);
 				break;
 			case SHIFT_SHR:
-				InvalidateFlagsPartially((void*)&dynrec_shr_dword_simple,t_SHRd);
+				InvalidateFlagsShift((void*)&dynrec_shr_dword_simple,t_SHRd,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_shr_dword);
 				break;
 			case SHIFT_SAR:
-				InvalidateFlagsPartially((void*)&dynrec_sar_dword_simple,t_SARd);
+				InvalidateFlagsShift((void*)&dynrec_sar_dword_simple,t_SARd,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_sar_dword);
 				break;
 			default: IllegalOptionDynrec("dyn_shift_dword_gencall");
@@ -1200,15 +1247,15 @@ static void dyn_shift_word_gencall(ShiftOps op,bool dword) {
 				break;
 			case SHIFT_SHL:
 			case SHIFT_SAL:
-				InvalidateFlagsPartially((void*)&dynrec_shl_word_simple,t_SHLw);
+				InvalidateFlagsShift((void*)&dynrec_shl_word_simple,t_SHLw,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_shl_word);
 				break;
 			case SHIFT_SHR:
-				InvalidateFlagsPartially((void*)&dynrec_shr_word_simple,t_SHRw);
+				InvalidateFlagsShift((void*)&dynrec_shr_word_simple,t_SHRw,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_shr_word);
 				break;
 			case SHIFT_SAR:
-				InvalidateFlagsPartially((void*)&dynrec_sar_word_simple,t_SARw);
+				InvalidateFlagsShift((void*)&dynrec_sar_word_simple,t_SARw,count_nonzero);
 				gen_call_function_raw((void*)&dynrec_sar_word);
 				break;
 			default: IllegalOptionDynrec("dyn_shift_word_gencall");
@@ -1297,6 +1344,7 @@ static Bit32u DRC_CALL_CONV dynrec_dshr_dword_simple(Bit32u op1,Bit32u op2,Bit8u
 }
 
 static void dyn_dpshift_word_gencall(bool left) {
+	dyn_call_keeps_regs();
 	if (left) {
 		DRC_PTR_SIZE_IM proc_addr=gen_call_function_R3((void*)&dynrec_dshl_word,FC_OP3);
 		InvalidateFlagsPartially((void*)&dynrec_dshl_word_simple,proc_addr,t_DSHLw);
@@ -1307,6 +1355,7 @@ static void dyn_dpshift_word_gencall(bool left) {
 }
 
 static void dyn_dpshift_dword_gencall(bool left) {
+	dyn_call_keeps_regs();
 	if (left) {
 		DRC_PTR_SIZE_IM proc_addr=gen_call_function_R3((void*)&dynrec_dshl_dword,FC_OP3);
 		InvalidateFlagsPartially((void*)&dynrec_dshl_dword_simple,proc_addr,t_DSHLd);
@@ -1354,6 +1403,12 @@ static Bit32u DRC_CALL_CONV dynrec_get_nzf_and_sf_eq_of(void)	{ return TFLG_NLE;
 
 
 static void dyn_branchflag_to_reg(BranchTypes btype) {
+#ifdef DRC_USE_LFLAGS_CONDITIONS
+	// the instruction before set the flags, the backend may compute the
+	// condition from its operands without the lazy flags evaluation
+	if (decode.flags_type!=t_UNKNOWN && gen_lflags_condition(btype,decode.flags_type)) return;
+#endif
+	dyn_call_keeps_regs();
 	switch (btype) {
 		case BR_O:gen_call_function_raw((void*)&dynrec_get_of);break;
 		case BR_NO:gen_call_function_raw((void*)&dynrec_get_nof);break;
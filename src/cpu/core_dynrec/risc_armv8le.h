@@ -43,6 +43,20 @@
 #define DRC_USE_REGS_ADDR
 // use FC_SEGS_ADDR to hold the address of "Segs" and to access it using FC_SEGS_ADDR
 #define DRC_USE_SEGS_ADDR
+// DRC_USE_TLB_READ, DRC_USE_DIRECT_LINKS and DRC_USE_LFLAGS_CONDITIONS have not
+// been run on an ARMv8 host yet (tests/Makefile: make check under qemu-aarch64),
+// leave them undefined for the plain code of the earlier backend
+#if defined(USE_FULL_TLB)
+// use tlb_read_addr to hold the address of "paging.tlb.read" (or "paging.tlb_dir") and read memory inline (see gen_read_tlb_fast)
+#define DRC_USE_TLB_READ
+#endif
+// jump directly to linked blocks, see gen_create_link_branch
+#define DRC_USE_DIRECT_LINKS
+// code cache size in MB that keeps every link within the +-128 MB of b,
+// the cache runs over its size by up to one block
+#define DRC_CACHE_MAX_MB 127
+// compute branch conditions from the lazy flags operands, see gen_lflags_condition
+#define DRC_USE_LFLAGS_CONDITIONS
 
 // register mapping
 typedef Bit8u HostReg;
@@ -195,6 +209,9 @@ typedef Bit8u HostReg;
 // used to hold the address of "core_dynrec.readdata" - filled in function gen_run_code
 #define readdata_addr HOST_r22
 
+// used to hold the address of "paging.tlb.read" or "paging.tlb_dir" - filled in function gen_run_code
+#define tlb_read_addr HOST_r23
+
 
 // instruction encodings
 
@@ -237,6 +254,8 @@ typedef Bit8u HostReg;
 #define SUB_REG_LSL_IMM(dst, src1, src2, imm) (0x4b000000 + (dst) + ((src1) << 5) + ((src2) << 16) + ((imm) << 10) )
 // cmp src, #(imm lsl simm)		@	0 <= imm <= 4095	&	simm = 0/12
 #define CMP_IMM(src, imm, simm) (0x7100001f + ((src) << 5) + ((imm) << 10) + ((simm)?0x00400000:0) )
+// cmp src1, src2, lsl #imm		@	0 <= imm <= 31
+#define CMP_REG_LSL_IMM(src1, src2, imm) (0x6b00001f + ((src1) << 5) + ((src2) << 16) + ((imm) << 10) )
 // nop
 #define NOP (0xd503201f)
 
@@ -251,6 +270,8 @@ typedef Bit8u HostReg;
 #define BIC_REG_LSL_IMM(dst, src1, src2, imm) (0x0a200000 + (dst) + ((src1) << 5) + ((src2) << 16) + ((imm) << 10) )
 // and dst, src1, src2, lsl #imm		@	0 <= imm <= 63
 #define AND64_REG_LSL_IMM(dst, src1, src2, imm) (0x8a000000 + (dst) + ((src1) << 5) + ((src2) << 16) + ((imm) << 10) )
+// tst src1, src2, lsl #imm		@	0 <= imm <= 31
+#define TST_REG_LSL_IMM(src1, src2, imm) (0x6a00001f + ((src1) << 5) + ((src2) << 16) + ((imm) << 10) )
 
 // load
 // ldr reg, [pc, #imm]		@	-1M <= imm < 1M	&	imm mod 4 = 0
@@ -267,6 +288,12 @@ typedef Bit8u HostReg;
 #define LDRB_IMM(reg, addr, imm) (0x39400000 + (reg) + ((addr) << 5) + ((imm) << 10) )
 // ldr reg, [addr1, addr2, lsl #imm]		@	imm = 0/2
 #define LDR64_REG_LSL_IMM(reg, addr1, addr2, imm) (0xf8606800 + (reg) + ((addr1) << 5) + ((addr2) << 16) + ((imm)?0x00001000:0) )
+// ldr reg, [addr1, addr2, uxtw]
+#define LDR_REG_UXTW(reg, addr1, addr2) (0xb8604800 + (reg) + ((addr1) << 5) + ((addr2) << 16) )
+// ldrh reg, [addr1, addr2, uxtw]
+#define LDRH_REG_UXTW(reg, addr1, addr2) (0x78604800 + (reg) + ((addr1) << 5) + ((addr2) << 16) )
+// ldrb reg, [addr1, addr2, uxtw]
+#define LDRB_REG_UXTW(reg, addr1, addr2) (0x38604800 + (reg) + ((addr1) << 5) + ((addr2) << 16) )
 // ldur reg, [addr, #imm]		@	-256 <= imm < 256
 #define LDUR64_IMM(reg, addr, imm) (0xf8400000 + (reg) + ((addr) << 5) + (((imm) << 12) & 0x001ff000) )
 // ldur reg, [addr, #imm]		@	-256 <= imm < 256
@@ -301,6 +328,8 @@ typedef Bit8u HostReg;
 #define BGT_FWD(imm) (0x5400000c + ((imm) << 3) )
 // b pc+imm		@	0 <= imm < 128M	&	imm mod 4 = 0
 #define B_FWD(imm) (0x14000000 + ((imm) >> 2) )
+// b pc+imm		@	-128M <= imm < 128M	&	imm mod 4 = 0
+#define B_REL(imm) (0x14000000 + (((imm) >> 2) & 0x03ffffff) )
 // br reg
 #define BR(reg) (0xd61f0000 + ((reg) << 5) )
 // blr reg
@@ -309,11 +338,19 @@ typedef Bit8u HostReg;
 #define CBZ_FWD(reg, imm) (0x34000000 + (reg) + ((imm) << 3) )
 // cbnz reg, pc+imm		@	0 <= imm < 1M	&	imm mod 4 = 0
 #define CBNZ_FWD(reg, imm) (0x35000000 + (reg) + ((imm) << 3) )
+// cbz reg, pc+imm (64-bit register)		@	0 <= imm < 1M	&	imm mod 4 = 0
+#define CBZ64_FWD(reg, imm) (0xb4000000 + (reg) + ((imm) << 3) )
 // ret reg
 #define RET_REG(reg) (0xd65f0000 + ((reg) << 5) )
 // ret
 #define RET RET_REG(HOST_x30)
 
+// conditional select
+// csinc dst, src1, src2, cond
+#define CSINC(dst, src1, src2, cond) (0x1a800400 + (dst) + ((src1) << 5) + ((cond) << 12) + ((src2) << 16) )
+// cset dst, cond
+#define CSET(dst, cond) CSINC(dst, HOST_wzr, HOST_wzr, (cond) ^ 1)
+
 // extend
 // sxth dst, src
 #define SXTH(dst, src) SBFM(dst, src, 0, 15)
@@ -875,13 +912,55 @@ static void INLINE gen_fill_branch_long(DRC_PTR_SIZE_IM data) {
 	*(Bit32u*)data=( (*(Bit32u*)data) & 0xfc000000 ) | ( ( ((Bit64u)cache.pos - data) >> 2 ) & 0x03ffffff );
 }
 
+#ifdef DRC_USE_TLB_READ
+// read size bytes from the guest address in addr_reg into dest_reg through
+// the TLB read table, falls through to the code that follows (the call of
+// the memory read function) if the page is not directly readable or the
+// access crosses a page boundary, returns the jump over that code which
+// has to be filled in with gen_fill_branch_long()
+static DRC_PTR_SIZE_IM gen_read_tlb_fast(HostReg dest_reg,HostReg addr_reg,Bitu size) {
+	DRC_PTR_SIZE_IM cross_page=0;
+#if defined(USE_BANKED_TLB)
+	cache_addd( UBFM(temp1, addr_reg, 12+TLB_BANK_SHIFT, 31) );         // lsr temp1, addr_reg, #(12+TLB_BANK_SHIFT)
+	cache_addd( LDR64_REG_LSL_IMM(temp1, tlb_read_addr, temp1, 1) );    // ldr temp1, [tlb_read_addr, temp1, lsl #3]
+	cache_addd( UBFM(temp2, addr_reg, 12, 11+TLB_BANK_SHIFT) );         // ubfx temp2, addr_reg, #12, #TLB_BANK_SHIFT
+	cache_addd( LDR64_REG_LSL_IMM(temp1, temp1, temp2, 1) );            // ldr temp1, [temp1, temp2, lsl #3]
+#else
+	cache_addd( UBFM(temp1, addr_reg, 12, 31) );                        // lsr temp1, addr_reg, #12
+	cache_addd( LDR64_REG_LSL_IMM(temp1, tlb_read_addr, temp1, 1) );    // ldr temp1, [tlb_read_addr, temp1, lsl #3]
+#endif
+	cache_addd( CBZ64_FWD(temp1, 0) );                                  // cbz temp1, slow
+	DRC_PTR_SIZE_IM not_direct=(DRC_PTR_SIZE_IM)cache.pos-4;
+	if (size>1) {
+		cache_addd( UBFM(temp2, addr_reg, 0, 11) );                     // and temp2, addr_reg, #0xfff
+		cache_addd( CMP_IMM(temp2, 4096-size, 0) );                     // cmp temp2, #(4096-size)
+		cache_addd( BGT_FWD(0) );                                       // bgt slow
+		cross_page=(DRC_PTR_SIZE_IM)cache.pos-4;
+	}
+	switch (size) {
+		case 1: cache_addd( LDRB_REG_UXTW(dest_reg, temp1, addr_reg) ); break;   // ldrb dest_reg, [temp1, addr_reg, uxtw]
+		case 2: cache_addd( LDRH_REG_UXTW(dest_reg, temp1, addr_reg) ); break;   // ldrh dest_reg, [temp1, addr_reg, uxtw]
+		default: cache_addd( LDR_REG_UXTW(dest_reg, temp1, addr_reg) ); break;   // ldr dest_reg, [temp1, addr_reg, uxtw]
+	}
+	cache_addd( B_FWD(0) );                                             // b done
+	DRC_PTR_SIZE_IM done=(DRC_PTR_SIZE_IM)cache.pos-4;
+	gen_fill_branch(not_direct);
+	if (cross_page) gen_fill_branch(cross_page);
+	return done;
+}
+#endif
+
 static void gen_run_code(void) {
 	Bit8u *pos1, *pos2, *pos3;
+#ifdef DRC_USE_TLB_READ
+	Bit8u *pos4;
+#endif
 
-	cache_addd( 0xa9bd7bfd );                                           // stp fp, lr, [sp, #-48]!
+	cache_addd( 0xa9bc7bfd );                                           // stp fp, lr, [sp, #-64]!
 	cache_addd( 0x910003fd );                                           // mov fp, sp
 	cache_addd( STP64_IMM(FC_ADDR, FC_REGS_ADDR, HOST_sp, 16) );        // stp FC_ADDR, FC_REGS_ADDR, [sp, #16]
 	cache_addd( STP64_IMM(FC_SEGS_ADDR, readdata_addr, HOST_sp, 32) );  // stp FC_SEGS_ADDR, readdata_addr, [sp, #32]
+	cache_addd( STR64_IMM(tlb_read_addr, HOST_sp, 48) );                // str tlb_read_addr, [sp, #48]
 
 	pos1 = cache.pos;
 	cache_addd( 0 );
@@ -889,6 +968,10 @@ static void gen_run_code(void) {
 	cache_addd( 0 );
 	pos3 = cache.pos;
 	cache_addd( 0 );
+#ifdef DRC_USE_TLB_READ
+	pos4 = cache.pos;
+	cache_addd( 0 );
+#endif
 
 	cache_addd( BR(HOST_x0) );			// br x0
 
@@ -906,6 +989,15 @@ static void gen_run_code(void) {
 	*(Bit32u *)pos3 = LDR64_PC(readdata_addr, cache.pos - pos3);  // ldr readdata_addr, [pc, #(&core_dynrec.readdata)]
 	cache_addq((Bit64u)&core_dynrec.readdata);      // address of "core_dynrec.readdata"
 
+#ifdef DRC_USE_TLB_READ
+	*(Bit32u *)pos4 = LDR64_PC(tlb_read_addr, cache.pos - pos4);  // ldr tlb_read_addr, [pc, #(&paging.tlb.read)]
+#if defined(USE_BANKED_TLB)
+	cache_addq((Bit64u)&paging.tlb_dir[0]);         // address of "paging.tlb_dir"
+#else
+	cache_addq((Bit64u)&paging.tlb.read[0]);        // address of "paging.tlb.read"
+#endif
+#endif
+
 	// align cache.pos to 32 bytes
 	if ((((Bitu)cache.pos) & 0x1f) != 0) {
 		cache.pos = cache.pos + (32 - (((Bitu)cache.pos) & 0x1f));
@@ -916,7 +1008,8 @@ static void gen_run_code(void) {
 static void gen_return_function(void) {
 	cache_addd( LDP64_IMM(FC_ADDR, FC_REGS_ADDR, HOST_sp, 16) );        // ldp FC_ADDR, FC_REGS_ADDR, [sp, #16]
 	cache_addd( LDP64_IMM(FC_SEGS_ADDR, readdata_addr, HOST_sp, 32) );  // ldp FC_SEGS_ADDR, readdata_addr, [sp, #32]
-	cache_addd( 0xa8c37bfd );                                           // ldp fp, lr, [sp], #48
+	cache_addd( LDR64_IMM(tlb_read_addr, HOST_sp, 48) );                // ldr tlb_read_addr, [sp, #48]
+	cache_addd( 0xa8c47bfd );                                           // ldp fp, lr, [sp], #64
 	cache_addd( RET );                                                  // ret
 }
 
@@ -1143,6 +1236,69 @@ static void cache_block_closing(Bit8u* block_start,Bitu block_size) {
 
 static void cache_block_before_close(void) { }
 
+// placeholder for a direct jump to a linked block, the nop falls through
+// to the jump through link[].to until gen_fill_link_branch fills it
+static Bit8u * gen_create_link_branch(void) {
+	Bit8u * pos=cache.pos;
+	cache_addd( NOP );      // nop
+	return pos;
+}
+
+// jump straight to target, or fall through to the indirect jump again when
+// the target is 0 (or out of the range of b)
+static void gen_fill_link_branch(Bit8u * pos,Bit8u * target) {
+	Bit64s offset=(Bit64s)target-(Bit64s)pos;
+	if (target && (offset >= -0x08000000) && (offset < 0x08000000)) {
+		*(Bit32u*)pos=B_REL(offset);        // b target
+	} else {
+		*(Bit32u*)pos=NOP;                  // nop
+	}
+	cache_block_closing(pos,4);
+}
+
+// arm condition codes of the x86 conditions after a compare (the carry is
+// inverted on arm) and after a logical operation (which clears C and V on
+// arm but OF and CF on x86), 0xff where the arm flags don't hold it
+static const Bit8u lflags_sub_conditions[16]={
+	0x6,0x7,0x3,0x2,0x0,0x1,0x9,0x8,		// vs vc cc cs eq ne ls hi
+	0x4,0x5,0xff,0xff,0xb,0xa,0xd,0xc		// mi pl -- -- lt ge le gt
+};
+static const Bit8u lflags_logic_conditions[16]={
+	0xff,0xff,0xff,0xff,0x0,0x1,0x0,0x1,	// -- -- -- -- eq ne eq ne
+	0x4,0x5,0xff,0xff,0xb,0xa,0xd,0xc		// mi pl -- -- lt ge le gt
+};
+
+// the condition btype into FC_RETOP (0 or 1) straight from the operands of
+// the compare, subtraction or logical operation that set the lazy flags,
+// bytes and words are shifted to the top so the arm flags match the x86 ones
+static bool gen_lflags_condition(Bitu btype,Bitu flags_type) {
+	bool logic;
+	Bitu shift;
+	switch (flags_type) {
+		case t_CMPb: case t_SUBb: logic=false; shift=24; break;
+		case t_CMPw: case t_SUBw: logic=false; shift=16; break;
+		case t_CMPd: case t_SUBd: logic=false; shift=0; break;
+		case t_ANDb: case t_ORb: case t_XORb: case t_TESTb: logic=true; shift=24; break;
+		case t_ANDw: case t_ORw: case t_XORw: case t_TESTw: logic=true; shift=16; break;
+		case t_ANDd: case t_ORd: case t_XORd: case t_TESTd: logic=true; shift=0; break;
+		default: return false;
+	}
+	Bit8u cond=logic ? lflags_logic_conditions[btype&15] : lflags_sub_conditions[btype&15];
+	if (cond==0xff) return false;
+	if (logic) {
+		gen_mov_word_to_reg(FC_OP1, &lf_resd, true);
+		if (shift) cache_addd( MOV_REG_LSL_IMM(FC_OP1, FC_OP1, shift) );    // lsl w0, w0, #shift
+		cache_addd( TST_REG_LSL_IMM(FC_OP1, FC_OP1, 0) );          // tst w0, w0
+	} else {
+		gen_mov_word_to_reg(FC_OP1, &lf_var1d, true);
+		gen_mov_word_to_reg(FC_OP2, &lf_var2d, true);
+		if (shift) cache_addd( MOV_REG_LSL_IMM(FC_OP1, FC_OP1, shift) );    // lsl w0, w0, #shift
+		cache_addd( CMP_REG_LSL_IMM(FC_OP1, FC_OP2, shift) );      // cmp w0, w1, lsl #shift
+	}
+	cache_addd( CSET(FC_RETOP, cond) );     // cset w0, cond
+	return true;
+}
+
 #ifdef DRC_USE_SEGS_ADDR
 
 // mov 16bit value from Segs[index] into dest_reg using FC_SEGS_ADDR (index modulo 2 must be zero)
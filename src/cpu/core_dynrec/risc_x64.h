@@ -28,6 +28,14 @@
 #define DRC_FLAGS_INVALIDATION
 // try to replace _simple functions by code
 #define DRC_FLAGS_INVALIDATION_DCODE
+// jump directly to linked blocks, see gen_create_link_branch
+#define DRC_USE_DIRECT_LINKS
+// compute branch conditions from the lazy flags operands, see gen_lflags_condition
+#define DRC_USE_LFLAGS_CONDITIONS
+// access cpu_regs through the gen_mov_regval functions
+#define DRC_USE_REGS_ADDR
+// keep the guest registers in host registers within a block, see gen_regs_get
+#define DRC_USE_REGS_CACHE
 
 // type with the same size as a pointer
 #define DRC_PTR_SIZE_IM Bit64u
@@ -44,6 +52,7 @@ typedef Bit8u HostReg;
 #define HOST_ECX 1
 #define HOST_EDX 2
 #define HOST_EBX 3
+#define HOST_EBP 5
 #define HOST_ESI 6
 #define HOST_EDI 7
 
@@ -80,6 +89,12 @@ typedef Bit8u HostReg;
 // temporary register for LEA
 #define TEMP_REG_DRC HOST_ESI
 
+// register that points to cpu_regs while generated code runs (set up
+// by gen_run_code), the guest registers and other global variables are
+// addressed relative to it instead of through a 64bit address
+#define BASE_REG_DRC HOST_EBP
+#define BASE_ADDR_DRC ((Bit64s)&cpu_regs)
+
 
 // move a full register from reg_src to reg_dst
 static void gen_mov_regs(HostReg reg_dst,HostReg reg_src) {
@@ -95,17 +110,209 @@ static void gen_mov_reg_qword(HostReg dest_reg,Bit64u imm) {
 }
 
 
+#ifdef DRC_USE_REGS_CACHE
+
+// Within a block the guest registers (cpu_regs.regs) are kept in the host
+// registers r12-r15 (the slots). A changed value is written back to cpu_regs
+// before the block is left, before a conditional branch and before calls of
+// helpers that may access the guest registers. r12-r15 are callee-saved, so
+// the values stay in the slots over calls of the other helpers (memory
+// accesses and the lazy flags functions, see gen_regs_keep_next_call).
+
+#define REGS_CACHE_SLOTS	4
+#define REGS_CACHE_BRANCHES	1024
+
+static struct {
+	Bit8u slot[8];					// slot+1 of a guest register, 0 if only in cpu_regs
+	Bit8u guest[REGS_CACHE_SLOTS];	// guest register+1 held in a slot, 0 if unused
+	Bitu age[REGS_CACHE_SLOTS];		// last use of a slot, the oldest one is reused
+	Bitu uses;
+	Bitu dirty;						// guest registers whose value is not in cpu_regs
+	bool unreachable;				// behind a jump or return until a branch target
+	bool keep;						// the next call doesn't access the guest registers
+	bool disabled;					// access the guest registers in cpu_regs only
+	struct {
+		DRC_PTR_SIZE_IM data;		// the branch as returned by gen_create_branch_
+		Bit32u slots;				// slot+1 of each guest register (4 bit) at the branch
+	} branches[REGS_CACHE_BRANCHES];
+	Bitu branch_count;
+	Bitu memory;					// accesses of guest registers in memory generated
+} regs_cache;
+
+// mov r12d+slot,[rbp+guest*4] (store==false) or mov [rbp+guest*4],r12d+slot
+static void gen_regs_move(Bitu slot,Bitu guest,bool store) {
+	cache_addb(0x44);			// rex.r
+	cache_addb(store ? 0x89 : 0x8b);
+	cache_addb(0x40+BASE_REG_DRC+((4+slot)<<3));
+	cache_addb((Bit8u)((Bit64s)DRCD_REG_VAL(guest)-BASE_ADDR_DRC));
+	regs_cache.memory++;
+}
+
+// write a changed guest register back to cpu_regs, it stays in its slot
+static void gen_regs_writeback(Bitu guest) {
+	if (regs_cache.dirty & (1<<guest)) {
+		gen_regs_move(regs_cache.slot[guest]-1,guest,true);
+		regs_cache.dirty&=~(1<<guest);
+	}
+}
+
+static void gen_regs_writeback_all(void) {
+	for (Bitu guest=0;guest<8;guest++) gen_regs_writeback(guest);
+}
+
+// the guest register is accessed in cpu_regs from now on
+static void gen_regs_release(Bitu guest) {
+	if (!regs_cache.slot[guest]) return;
+	gen_regs_writeback(guest);
+	regs_cache.guest[regs_cache.slot[guest]-1]=0;
+	regs_cache.slot[guest]=0;
+}
+
+// empty all slots, the guest registers have been written back already
+static void gen_regs_forget_all(void) {
+	for (Bitu guest=0;guest<8;guest++) regs_cache.slot[guest]=0;
+	for (Bitu slot=0;slot<REGS_CACHE_SLOTS;slot++) regs_cache.guest[slot]=0;
+}
+
+// the slot that holds a guest register, load tells whether the value has to
+// be read from cpu_regs (not when it is overwritten completely)
+static Bitu gen_regs_get(Bitu guest,bool load) {
+	Bitu slot=regs_cache.slot[guest];
+	if (slot) slot--;
+	else {
+		// take a free slot or the one that wasn't used for the longest time
+		for (Bitu i=0;i<REGS_CACHE_SLOTS;i++) {
+			if (!regs_cache.guest[i]) {
+				slot=i;
+				break;
+			}
+			if (regs_cache.age[i]<regs_cache.age[slot]) slot=i;
+		}
+		if (regs_cache.guest[slot]) gen_regs_release(regs_cache.guest[slot]-1);
+		regs_cache.guest[slot]=(Bit8u)(guest+1);
+		regs_cache.slot[guest]=(Bit8u)(slot+1);
+		if (load) gen_regs_move(slot,guest,false);
+	}
+	regs_cache.age[slot]=++regs_cache.uses;
+	return slot;
+}
+
+// an instruction accesses cpu_regs directly, a guest register in it leaves its slot
+static void gen_regs_memory(void* data) {
+	Bit64s index=(Bit64s)data-(Bit64s)&cpu_regs;
+	if ((index>=0) && (index<(Bit64s)sizeof(cpu_regs.regs))) {
+		gen_regs_release((Bitu)index/4);
+		regs_cache.memory++;
+	}
+}
+
+// both paths of a conditional branch start with the guest registers written
+// back and in the same slots, remember the slots for gen_regs_branch_target
+static void gen_regs_branch(DRC_PTR_SIZE_IM data) {
+	Bit32u slots=0;
+	for (Bitu guest=0;guest<8;guest++) slots|=(Bit32u)regs_cache.slot[guest]<<(guest*4);
+	regs_cache.branches[regs_cache.branch_count%REGS_CACHE_BRANCHES].data=data;
+	regs_cache.branches[regs_cache.branch_count%REGS_CACHE_BRANCHES].slots=slots;
+	regs_cache.branch_count++;
+}
+
+// the target of a branch is at the current position: the guest registers in
+// the same slot on both paths stay there, the others are read from cpu_regs
+// again (all of them if the branch dropped out of the table)
+static void gen_regs_branch_target(DRC_PTR_SIZE_IM data) {
+	Bit32u slots=0;
+	for (Bitu i=regs_cache.branch_count;(i>0) && (regs_cache.branch_count-i<REGS_CACHE_BRANCHES);i--) {
+		if (regs_cache.branches[(i-1)%REGS_CACHE_BRANCHES].data==data) {
+			slots=regs_cache.branches[(i-1)%REGS_CACHE_BRANCHES].slots;
+			break;
+		}
+	}
+	if (regs_cache.unreachable) {
+		// only the branch gets here
+		gen_regs_forget_all();
+		for (Bitu guest=0;guest<8;guest++) {
+			Bitu slot=(slots>>(guest*4))&0xf;
+			if (!slot) continue;
+			regs_cache.slot[guest]=(Bit8u)slot;
+			regs_cache.guest[slot-1]=(Bit8u)(guest+1);
+		}
+		regs_cache.unreachable=false;
+	} else {
+		gen_regs_writeback_all();
+		for (Bitu guest=0;guest<8;guest++) {
+			if (regs_cache.slot[guest]!=((slots>>(guest*4))&0xf)) gen_regs_release(guest);
+		}
+	}
+}
+
+// the code continues somewhere else (block exit), the guest registers have
+// to be in cpu_regs
+static void gen_regs_leave(void) {
+	gen_regs_writeback_all();
+}
+
+// the code behind a jump or return is reached through branches only
+static void gen_regs_left(void) {
+	gen_regs_forget_all();
+	regs_cache.unreachable=true;
+}
+
+// a helper is called, unless it is known to leave the guest registers alone
+// they are written back before and taken from cpu_regs again after the call,
+// returns whether the slots have to be emptied after the call
+static bool gen_regs_call(void) {
+	if (regs_cache.keep) {
+		regs_cache.keep=false;
+		return false;
+	}
+	gen_regs_writeback_all();
+	return true;
+}
+
+// the next call neither reads nor changes the guest registers
+static void gen_regs_keep_next_call(void) {
+	regs_cache.keep=true;
+}
+
+// a new block is translated, all guest registers are in cpu_regs
+static void gen_regs_open_block(void) {
+	gen_regs_forget_all();
+	regs_cache.dirty=0;
+	regs_cache.unreachable=false;
+	regs_cache.keep=false;
+	regs_cache.branch_count=0;
+}
+
+#endif
+
 // This function generates an instruction with register addressing and a memory location
 static INLINE void gen_reg_memaddr(HostReg reg,void* data,Bit8u op,Bit8u prefix=0) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_memory(data);
+#endif
 	Bit64s diff = (Bit64s)data-((Bit64s)cache.pos+(prefix?7:6));
-//	if ((diff<0x80000000LL) && (diff>-0x80000000LL)) { //clang messes itself up on this...
-	if ( (diff>>63) == (diff>>31) ) { //signed bit extend, test to see if value fits in a Bit32s
+	Bit64s base_diff = (Bit64s)data-BASE_ADDR_DRC;
+	if ((base_diff>=-128) && (base_diff<=127)) {
+		// mov reg,[rbp+disp8] (or similar, depending on the op) for the guest registers
+		if(prefix) cache_addb(prefix);
+		cache_addb(op);
+		cache_addb(0x40+BASE_REG_DRC+(reg<<3));
+		cache_addb((Bit8u)base_diff);
+//	} else if ((diff<0x80000000LL) && (diff>-0x80000000LL)) { //clang messes itself up on this...
+	} else if ( (diff>>63) == (diff>>31) ) { //signed bit extend, test to see if value fits in a Bit32s
 		// mov reg,[rip+diff] (or similar, depending on the op) to fetch *data
 		if(prefix) cache_addb(prefix);
 		cache_addb(op);
 		cache_addb(0x05+(reg<<3));
 		// RIP-relative addressing is offset after the instruction 
 		cache_addd((Bit32u)(((Bit64u)diff)&0xffffffffLL)); 
+	} else if ( (base_diff>>63) == (base_diff>>31) ) {
+		// mov reg,[rbp+disp32] (or similar, depending on the op) when the code cache
+		// is too far away from the global variables (mmap'd for example)
+		if(prefix) cache_addb(prefix);
+		cache_addb(op);
+		cache_addb(0x80+BASE_REG_DRC+(reg<<3));
+		cache_addd((Bit32u)(((Bit64u)base_diff)&0xffffffffLL));
 	} else if ((Bit64u)data<0x100000000LL) {
 		// mov reg,[data] (or similar, depending on the op) when absolute address of data is <4GB
 		if(prefix) cache_addb(prefix);
@@ -130,9 +337,25 @@ static INLINE void gen_reg_memaddr(HostReg reg,void* data,Bit8u op,Bit8u prefix=
 
 // Same as above, but with immediate addressing and a memory location
 static INLINE void gen_memaddr(Bitu modreg,void* data,Bitu off,Bitu imm,Bit8u op,Bit8u prefix=0) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_memory(data);
+#endif
 	Bit64s diff = (Bit64s)data-((Bit64s)cache.pos+off+(prefix?7:6));
-//	if ((diff<0x80000000LL) && (diff>-0x80000000LL)) {
-	if ( (diff>>63) == (diff>>31) ) {
+	Bit64s base_diff = (Bit64s)data-BASE_ADDR_DRC;
+	if ((base_diff>=-128) && (base_diff<=127)) {
+		// [rbp+disp8] for the guest registers
+		if(prefix) cache_addb(prefix);
+		cache_addw(op+((modreg-4+0x40+BASE_REG_DRC)<<8));
+		cache_addb((Bit8u)base_diff);
+
+		switch(off) {
+			case 1: cache_addb(((Bit8u)imm&0xff)); break;
+			case 2: cache_addw(((Bit16u)imm&0xffff)); break;
+			case 4: cache_addd(((Bit32u)imm&0xffffffff)); break;
+		}
+
+//	} else if ((diff<0x80000000LL) && (diff>-0x80000000LL)) {
+	} else if ( (diff>>63) == (diff>>31) ) {
 		// RIP-relative addressing is offset after the instruction 
 		if(prefix) cache_addb(prefix);
 		cache_addw(op+((modreg+1)<<8));
@@ -144,6 +367,18 @@ static INLINE void gen_memaddr(Bitu modreg,void* data,Bitu off,Bitu imm,Bit8u op
 			case 4: cache_addd(((Bit32u)imm&0xffffffff)); break;
 		}
 
+	} else if ( (base_diff>>63) == (base_diff>>31) ) {
+		// [rbp+disp32] when the code cache is far away from the global variables
+		if(prefix) cache_addb(prefix);
+		cache_addw(op+((modreg-4+0x80+BASE_REG_DRC)<<8));
+		cache_addd((Bit32u)(((Bit64u)base_diff)&0xffffffffLL));
+
+		switch(off) {
+			case 1: cache_addb(((Bit8u)imm&0xff)); break;
+			case 2: cache_addw(((Bit16u)imm&0xffff)); break;
+			case 4: cache_addd(((Bit32u)imm&0xffffffff)); break;
+		}
+
 	} else if ((Bit64u)data<0x100000000LL) {
 		if(prefix) cache_addb(prefix);
 		cache_addw(op+(modreg<<8));
@@ -364,6 +599,11 @@ static INLINE void gen_lea(HostReg dest_reg,Bitu scale,Bits imm) {
 
 // generate a call to a parameterless function
 static void INLINE gen_call_function_raw(void * func) {
+#ifdef DRC_USE_REGS_CACHE
+	// the lazy flags functions (queued by InvalidateFlags, see gen_fill_function_ptr)
+	// keep the guest registers, so nothing is inserted before their call
+	bool forget_regs=gen_regs_call();
+#endif
 //	cache_addb(0x48); 
 //	cache_addw(0xec83); 
 #if defined (_WIN64)
@@ -389,12 +629,18 @@ static void INLINE gen_call_function_raw(void * func) {
 //	cache_addb(0x08);	// add rsp,0x08 (reset alignment)
 	cache_addd(0x08c48348);
 #endif 
+#ifdef DRC_USE_REGS_CACHE
+	if (forget_regs) gen_regs_forget_all();
+#endif
 }
 
 // generate a call to a function with paramcount parameters
 // note: the parameters are loaded in the architecture specific way
 // using the gen_load_param_ functions below
 static Bit64u INLINE gen_call_function_setup(void * func,Bitu paramcount,bool fastcall=false) {
+#ifdef DRC_USE_REGS_CACHE
+	bool forget_regs=gen_regs_call();
+#endif
 	// align the stack
 	cache_addb(0x48);
 	cache_addw(0xc48b);		// mov rax,rsp
@@ -447,6 +693,9 @@ static Bit64u INLINE gen_call_function_setup(void * func,Bitu paramcount,bool fa
 	// restore stack
 	cache_addb(0x5c);		// pop rsp
 
+#ifdef DRC_USE_REGS_CACHE
+	if (forget_regs) gen_regs_forget_all();
+#endif
 	return proc_addr;
 }
 
@@ -585,6 +834,9 @@ static void INLINE gen_load_param_mem(Bitu mem,Bitu param) {
 
 // jump to an address pointed at by ptr, offset is in imm
 static void gen_jmp_ptr(void * ptr,Bits imm=0) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	cache_addw(0xa148);		// mov rax,[data]
 	cache_addq((Bit64u)ptr);
 
@@ -598,33 +850,51 @@ static void gen_jmp_ptr(void * ptr,Bits imm=0) {
 		cache_addb(0xa0);
 		cache_addd(imm);
 	}
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_left();
+#endif
 }
 
 
 // short conditional jump (+-127 bytes) if register is zero
 // the destination is set by gen_fill_branch() later
 static Bit64u gen_create_branch_on_zero(HostReg reg,bool dword) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	if (!dword) cache_addb(0x66);
 	cache_addb(0x0b);					// or reg,reg
 	cache_addb(0xc0+reg+(reg<<3));
 
 	cache_addw(0x0074);					// jz addr
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch((Bit64u)cache.pos-1);
+#endif
 	return ((Bit64u)cache.pos-1);
 }
 
 // short conditional jump (+-127 bytes) if register is nonzero
 // the destination is set by gen_fill_branch() later
 static Bit64u gen_create_branch_on_nonzero(HostReg reg,bool dword) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	if (!dword) cache_addb(0x66);
 	cache_addb(0x0b);					// or reg,reg
 	cache_addb(0xc0+reg+(reg<<3));
 
 	cache_addw(0x0075);					// jnz addr
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch((Bit64u)cache.pos-1);
+#endif
 	return ((Bit64u)cache.pos-1);
 }
 
 // calculate relative offset and fill it into the location pointed to by data
 static void gen_fill_branch(DRC_PTR_SIZE_IM data) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch_target(data);
+#endif
 #if C_DEBUG
 	Bit64s len=(Bit64u)cache.pos-data;
 	if (len<0) len=-len;
@@ -639,45 +909,79 @@ static void gen_fill_branch(DRC_PTR_SIZE_IM data) {
 static Bit64u gen_create_branch_long_nonzero(HostReg reg,bool isdword) {
 	// isdword: cmp reg32,0
 	// not isdword: cmp reg8,0
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	cache_addb(0x0a+(isdword?1:0));				// or reg,reg
 	cache_addb(0xc0+reg+(reg<<3));
 
 	cache_addw(0x850f);		// jnz
 	cache_addd(0);
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch((Bit64u)cache.pos-4);
+#endif
 	return ((Bit64u)cache.pos-4);
 }
 
 // compare 32bit-register against zero and jump if value less/equal than zero
 static Bit64u gen_create_branch_long_leqzero(HostReg reg) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	cache_addw(0xf883+(reg<<8));
 	cache_addb(0x00);		// cmp reg,0
 
 	cache_addw(0x8e0f);		// jle
 	cache_addd(0);
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch((Bit64u)cache.pos-4);
+#endif
 	return ((Bit64u)cache.pos-4);
 }
 
 // calculate long relative offset and fill it into the location pointed to by data
 static void gen_fill_branch_long(Bit64u data) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_branch_target(data);
+#endif
 	*(Bit32u*)data=(Bit32u)((Bit64u)cache.pos-data-4);
 }
 
 
 static void gen_run_code(void) {
 	cache_addb(0x53);					// push rbx
+	cache_addb(0x55);					// push rbp
 #if defined (_WIN64)
 	cache_addw(0x5657);			// push rdi; push rsi
 #endif
+#ifdef DRC_USE_REGS_CACHE
+	cache_addd(0x55415441);		// push r12; push r13
+	cache_addd(0x57415641);		// push r14; push r15
+#endif
+	cache_addd(0x08ec8348);		// sub rsp,0x08 (keep the stack aligned)
+	gen_mov_reg_qword(BASE_REG_DRC,(Bit64u)BASE_ADDR_DRC);	// mov rbp,&cpu_regs
 	cache_addw(0xd0ff+(FC_OP1<<8));		// call rdi
+	cache_addd(0x08c48348);		// add rsp,0x08
+#ifdef DRC_USE_REGS_CACHE
+	cache_addd(0x5e415f41);		// pop r15; pop r14
+	cache_addd(0x5c415d41);		// pop r13; pop r12
+#endif
 #if defined (_WIN64)
 	cache_addw(0x5f5e);			// pop rsi; pop rdi
 #endif
+	cache_addb(0x5d);					// pop  rbp
 	cache_addb(0x5b);					// pop  rbx
 }
 
 // return from a function
 static void gen_return_function(void) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
 	cache_addb(0xc3);		// ret
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_left();
+#endif
 }
 
 #ifdef DRC_FLAGS_INVALIDATION
@@ -818,3 +1122,208 @@ static void gen_fill_function_ptr(Bit8u * pos,void* fct_ptr,Bitu flags_type) {
 static void cache_block_closing(Bit8u* block_start,Bitu block_size) { }
 
 static void cache_block_before_close(void) { }
+
+// placeholder for a direct jump to a linked block, the five byte nop falls
+// through to the jump through link[].to until gen_fill_link_branch fills it
+static Bit8u * gen_create_link_branch(void) {
+#ifdef DRC_USE_REGS_CACHE
+	gen_regs_leave();
+#endif
+	Bit8u * pos=cache.pos;
+	cache_addb(0x0f);		// nop dword [rax+rax*1+0]
+	cache_addd(0x0000441f);
+	return pos;
+}
+
+// jump straight to target, or fall through to the indirect jump again when
+// the target is 0 (or out of the range of a rel32 jump)
+static void gen_fill_link_branch(Bit8u * pos,Bit8u * target) {
+	Bit64s rel=(Bit64s)target-((Bit64s)pos+5);
+	if (target && (rel==(Bit32s)rel)) {
+		*(Bit32s*)(pos+1)=(Bit32s)rel;
+		*pos=0xe9;			// jmp target
+	} else {
+		*(Bit32u*)(pos+1)=0x0000441f;
+		*pos=0x0f;			// nop dword [rax+rax*1+0]
+	}
+}
+
+// the condition btype into FC_RETOP (0 or 1) straight from the operands of
+// the compare, subtraction or logical operation that set the lazy flags,
+// the host instruction of the same size sets the flags like the guest one
+static bool gen_lflags_condition(Bitu btype,Bitu flags_type) {
+	switch (flags_type) {
+		case t_CMPb: case t_SUBb:
+		case t_CMPw: case t_SUBw:
+		case t_CMPd: case t_SUBd:
+			gen_mov_word_to_reg(HOST_EAX,&lf_var1d,true);
+			gen_mov_word_to_reg(HOST_ECX,&lf_var2d,true);
+			if (flags_type==t_CMPw || flags_type==t_SUBw) cache_addb(0x66);
+			if (flags_type==t_CMPb || flags_type==t_SUBb) cache_addw(0xc838);	// cmp al,cl
+			else cache_addw(0xc839);		// cmp eax,ecx
+			break;
+		case t_ANDb: case t_ORb: case t_XORb: case t_TESTb:
+		case t_ANDw: case t_ORw: case t_XORw: case t_TESTw:
+		case t_ANDd: case t_ORd: case t_XORd: case t_TESTd:
+			gen_mov_word_to_reg(HOST_EAX,&lf_resd,true);
+			if (flags_type==t_ANDw || flags_type==t_ORw || flags_type==t_XORw || flags_type==t_TESTw) cache_addb(0x66);
+			if (flags_type==t_ANDb || flags_type==t_ORb || flags_type==t_XORb || flags_type==t_TESTb) cache_addw(0xc084);	// test al,al
+			else cache_addw(0xc085);		// test eax,eax
+			break;
+		default:
+			return false;
+	}
+	// the branch types are the x86 condition codes
+	cache_addw(0x900f+((btype&15)<<8));	// setcc al
+	cache_addb(0xc0);
+	cache_addw(0xb60f);		// movzx eax,al
+	cache_addb(0xc0);
+	return true;
+}
+
+#ifdef DRC_USE_REGS_ADDR
+
+#ifdef DRC_USE_REGS_CACHE
+// the slot of the guest register that holds cpu_regs[index], -1 if the
+// access goes to cpu_regs directly
+static Bits gen_regs_slot(Bitu index,bool load) {
+	if (regs_cache.disabled || (index>=sizeof(cpu_regs.regs))) return -1;
+	return (Bits)gen_regs_get(index/4,load);
+}
+#else
+#define gen_regs_slot(index,load) (-1)
+#endif
+
+// mov 16bit value from cpu_regs[index] into dest_reg (index modulo 2 must be zero)
+// 16bit moves may destroy the upper 16bit of the destination register
+static void gen_mov_regval16_to_reg(HostReg dest_reg,Bitu index) {
+	Bits slot=(index&3) ? -1 : gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_mov_word_to_reg(dest_reg,(Bit8u*)&cpu_regs+index,false);
+		return;
+	}
+	cache_addb(0x41);		// movzx dest_reg,r12w+slot
+	cache_addw(0xb70f);
+	cache_addb(0xc4+(dest_reg<<3)+slot);
+}
+
+// mov 32bit value from cpu_regs[index] into dest_reg (index modulo 4 must be zero)
+static void gen_mov_regval32_to_reg(HostReg dest_reg,Bitu index) {
+	Bits slot=gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_mov_word_to_reg(dest_reg,(Bit8u*)&cpu_regs+index,true);
+		return;
+	}
+	cache_addw(0x8b41);		// mov dest_reg,r12d+slot
+	cache_addb(0xc4+(dest_reg<<3)+slot);
+}
+
+// move a 32bit (dword==true) or 16bit (dword==false) value from cpu_regs[index] into dest_reg (if dword==true index modulo 4 must be zero) (if dword==false index modulo 2 must be zero)
+// 16bit moves may destroy the upper 16bit of the destination register
+static void gen_mov_regword_to_reg(HostReg dest_reg,Bitu index,bool dword) {
+	if (dword) gen_mov_regval32_to_reg(dest_reg,index);
+	else gen_mov_regval16_to_reg(dest_reg,index);
+}
+
+// move an 8bit value from cpu_regs[index] into dest_reg
+// the upper 24bit of the destination register can be destroyed
+// this function does not use FC_OP1/FC_OP2 as dest_reg as these
+// registers might not be directly byte-accessible on some architectures
+static void gen_mov_regbyte_to_reg_low(HostReg dest_reg,Bitu index) {
+	Bits slot=(index&2) ? -1 : gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_mov_byte_to_reg_low(dest_reg,(Bit8u*)&cpu_regs+index);
+		return;
+	}
+	if (index&1) {
+		cache_addw(0x8b41);		// mov dest_reg,r12d+slot
+		cache_addb(0xc4+(dest_reg<<3)+slot);
+		cache_addw(0xe8c1+(dest_reg<<8));	// shr dest_reg,8
+		cache_addb(0x08);
+	} else {
+		cache_addb(0x41);		// movzx dest_reg,r12b+slot
+		cache_addw(0xb60f);
+		cache_addb(0xc4+(dest_reg<<3)+slot);
+	}
+}
+
+// move an 8bit value from cpu_regs[index] into dest_reg
+// the upper 24bit of the destination register can be destroyed
+// this function can use FC_OP1/FC_OP2 as dest_reg which are
+// not directly byte-accessible on some architectures
+static void gen_mov_regbyte_to_reg_low_canuseword(HostReg dest_reg,Bitu index) {
+	gen_mov_regbyte_to_reg_low(dest_reg,index);
+}
+
+
+// add a 32bit value from cpu_regs[index] to a full register (index modulo 4 must be zero)
+static void gen_add_regval32_to_reg(HostReg reg,Bitu index) {
+	Bits slot=gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_add(reg,(Bit8u*)&cpu_regs+index);
+		return;
+	}
+	cache_addw(0x0341);		// add reg,r12d+slot
+	cache_addb(0xc4+(reg<<3)+slot);
+}
+
+
+// move 16bit of register into cpu_regs[index] (index modulo 2 must be zero)
+static void gen_mov_regval16_from_reg(HostReg src_reg,Bitu index) {
+	Bits slot=(index&3) ? -1 : gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_mov_word_from_reg(src_reg,(Bit8u*)&cpu_regs+index,false);
+		return;
+	}
+	cache_addw(0x4466);		// mov r12w+slot,src_reg
+	cache_addb(0x8b);
+	cache_addb(0xe0+(slot<<3)+src_reg);
+#ifdef DRC_USE_REGS_CACHE
+	regs_cache.dirty|=1<<(index/4);
+#endif
+}
+
+// move 32bit of register into cpu_regs[index] (index modulo 4 must be zero)
+static void gen_mov_regval32_from_reg(HostReg src_reg,Bitu index) {
+	Bits slot=gen_regs_slot(index,false);
+	if (slot<0) {
+		gen_mov_word_from_reg(src_reg,(Bit8u*)&cpu_regs+index,true);
+		return;
+	}
+	cache_addw(0x8b44);		// mov r12d+slot,src_reg
+	cache_addb(0xe0+(slot<<3)+src_reg);
+#ifdef DRC_USE_REGS_CACHE
+	regs_cache.dirty|=1<<(index/4);
+#endif
+}
+
+// move 32bit (dword==true) or 16bit (dword==false) of a register into cpu_regs[index] (if dword==true index modulo 4 must be zero) (if dword==false index modulo 2 must be zero)
+static void gen_mov_regword_from_reg(HostReg src_reg,Bitu index,bool dword) {
+	if (dword) gen_mov_regval32_from_reg(src_reg,index);
+	else gen_mov_regval16_from_reg(src_reg,index);
+}
+
+// move the lowest 8bit of a register into cpu_regs[index]
+static void gen_mov_regbyte_from_reg_low(HostReg src_reg,Bitu index) {
+	Bits slot=(index&2) ? -1 : gen_regs_slot(index,true);
+	if (slot<0) {
+		gen_mov_byte_from_reg_low(src_reg,(Bit8u*)&cpu_regs+index);
+		return;
+	}
+	// the high byte is rotated into the low byte of the slot and back
+	if (index&1) {
+		cache_addw(0xc141);		// ror r12d+slot,8
+		cache_addw(0x08cc+slot);
+	}
+	cache_addw(0x8a44);		// mov r12b+slot,src_reg (rex: sil/dil instead of dh/bh)
+	cache_addb(0xe0+(slot<<3)+src_reg);
+	if (index&1) {
+		cache_addw(0xc141);		// rol r12d+slot,8
+		cache_addw(0x08c4+slot);
+	}
+#ifdef DRC_USE_REGS_CACHE
+	regs_cache.dirty|=1<<(index/4);
+#endif
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "lazyflags.h"
 #include "paging.h"
 #include "fpu.h"
+#include "mmx.h"
 #include "debug.h"
 #include "inout.h"
 #include "callback.h"
@@ -175,6 +175,7 @@ l_M_Ed:
 			inst_op2_d=LoadMw(inst.rm_eaa+4);
 			break;
 		case M_EA:
+			if (inst.rm>=0xc0) goto illegalopcode;
 			inst_op1_d=inst.rm_off;
 			break;
 		case M_POPw:
@@ -186,12 +187,12 @@ l_M_Ed:
 		case M_GRP:
 			inst.code=Groups[inst.code.op][inst.rm_index];
 			goto l_MODRMswitch;
-		case M_GRP_Ib:
-			inst_op2_d=Fetchb();
+		case M_GRP_Ib:		/* the shift groups, the count is taken mod 32 */
+			inst_op2_d=Fetchb()&0x1f;
 			inst.code=Groups[inst.code.op][inst.rm_index];
 			goto l_MODRMswitch;
 		case M_GRP_CL:
-			inst_op2_d=reg_cl;
+			inst_op2_d=reg_cl&0x1f;
 			inst.code=Groups[inst.code.op][inst.rm_index];
 			goto l_MODRMswitch;
 		case M_GRP_1:
@@ -502,11 +503,20 @@ l_M_Ed:
 		continue;
 	case D_RDTSC: {
 		if (CPU_ArchitectureType<CPU_ARCHTYPE_PENTIUMSLOW) goto illegalopcode;
-		Bit64s tsc=(Bit64s)(PIC_FullIndex()*(double)(CPU_CycleAutoAdjust?70000:CPU_CycleMax));
+		Bit64u tsc=CPU_ReadTimeStamp();
 		reg_edx=(Bit32u)(tsc>>32);
 		reg_eax=(Bit32u)(tsc&0xffffffff);
 		break;
 		}
+	case D_EMMS:
+#if C_FPU
+		if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+		MMX_Sync();
+		MMX_EMMS();
+		goto nextopcode;
+#else
+		goto illegalopcode;
+#endif
 	default:
 		LOG(LOG_CPU,LOG_ERROR)("LOAD:Unhandled code %d opcode %X",inst.code.load,inst.entry);
 		goto illegalopcode;
@@ -391,6 +391,7 @@ switch (inst.code.op) {
 		goto nextopcode;
 	case O_CBACK:
 		FillFlags();SaveIP();
+		if (CALLBACK_RunLeaf(inst_op1_d)) continue;
 		return inst_op1_d;
 	case O_GRP6w:
 	case O_GRP6d:
@@ -610,8 +611,34 @@ switch (inst.code.op) {
 		if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegalopcode;
 		BSWAPD(inst_op1_d);
 		break;
+	case O_CMPXCHGb:
+		if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegalopcode;
+		FillFlags();
+		if (inst_op1_b==reg_al) {
+			inst_op1_b=reg_8(inst.rm_index);
+			if (inst.rm<0xc0) SaveMb(inst.rm_eaa,inst_op1_b);	// early write-pf
+			SETFLAGBIT(ZF,1);
+		} else {
+			if (inst.rm<0xc0) SaveMb(inst.rm_eaa,inst_op1_b);	// early write-pf
+			reg_al=inst_op1_b;
+			SETFLAGBIT(ZF,0);
+		}
+		break;
+	case O_CMPXCHGw:
+		if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegalopcode;
+		FillFlags();
+		if (inst_op1_w==reg_ax) {
+			inst_op1_w=reg_16(inst.rm_index);
+			if (inst.rm<0xc0) SaveMw(inst.rm_eaa,inst_op1_w);	// early write-pf
+			SETFLAGBIT(ZF,1);
+		} else {
+			if (inst.rm<0xc0) SaveMw(inst.rm_eaa,inst_op1_w);	// early write-pf
+			reg_ax=inst_op1_w;
+			SETFLAGBIT(ZF,0);
+		}
+		break;
 	case O_CMPXCHG:
-		if (CPU_ArchitectureType<CPU_ARCHTYPE_486NEWSLOW) goto illegalopcode;
+		if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegalopcode;
 		FillFlags();
 		if (inst_op1_d==reg_eax) {
 			inst_op1_d=reg_32(inst.rm_index);
@@ -623,6 +650,57 @@ switch (inst.code.op) {
 			SETFLAGBIT(ZF,0);
 		}
 		break;
+	case O_MMX:
+#if C_FPU
+		if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegalopcode;
+		MMX_Sync();
+		switch (inst.entry&0xff) {
+		case 0x6e:												/* MOVD Pq,Ed */
+			{
+				Bit32u val=(inst.rm>=0xc0) ? reg_32(inst.rm_eai) : LoadMd(inst.rm_eaa);
+				MMX_Enter();
+				MMX_Store(inst.rm_index,val);
+			}
+			break;
+		case 0x7e:												/* MOVD Ed,Pq */
+			MMX_Enter();
+			if (inst.rm>=0xc0) reg_32(inst.rm_eai)=(Bit32u)MMX_Load(inst.rm_index);
+			else SaveMd(inst.rm_eaa,(Bit32u)MMX_Load(inst.rm_index));
+			break;
+		case 0x7f:												/* MOVQ Qq,Pq */
+			MMX_Enter();
+			if (inst.rm>=0xc0) MMX_Store(inst.rm_eai,MMX_Load(inst.rm_index));
+			else {
+				Bit64u val=MMX_Load(inst.rm_index);
+				SaveMd(inst.rm_eaa,(Bit32u)val);
+				SaveMd(inst.rm_eaa+4,(Bit32u)(val >> 32));
+			}
+			break;
+		case 0x71:case 0x72:case 0x73:							/* PSRLx/PSRAx/PSLLx Nq,Ib */
+			{
+				/* The /2 /4 /6 forms shift like the 0xdx 0xex 0xfx ones */
+				MMX_Op op=0;
+				if (inst.rm_index>=2 && !(inst.rm_index&1)) op=MMX_Ops[0x70+(inst.rm_index-2)*8+(inst.entry&0xf)];
+				if (inst.rm<0xc0 || !op) goto illegalopcode;
+				Bit64u count=Fetchb();
+				MMX_Enter();
+				MMX_Store(inst.rm_eai,op(MMX_Load(inst.rm_eai),count));
+			}
+			break;
+		default:												/* op Pq,Qq */
+			{
+				Bit64u src;
+				if (inst.rm>=0xc0) src=MMX_Load(inst.rm_eai);
+				else src=(Bit64u)LoadMd(inst.rm_eaa) | ((Bit64u)LoadMd(inst.rm_eaa+4) << 32);
+				MMX_Enter();
+				MMX_Store(inst.rm_index,MMX_Ops[(inst.entry&0xff)-0x60](MMX_Load(inst.rm_index),src));
+			}
+			break;
+		}
+		goto nextopcode;
+#else
+		goto illegalopcode;
+#endif
 	case O_FPU:
 #if C_FPU
 		switch (((inst.rm>=0xc0) << 3) | inst.code.save) {
@@ -267,27 +267,27 @@ static OpCode OpCodeTable[1024]={
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 
 /* 0x160 - 0x167 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 /* 0x168 - 0x16f */
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 
 /* 0x170 - 0x177 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{D_EMMS	,0			,0		,0		},
 /* 0x178 - 0x17f */
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x180 - 0x187 */
 {L_Iwx		,O_C_O		,S_C_AIPw,0		},{L_Iwx	,O_C_NO		,S_C_AIPw,0		},
@@ -323,7 +323,7 @@ static OpCode OpCodeTable[1024]={
 {0			,0			,0		,0		},{L_MODRM	,O_IMULRw	,S_Gw	,M_EwxGwx	},
 
 /* 0x1b0 - 0x1b7 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_CMPXCHGb	,S_Eb	,M_Eb	},{L_MODRM	,O_CMPXCHGw	,S_Ew	,M_Ew	},
 {L_MODRM	,O_SEGSS	,S_SEGGw,M_Efw	},{L_MODRM	,O_BTRw		,S_Ew	,M_EwGwt	},
 {L_MODRM	,O_SEGFS	,S_SEGGw,M_Efw	},{L_MODRM	,O_SEGGS	,S_SEGGw,M_Efw	},
 {L_MODRM	,0			,S_Gw	,M_Eb	},{L_MODRM	,0			,S_Gw	,M_Ew	},
@@ -345,37 +345,37 @@ static OpCode OpCodeTable[1024]={
 {L_REGw		,O_BSWAPw	,S_REGw	,REGI_SI},{L_REGw	,O_BSWAPw	,S_REGw	,REGI_DI},
 
 /* 0x1d0 - 0x1d7 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x1d8 - 0x1df */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x1e0 - 0x1ee */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x1e8 - 0x1ef */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x1f0 - 0x1fc */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x1f8 - 0x1ff */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
 
 
 /* 0x200 - 0x207 */
@@ -623,27 +623,27 @@ static OpCode OpCodeTable[1024]={
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 
 /* 0x360 - 0x367 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 /* 0x368 - 0x36f */
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 
 /* 0x370 - 0x377 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{D_EMMS	,0			,0		,0		},
 /* 0x378 - 0x37f */
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x380 - 0x387 */
 {L_Idx		,O_C_O		,S_C_AIPd,0		},{L_Idx	,O_C_NO		,S_C_AIPd,0		},
@@ -679,7 +679,7 @@ static OpCode OpCodeTable[1024]={
 {0			,0			,0		,0		},{L_MODRM	,O_IMULRd	,S_Gd	,M_EdxGdx	},
 
 /* 0x3b0 - 0x3b7 */
-{0			,0			,0		,0		},{L_MODRM	,O_CMPXCHG	,S_Ed	,M_Ed	},
+{L_MODRM	,O_CMPXCHGb	,S_Eb	,M_Eb	},{L_MODRM	,O_CMPXCHG	,S_Ed	,M_Ed	},
 {L_MODRM	,O_SEGSS	,S_SEGGd,M_Efd	},{L_MODRM	,O_BTRd		,S_Ed	,M_EdGdt	},
 {L_MODRM	,O_SEGFS	,S_SEGGd,M_Efd	},{L_MODRM	,O_SEGGS	,S_SEGGd,M_Efd	},
 {L_MODRM	,0			,S_Gd	,M_Eb	},{L_MODRM	,0			,S_Gd	,M_Ew	},
@@ -701,37 +701,37 @@ static OpCode OpCodeTable[1024]={
 {L_REGd		,O_BSWAPd	,S_REGd	,REGI_SI},{L_REGd	,O_BSWAPd	,S_REGd	,REGI_DI},
 
 /* 0x3d0 - 0x3d7 */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x3d8 - 0x3df */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x3e0 - 0x3ee */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x3e8 - 0x3ef */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 
 /* 0x3f0 - 0x3fc */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{0			,0			,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
 {0			,0			,0		,0		},{0		,0			,0		,0		},
 /* 0x3f8 - 0x3ff */
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
-{0			,0			,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{L_MODRM	,O_MMX		,0		,0		},
+{L_MODRM	,O_MMX		,0		,0		},{0		,0			,0		,0		},
 
 };
 
@@ -28,10 +28,14 @@ switch (inst.code.save) {
 	case S_Gb:
 		reg_8(inst.rm_index)=inst_op1_b;
 		break;	
-	case S_EbGb:
-		if (inst.rm<0xc0) SaveMb(inst.rm_eaa,inst_op1_b);
-		else reg_8(inst.rm_eai)=inst_op1_b;
-		reg_8(inst.rm_index)=inst_op2_b;
+	case S_EbGb:		/* E is written last, xadd of a register with itself leaves the sum */
+		if (inst.rm<0xc0) {
+			SaveMb(inst.rm_eaa,inst_op1_b);
+			reg_8(inst.rm_index)=inst_op2_b;
+		} else {
+			reg_8(inst.rm_index)=inst_op2_b;
+			reg_8(inst.rm_eai)=inst_op1_b;
+		}
 		break;	
 /* Word */
 	case S_Ew:
@@ -42,9 +46,13 @@ switch (inst.code.save) {
 		reg_16(inst.rm_index)=inst_op1_w;
 		break;	
 	case S_EwGw:
-		if (inst.rm<0xc0) SaveMw(inst.rm_eaa,inst_op1_w);
-		else reg_16(inst.rm_eai)=inst_op1_w;
-		reg_16(inst.rm_index)=inst_op2_w;
+		if (inst.rm<0xc0) {
+			SaveMw(inst.rm_eaa,inst_op1_w);
+			reg_16(inst.rm_index)=inst_op2_w;
+		} else {
+			reg_16(inst.rm_index)=inst_op2_w;
+			reg_16(inst.rm_eai)=inst_op1_w;
+		}
 		break;	
 /* Dword */
 	case S_Ed:
@@ -59,9 +67,13 @@ switch (inst.code.save) {
 		reg_32(inst.rm_index)=inst_op1_d;
 		break;	
 	case S_EdGd:
-		if (inst.rm<0xc0) SaveMd(inst.rm_eaa,inst_op1_d);
-		else reg_32(inst.rm_eai)=inst_op1_d;
-		reg_32(inst.rm_index)=inst_op2_d;
+		if (inst.rm<0xc0) {
+			SaveMd(inst.rm_eaa,inst_op1_d);
+			reg_32(inst.rm_index)=inst_op2_d;
+		} else {
+			reg_32(inst.rm_index)=inst_op2_d;
+			reg_32(inst.rm_eai)=inst_op1_d;
+		}
 		break;	
 
 	case S_REGb:
@@ -64,7 +64,7 @@ enum {
 	D_CPUID,
 	D_HLT,D_CLTS,
 	D_LOCK,D_ICEBP,
-	D_RDTSC,
+	D_RDTSC,D_EMMS,
 	L_ERROR
 };
 
@@ -114,7 +114,8 @@ enum {
 	O_BSFw,O_BSRw,O_BSFd,O_BSRd,
 
 	O_BSWAPw, O_BSWAPd,
-	O_CMPXCHG,
+	O_CMPXCHGb,O_CMPXCHGw,O_CMPXCHG,
+	O_MMX,
 	O_FPU
 
 
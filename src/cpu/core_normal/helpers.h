@@ -141,6 +141,37 @@
 	}																		\
 }
 
+#define LoadMq(off) ((Bit64u)LoadMd(off) | ((Bit64u)LoadMd((off)+4) << 32))
+#define SaveMq(off,val) {SaveMd(off,(Bit32u)(val));SaveMd((off)+4,(Bit32u)((val) >> 32));}
+
+/* The registers may still be kept by the dynamic core that handed over the instruction */
+#define MMX_CHECK {															\
+	if (CPU_ArchitectureType<CPU_ARCHTYPE_PMMXSLOW) goto illegal_opcode;		\
+	MMX_Sync();																\
+}
+
+#define MMX_RM(op) {															\
+	MMX_CHECK;																\
+	GetRM;Bit64u src;															\
+	if (rm >= 0xc0) src=MMX_Load(rm&7);											\
+	else {GetEAa;src=LoadMq(eaa);}												\
+	MMX_Enter();MMX_Store((rm>>3)&7,op(MMX_Load((rm>>3)&7),src));				\
+}
+
+#define MMX_SHIFT_IMM(srl,sra,sll) {											\
+	MMX_CHECK;																\
+	GetRM;MMX_Op op;															\
+	switch ((rm>>3)&7) {														\
+	case 0x02:op=srl;break;														\
+	case 0x04:op=sra;break;														\
+	case 0x06:op=sll;break;														\
+	default:op=0;break;															\
+	}																			\
+	if ((rm < 0xc0) || (!op)) goto illegal_opcode;								\
+	Bit64u count=Fetchb();														\
+	MMX_Enter();MMX_Store(rm&7,op(MMX_Load(rm&7),count));						\
+}
+
 #define CASE_W(_WHICH)							\
 	case (OPCODE_NONE+_WHICH):
 
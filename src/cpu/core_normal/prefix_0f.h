@@ -228,12 +228,81 @@
 	CASE_0F_B(0x31)												/* RDTSC */
 		{
 			if (CPU_ArchitectureType<CPU_ARCHTYPE_PENTIUMSLOW) goto illegal_opcode;
-			/* Use a fixed number when in auto cycles mode as else the reported value changes constantly */
-			Bit64s tsc=(Bit64s)(PIC_FullIndex()*(double) (CPU_CycleAutoAdjust?70000:CPU_CycleMax));
+			Bit64u tsc=CPU_ReadTimeStamp();
 			reg_edx=(Bit32u)(tsc>>32);
 			reg_eax=(Bit32u)(tsc&0xffffffff);
 		}
 		break;
+#ifdef CPU_FPU
+	CASE_0F_B(0x60)												/* PUNPCKLBW Pq,Qq */
+		MMX_RM(MMX_PUNPCKLBW);break;
+	CASE_0F_B(0x61)												/* PUNPCKLWD Pq,Qq */
+		MMX_RM(MMX_PUNPCKLWD);break;
+	CASE_0F_B(0x62)												/* PUNPCKLDQ Pq,Qq */
+		MMX_RM(MMX_PUNPCKLDQ);break;
+	CASE_0F_B(0x63)												/* PACKSSWB Pq,Qq */
+		MMX_RM(MMX_PACKSSWB);break;
+	CASE_0F_B(0x64)												/* PCMPGTB Pq,Qq */
+		MMX_RM(MMX_PCMPGTB);break;
+	CASE_0F_B(0x65)												/* PCMPGTW Pq,Qq */
+		MMX_RM(MMX_PCMPGTW);break;
+	CASE_0F_B(0x66)												/* PCMPGTD Pq,Qq */
+		MMX_RM(MMX_PCMPGTD);break;
+	CASE_0F_B(0x67)												/* PACKUSWB Pq,Qq */
+		MMX_RM(MMX_PACKUSWB);break;
+	CASE_0F_B(0x68)												/* PUNPCKHBW Pq,Qq */
+		MMX_RM(MMX_PUNPCKHBW);break;
+	CASE_0F_B(0x69)												/* PUNPCKHWD Pq,Qq */
+		MMX_RM(MMX_PUNPCKHWD);break;
+	CASE_0F_B(0x6a)												/* PUNPCKHDQ Pq,Qq */
+		MMX_RM(MMX_PUNPCKHDQ);break;
+	CASE_0F_B(0x6b)												/* PACKSSDW Pq,Qq */
+		MMX_RM(MMX_PACKSSDW);break;
+	CASE_0F_B(0x6e)												/* MOVD Pq,Ed */
+		{
+			MMX_CHECK;
+			GetRM;Bit32u val;
+			if (rm >= 0xc0) {GetEArd;val=*eard;}
+			else {GetEAa;val=LoadMd(eaa);}
+			MMX_Enter();MMX_Store((rm>>3)&7,val);
+		}
+		break;
+	CASE_0F_B(0x6f)												/* MOVQ Pq,Qq */
+		MMX_RM(MMX_MOVQ);break;
+	CASE_0F_B(0x71)												/* PSRLW/PSRAW/PSLLW Nq,Ib */
+		MMX_SHIFT_IMM(MMX_PSRLW,MMX_PSRAW,MMX_PSLLW);break;
+	CASE_0F_B(0x72)												/* PSRLD/PSRAD/PSLLD Nq,Ib */
+		MMX_SHIFT_IMM(MMX_PSRLD,MMX_PSRAD,MMX_PSLLD);break;
+	CASE_0F_B(0x73)												/* PSRLQ/PSLLQ Nq,Ib */
+		MMX_SHIFT_IMM(MMX_PSRLQ,0,MMX_PSLLQ);break;
+	CASE_0F_B(0x74)												/* PCMPEQB Pq,Qq */
+		MMX_RM(MMX_PCMPEQB);break;
+	CASE_0F_B(0x75)												/* PCMPEQW Pq,Qq */
+		MMX_RM(MMX_PCMPEQW);break;
+	CASE_0F_B(0x76)												/* PCMPEQD Pq,Qq */
+		MMX_RM(MMX_PCMPEQD);break;
+	CASE_0F_B(0x77)												/* EMMS */
+		MMX_CHECK;
+		MMX_EMMS();break;
+	CASE_0F_B(0x7e)												/* MOVD Ed,Pq */
+		{
+			MMX_CHECK;
+			GetRM;MMX_Enter();
+			Bit32u val=(Bit32u)MMX_Load((rm>>3)&7);
+			if (rm >= 0xc0) {GetEArd;*eard=val;}
+			else {GetEAa;SaveMd(eaa,val);}
+		}
+		break;
+	CASE_0F_B(0x7f)												/* MOVQ Qq,Pq */
+		{
+			MMX_CHECK;
+			GetRM;MMX_Enter();
+			Bit64u val=MMX_Load((rm>>3)&7);
+			if (rm >= 0xc0) MMX_Store(rm&7,val);
+			else {GetEAa;SaveMq(eaa,val);}
+		}
+		break;
+#endif
 	CASE_0F_W(0x80)												/* JO */
 		JumpCond16_w(TFLG_O);break;
 	CASE_0F_W(0x81)												/* JNO */
@@ -577,16 +646,16 @@
 		{
 			if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegal_opcode;
 			GetRMrb;Bit8u oldrmrb=*rmrb;
-			if (rm >= 0xc0 ) {GetEArb;*rmrb=*earb;*earb+=oldrmrb;}
-			else {GetEAa;*rmrb=LoadMb(eaa);SaveMb(eaa,LoadMb(eaa)+oldrmrb);}
+			if (rm >= 0xc0 ) {GetEArb;*rmrb=*earb;ADDB(*earb,oldrmrb,LoadRb,SaveRb);}
+			else {GetEAa;*rmrb=LoadMb(eaa);ADDB(eaa,oldrmrb,LoadMb,SaveMb);}
 			break;
 		}
 	CASE_0F_W(0xc1)												/* XADD Gw,Ew */
 		{
 			if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegal_opcode;
 			GetRMrw;Bit16u oldrmrw=*rmrw;
-			if (rm >= 0xc0 ) {GetEArw;*rmrw=*earw;*earw+=oldrmrw;}
-			else {GetEAa;*rmrw=LoadMw(eaa);SaveMw(eaa,LoadMw(eaa)+oldrmrw);}
+			if (rm >= 0xc0 ) {GetEArw;*rmrw=*earw;ADDW(*earw,oldrmrw,LoadRw,SaveRw);}
+			else {GetEAa;*rmrw=LoadMw(eaa);ADDW(eaa,oldrmrw,LoadMw,SaveMw);}
 			break;
 		}
 	CASE_0F_W(0xc8)												/* BSWAP AX */
@@ -613,4 +682,64 @@
 	CASE_0F_W(0xcf)												/* BSWAP DI */
 		if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegal_opcode;
 		BSWAPW(reg_di);break;
+#ifdef CPU_FPU
+	CASE_0F_B(0xd1)												/* PSRLW Pq,Qq */
+		MMX_RM(MMX_PSRLW);break;
+	CASE_0F_B(0xd2)												/* PSRLD Pq,Qq */
+		MMX_RM(MMX_PSRLD);break;
+	CASE_0F_B(0xd3)												/* PSRLQ Pq,Qq */
+		MMX_RM(MMX_PSRLQ);break;
+	CASE_0F_B(0xd5)												/* PMULLW Pq,Qq */
+		MMX_RM(MMX_PMULLW);break;
+	CASE_0F_B(0xd8)												/* PSUBUSB Pq,Qq */
+		MMX_RM(MMX_PSUBUSB);break;
+	CASE_0F_B(0xd9)												/* PSUBUSW Pq,Qq */
+		MMX_RM(MMX_PSUBUSW);break;
+	CASE_0F_B(0xdb)												/* PAND Pq,Qq */
+		MMX_RM(MMX_PAND);break;
+	CASE_0F_B(0xdc)												/* PADDUSB Pq,Qq */
+		MMX_RM(MMX_PADDUSB);break;
+	CASE_0F_B(0xdd)												/* PADDUSW Pq,Qq */
+		MMX_RM(MMX_PADDUSW);break;
+	CASE_0F_B(0xdf)												/* PANDN Pq,Qq */
+		MMX_RM(MMX_PANDN);break;
+	CASE_0F_B(0xe1)												/* PSRAW Pq,Qq */
+		MMX_RM(MMX_PSRAW);break;
+	CASE_0F_B(0xe2)												/* PSRAD Pq,Qq */
+		MMX_RM(MMX_PSRAD);break;
+	CASE_0F_B(0xe5)												/* PMULHW Pq,Qq */
+		MMX_RM(MMX_PMULHW);break;
+	CASE_0F_B(0xe8)												/* PSUBSB Pq,Qq */
+		MMX_RM(MMX_PSUBSB);break;
+	CASE_0F_B(0xe9)												/* PSUBSW Pq,Qq */
+		MMX_RM(MMX_PSUBSW);break;
+	CASE_0F_B(0xeb)												/* POR Pq,Qq */
+		MMX_RM(MMX_POR);break;
+	CASE_0F_B(0xec)												/* PADDSB Pq,Qq */
+		MMX_RM(MMX_PADDSB);break;
+	CASE_0F_B(0xed)												/* PADDSW Pq,Qq */
+		MMX_RM(MMX_PADDSW);break;
+	CASE_0F_B(0xef)												/* PXOR Pq,Qq */
+		MMX_RM(MMX_PXOR);break;
+	CASE_0F_B(0xf1)												/* PSLLW Pq,Qq */
+		MMX_RM(MMX_PSLLW);break;
+	CASE_0F_B(0xf2)												/* PSLLD Pq,Qq */
+		MMX_RM(MMX_PSLLD);break;
+	CASE_0F_B(0xf3)												/* PSLLQ Pq,Qq */
+		MMX_RM(MMX_PSLLQ);break;
+	CASE_0F_B(0xf5)												/* PMADDWD Pq,Qq */
+		MMX_RM(MMX_PMADDWD);break;
+	CASE_0F_B(0xf8)												/* PSUBB Pq,Qq */
+		MMX_RM(MMX_PSUBB);break;
+	CASE_0F_B(0xf9)												/* PSUBW Pq,Qq */
+		MMX_RM(MMX_PSUBW);break;
+	CASE_0F_B(0xfa)												/* PSUBD Pq,Qq */
+		MMX_RM(MMX_PSUBD);break;
+	CASE_0F_B(0xfc)												/* PADDB Pq,Qq */
+		MMX_RM(MMX_PADDB);break;
+	CASE_0F_B(0xfd)												/* PADDW Pq,Qq */
+		MMX_RM(MMX_PADDW);break;
+	CASE_0F_B(0xfe)												/* PADDD Pq,Qq */
+		MMX_RM(MMX_PADDD);break;
+#endif
 		
@@ -435,8 +435,8 @@
 		{
 			if (CPU_ArchitectureType<CPU_ARCHTYPE_486OLDSLOW) goto illegal_opcode;
 			GetRMrd;Bit32u oldrmrd=*rmrd;
-			if (rm >= 0xc0 ) {GetEArd;*rmrd=*eard;*eard+=oldrmrd;}
-			else {GetEAa;*rmrd=LoadMd(eaa);SaveMd(eaa,LoadMd(eaa)+oldrmrd);}
+			if (rm >= 0xc0 ) {GetEArd;*rmrd=*eard;ADDD(*eard,oldrmrd,LoadRd,SaveRd);}
+			else {GetEAa;*rmrd=LoadMd(eaa);ADDD(eaa,oldrmrd,LoadMd,SaveMd);}
 			break;
 		}
 	CASE_0F_D(0xc8)												/* BSWAP EAX */
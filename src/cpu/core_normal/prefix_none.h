@@ -495,6 +495,7 @@
 			//Little hack to always use segprefixed version
 			BaseDS=BaseSS=0;
 			GetRMrw;
+			if (rm >= 0xc0) goto illegal_opcode;
 			if (TEST_PREFIX_ADDR) {
 				*rmrw=(Bit16u)(*EATable[256+rm])();
 			} else {
@@ -1125,6 +1126,11 @@
 				{
 					Bitu cb=Fetchw();
 					FillFlags();SAVEIP;
+					if (CALLBACK_RunLeaf(cb)) {
+						/* Served without leaving the core, the handler may have moved ip */
+						LOADIP;
+						break;
+					}
 					return cb;
 				}
 			default:
@@ -27,6 +27,7 @@
 #include "callback.h"
 #include "pic.h"
 #include "fpu.h"
+#include "mmx.h"
 #include "paging.h"
 
 #if C_DEBUG
@@ -312,3 +313,8 @@ void CPU_Core_Prefetch_Init(void) {
 
 }
 
+// drop the queued bytes so the next instruction is fetched from memory again
+void CPU_Core_Prefetch_Invalidate(void) {
+	pq_valid=false;
+}
+
@@ -0,0 +1,879 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* The threaded core decodes an instruction once into a record holding the
+   handler that runs it and its operands: register pointers, the parts of
+   the memory operand and the immediate. The records of a straight run of
+   code up to a branch make a block, kept in a table indexed by the linear
+   address it starts at. A block runs as calls of the handlers one after the
+   other, one instruction and one cycle at a time like the normal core.
+
+   A block keeps the bytes it was decoded from, they are compared with the
+   bytes in memory before every run and after every instruction that writes
+   memory. Code that was written over, paged elsewhere or mapped in by EMS
+   is decoded again, no page handlers need to report the writes.
+   Instructions without a handler here, the ones near the end of a page and
+   the ones in pages without a host pointer are run by the normal core. */
+
+#include <string.h>
+
+#include "dosbox.h"
+#include "mem.h"
+#include "cpu.h"
+#include "lazyflags.h"
+#include "callback.h"
+#include "paging.h"
+#include "modrm.h"
+
+#if C_DEBUG
+#include "debug.h"
+#endif
+
+#if (!C_CORE_INLINE)
+#define LoadMb(off) mem_readb(off)
+#define LoadMw(off) mem_readw(off)
+#define LoadMd(off) mem_readd(off)
+#define SaveMb(off,val)	mem_writeb(off,val)
+#define SaveMw(off,val)	mem_writew(off,val)
+#define SaveMd(off,val)	mem_writed(off,val)
+#else
+#define LoadMb(off) mem_readb_inline(off)
+#define LoadMw(off) mem_readw_inline(off)
+#define LoadMd(off) mem_readd_inline(off)
+#define SaveMb(off,val)	mem_writeb_inline(off,val)
+#define SaveMw(off,val)	mem_writew_inline(off,val)
+#define SaveMd(off,val)	mem_writed_inline(off,val)
+#endif
+
+#define LoadMbs(off) (Bit8s)(LoadMb(off))
+#define LoadMws(off) (Bit16s)(LoadMw(off))
+
+#define LoadRb(reg) reg
+#define LoadRw(reg) reg
+#define LoadRd(reg) reg
+
+#define SaveRb(reg,val)	reg=val
+#define SaveRw(reg,val)	reg=val
+#define SaveRd(reg,val)	reg=val
+
+#define Push_16 CPU_Push16
+#define Push_32 CPU_Push32
+#define Pop_16 CPU_Pop16
+#define Pop_32 CPU_Pop32
+
+#include "instructions.h"
+
+extern Bitu cycle_count;
+
+#define THREADED_BLOCKS		2048		// a power of two
+#define THREADED_BLOCKLEN	16			// records of a block
+#define THREADED_BLOCKSIZE	64			// bytes of a block
+#define THREADED_MAXLEN		16			// longer instructions go to the normal core
+
+// record flags
+#define THREADED_WRITES		0x1			// writes memory, the block is compared after it
+#define THREADED_BRANCH		0x2			// moves reg_eip itself, the last of a block
+
+struct ThreadedRecord;
+typedef void (*ThreadedHandler)(const ThreadedRecord * rec);
+
+struct ThreadedRecord {
+	ThreadedHandler handler;	// 0 to run the instruction on the normal core
+	void * op1;					// register operands, op1 the one written
+	void * op2;
+	Bit32u * base;				// memory operand, threaded.zero for none
+	Bit32u * index;
+	Bit32u disp;				// or the branch displacement
+	Bit32u addr_mask;
+	Bit32u imm;					// or the displacement size of a 16-bit jcc
+	Bit8u len;
+	Bit8u seg;
+	Bit8u scale;
+	Bit8u flags;
+};
+
+struct ThreadedBlock {
+	PhysPt ip;
+	Bit8u mode;					// 1+cpu.code.big, 0 for a free block
+	Bit8u count;				// records, 0 to run the instruction on the normal core
+	Bit8u size;					// bytes compared
+	Bit8u bytes[THREADED_BLOCKSIZE];
+	ThreadedRecord records[THREADED_BLOCKLEN];
+};
+
+static struct {
+	ThreadedBlock blocks[THREADED_BLOCKS];
+	Bit32u zero;
+} threaded;
+
+static INLINE PhysPt ThreadedEA(const ThreadedRecord * rec) {
+	return SegPhys((SegNames)rec->seg)+((*rec->base+(*rec->index<<rec->scale)+rec->disp)&rec->addr_mask);
+}
+
+/* Handlers, they run with reg_eip at the start of the instruction like in
+   the normal core, only the branches move it on */
+#define THREADED_ALU(INST,TYPE,LOADR,SAVER,LOADM,SAVEM)					\
+static void Threaded_##INST##_RR(const ThreadedRecord * rec) {			\
+	INST(*(TYPE *)rec->op1,*(TYPE *)rec->op2,LOADR,SAVER);				\
+}																		\
+static void Threaded_##INST##_MR(const ThreadedRecord * rec) {			\
+	PhysPt eaa=ThreadedEA(rec);											\
+	INST(eaa,*(TYPE *)rec->op2,LOADM,SAVEM);							\
+}																		\
+static void Threaded_##INST##_RI(const ThreadedRecord * rec) {			\
+	INST(*(TYPE *)rec->op1,(TYPE)rec->imm,LOADR,SAVER);					\
+}																		\
+static void Threaded_##INST##_MI(const ThreadedRecord * rec) {			\
+	PhysPt eaa=ThreadedEA(rec);											\
+	INST(eaa,(TYPE)rec->imm,LOADM,SAVEM);								\
+}
+
+#define THREADED_ALU_B(INST) THREADED_ALU(INST,Bit8u,LoadRb,SaveRb,LoadMb,SaveMb)
+#define THREADED_ALU_W(INST) THREADED_ALU(INST,Bit16u,LoadRw,SaveRw,LoadMw,SaveMw)
+#define THREADED_ALU_D(INST) THREADED_ALU(INST,Bit32u,LoadRd,SaveRd,LoadMd,SaveMd)
+
+#define THREADED_ALU_RM_B(INST)											\
+	THREADED_ALU_B(INST)												\
+	static void Threaded_##INST##_RM(const ThreadedRecord * rec) {		\
+		PhysPt eaa=ThreadedEA(rec);										\
+		INST(*(Bit8u *)rec->op1,LoadMb(eaa),LoadRb,SaveRb);				\
+	}
+#define THREADED_ALU_RM_W(INST)											\
+	THREADED_ALU_W(INST)												\
+	static void Threaded_##INST##_RM(const ThreadedRecord * rec) {		\
+		PhysPt eaa=ThreadedEA(rec);										\
+		INST(*(Bit16u *)rec->op1,LoadMw(eaa),LoadRw,SaveRw);			\
+	}
+#define THREADED_ALU_RM_D(INST)											\
+	THREADED_ALU_D(INST)												\
+	static void Threaded_##INST##_RM(const ThreadedRecord * rec) {		\
+		PhysPt eaa=ThreadedEA(rec);										\
+		INST(*(Bit32u *)rec->op1,LoadMd(eaa),LoadRd,SaveRd);			\
+	}
+
+THREADED_ALU_RM_B(ADDB) THREADED_ALU_RM_W(ADDW) THREADED_ALU_RM_D(ADDD)
+THREADED_ALU_RM_B(ORB)  THREADED_ALU_RM_W(ORW)  THREADED_ALU_RM_D(ORD)
+THREADED_ALU_RM_B(ADCB) THREADED_ALU_RM_W(ADCW) THREADED_ALU_RM_D(ADCD)
+THREADED_ALU_RM_B(SBBB) THREADED_ALU_RM_W(SBBW) THREADED_ALU_RM_D(SBBD)
+THREADED_ALU_RM_B(ANDB) THREADED_ALU_RM_W(ANDW) THREADED_ALU_RM_D(ANDD)
+THREADED_ALU_RM_B(SUBB) THREADED_ALU_RM_W(SUBW) THREADED_ALU_RM_D(SUBD)
+THREADED_ALU_RM_B(XORB) THREADED_ALU_RM_W(XORW) THREADED_ALU_RM_D(XORD)
+THREADED_ALU_RM_B(CMPB) THREADED_ALU_RM_W(CMPW) THREADED_ALU_RM_D(CMPD)
+THREADED_ALU_B(TESTB)   THREADED_ALU_W(TESTW)   THREADED_ALU_D(TESTD)
+
+// mov in the forms of the alu instructions
+#define MOVB(op1,op2,load,save) save(op1,op2);
+#define MOVW(op1,op2,load,save) save(op1,op2);
+#define MOVD(op1,op2,load,save) save(op1,op2);
+THREADED_ALU_RM_B(MOVB) THREADED_ALU_RM_W(MOVW) THREADED_ALU_RM_D(MOVD)
+
+#define THREADED_INCDEC(INST,TYPE,LOADR,SAVER,LOADM,SAVEM)				\
+static void Threaded_##INST##_R(const ThreadedRecord * rec) {			\
+	INST(*(TYPE *)rec->op1,LOADR,SAVER);								\
+}																		\
+static void Threaded_##INST##_M(const ThreadedRecord * rec) {			\
+	PhysPt eaa=ThreadedEA(rec);											\
+	INST(eaa,LOADM,SAVEM);												\
+}
+
+THREADED_INCDEC(INCB,Bit8u,LoadRb,SaveRb,LoadMb,SaveMb)
+THREADED_INCDEC(INCW,Bit16u,LoadRw,SaveRw,LoadMw,SaveMw)
+THREADED_INCDEC(INCD,Bit32u,LoadRd,SaveRd,LoadMd,SaveMd)
+THREADED_INCDEC(DECB,Bit8u,LoadRb,SaveRb,LoadMb,SaveMb)
+THREADED_INCDEC(DECW,Bit16u,LoadRw,SaveRw,LoadMw,SaveMw)
+THREADED_INCDEC(DECD,Bit32u,LoadRd,SaveRd,LoadMd,SaveMd)
+
+#define THREADED_XCHG(NAME,TYPE,LOADM,SAVEM)							\
+static void Threaded_##NAME##_RR(const ThreadedRecord * rec) {			\
+	TYPE old=*(TYPE *)rec->op1;											\
+	*(TYPE *)rec->op1=*(TYPE *)rec->op2;								\
+	*(TYPE *)rec->op2=old;												\
+}																		\
+static void Threaded_##NAME##_RM(const ThreadedRecord * rec) {			\
+	PhysPt eaa=ThreadedEA(rec);											\
+	TYPE old=*(TYPE *)rec->op1;											\
+	*(TYPE *)rec->op1=LOADM(eaa);										\
+	SAVEM(eaa,old);														\
+}
+
+THREADED_XCHG(XCHGB,Bit8u,LoadMb,SaveMb)
+THREADED_XCHG(XCHGW,Bit16u,LoadMw,SaveMw)
+THREADED_XCHG(XCHGD,Bit32u,LoadMd,SaveMd)
+
+// movzx and movsx, the source of the size of the second type
+#define THREADED_MOVX(NAME,TYPE,SRC,LOADM)								\
+static void Threaded_##NAME##_RR(const ThreadedRecord * rec) {			\
+	*(TYPE *)rec->op1=*(SRC *)rec->op2;									\
+}																		\
+static void Threaded_##NAME##_RM(const ThreadedRecord * rec) {			\
+	PhysPt eaa=ThreadedEA(rec);											\
+	*(TYPE *)rec->op1=LOADM(eaa);										\
+}
+
+THREADED_MOVX(MOVZXWB,Bit16u,Bit8u,LoadMb)
+THREADED_MOVX(MOVZXDB,Bit32u,Bit8u,LoadMb)
+THREADED_MOVX(MOVZXDW,Bit32u,Bit16u,LoadMw)
+THREADED_MOVX(MOVSXWB,Bit16u,Bit8s,LoadMbs)
+THREADED_MOVX(MOVSXDB,Bit32u,Bit8s,LoadMbs)
+THREADED_MOVX(MOVSXDW,Bit32u,Bit16s,LoadMws)
+
+static void Threaded_LEAW(const ThreadedRecord * rec) {
+	*(Bit16u *)rec->op1=(Bit16u)((*rec->base+(*rec->index<<rec->scale)+rec->disp)&rec->addr_mask);
+}
+
+static void Threaded_LEAD(const ThreadedRecord * rec) {
+	*(Bit32u *)rec->op1=(*rec->base+(*rec->index<<rec->scale)+rec->disp)&rec->addr_mask;
+}
+
+static void Threaded_PUSHW(const ThreadedRecord * rec) {
+	Push_16(*(Bit16u *)rec->op1);
+}
+
+static void Threaded_PUSHD(const ThreadedRecord * rec) {
+	Push_32(*(Bit32u *)rec->op1);
+}
+
+static void Threaded_POPW(const ThreadedRecord * rec) {
+	*(Bit16u *)rec->op1=Pop_16();
+}
+
+static void Threaded_POPD(const ThreadedRecord * rec) {
+	*(Bit32u *)rec->op1=Pop_32();
+}
+
+static void Threaded_NOP(const ThreadedRecord * rec) {
+}
+
+static void Threaded_CBW(const ThreadedRecord * rec) {
+	reg_ax=(Bit8s)reg_al;
+}
+
+static void Threaded_CWDE(const ThreadedRecord * rec) {
+	reg_eax=(Bit16s)reg_ax;
+}
+
+static void Threaded_CWD(const ThreadedRecord * rec) {
+	if (reg_ax & 0x8000) reg_dx=0xffff;else reg_dx=0;
+}
+
+static void Threaded_CDQ(const ThreadedRecord * rec) {
+	if (reg_eax & 0x80000000) reg_edx=0xffffffff;
+	else reg_edx=0;
+}
+
+static void Threaded_CLC(const ThreadedRecord * rec) {
+	FillFlags();
+	SETFLAGBIT(CF,false);
+}
+
+static void Threaded_STC(const ThreadedRecord * rec) {
+	FillFlags();
+	SETFLAGBIT(CF,true);
+}
+
+static void Threaded_CLD(const ThreadedRecord * rec) {
+	SETFLAGBIT(DF,false);
+	cpu.direction=1;
+}
+
+static void Threaded_STD(const ThreadedRecord * rec) {
+	SETFLAGBIT(DF,true);
+	cpu.direction=-1;
+}
+
+/* The branches take the instruction pointer the way the normal core does,
+   a 16-bit jcc only moves ip past its displacement after the jump */
+static void Threaded_JMPW(const ThreadedRecord * rec) {
+	reg_eip=(Bit16u)(reg_eip+rec->len+rec->disp);
+}
+
+static void Threaded_JMPD(const ThreadedRecord * rec) {
+	reg_eip+=rec->len+rec->disp;
+}
+
+static void Threaded_CALLW(const ThreadedRecord * rec) {
+#if C_DEBUG
+	Bitu fromOffset=reg_eip;
+#endif
+	reg_eip+=rec->len;
+	Push_16(reg_eip);
+#if C_DEBUG
+	CallFunction::AddCall(SegValue(cs),fromOffset,SegValue(cs),(Bit16u)(reg_eip+rec->disp),reg_eip);
+#endif
+	reg_eip=(Bit16u)(reg_eip+rec->disp);
+}
+
+static void Threaded_CALLD(const ThreadedRecord * rec) {
+	reg_eip+=rec->len;
+	Push_32(reg_eip);
+	reg_eip+=rec->disp;
+}
+
+static void Threaded_RETW(const ThreadedRecord * rec) {
+	reg_eip=Pop_16();
+#if C_DEBUG
+	CallFunction::NotifyReturn(SegValue(cs),reg_eip);
+#endif
+	reg_esp+=rec->imm;
+}
+
+static void Threaded_RETD(const ThreadedRecord * rec) {
+	reg_eip=Pop_32();
+	reg_esp+=rec->imm;
+}
+
+#define THREADED_JCC(NAME,COND)											\
+static void Threaded_J##NAME##_W(const ThreadedRecord * rec) {			\
+	reg_eip+=rec->len-rec->imm;											\
+	if (COND) reg_ip+=(Bit16u)rec->disp;								\
+	reg_ip+=(Bit16u)rec->imm;											\
+}																		\
+static void Threaded_J##NAME##_D(const ThreadedRecord * rec) {			\
+	reg_eip+=rec->len;													\
+	if (COND) reg_eip+=rec->disp;										\
+}
+
+THREADED_JCC(O,TFLG_O)		THREADED_JCC(NO,TFLG_NO)
+THREADED_JCC(B,TFLG_B)		THREADED_JCC(NB,TFLG_NB)
+THREADED_JCC(Z,TFLG_Z)		THREADED_JCC(NZ,TFLG_NZ)
+THREADED_JCC(BE,TFLG_BE)	THREADED_JCC(NBE,TFLG_NBE)
+THREADED_JCC(S,TFLG_S)		THREADED_JCC(NS,TFLG_NS)
+THREADED_JCC(P,TFLG_P)		THREADED_JCC(NP,TFLG_NP)
+THREADED_JCC(L,TFLG_L)		THREADED_JCC(NL,TFLG_NL)
+THREADED_JCC(LE,TFLG_LE)	THREADED_JCC(NLE,TFLG_NLE)
+
+/* Handler tables of the decoder, by operand size: byte, word, dword */
+struct ThreadedForms {
+	ThreadedHandler rr,rm,mr,ri,mi;
+};
+
+#define THREADED_FORMS(B,W,D) {													\
+	{Threaded_##B##_RR,Threaded_##B##_RM,Threaded_##B##_MR,Threaded_##B##_RI,Threaded_##B##_MI},	\
+	{Threaded_##W##_RR,Threaded_##W##_RM,Threaded_##W##_MR,Threaded_##W##_RI,Threaded_##W##_MI},	\
+	{Threaded_##D##_RR,Threaded_##D##_RM,Threaded_##D##_MR,Threaded_##D##_RI,Threaded_##D##_MI}}
+
+static const ThreadedForms threaded_alu[8][3]={
+	THREADED_FORMS(ADDB,ADDW,ADDD),THREADED_FORMS(ORB,ORW,ORD),
+	THREADED_FORMS(ADCB,ADCW,ADCD),THREADED_FORMS(SBBB,SBBW,SBBD),
+	THREADED_FORMS(ANDB,ANDW,ANDD),THREADED_FORMS(SUBB,SUBW,SUBD),
+	THREADED_FORMS(XORB,XORW,XORD),THREADED_FORMS(CMPB,CMPW,CMPD)
+};
+
+static const ThreadedForms threaded_mov[3]=THREADED_FORMS(MOVB,MOVW,MOVD);
+
+static const ThreadedForms threaded_test[3]={
+	{Threaded_TESTB_RR,0,Threaded_TESTB_MR,Threaded_TESTB_RI,Threaded_TESTB_MI},
+	{Threaded_TESTW_RR,0,Threaded_TESTW_MR,Threaded_TESTW_RI,Threaded_TESTW_MI},
+	{Threaded_TESTD_RR,0,Threaded_TESTD_MR,Threaded_TESTD_RI,Threaded_TESTD_MI}
+};
+
+static const ThreadedHandler threaded_inc[3][2]={
+	{Threaded_INCB_R,Threaded_INCB_M},{Threaded_INCW_R,Threaded_INCW_M},{Threaded_INCD_R,Threaded_INCD_M}
+};
+
+static const ThreadedHandler threaded_dec[3][2]={
+	{Threaded_DECB_R,Threaded_DECB_M},{Threaded_DECW_R,Threaded_DECW_M},{Threaded_DECD_R,Threaded_DECD_M}
+};
+
+static const ThreadedHandler threaded_xchg[3][2]={
+	{Threaded_XCHGB_RR,Threaded_XCHGB_RM},{Threaded_XCHGW_RR,Threaded_XCHGW_RM},{Threaded_XCHGD_RR,Threaded_XCHGD_RM}
+};
+
+static const ThreadedHandler threaded_jcc[16][2]={
+	{Threaded_JO_W,Threaded_JO_D},{Threaded_JNO_W,Threaded_JNO_D},
+	{Threaded_JB_W,Threaded_JB_D},{Threaded_JNB_W,Threaded_JNB_D},
+	{Threaded_JZ_W,Threaded_JZ_D},{Threaded_JNZ_W,Threaded_JNZ_D},
+	{Threaded_JBE_W,Threaded_JBE_D},{Threaded_JNBE_W,Threaded_JNBE_D},
+	{Threaded_JS_W,Threaded_JS_D},{Threaded_JNS_W,Threaded_JNS_D},
+	{Threaded_JP_W,Threaded_JP_D},{Threaded_JNP_W,Threaded_JNP_D},
+	{Threaded_JL_W,Threaded_JL_D},{Threaded_JNL_W,Threaded_JNL_D},
+	{Threaded_JLE_W,Threaded_JLE_D},{Threaded_JNLE_W,Threaded_JNLE_D}
+};
+
+/* The decoder, it reads a copy of the instruction bytes padded with zeroes
+   so the bytes of an instruction too long to keep can be read as well */
+struct ThreadedDecoder {
+	Bit8u code[THREADED_MAXLEN*2];
+	Bitu pos;
+	Bitu size;					// operand size, 1 word, 2 dword
+	bool big_addr;
+	bool seg_override;
+	SegNames seg;
+	Bit8u rm;
+};
+
+static Bit8u ThreadedFetchb(ThreadedDecoder & dec) {
+	return dec.code[dec.pos++];
+}
+
+static Bit16u ThreadedFetchw(ThreadedDecoder & dec) {
+	Bit16u val=dec.code[dec.pos] | (dec.code[dec.pos+1]<<8);
+	dec.pos+=2;
+	return val;
+}
+
+static Bit32u ThreadedFetchd(ThreadedDecoder & dec) {
+	Bit32u val=ThreadedFetchw(dec);
+	return val | ((Bit32u)ThreadedFetchw(dec)<<16);
+}
+
+// an immediate of the operand size
+static Bit32u ThreadedFetchv(ThreadedDecoder & dec,Bitu size) {
+	switch (size) {
+	case 0: return ThreadedFetchb(dec);
+	case 1: return ThreadedFetchw(dec);
+	default: return ThreadedFetchd(dec);
+	}
+}
+
+static void * ThreadedReg(Bitu size,Bit8u rm) {
+	switch (size) {
+	case 0: return lookupRMregb[rm];
+	case 1: return lookupRMregw[rm];
+	default: return lookupRMregd[rm];
+	}
+}
+
+static void * ThreadedRMReg(Bitu size,Bit8u rm) {
+	switch (size) {
+	case 0: return lookupRMEAregb[rm];
+	case 1: return lookupRMEAregw[rm];
+	default: return lookupRMEAregd[rm];
+	}
+}
+
+// the parts of a memory operand in the normal core's EA table
+static void ThreadedDecodeEA(ThreadedRecord * rec,ThreadedDecoder & dec) {
+	static Bit32u * const regs[8]={&reg_eax,&reg_ecx,&reg_edx,&reg_ebx,&reg_esp,&reg_ebp,&reg_esi,&reg_edi};
+	Bit8u rm=dec.rm;
+	Bitu mod=rm>>6;
+	bool stack=false;
+	rec->base=&threaded.zero;
+	rec->index=&threaded.zero;
+	rec->scale=0;
+	rec->disp=0;
+	if (!dec.big_addr) {
+		static Bit32u * const bases[8]={&reg_ebx,&reg_ebx,&reg_ebp,&reg_ebp,&reg_esi,&reg_edi,&reg_ebp,&reg_ebx};
+		static Bit32u * const indexes[8]={&reg_esi,&reg_edi,&reg_esi,&reg_edi,0,0,0,0};
+		rec->addr_mask=0xffff;
+		if (mod==0 && (rm&7)==6) {
+			rec->disp=ThreadedFetchw(dec);
+		} else {
+			rec->base=bases[rm&7];
+			if (indexes[rm&7]) rec->index=indexes[rm&7];
+			stack=(rm&7)==2 || (rm&7)==3 || (rm&7)==6;
+		}
+		if (mod==1) rec->disp=(Bit32u)(Bit32s)(Bit8s)ThreadedFetchb(dec);
+		else if (mod==2) rec->disp=ThreadedFetchw(dec);
+	} else {
+		rec->addr_mask=0xffffffff;
+		Bitu base=rm&7;
+		if (base==4) {
+			Bit8u sib=ThreadedFetchb(dec);
+			base=sib&7;
+			if (((sib>>3)&7)!=4) rec->index=regs[(sib>>3)&7];
+			rec->scale=sib>>6;
+			if (base==5 && mod==0) {
+				rec->disp=ThreadedFetchd(dec);
+				base=8;
+			}
+		} else if (base==5 && mod==0) {
+			rec->disp=ThreadedFetchd(dec);
+			base=8;
+		}
+		if (base<8) {
+			rec->base=regs[base];
+			stack=(base==4) || (base==5);
+		}
+		if (mod==1) rec->disp=(Bit32u)(Bit32s)(Bit8s)ThreadedFetchb(dec);
+		else if (mod==2) rec->disp=ThreadedFetchd(dec);
+	}
+	if (dec.seg_override) rec->seg=dec.seg;
+	else rec->seg=stack ? ss : ds;
+}
+
+// the modrm byte and a memory operand after it, false for a register operand
+static bool ThreadedDecodeModrm(ThreadedRecord * rec,ThreadedDecoder & dec) {
+	dec.rm=ThreadedFetchb(dec);
+	if (dec.rm>=0xc0) return false;
+	ThreadedDecodeEA(rec,dec);
+	return true;
+}
+
+// Ex,Gx with E written and Gx,Ex with G written
+static ThreadedHandler ThreadedDecodeEG(ThreadedRecord * rec,ThreadedDecoder & dec,const ThreadedForms & forms,Bitu size) {
+	if (ThreadedDecodeModrm(rec,dec)) {
+		rec->op2=ThreadedReg(size,dec.rm);
+		rec->flags=THREADED_WRITES;
+		return forms.mr;
+	}
+	rec->op1=ThreadedRMReg(size,dec.rm);
+	rec->op2=ThreadedReg(size,dec.rm);
+	return forms.rr;
+}
+
+static ThreadedHandler ThreadedDecodeGE(ThreadedRecord * rec,ThreadedDecoder & dec,const ThreadedForms & forms,Bitu size) {
+	bool mem=ThreadedDecodeModrm(rec,dec);
+	rec->op1=ThreadedReg(size,dec.rm);
+	if (mem) return forms.rm;
+	rec->op2=ThreadedRMReg(size,dec.rm);
+	return forms.rr;
+}
+
+// Ex,imm, the immediate after the memory operand
+static ThreadedHandler ThreadedDecodeEI(ThreadedRecord * rec,ThreadedDecoder & dec,const ThreadedForms & forms,Bitu size,Bitu imm_size) {
+	bool mem=ThreadedDecodeModrm(rec,dec);
+	rec->imm=ThreadedFetchv(dec,imm_size);
+	if (imm_size<size) rec->imm=(Bit32u)(Bit32s)(Bit8s)rec->imm;
+	if (mem) {
+		rec->flags=THREADED_WRITES;
+		return forms.mi;
+	}
+	rec->op1=ThreadedRMReg(size,dec.rm);
+	return forms.ri;
+}
+
+static ThreadedHandler ThreadedDecodeMovx(ThreadedRecord * rec,ThreadedDecoder & dec,ThreadedHandler rr,ThreadedHandler rm,Bitu src_size) {
+	bool mem=ThreadedDecodeModrm(rec,dec);
+	rec->op1=ThreadedReg(dec.size,dec.rm);
+	if (mem) return rm;
+	rec->op2=ThreadedRMReg(src_size,dec.rm);
+	return rr;
+}
+
+static ThreadedHandler ThreadedDecodeOpcode(ThreadedRecord * rec,ThreadedDecoder & dec) {
+	Bitu size=dec.size;
+	Bit8u op;
+	for (;;) {
+		// stray prefixes make the instruction too long to keep
+		if (dec.pos>=THREADED_MAXLEN) return 0;
+		op=ThreadedFetchb(dec);
+		switch (op) {
+		case 0x26:dec.seg=es;break;
+		case 0x2e:dec.seg=cs;break;
+		case 0x36:dec.seg=ss;break;
+		case 0x3e:dec.seg=ds;break;
+		case 0x64:dec.seg=fs;break;
+		case 0x65:dec.seg=gs;break;
+		case 0x66:
+			size=dec.size=cpu.code.big ? 1 : 2;
+			continue;
+		case 0x67:
+			dec.big_addr=!cpu.code.big;
+			continue;
+		default:
+			goto opcode;
+		}
+		dec.seg_override=true;
+	}
+opcode:
+	if (op<0x40 && (op&7)<6) {
+		const ThreadedForms * forms=threaded_alu[op>>3];
+		switch (op&7) {
+		case 0x00:return ThreadedDecodeEG(rec,dec,forms[0],0);
+		case 0x01:return ThreadedDecodeEG(rec,dec,forms[size],size);
+		case 0x02:return ThreadedDecodeGE(rec,dec,forms[0],0);
+		case 0x03:return ThreadedDecodeGE(rec,dec,forms[size],size);
+		case 0x04:
+			rec->op1=&reg_al;
+			rec->imm=ThreadedFetchb(dec);
+			return forms[0].ri;
+		case 0x05:
+			rec->op1=ThreadedReg(size,0);
+			rec->imm=ThreadedFetchv(dec,size);
+			return forms[size].ri;
+		}
+	}
+	if (op>=0x70 && op<0x80) {
+		rec->disp=(Bit32u)(Bit32s)(Bit8s)ThreadedFetchb(dec);
+		rec->imm=1;
+		rec->flags=THREADED_BRANCH;
+		return threaded_jcc[op&0xf][size-1];
+	}
+	if (op>=0xb0 && op<0xc0) {
+		Bitu reg_size=op<0xb8 ? 0 : size;
+		rec->op1=ThreadedReg(reg_size,(op&7)<<3);
+		rec->imm=ThreadedFetchv(dec,reg_size);
+		return threaded_mov[reg_size].ri;
+	}
+	switch (op) {
+	case 0x0f:
+		op=ThreadedFetchb(dec);
+		if (op>=0x80 && op<0x90) {
+			if (size==1) {
+				rec->disp=(Bit32u)(Bit32s)(Bit16s)ThreadedFetchw(dec);
+				rec->imm=2;
+			} else rec->disp=ThreadedFetchd(dec);
+			rec->flags=THREADED_BRANCH;
+			return threaded_jcc[op&0xf][size-1];
+		}
+		switch (op) {
+		case 0xb6:
+			if (size==1) return ThreadedDecodeMovx(rec,dec,Threaded_MOVZXWB_RR,Threaded_MOVZXWB_RM,0);
+			return ThreadedDecodeMovx(rec,dec,Threaded_MOVZXDB_RR,Threaded_MOVZXDB_RM,0);
+		case 0xbe:
+			if (size==1) return ThreadedDecodeMovx(rec,dec,Threaded_MOVSXWB_RR,Threaded_MOVSXWB_RM,0);
+			return ThreadedDecodeMovx(rec,dec,Threaded_MOVSXDB_RR,Threaded_MOVSXDB_RM,0);
+		case 0xb7:
+		case 0xbf:
+			if (size==1) return ThreadedDecodeGE(rec,dec,threaded_mov[1],1);
+			if (op==0xb7) return ThreadedDecodeMovx(rec,dec,Threaded_MOVZXDW_RR,Threaded_MOVZXDW_RM,1);
+			return ThreadedDecodeMovx(rec,dec,Threaded_MOVSXDW_RR,Threaded_MOVSXDW_RM,1);
+		}
+		return 0;
+	case 0x40:case 0x41:case 0x42:case 0x43:case 0x44:case 0x45:case 0x46:case 0x47:
+		rec->op1=ThreadedReg(size,(op&7)<<3);
+		return threaded_inc[size][0];
+	case 0x48:case 0x49:case 0x4a:case 0x4b:case 0x4c:case 0x4d:case 0x4e:case 0x4f:
+		rec->op1=ThreadedReg(size,(op&7)<<3);
+		return threaded_dec[size][0];
+	case 0x50:case 0x51:case 0x52:case 0x53:case 0x54:case 0x55:case 0x56:case 0x57:
+		rec->op1=ThreadedReg(size,(op&7)<<3);
+		rec->flags=THREADED_WRITES;
+		return size==1 ? Threaded_PUSHW : Threaded_PUSHD;
+	case 0x58:case 0x59:case 0x5a:case 0x5b:case 0x5c:case 0x5d:case 0x5e:case 0x5f:
+		rec->op1=ThreadedReg(size,(op&7)<<3);
+		return size==1 ? Threaded_POPW : Threaded_POPD;
+	case 0x80:
+	case 0x82:
+		dec.rm=dec.code[dec.pos];
+		return ThreadedDecodeEI(rec,dec,threaded_alu[(dec.rm>>3)&7][0],0,0);
+	case 0x81:
+		dec.rm=dec.code[dec.pos];
+		return ThreadedDecodeEI(rec,dec,threaded_alu[(dec.rm>>3)&7][size],size,size);
+	case 0x83:
+		dec.rm=dec.code[dec.pos];
+		return ThreadedDecodeEI(rec,dec,threaded_alu[(dec.rm>>3)&7][size],size,0);
+	case 0x84:return ThreadedDecodeEG(rec,dec,threaded_test[0],0);
+	case 0x85:return ThreadedDecodeEG(rec,dec,threaded_test[size],size);
+	case 0x86:
+	case 0x87:
+		{
+			Bitu xchg_size=op==0x86 ? 0 : size;
+			bool mem=ThreadedDecodeModrm(rec,dec);
+			rec->op1=ThreadedReg(xchg_size,dec.rm);
+			if (mem) {
+				rec->flags=THREADED_WRITES;
+				return threaded_xchg[xchg_size][1];
+			}
+			rec->op2=ThreadedRMReg(xchg_size,dec.rm);
+			return threaded_xchg[xchg_size][0];
+		}
+	case 0x88:
+		// the normal core checks the segment in protected mode
+		if (dec.code[dec.pos]==0x05 && !cpu.code.big) {
+			dec.pos++;
+			return 0;
+		}
+		return ThreadedDecodeEG(rec,dec,threaded_mov[0],0);
+	case 0x89:return ThreadedDecodeEG(rec,dec,threaded_mov[size],size);
+	case 0x8a:return ThreadedDecodeGE(rec,dec,threaded_mov[0],0);
+	case 0x8b:return ThreadedDecodeGE(rec,dec,threaded_mov[size],size);
+	case 0x8d:
+		if (!ThreadedDecodeModrm(rec,dec)) return 0;
+		rec->op1=ThreadedReg(size,dec.rm);
+		return size==1 ? Threaded_LEAW : Threaded_LEAD;
+	case 0x90:
+		return Threaded_NOP;
+	case 0x91:case 0x92:case 0x93:case 0x94:case 0x95:case 0x96:case 0x97:
+		rec->op1=ThreadedReg(size,0);
+		rec->op2=ThreadedReg(size,(op&7)<<3);
+		return threaded_xchg[size][0];
+	case 0x98:return size==1 ? Threaded_CBW : Threaded_CWDE;
+	case 0x99:return size==1 ? Threaded_CWD : Threaded_CDQ;
+	case 0xa0:
+	case 0xa1:
+	case 0xa2:
+	case 0xa3:
+		{
+			Bitu mov_size=(op&1) ? size : 0;
+			rec->base=&threaded.zero;
+			rec->index=&threaded.zero;
+			rec->scale=0;
+			rec->addr_mask=dec.big_addr ? 0xffffffff : 0xffff;
+			rec->disp=dec.big_addr ? ThreadedFetchd(dec) : ThreadedFetchw(dec);
+			rec->seg=dec.seg_override ? dec.seg : ds;
+			rec->op1=rec->op2=ThreadedReg(mov_size,0);
+			if (op<0xa2) return threaded_mov[mov_size].rm;
+			rec->flags=THREADED_WRITES;
+			return threaded_mov[mov_size].mr;
+		}
+	case 0xa8:
+		rec->op1=&reg_al;
+		rec->imm=ThreadedFetchb(dec);
+		return threaded_test[0].ri;
+	case 0xa9:
+		rec->op1=ThreadedReg(size,0);
+		rec->imm=ThreadedFetchv(dec,size);
+		return threaded_test[size].ri;
+	case 0xc2:
+	case 0xc3:
+		rec->imm=(op==0xc2) ? ThreadedFetchw(dec) : 0;
+		rec->flags=THREADED_BRANCH;
+		return size==1 ? Threaded_RETW : Threaded_RETD;
+	case 0xc6:return ThreadedDecodeEI(rec,dec,threaded_mov[0],0,0);
+	case 0xc7:return ThreadedDecodeEI(rec,dec,threaded_mov[size],size,size);
+	case 0xe8:
+		rec->disp=(size==1) ? (Bit32u)(Bit32s)(Bit16s)ThreadedFetchw(dec) : ThreadedFetchd(dec);
+		rec->flags=THREADED_WRITES|THREADED_BRANCH;
+		return size==1 ? Threaded_CALLW : Threaded_CALLD;
+	case 0xe9:
+		rec->disp=(size==1) ? (Bit32u)(Bit32s)(Bit16s)ThreadedFetchw(dec) : ThreadedFetchd(dec);
+		rec->flags=THREADED_BRANCH;
+		return size==1 ? Threaded_JMPW : Threaded_JMPD;
+	case 0xeb:
+		rec->disp=(Bit32u)(Bit32s)(Bit8s)ThreadedFetchb(dec);
+		rec->flags=THREADED_BRANCH;
+		return size==1 ? Threaded_JMPW : Threaded_JMPD;
+	case 0xf8:return Threaded_CLC;
+	case 0xf9:return Threaded_STC;
+	case 0xfc:return Threaded_CLD;
+	case 0xfd:return Threaded_STD;
+	case 0xfe:
+	case 0xff:
+		{
+			Bitu incdec_size=op==0xfe ? 0 : size;
+			Bitu which=(dec.code[dec.pos]>>3)&7;
+			if (which>1) {
+				dec.pos++;
+				return 0;
+			}
+			bool mem=ThreadedDecodeModrm(rec,dec);
+			if (mem) rec->flags=THREADED_WRITES;
+			else rec->op1=ThreadedRMReg(incdec_size,dec.rm);
+			return (which ? threaded_dec : threaded_inc)[incdec_size][mem ? 1 : 0];
+		}
+	}
+	return 0;
+}
+
+/* Decode the instruction in code into its record, an instruction without a
+   handler keeps the length read to find that out */
+static void ThreadedDecode(ThreadedRecord * rec,const Bit8u * code) {
+	ThreadedDecoder dec;
+	memcpy(dec.code,code,THREADED_MAXLEN);
+	memset(&dec.code[THREADED_MAXLEN],0,THREADED_MAXLEN);
+	dec.pos=0;
+	dec.size=cpu.code.big ? 2 : 1;
+	dec.big_addr=cpu.code.big;
+	dec.seg_override=false;
+	dec.seg=ds;
+	rec->flags=0;
+	rec->handler=ThreadedDecodeOpcode(rec,dec);
+	if (dec.pos>THREADED_MAXLEN) {
+		rec->handler=0;
+		dec.pos=THREADED_MAXLEN;
+	}
+	rec->len=(Bit8u)dec.pos;
+}
+
+/* Decode the block at ip, it ends after a branch, before an instruction
+   without a handler or one that starts too near the end of the page */
+static void ThreadedDecodeBlock(ThreadedBlock * block,PhysPt ip,HostPt host) {
+	Bitu size=0;
+	Bitu count=0;
+	while (count<THREADED_BLOCKLEN && ((ip+size)&(MEM_PAGESIZE-1))<=MEM_PAGESIZE-THREADED_MAXLEN) {
+		ThreadedRecord * rec=&block->records[count];
+		ThreadedDecode(rec,host+ip+size);
+		if (!rec->handler) {
+			if (!count) size=rec->len;
+			break;
+		}
+		if (size+rec->len>THREADED_BLOCKSIZE) break;
+		size+=rec->len;
+		count++;
+		if (rec->flags & THREADED_BRANCH) break;
+	}
+	block->ip=ip;
+	block->mode=1+cpu.code.big;
+	block->count=(Bit8u)count;
+	block->size=(Bit8u)size;
+	memcpy(block->bytes,host+ip,size);
+}
+
+Bits CPU_Core_Threaded_Run(void) {
+	while (CPU_Cycles-->0) {
+		PhysPt ip=SegPhys(cs)+reg_eip;
+		HostPt host=get_tlb_read(ip);
+		if (GCC_LIKELY(host && (ip&(MEM_PAGESIZE-1))<=MEM_PAGESIZE-THREADED_MAXLEN)) {
+			ThreadedBlock * block=&threaded.blocks[(ip ^ (ip>>14)) & (THREADED_BLOCKS-1)];
+			if (GCC_UNLIKELY(block->ip!=ip || block->mode!=1+cpu.code.big ||
+				memcmp(host+ip,block->bytes,block->size))) {
+				ThreadedDecodeBlock(block,ip,host);
+			}
+			if (GCC_LIKELY(block->count)) {
+				const ThreadedRecord * rec=block->records;
+				const ThreadedRecord * last=rec+block->count-1;
+				for (;;) {
+#if C_DEBUG
+#if C_HEAVY_DEBUG
+					if (DEBUG_HeavyIsBreakpoint()) {
+						FillFlags();
+						return debugCallback;
+					};
+#endif
+					cycle_count++;
+#endif
+					rec->handler(rec);
+					if (rec==last) {
+						if (!(rec->flags & THREADED_BRANCH)) reg_eip+=rec->len;
+						break;
+					}
+					reg_eip+=rec->len;
+					// code written over in the block is decoded again from here
+					if ((rec->flags & THREADED_WRITES) && memcmp(host+ip,block->bytes,block->size)) break;
+					if (CPU_Cycles<=0) break;
+					CPU_Cycles--;
+					rec++;
+				}
+				continue;
+			}
+		}
+		// the normal core runs the instruction, it stops early (CPU_Cycles left
+		// at 0) when the instruction needs the cpu loop, e.g. to let an irq in
+		Bits old_cycles=CPU_Cycles;
+		CPU_Cycles=1;
+		Bits ret=CPU_Core_Normal_Run();
+		if (!ret && CPU_Cycles<0 && cpudecoder==&CPU_Core_Threaded_Run) {
+			CPU_Cycles=old_cycles;
+			continue;
+		}
+		CPU_CycleLeft+=old_cycles;
+		if (cpudecoder==&CPU_Core_Normal_Trap_Run) cpudecoder=&CPU_Core_Threaded_Trap_Run;
+		return ret;
+	}
+	FillFlags();
+	return CBRET_NONE;
+}
+
+Bits CPU_Core_Threaded_Trap_Run(void) {
+	Bits oldCycles = CPU_Cycles;
+	CPU_Cycles = 1;
+	cpu.trap_skip = false;
+
+	Bits ret=CPU_Core_Normal_Run();
+	if (!cpu.trap_skip) CPU_HW_Interrupt(1);
+	CPU_Cycles = oldCycles-1;
+	cpudecoder = &CPU_Core_Threaded_Run;
+
+	return ret;
+}
+
+void CPU_Core_Threaded_Init(void) {
+
+}
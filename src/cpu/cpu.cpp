@@ -30,6 +30,7 @@
 #include "paging.h"
 #include "lazyflags.h"
 #include "support.h"
+#include "pic.h"
 
 Bitu DEBUG_EnableDebugger(void);
 extern void GFX_SetTitle(Bit32s cycles ,Bits frameskip,bool paused);
@@ -60,6 +61,7 @@ Bit64s CPU_IODelayRemoved = 0;
 CPU_Decoder * cpudecoder;
 bool CPU_CycleAutoAdjust = false;
 bool CPU_SkipCycleAutoAdjust = false;
+bool CPU_CycleGovernor = false;		// Max cycles steered by the feedback governor in dosbox.cpp
 Bitu CPU_AutoDetermineMode = 0;
 
 Bitu CPU_ArchitectureType = CPU_ARCHTYPE_MIXED;
@@ -71,6 +73,7 @@ Bitu CPU_PrefetchQueueSize=0;
 void CPU_Core_Full_Init(void);
 void CPU_Core_Normal_Init(void);
 void CPU_Core_Simple_Init(void);
+void CPU_Core_Threaded_Init(void);
 #if (C_DYNAMIC_X86)
 void CPU_Core_Dyn_X86_Init(void);
 void CPU_Core_Dyn_X86_Cache_Init(bool enable_cache);
@@ -80,6 +83,7 @@ void CPU_Core_Dyn_X86_SetFPUMode(bool dh_fpu);
 void CPU_Core_Dynrec_Init(void);
 void CPU_Core_Dynrec_Cache_Init(bool enable_cache);
 void CPU_Core_Dynrec_Cache_Close(void);
+void CPU_Core_Dynrec_Cache_SetSize(Bitu megabytes);
 #endif
 
 /* In debug mode exceptions are tested and dosbox exits when 
@@ -2012,6 +2016,28 @@ bool CPU_PopSeg(SegNames seg,bool use32) {
 	return false;
 }
 
+/* The time stamp counter follows the cycles actually emulated */
+static struct {
+	Bit64u base;		// Cycles of the finished ticks
+	Bit64u last;		// Last value read, the counter never runs backwards
+} cpu_tsc;
+
+/* Called at the end of each tick, before the cycle counters are reset */
+void CPU_TimeStampTick(void) {
+	/* Use a fixed rate when in auto cycles mode as else the reported speed changes constantly */
+	if (CPU_CycleAutoAdjust) cpu_tsc.base+=70000;
+	else if (PIC_TickIndexND()>0) cpu_tsc.base+=(Bit64u)PIC_TickIndexND();
+}
+
+Bit64u CPU_ReadTimeStamp(void) {
+	Bit64u tsc=cpu_tsc.base;
+	if (CPU_CycleAutoAdjust) tsc+=(Bit64u)(PIC_TickIndex()*70000.0);
+	else if (PIC_TickIndexND()>0) tsc+=(Bit64u)PIC_TickIndexND();
+	if (tsc<cpu_tsc.last) tsc=cpu_tsc.last;
+	cpu_tsc.last=tsc;
+	return tsc;
+}
+
 bool CPU_CPUID(void) {
 	if (CPU_ArchitectureType<CPU_ARCHTYPE_486NEWSLOW) return false;
 	switch (reg_eax) {
@@ -2033,6 +2059,11 @@ bool CPU_CPUID(void) {
 			reg_ebx=0;			/* Not Supported */
 			reg_ecx=0;			/* No features */
 			reg_edx=0x00000011;	/* FPU+TimeStamp/RDTSC */
+		} else if (CPU_ArchitectureType==CPU_ARCHTYPE_PMMXSLOW) {
+			reg_eax=0x543;		/* intel pentium mmx */
+			reg_ebx=0;			/* Not Supported */
+			reg_ecx=0;			/* No features */
+			reg_edx=0x00800011;	/* FPU+TimeStamp/RDTSC+MMX */
 		} else {
 			return false;
 		}
@@ -2215,7 +2246,8 @@ public:
 			cpu.drx[i]=0;
 			cpu.trx[i]=0;
 		}
-		if (CPU_ArchitectureType==CPU_ARCHTYPE_PENTIUMSLOW) {
+		if ((CPU_ArchitectureType==CPU_ARCHTYPE_PENTIUMSLOW) ||
+			(CPU_ArchitectureType==CPU_ARCHTYPE_PMMXSLOW)) {
 			cpu.drx[6]=0xffff0ff0;
 		} else {
 			cpu.drx[6]=0xffff1ff0;
@@ -2226,6 +2258,7 @@ public:
 		CPU_Core_Normal_Init();
 		CPU_Core_Simple_Init();
 		CPU_Core_Full_Init();
+		CPU_Core_Threaded_Init();
 #if (C_DYNAMIC_X86)
 		CPU_Core_Dyn_X86_Init();
 #elif (C_DYNREC)
@@ -2247,10 +2280,12 @@ public:
 		std::string type = p->GetSection()->Get_string("type");
 		std::string str ;
 		CommandLine cmd(0,p->GetSection()->Get_string("parameters"));
-		if (type=="max") {
+		CPU_CycleGovernor=false;
+		if ((type=="max") || (type=="governor")) {
 			CPU_CycleMax=0;
 			CPU_CyclePercUsed=100;
 			CPU_CycleAutoAdjust=true;
+			CPU_CycleGovernor=(type=="governor");
 			CPU_CycleLimit=-1;
 			for (Bitu cmdnum=1; cmdnum<=cmd.GetCount(); cmdnum++) {
 				if (cmd.FindCommand(cmdnum,str)) {
@@ -2329,6 +2364,8 @@ public:
 			cpudecoder=&CPU_Core_Simple_Run;
 		} else if (core == "full") {
 			cpudecoder=&CPU_Core_Full_Run;
+		} else if (core == "threaded") {
+			cpudecoder=&CPU_Core_Threaded_Run;
 		} else if (core == "auto") {
 			cpudecoder=&CPU_Core_Normal_Run;
 #if (C_DYNAMIC_X86)
@@ -2353,6 +2390,7 @@ public:
 #if (C_DYNAMIC_X86)
 		CPU_Core_Dyn_X86_Cache_Init((core == "dynamic") || (core == "dynamic_nodhfpu"));
 #elif (C_DYNREC)
+		CPU_Core_Dynrec_Cache_SetSize(section->Get_int("dynrec_cache"));
 		CPU_Core_Dynrec_Cache_Init( core == "dynamic" );
 #endif
 
@@ -2392,6 +2430,8 @@ public:
 			}
 		} else if (cputype == "pentium_slow") {
 			CPU_ArchitectureType = CPU_ARCHTYPE_PENTIUMSLOW;
+		} else if (cputype == "pentium_mmx") {
+			CPU_ArchitectureType = CPU_ARCHTYPE_PMMXSLOW;
 		}
 
 		if (CPU_ArchitectureType>=CPU_ARCHTYPE_486NEWSLOW) CPU_extflags_toggle=(FLAG_ID|FLAG_AC);
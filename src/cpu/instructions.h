@@ -231,8 +231,9 @@
 	if (!(op2&0x7)) {								\
 		if (op2&0x18) {								\
 			FillFlagsNoCFOF();						\
-			SETFLAGBIT(CF,op1 & 1);					\
-			SETFLAGBIT(OF,(op1 & 1) ^ (op1 >> 7));	\
+			lf_var1b=load(op1);						\
+			SETFLAGBIT(CF,lf_var1b & 1);			\
+			SETFLAGBIT(OF,(lf_var1b & 1) ^ (lf_var1b >> 7));	\
 		}											\
 		break;										\
 	}												\
@@ -249,8 +250,9 @@
 	if (!(op2&0xf)) {								\
 		if (op2&0x10) {								\
 			FillFlagsNoCFOF();						\
-			SETFLAGBIT(CF,op1 & 1);					\
-			SETFLAGBIT(OF,(op1 & 1) ^ (op1 >> 15));	\
+			lf_var1w=load(op1);						\
+			SETFLAGBIT(CF,lf_var1w & 1);			\
+			SETFLAGBIT(OF,(lf_var1w & 1) ^ (lf_var1w >> 15));	\
 		}											\
 		break;										\
 	}												\
@@ -279,8 +281,9 @@
 	if (!(op2&0x7)) {								\
 		if (op2&0x18) {								\
 			FillFlagsNoCFOF();						\
-			SETFLAGBIT(CF,op1>>7);					\
-			SETFLAGBIT(OF,(op1>>7) ^ ((op1>>6) & 1));			\
+			lf_var1b=load(op1);						\
+			SETFLAGBIT(CF,lf_var1b>>7);				\
+			SETFLAGBIT(OF,(lf_var1b>>7) ^ ((lf_var1b>>6) & 1));	\
 		}											\
 		break;										\
 	}												\
@@ -297,8 +300,9 @@
 	if (!(op2&0xf)) {							\
 		if (op2&0x10) {							\
 			FillFlagsNoCFOF();					\
-			SETFLAGBIT(CF,op1>>15);				\
-			SETFLAGBIT(OF,(op1>>15) ^ ((op1>>14) & 1));			\
+			lf_var1w=load(op1);					\
+			SETFLAGBIT(CF,lf_var1w>>15);		\
+			SETFLAGBIT(OF,(lf_var1w>>15) ^ ((lf_var1w>>14) & 1));	\
 		}										\
 		break;									\
 	}											\
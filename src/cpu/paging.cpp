@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <vector>
 
 #include "dosbox.h"
 #include "mem.h"
@@ -29,6 +30,7 @@
 #include "cpu.h"
 #include "debug.h"
 #include "setup.h"
+#include "perf_stats.h"
 
 #define LINK_TOTAL		(64*1024)
 
@@ -37,6 +39,31 @@
 
 PagingBlock paging;
 
+// the page directory and table entries each link was made from, and the
+// privilege level and cpu type InitPage decided the kind of link with
+struct PagingLinkTables {
+	Bit32u pde,pte;
+	bool user;
+	Bitu archtype;
+	bool valid;
+};
+static PagingLinkTables link_tables[PAGING_LINKS];
+// set by InitPage for the link it makes next, other links are not kept
+static PagingLinkTables link_tables_next;
+
+static INLINE void NextLinkTables(Bit32u pde,Bit32u pte) {
+	link_tables_next.pde=pde;
+	link_tables_next.pte=pte;
+	link_tables_next.user=((cpu.cpl&cpu.mpl)==3);
+	link_tables_next.archtype=CPU_ArchitectureType;
+	link_tables_next.valid=true;
+}
+
+static INLINE void RecordLinkTables(void) {
+	link_tables[paging.links.used]=link_tables_next;
+	link_tables_next.valid=false;
+}
+
 
 Bitu PageHandler::readb(PhysPt addr) {
 	E_Exit("No byte handler for read from %d",addr);	
@@ -237,6 +264,7 @@ static INLINE bool InitPage_CheckUseraccess(Bitu u1,Bitu u2) {
 	case CPU_ARCHTYPE_486OLDSLOW:
 	case CPU_ARCHTYPE_486NEWSLOW:
 	case CPU_ARCHTYPE_PENTIUMSLOW:
+	case CPU_ARCHTYPE_PMMXSLOW:
 		return ((u1)==0) || ((u2)==0);
 	}
 }
@@ -342,6 +370,7 @@ public:
 					case CPU_ARCHTYPE_486OLDSLOW:
 					case CPU_ARCHTYPE_486NEWSLOW:
 					case CPU_ARCHTYPE_PENTIUMSLOW:
+					case CPU_ARCHTYPE_PMMXSLOW:
 						priv_check=1;
 						break;
 					}
@@ -360,6 +389,7 @@ public:
 					case CPU_ARCHTYPE_486OLDSLOW:
 					case CPU_ARCHTYPE_486NEWSLOW:
 					case CPU_ARCHTYPE_PENTIUMSLOW:
+					case CPU_ARCHTYPE_PMMXSLOW:
 						priv_check=2;
 						break;
 					}
@@ -367,6 +397,8 @@ public:
 				// check if actually failing the write-protected check
 				if (writing && USERWRITE_PROHIBITED) priv_check=3;
 			}
+			// a link made behind a page fault is not kept across CR3 switches
+			bool keep_link=(priv_check!=3);
 			if (priv_check==3) {
 				LOG(LOG_PAGING,LOG_NORMAL)("Page access denied: cpl=%i, %x:%x:%x:%x",
 					cpu.cpl,entry.block.us,table.block.us,entry.block.wr,table.block.wr);
@@ -389,6 +421,8 @@ public:
 			}
 
 			phys_page=entry.block.base;
+			PERF_COUNT(PERF_COUNTER_TLB_FILL,1);
+			if (keep_link) NextLinkTables(table.load,entry.load);
 			
 			// now see how the page should be linked best, if we need to catch privilege
 			// checks later on it should be linked as read-only page
@@ -644,34 +678,80 @@ bool PAGING_ForcePageInit(Bitu lin_addr) {
 }
 
 #if defined(USE_FULL_TLB)
+static void PAGING_InitTLBBank(tlb_bank * bank) {
+	for (Bitu i=0;i<TLB_BANK_SIZE;i++) {
+		bank->read[i]=0;
+		bank->write[i]=0;
+		bank->readhandler[i]=&init_page_handler;
+		bank->writehandler[i]=&init_page_handler;
+	}
+}
+
+#if defined(USE_BANKED_TLB)
+/* Read only bank of unlinked pages shared by all unallocated directory entries,
+   so lookups never have to check for a missing bank */
+static tlb_bank tlb_unlinked_bank;
+
 void PAGING_InitTLB(void) {
-	for (Bitu i=0;i<TLB_SIZE;i++) {
-		paging.tlb.read[i]=0;
-		paging.tlb.write[i]=0;
-		paging.tlb.readhandler[i]=&init_page_handler;
-		paging.tlb.writehandler[i]=&init_page_handler;
+	PAGING_InitTLBBank(&tlb_unlinked_bank);
+	for (Bitu i=0;i<TLB_DIR_SIZE;i++) {
+		if (paging.tlb_dir[i] && paging.tlb_dir[i]!=&tlb_unlinked_bank) free(paging.tlb_dir[i]);
+		paging.tlb_dir[i]=&tlb_unlinked_bank;
 	}
 	paging.links.used=0;
 }
 
-void PAGING_ClearTLB(void) {
+/* Bank holding lin_page, or NULL if nothing was ever linked in it */
+static INLINE tlb_bank * PAGING_FindTLBBank(Bitu lin_page) {
+	tlb_bank * bank=paging.tlb_dir[lin_page>>TLB_BANK_SHIFT];
+	return (bank==&tlb_unlinked_bank) ? NULL : bank;
+}
+
+static INLINE tlb_bank * PAGING_GetTLBBank(Bitu lin_page) {
+	tlb_bank * & bank=paging.tlb_dir[lin_page>>TLB_BANK_SHIFT];
+	if (GCC_UNLIKELY(bank==&tlb_unlinked_bank)) {
+		bank=(tlb_bank *)malloc(sizeof(tlb_bank));
+		if (!bank) E_Exit("Out of Memory");
+		PAGING_InitTLBBank(bank);
+	}
+	return bank;
+}
+#else
+void PAGING_InitTLB(void) {
+	PAGING_InitTLBBank(&paging.tlb);
+	paging.links.used=0;
+}
+
+static INLINE tlb_bank * PAGING_FindTLBBank(Bitu /*lin_page*/) {
+	return &paging.tlb;
+}
+
+static INLINE tlb_bank * PAGING_GetTLBBank(Bitu /*lin_page*/) {
+	return &paging.tlb;
+}
+#endif
+
+static INLINE void PAGING_UnlinkPage(Bitu lin_page) {
+	tlb_bank * bank=PAGING_FindTLBBank(lin_page);
+	if (!bank) return;
+	Bitu index=lin_page & TLB_BANK_MASK;
+	bank->read[index]=0;
+	bank->write[index]=0;
+	bank->readhandler[index]=&init_page_handler;
+	bank->writehandler[index]=&init_page_handler;
+}
+
+static void PAGING_ClearLinks(void) {
 	Bit32u * entries=&paging.links.entries[0];
 	for (;paging.links.used>0;paging.links.used--) {
-		Bitu page=*entries++;
-		paging.tlb.read[page]=0;
-		paging.tlb.write[page]=0;
-		paging.tlb.readhandler[page]=&init_page_handler;
-		paging.tlb.writehandler[page]=&init_page_handler;
+		PAGING_UnlinkPage(*entries++);
 	}
 	paging.links.used=0;
 }
 
 void PAGING_UnlinkPages(Bitu lin_page,Bitu pages) {
 	for (;pages>0;pages--) {
-		paging.tlb.read[lin_page]=0;
-		paging.tlb.write[lin_page]=0;
-		paging.tlb.readhandler[lin_page]=&init_page_handler;
-		paging.tlb.writehandler[lin_page]=&init_page_handler;
+		PAGING_UnlinkPage(lin_page);
 		lin_page++;
 	}
 }
@@ -679,10 +759,7 @@ void PAGING_UnlinkPages(Bitu lin_page,Bitu pages) {
 void PAGING_MapPage(Bitu lin_page,Bitu phys_page) {
 	if (lin_page<LINK_START) {
 		paging.firstmb[lin_page]=phys_page;
-		paging.tlb.read[lin_page]=0;
-		paging.tlb.write[lin_page]=0;
-		paging.tlb.readhandler[lin_page]=&init_page_handler;
-		paging.tlb.writehandler[lin_page]=&init_page_handler;
+		PAGING_UnlinkPage(lin_page);
 	} else {
 		PAGING_LinkPage(lin_page,phys_page);
 	}
@@ -699,15 +776,18 @@ void PAGING_LinkPage(Bitu lin_page,Bitu phys_page) {
 		PAGING_ClearTLB();
 	}
 
-	paging.tlb.phys_page[lin_page]=phys_page;
-	if (handler->flags & PFLAG_READABLE) paging.tlb.read[lin_page]=handler->GetHostReadPt(phys_page)-lin_base;
-	else paging.tlb.read[lin_page]=0;
-	if (handler->flags & PFLAG_WRITEABLE) paging.tlb.write[lin_page]=handler->GetHostWritePt(phys_page)-lin_base;
-	else paging.tlb.write[lin_page]=0;
+	tlb_bank * bank=PAGING_GetTLBBank(lin_page);
+	Bitu index=lin_page & TLB_BANK_MASK;
+	bank->phys_page[index]=phys_page;
+	if (handler->flags & PFLAG_READABLE) bank->read[index]=handler->GetHostReadPt(phys_page)-lin_base;
+	else bank->read[index]=0;
+	if (handler->flags & PFLAG_WRITEABLE) bank->write[index]=handler->GetHostWritePt(phys_page)-lin_base;
+	else bank->write[index]=0;
 
+	RecordLinkTables();
 	paging.links.entries[paging.links.used++]=lin_page;
-	paging.tlb.readhandler[lin_page]=handler;
-	paging.tlb.writehandler[lin_page]=handler;
+	bank->readhandler[index]=handler;
+	bank->writehandler[index]=handler;
 }
 
 void PAGING_LinkPage_ReadOnly(Bitu lin_page,Bitu phys_page) {
@@ -721,14 +801,17 @@ void PAGING_LinkPage_ReadOnly(Bitu lin_page,Bitu phys_page) {
 		PAGING_ClearTLB();
 	}
 
-	paging.tlb.phys_page[lin_page]=phys_page;
-	if (handler->flags & PFLAG_READABLE) paging.tlb.read[lin_page]=handler->GetHostReadPt(phys_page)-lin_base;
-	else paging.tlb.read[lin_page]=0;
-	paging.tlb.write[lin_page]=0;
+	tlb_bank * bank=PAGING_GetTLBBank(lin_page);
+	Bitu index=lin_page & TLB_BANK_MASK;
+	bank->phys_page[index]=phys_page;
+	if (handler->flags & PFLAG_READABLE) bank->read[index]=handler->GetHostReadPt(phys_page)-lin_base;
+	else bank->read[index]=0;
+	bank->write[index]=0;
 
+	RecordLinkTables();
 	paging.links.entries[paging.links.used++]=lin_page;
-	paging.tlb.readhandler[lin_page]=handler;
-	paging.tlb.writehandler[lin_page]=&init_page_handler_userro;
+	bank->readhandler[index]=handler;
+	bank->writehandler[index]=&init_page_handler_userro;
 }
 
 #else
@@ -753,7 +836,7 @@ void PAGING_InitTLB(void) {
  	paging.links.used=0;
 }
 
-void PAGING_ClearTLB(void) {
+static void PAGING_ClearLinks(void) {
 	Bit32u * entries=&paging.links.entries[0];
 	for (;paging.links.used>0;paging.links.used--) {
 		Bitu page=*entries++;
@@ -807,6 +890,7 @@ void PAGING_LinkPage(Bitu lin_page,Bitu phys_page) {
 	if (handler->flags & PFLAG_WRITEABLE) entry->write=handler->GetHostWritePt(phys_page)-lin_base;
 	else entry->write=0;
 
+ 	RecordLinkTables();
  	paging.links.entries[paging.links.used++]=lin_page;
 	entry->readhandler=handler;
 	entry->writehandler=handler;
@@ -829,6 +913,7 @@ void PAGING_LinkPage_ReadOnly(Bitu lin_page,Bitu phys_page) {
 	else entry->read=0;
 	entry->write=0;
 
+ 	RecordLinkTables();
  	paging.links.entries[paging.links.used++]=lin_page;
 	entry->readhandler=handler;
 	entry->writehandler=&init_page_handler_userro;
@@ -837,14 +922,117 @@ void PAGING_LinkPage_ReadOnly(Bitu lin_page,Bitu phys_page) {
 #endif
 
 
+/* The links of the last few page directories are kept when CR3 changes, so
+   switching back to one of them relinks its pages directly instead of going
+   through the InitPageHandler again. Only links InitPage made without a page
+   fault are kept. A page is relinked while its page directory and table
+   entries are unchanged since it was linked and its physical page still has
+   the same handler, and while InitPage would link it the same way: either
+   both entries allow user access and writes, or the privilege level (user
+   or supervisor) and the cpu type are the ones it was linked with. Any other
+   TLB flush drops the saved links. */
+#define PAGING_CONTEXTS		4
+
+struct PagingContextLink {
+	Bit32u lin_page,phys_page;
+	Bit32u pde,pte;
+	bool user;
+	Bitu archtype;
+	PageHandler * handler;
+	bool read_only;
+};
+
+static struct {
+	bool valid;
+	Bitu cr3;
+	Bitu last_used;
+	std::vector<PagingContextLink> links;
+} paging_contexts[PAGING_CONTEXTS];
+static Bitu paging_contexts_clock=0;
+
+static void PAGING_SaveContext(Bitu cr3) {
+	// reuse the slot of this directory, else a free or the least recently used one
+	Bitu slot=0;
+	for (Bitu i=0;i<PAGING_CONTEXTS;i++) {
+		if (paging_contexts[i].valid && paging_contexts[i].cr3==cr3) {
+			slot=i;
+			break;
+		}
+		if (!paging_contexts[slot].valid) continue;
+		if (!paging_contexts[i].valid || paging_contexts[i].last_used<paging_contexts[slot].last_used) slot=i;
+	}
+	paging_contexts[slot].valid=true;
+	paging_contexts[slot].cr3=cr3;
+	paging_contexts[slot].last_used=paging_contexts_clock++;
+	paging_contexts[slot].links.clear();
+	for (Bitu i=0;i<paging.links.used;i++) {
+		Bitu lin_addr=paging.links.entries[i] << 12;
+		PageHandler * handler=get_tlb_readhandler(lin_addr);
+		if (handler->flags & PFLAG_INIT) continue;		// unlinked again
+		if (!link_tables[i].valid) continue;
+		PagingContextLink link;
+		link.lin_page=paging.links.entries[i];
+		link.phys_page=PAGING_GetPhysicalPage(lin_addr) >> 12;
+		link.pde=link_tables[i].pde;
+		link.pte=link_tables[i].pte;
+		link.user=link_tables[i].user;
+		link.archtype=link_tables[i].archtype;
+		link.handler=handler;
+		link.read_only=(get_tlb_writehandler(lin_addr)==&init_page_handler_userro);
+		paging_contexts[slot].links.push_back(link);
+	}
+}
+
+static void PAGING_RestoreContext(Bitu cr3) {
+	for (Bitu slot=0;slot<PAGING_CONTEXTS;slot++) {
+		if (!paging_contexts[slot].valid || paging_contexts[slot].cr3!=cr3) continue;
+		std::vector<PagingContextLink> & links=paging_contexts[slot].links;
+		for (Bitu i=0;i<links.size();i++) {
+			const PagingContextLink & link=links[i];
+			if (phys_readd((paging.base.page<<12)+(link.lin_page >> 10)*4)!=link.pde) continue;
+			if (phys_readd((link.pde & ~4095)+(link.lin_page & 0x3ff)*4)!=link.pte) continue;
+			if (MEM_GetPageHandler(link.phys_page)!=link.handler) continue;
+			// U/S and R/W set in both entries are linked alike at every level
+			if ((link.pde & link.pte & 6)!=6) {
+				if (link.user!=((cpu.cpl&cpu.mpl)==3)) continue;
+				if (link.archtype!=CPU_ArchitectureType) continue;
+			}
+			// kept again on the next switch
+			link_tables_next.pde=link.pde;
+			link_tables_next.pte=link.pte;
+			link_tables_next.user=link.user;
+			link_tables_next.archtype=link.archtype;
+			link_tables_next.valid=true;
+			if (link.read_only) PAGING_LinkPage_ReadOnly(link.lin_page,link.phys_page);
+			else PAGING_LinkPage(link.lin_page,link.phys_page);
+			PERF_COUNT(PERF_COUNTER_TLB_RESTORE,1);
+		}
+		// the links belong to the TLB again until the next switch
+		paging_contexts[slot].valid=false;
+		links.clear();
+		return;
+	}
+}
+
+void PAGING_ClearTLB(void) {
+	for (Bitu slot=0;slot<PAGING_CONTEXTS;slot++) {
+		paging_contexts[slot].valid=false;
+		paging_contexts[slot].links.clear();
+	}
+	PAGING_ClearLinks();
+}
+
 void PAGING_SetDirBase(Bitu cr3) {
+	Bitu old_cr3=paging.cr3;
 	paging.cr3=cr3;
 	
 	paging.base.page=cr3 >> 12;
 	paging.base.addr=cr3 & ~4095;
 //	LOG(LOG_PAGING,LOG_NORMAL)("CR3:%X Base %X",cr3,paging.base.page);
 	if (paging.enabled) {
-		PAGING_ClearTLB();
+		PAGING_SaveContext(old_cr3);
+		PAGING_ClearLinks();
+		PAGING_RestoreContext(cr3);
 	}
 }
 
@@ -75,6 +75,9 @@ static void DrawVariables(void);
 
 char* AnalyzeInstruction(char* inst, bool saveSelector);
 Bit32u GetHexValue(char* str, char*& hex);
+#if C_HEAVY_DEBUG && C_DYNREC
+void CPU_Core_Dynrec_InvalidateBreakpoint(PhysPt address);
+#endif
 
 #if 0
 class DebugPageHandler : public PageHandler {
@@ -323,6 +326,10 @@ void CBreakpoint::Activate(bool _active)
 			};
 		}
 	}
+#elif C_DYNREC
+	// The recompiler only checks breakpoints that were active when the code was translated
+	if (GetType() == BKPNT_PHYSICAL && active != _active)
+		CPU_Core_Dynrec_InvalidateBreakpoint(location);
 #endif
 	active = _active;
 };
@@ -550,11 +557,24 @@ bool CBreakpoint::IsBreakpoint(Bit16u seg, Bit32u off)
 	return FindPhysBreakpoint(seg, off, false) != 0;
 }
 
+// is there an active execution breakpoint at the linear address ?
+bool CBreakpoint::HasActiveBreakpoint(PhysPt adr)
+{
+	std::list<CBreakpoint*>::iterator i;
+	for (i = BPoints.begin(); i != BPoints.end(); ++i) {
+		CBreakpoint* bp = (*i);
+		if (bp->GetType() == BKPNT_PHYSICAL && bp->GetLocation() == adr && bp->IsActive())
+			return true;
+	}
+	return false;
+}
+
 bool CBreakpoint::DeleteBreakpoint(Bit16u seg, Bit32u off)
 {
 	CBreakpoint* bp = FindPhysBreakpoint(seg, off, false);
 	if (bp) {
 		BPoints.remove(bp);
+		bp->Activate(false);
 		delete bp;
 		return true;
 	}
@@ -1326,6 +1346,15 @@ bool ParseCommand(char* str) {
 		return true;
 	};
 
+	if (command == "FUZZCORES") { // Compare the cores on random code
+		Bitu cases = GetHexValue(found,found); found++;
+		Bit32u seed = GetHexValue(found,found);
+		if (!seed) seed = 1;
+		Bitu failures = FUZZ_Cores(cases ? cases : 0x100,seed,&DEBUG_ShowMsg);
+		DEBUG_ShowMsg("FUZZ: %X cases, %X failures, next seed %X.\n",(Bit32u)(cases ? cases : 0x100),(Bit32u)failures,seed);
+		return true;
+	};
+
 	if(command == "TIMERIRQ") { //Start a timer irq
 		DEBUG_RaiseTimerIrq(); 
 		DEBUG_ShowMsg("Debug: Timer Int started.\n");
@@ -1393,6 +1422,7 @@ bool ParseCommand(char* str) {
 		DEBUG_ShowMsg("PAGING [page]             - Display content of page table.\n");
 		DEBUG_ShowMsg("EXTEND                    - Toggle additional info.\n");
 		DEBUG_ShowMsg("TIMERIRQ                  - Run the system timer.\n");
+		DEBUG_ShowMsg("FUZZCORES [cases] [seed]  - Compare the cpu cores on random code.\n");
 
 		DEBUG_ShowMsg("HELP                      - Help\n");
 		DEBUG_ShowMsg("Keys------------------------------------------------\n");
@@ -295,11 +295,15 @@ static char const *second[] = {
   0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0,
 /* 6 */
-  0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0,
+  "punpcklbw %GM,%EM", "punpcklwd %GM,%EM", "punpckldq %GM,%EM", "packsswb %GM,%EM",
+  "pcmpgtb %GM,%EM",  "pcmpgtw %GM,%EM", "pcmpgtd %GM,%EM", "packuswb %GM,%EM",
+  "punpckhbw %GM,%EM", "punpckhwd %GM,%EM", "punpckhdq %GM,%EM", "packssdw %GM,%EM",
+  0,                  0,                 "movd %GM,%Ed",   "movq %GM,%EM",
 /* 7 */
-  0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0,
+  0,                  "%g8w %EM,%Ib",    "%g8d %EM,%Ib",   "%g9 %EM,%Ib",
+  "pcmpeqb %GM,%EM",  "pcmpeqw %GM,%EM", "pcmpeqd %GM,%EM", "emms",
+  0,                  0,                 0,                0,
+  0,                  0,                 "movd %Ed,%GM",   "movq %EM,%GM",
 /* 8 */
   "jo %Jv",           "jno %Jv",         "jb %Jv",         "jnb %Jv",
   "jz %Jv",           "jnz %Jv",         "jbe %Jv",        "ja %Jv",
@@ -326,14 +330,20 @@ static char const *second[] = {
   "bswap eax",        "bswap ecx",       "bswap edx",      "bswap ebx",
   "bswap esp",        "bswap ebp",       "bswap esi",      "bswap edi",
 /* d */
-  0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0,
+  0,                  "psrlw %GM,%EM",   "psrld %GM,%EM",  "psrlq %GM,%EM",
+  0,                  "pmullw %GM,%EM",  0,                0,
+  "psubusb %GM,%EM",  "psubusw %GM,%EM", 0,                "pand %GM,%EM",
+  "paddusb %GM,%EM",  "paddusw %GM,%EM", 0,                "pandn %GM,%EM",
 /* e */
-  0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0,
+  0,                  "psraw %GM,%EM",   "psrad %GM,%EM",  0,
+  0,                  "pmulhw %GM,%EM",  0,                0,
+  "psubsb %GM,%EM",   "psubsw %GM,%EM",  0,                "por %GM,%EM",
+  "paddsb %GM,%EM",   "paddsw %GM,%EM",  0,                "pxor %GM,%EM",
 /* f */
-  0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0,
+  0,                  "psllw %GM,%EM",   "pslld %GM,%EM",  "psllq %GM,%EM",
+  0,                  "pmaddwd %GM,%EM", 0,                0,
+  "psubb %GM,%EM",    "psubw %GM,%EM",   "psubd %GM,%EM",  0,
+  "paddb %GM,%EM",    "paddw %GM,%EM",   "paddd %GM,%EM",  0,
 };
 
 static char const *groups[][8] = {   /* group 0 is group 3 for %Ev set */
@@ -360,7 +370,13 @@ static char const *groups[][8] = {   /* group 0 is group 3 for %Ev set */
     "smsw %Ew",       0,                 "lmsw %Ew",       "invlpg"        },
 /* 7 */
   { 0,                0,                 0,                0,
-    "bt",             "bts",             "btr",            "btc"           }
+    "bt",             "bts",             "btr",            "btc"           },
+/* 8 */
+  { 0,                0,                 "psrl",           0,
+    "psra",           0,                 "psll",           0               },
+/* 9 */
+  { 0,                0,                 "psrlq",          0,
+    0,                0,                 "psllq",          0               }
 };
 
 /* zero here means invalid.  If first entry starts with '*', use st(i) */
@@ -669,6 +685,10 @@ static void reg_name(int regnum, char size)
     uprintf("st(%d)", regnum);
     return;
   }
+  if (size == 'M') { /* mmx register? */
+    uprintf("mm%d", regnum);
+    return;
+  }
   if ((((size == 'c') || (size == 'v')) && (opsize == 32)) || (size == 'd'))
     uputchar('e');
   if ((size=='q' || size == 'b' || size=='c') && !wordop) {
@@ -743,7 +763,9 @@ static void do_modrm(char subtype, OpInfo* opInfo)
     return;
   }
   if (must_do_size) {
-    if (wordop) {
+    if (subtype == 'M') {
+		ua_str("qword ", opInfo);
+    } else if (wordop) {
       if (addrsize==32 || opsize==32) {       /* then must specify size */
 		ua_str("dword ", opInfo);
       } else {
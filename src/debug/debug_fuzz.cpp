@@ -0,0 +1,804 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+
+#include "dosbox.h"
+#if C_DEBUG
+
+#include <string.h>
+#include <stdio.h>
+#include <vector>
+
+#include "debug.h"
+#include "cpu.h"
+#include "mem.h"
+#include "paging.h"
+#include "fpu.h"
+#include "mmx.h"
+#include "callback.h"
+#include "debug_inc.h"
+#include "../cpu/lazyflags.h"
+
+/* Differential fuzzer for the cpu cores. Every case builds its own machine
+   (real mode, or protected mode with a 16 or 32-bit code segment) in a few
+   scratch pages, runs a random instruction stream on a core and on the
+   normal core and compares the results. Guest memory is watched through a
+   page handler that keeps the first image of every page written, so only
+   those pages are compared and copied back between runs. Some cases are a
+   counted loop around a conditional branch instead, run with enough cycles
+   for a dynamic core to link its blocks. */
+
+#if C_DYNREC
+void CPU_Core_Dynrec_Cache_Init(bool enable_cache);
+void CPU_Core_Dynrec_ReleasePage(Bitu phys_page);
+#endif
+void CPU_Core_Prefetch_Invalidate(void);
+#if C_HEAVY_DEBUG
+extern bool skipFirstInstruction;
+#endif
+
+#define FUZZ_MAX_OPCODES	8		// instructions in a generated stream
+#define FUZZ_MAX_STEPS		64		// core calls before a run is given up
+#define FUZZ_LOOP_CYCLES	4096	// cycles of a core call in a loop case
+
+// scratch machine, physical addresses
+#define FUZZ_IVT			0x00000	// real mode interrupt vectors
+#define FUZZ_STUBS			0x01000	// a jmp $ for every vector
+#define FUZZ_GDT			0x02000
+#define FUZZ_IDT			0x02800
+#define FUZZ_CODE			0x10000	// base of the code segments
+#define FUZZ_DATA			0x20000	// base of the data and stack segments
+#define FUZZ_IP				0x0100	// offset of the stream in the code segment
+
+// protected mode selectors
+#define FUZZ_SEL_FLAT		0x08	// 32-bit code at 0, runs the stubs
+#define FUZZ_SEL_CODE16		0x10
+#define FUZZ_SEL_CODE32		0x18
+#define FUZZ_SEL_DATA16		0x20
+#define FUZZ_SEL_DATA32		0x28
+
+enum FuzzMode { FUZZ_REAL,FUZZ_PROT16,FUZZ_PROT32,FUZZ_MODES };
+static const char * fuzz_modenames[FUZZ_MODES]={"real mode","16-bit protected mode","32-bit protected mode"};
+
+struct FuzzCore {
+	const char * name;
+	CPU_Decoder * decoder;
+};
+
+struct FuzzState {
+	CPU_Regs regs;
+	Segments segs;
+	CPUBlock cpu;
+	LazyFlags lflags;
+	Bit32s cycles,cycle_left;
+	CPU_Decoder * decoder;
+#if C_FPU
+	FPU_rec fpu;		// code the stream wrote over itself can reach the fpu
+#endif
+};
+
+// instructions that neither touch ports nor leave the stream on purpose
+static const Bit8u fuzz_opcodes[]={
+	0x00,0x01,0x02,0x03,0x04,0x05,0x08,0x09,0x0a,0x0b,0x0c,0x0d,
+	0x10,0x11,0x12,0x13,0x14,0x15,0x18,0x19,0x1a,0x1b,0x1c,0x1d,
+	0x20,0x21,0x22,0x23,0x24,0x25,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2f,
+	0x30,0x31,0x32,0x33,0x34,0x35,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3f,
+	0x40,0x41,0x42,0x43,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4d,0x4e,0x4f,
+	0x50,0x51,0x52,0x53,0x55,0x56,0x57,0x58,0x59,0x5a,0x5b,0x5d,0x5e,0x5f,
+	0x60,0x61,0x69,0x6b,
+	0x80,0x81,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x8b,0x8c,0x8d,
+	0x90,0x91,0x92,0x93,0x95,0x96,0x97,0x98,0x99,0x9c,0x9e,0x9f,
+	0xa0,0xa1,0xa2,0xa3,0xa8,0xa9,
+	0xb0,0xb1,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xbb,0xbc,0xbd,0xbe,0xbf,
+	0xc0,0xc1,0xc6,0xc7,0xd0,0xd1,0xd2,0xd3,0xd4,0xd5,0xd6,
+	0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff
+};
+static const Bit8u fuzz_opcodes_0f[]={
+	0x90,0x91,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0x9b,0x9c,0x9d,0x9e,0x9f,
+	0xa3,0xa4,0xa5,0xab,0xac,0xad,0xaf,0xb0,0xb1,0xb3,0xb6,0xb7,
+	0xba,0xbb,0xbc,0xbd,0xbe,0xbf,0xc0,0xc1
+};
+// drawn from as often as the others when the cputype has them
+static const Bit8u fuzz_opcodes_mmx[]={
+	0x60,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6e,0x6f,
+	0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x7e,0x7f,
+	0xd1,0xd2,0xd3,0xd5,0xd8,0xd9,0xdb,0xdc,0xdd,0xdf,
+	0xe1,0xe2,0xe5,0xe8,0xe9,0xeb,0xec,0xed,0xef,
+	0xf1,0xf2,0xf3,0xf5,0xf8,0xf9,0xfa,0xfc,0xfd,0xfe
+};
+// no cs override, a write through it would change the stream under the cores
+static const Bit8u fuzz_prefixes[]={
+	0x26,0x36,0x3e,0x64,0x65,0x66,0x67,0xf2,0xf3
+};
+
+static struct {
+	Bit32u seed;
+	FUZZ_Print print;
+	PhysPt start;					// linear address of the generated stream
+	Bitu count;						// instructions in the stream
+	Bitu ends[FUZZ_MAX_OPCODES+1];	// offset behind each instruction
+	Bitu undefined[FUZZ_MAX_OPCODES+1];	// flags left undefined up to there
+	Bit8u code[FUZZ_MAX_OPCODES*16];
+	FuzzMode mode;
+	Bit32s cycles;					// cycles of every core call
+	bool overwritten;				// the stream was written since it was set up
+	std::vector<PageHandler *> handlers;	// handlers replaced by the write tracker
+	std::vector<Bit32u> slots;		// image slot+1 of every written page
+	std::vector<Bitu> dirty;		// pages written since the last restore
+	std::vector<Bit8u> images;		// first image of the written pages
+	std::vector<Bitu> test_dirty;	// pages written by the tested core
+	std::vector<Bit8u> test_images;	// and their contents after its run
+} fuzz;
+
+static void FuzzTouchPage(Bitu page) {
+	if (fuzz.slots[page]) return;
+	Bitu slot=fuzz.dirty.size();
+	if (fuzz.images.size()<(slot+1)*MEM_PAGESIZE) fuzz.images.resize((slot+1)*MEM_PAGESIZE);
+	memcpy(&fuzz.images[slot*MEM_PAGESIZE],MemBase+page*MEM_PAGESIZE,MEM_PAGESIZE);
+	fuzz.slots[page]=(Bit32u)(slot+1);
+	fuzz.dirty.push_back(page);
+}
+
+// a write into the stream (the data segments can wrap around to it) changes
+// the code under the cores, which the prefetching ones see later than the
+// normal core, such a case can't be compared
+static void FuzzWritten(PhysPt addr,Bitu size) {
+	FuzzTouchPage(addr/MEM_PAGESIZE);
+	if (addr+size>fuzz.start && addr<fuzz.start+fuzz.ends[fuzz.count]+2) fuzz.overwritten=true;
+}
+
+// ram that can be read directly but sends the writes through the handler
+class FuzzPageHandler : public PageHandler {
+public:
+	FuzzPageHandler() {
+		flags=PFLAG_READABLE;
+	}
+	Bitu readb(PhysPt addr) {
+		return host_readb(MemBase+PAGING_GetPhysicalAddress(addr));
+	}
+	Bitu readw(PhysPt addr) {
+		return host_readw(MemBase+PAGING_GetPhysicalAddress(addr));
+	}
+	Bitu readd(PhysPt addr) {
+		return host_readd(MemBase+PAGING_GetPhysicalAddress(addr));
+	}
+	void writeb(PhysPt addr,Bitu val) {
+		addr=PAGING_GetPhysicalAddress(addr);
+		FuzzWritten(addr,1);
+		host_writeb(MemBase+addr,(Bit8u)val);
+	}
+	void writew(PhysPt addr,Bitu val) {
+		addr=PAGING_GetPhysicalAddress(addr);
+		FuzzWritten(addr,2);
+		host_writew(MemBase+addr,(Bit16u)val);
+	}
+	void writed(PhysPt addr,Bitu val) {
+		addr=PAGING_GetPhysicalAddress(addr);
+		FuzzWritten(addr,4);
+		host_writed(MemBase+addr,(Bit32u)val);
+	}
+	HostPt GetHostReadPt(Bitu phys_page) {
+		return MemBase+phys_page*MEM_PAGESIZE;
+	}
+};
+
+static FuzzPageHandler fuzz_page_handler;
+
+// put the write tracker on every plain ram page (a dynamic core wraps the
+// pages it runs code from, these are written by the fuzzer in every case)
+static void FuzzTrackWrites(bool enable) {
+	Bitu pages=MEM_TotalPages();
+#if C_DYNREC
+	for (Bitu page=0;page<pages;page++) CPU_Core_Dynrec_ReleasePage(page);
+#endif
+	if (enable) {
+		fuzz.handlers.assign(pages,(PageHandler *)0);
+		fuzz.slots.assign(pages,0);
+		fuzz.dirty.clear();
+		for (Bitu page=0;page<pages;page++) {
+			PageHandler * handler=MEM_GetPageHandler(page);
+			if (handler->flags!=(PFLAG_READABLE|PFLAG_WRITEABLE)) continue;
+			if (handler->GetHostReadPt(page)!=MemBase+page*MEM_PAGESIZE) continue;
+			fuzz.handlers[page]=handler;
+			MEM_SetPageHandler(page,1,&fuzz_page_handler);
+		}
+	} else {
+		for (Bitu page=0;page<pages;page++) {
+			if (fuzz.handlers[page]) MEM_SetPageHandler(page,1,fuzz.handlers[page]);
+		}
+		fuzz.handlers.clear();
+		fuzz.slots.clear();
+		fuzz.images.clear();
+		fuzz.test_images.clear();
+	}
+	PAGING_ClearTLB();
+}
+
+// copy back the pages written since the last restore, the code translated
+// from them is thrown away first
+static void FuzzRestoreMemory(void) {
+	for (Bitu i=0;i<fuzz.dirty.size();i++) {
+		Bitu page=fuzz.dirty[i];
+#if C_DYNREC
+		CPU_Core_Dynrec_ReleasePage(page);
+#endif
+		memcpy(MemBase+page*MEM_PAGESIZE,&fuzz.images[i*MEM_PAGESIZE],MEM_PAGESIZE);
+		fuzz.slots[page]=0;
+	}
+	fuzz.dirty.clear();
+}
+
+static Bit32u FuzzRandom(void) {
+	// xorshift, the same seed gives the same cases
+	fuzz.seed^=fuzz.seed<<13;
+	fuzz.seed^=fuzz.seed>>17;
+	fuzz.seed^=fuzz.seed<<5;
+	return fuzz.seed;
+}
+
+static void FuzzSaveState(FuzzState & state) {
+	state.regs=cpu_regs;
+	state.segs=Segs;
+	state.cpu=cpu;
+	state.lflags=lflags;
+	state.cycles=CPU_Cycles;
+	state.cycle_left=CPU_CycleLeft;
+	state.decoder=cpudecoder;
+#if C_FPU
+	state.fpu=fpu;
+#endif
+}
+
+static void FuzzLoadState(const FuzzState & state) {
+	cpu_regs=state.regs;
+	Segs=state.segs;
+	cpu=state.cpu;
+	lflags=state.lflags;
+	CPU_Cycles=state.cycles;
+	CPU_CycleLeft=state.cycle_left;
+	cpudecoder=state.decoder;
+#if C_FPU
+	fpu=state.fpu;
+#endif
+}
+
+static void FuzzWriteDescriptor(PhysPt where,Bit32u base,Bit32u limit,Bit8u access,Bit8u size) {
+	if (limit>0xfffff) {
+		limit>>=12;
+		size|=0x80;		// granularity
+	}
+	mem_writew(where+0,(Bit16u)limit);
+	mem_writew(where+2,(Bit16u)base);
+	mem_writeb(where+4,(Bit8u)(base>>16));
+	mem_writeb(where+5,access);
+	mem_writeb(where+6,(Bit8u)(size|((limit>>16)&0xf)));
+	mem_writeb(where+7,(Bit8u)(base>>24));
+}
+
+// the tables and the handler stubs of the scratch machine, every vector
+// leads to its own jmp $ so an exception shows in the final CS:EIP
+static void FuzzWriteMachine(void) {
+	for (Bitu v=0;v<256;v++) {
+		mem_writew(FUZZ_STUBS+v*2,0xfeeb);
+		mem_writed(FUZZ_IVT+v*4,(Bit32u)(((FUZZ_STUBS>>4)<<16)|(v*2)));
+		PhysPt gate=FUZZ_IDT+v*8;
+		mem_writew(gate+0,(Bit16u)(FUZZ_STUBS+v*2));
+		mem_writew(gate+2,FUZZ_SEL_FLAT);
+		mem_writeb(gate+4,0);
+		mem_writeb(gate+5,0x8e);	// present 32-bit interrupt gate
+		mem_writew(gate+6,0);
+	}
+	mem_writed(FUZZ_GDT+0,0);
+	mem_writed(FUZZ_GDT+4,0);
+	FuzzWriteDescriptor(FUZZ_GDT+FUZZ_SEL_FLAT,0,0xffffffff,0x9b,0x40);
+	FuzzWriteDescriptor(FUZZ_GDT+FUZZ_SEL_CODE16,FUZZ_CODE,0xffff,0x9b,0x00);
+	FuzzWriteDescriptor(FUZZ_GDT+FUZZ_SEL_CODE32,FUZZ_CODE,0xffffffff,0x9b,0x40);
+	FuzzWriteDescriptor(FUZZ_GDT+FUZZ_SEL_DATA16,FUZZ_DATA,0xffff,0x93,0x00);
+	FuzzWriteDescriptor(FUZZ_GDT+FUZZ_SEL_DATA32,FUZZ_DATA,0xffffffff,0x93,0x40);
+}
+
+// the cpu state of a mode, the machine has to be in memory already
+static void FuzzEnterMode(FuzzMode mode,bool big_stack) {
+	cpu.cpl=0;
+	cpu.cr0&=~(CR0_PAGING|CR0_PROTECTION);
+	cpu.gdt.SetBase(FUZZ_GDT);
+	cpu.gdt.SetLimit(FUZZ_SEL_DATA32+7);
+	reg_flags&=~(FLAG_VM|FLAG_NT|FLAG_TF|FLAG_IOPL);
+	reg_eip=FUZZ_IP;
+	if (mode==FUZZ_REAL) {
+		cpu.pmode=false;
+		cpu.idt.SetBase(FUZZ_IVT);
+		cpu.idt.SetLimit(256*4-1);
+		for (Bitu s=0;s<6;s++) CPU_SetSegGeneral((SegNames)s,FUZZ_DATA>>4);
+		Segs.val[cs]=FUZZ_CODE>>4;
+		Segs.phys[cs]=FUZZ_CODE;
+		cpu.code.big=false;
+		reg_esp=0xff00;
+	} else {
+		cpu.cr0|=CR0_PROTECTION;
+		cpu.pmode=true;
+		cpu.idt.SetBase(FUZZ_IDT);
+		cpu.idt.SetLimit(256*8-1);
+		for (Bitu s=0;s<6;s++) CPU_SetSegGeneral((SegNames)s,FUZZ_SEL_DATA16);
+		CPU_SetSegGeneral(ss,big_stack ? FUZZ_SEL_DATA32 : FUZZ_SEL_DATA16);
+		cpu.code.big=(mode==FUZZ_PROT32);
+		Segs.val[cs]=cpu.code.big ? FUZZ_SEL_CODE32 : FUZZ_SEL_CODE16;
+		Segs.phys[cs]=FUZZ_CODE;
+		reg_esp=big_stack ? 0x1ff00 : 0xff00;
+	}
+}
+
+// write the first count instructions followed by a jmp $, false on a page fault
+static bool FuzzWriteStream(const Bit8u * code,Bitu size,PhysPt start) {
+	for (Bitu i=0;i<size;i++) {
+		if (mem_writeb_checked(start+i,code[i])) return false;
+	}
+	if (mem_writeb_checked(start+size,0xeb)) return false;
+	if (mem_writeb_checked(start+size+1,0xfe)) return false;
+	return true;
+}
+
+// the arithmetic flags an instruction leaves undefined (the cores are free
+// to differ in them) and whether it reads the flags, a division reads them
+// as its fault pushes them; false if the instruction has undefined results
+static bool FuzzFlagUse(Bit8u op,bool twobyte,Bit8u modrm,bool big_op,Bitu & undefined,bool & reads) {
+	Bitu reg=(modrm>>3)&7;
+	undefined=0;
+	reads=false;
+	if (twobyte) switch (op) {
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:
+		case 0x98: case 0x99: case 0x9a: case 0x9b: case 0x9c: case 0x9d: case 0x9e: case 0x9f:
+			reads=true; break;										// setcc
+		case 0xa3: case 0xab: case 0xb3: case 0xbb: case 0xba:		// bt, bts, btr, btc
+			undefined=FLAG_OF|FLAG_SF|FLAG_AF|FLAG_PF; break;
+		case 0xa4: case 0xa5: case 0xac: case 0xad:					// shld, shrd
+			// a 16-bit operand shifted by 16 or more is undefined
+			if (!big_op) return false;
+			undefined=FMASK_TEST; break;
+		case 0xaf:													// imul
+			undefined=FLAG_SF|FLAG_ZF|FLAG_AF|FLAG_PF; break;
+		case 0xbc: case 0xbd:										// bsf, bsr
+			undefined=FMASK_TEST&~FLAG_ZF; break;
+	} else switch (op) {
+		case 0x08: case 0x09: case 0x0a: case 0x0b: case 0x0c: case 0x0d:	// or
+		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25:	// and
+		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:	// xor
+		case 0x84: case 0x85: case 0xa8: case 0xa9:							// test
+			undefined=FLAG_AF; break;
+		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15:	// adc
+		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d:	// sbb
+		case 0x9c: case 0x9f: case 0xd6: case 0xf5:							// pushf, lahf, salc, cmc
+			reads=true; break;
+		case 0x27: case 0x2f:												// daa, das
+			reads=true; undefined=FLAG_OF; break;
+		case 0x37: case 0x3f:												// aaa, aas
+			reads=true; undefined=FLAG_OF|FLAG_SF|FLAG_ZF|FLAG_PF; break;
+		case 0x8d:															// lea
+			if (modrm>=0xc0) reads=true;									// #UD pushes them
+			break;
+		case 0x69: case 0x6b:												// imul
+			undefined=FLAG_SF|FLAG_ZF|FLAG_AF|FLAG_PF; break;
+		case 0x80: case 0x81: case 0x83:
+			if (reg==2 || reg==3) reads=true;								// adc, sbb
+			else if (reg==1 || reg==4 || reg==6) undefined=FLAG_AF;			// or, and, xor
+			break;
+		case 0xc0: case 0xc1: case 0xd2: case 0xd3:							// by a count
+			if (reg==2 || reg==3) reads=true;								// rcl, rcr
+			undefined=(reg<4) ? FLAG_OF : (FLAG_OF|FLAG_AF|FLAG_CF);
+			break;
+		case 0xd0: case 0xd1:												// by one
+			if (reg==2 || reg==3) reads=true;
+			if (reg>=4) undefined=FLAG_AF;
+			break;
+		case 0xd4: case 0xd5:												// aam, aad
+			reads=true; undefined=FLAG_OF|FLAG_AF|FLAG_CF; break;
+		case 0xf6: case 0xf7:
+			if (reg<2) undefined=FLAG_AF;									// test
+			else if (reg>=4 && reg<6) undefined=FLAG_SF|FLAG_ZF|FLAG_AF|FLAG_PF;	// mul, imul
+			else if (reg>=6) { reads=true; undefined=FMASK_TEST; }			// div, idiv
+			break;
+	}
+	return true;
+}
+
+// append a random instruction, its length is taken from the disassembler
+static bool FuzzGenerate(void) {
+	Bit8u inst[16];
+	Bitu len,op_pos;
+	bool twobyte;
+	Bitu undefined;
+	for (;;) {
+		len=0;
+		bool opsize=false;
+		while (len<2 && !(FuzzRandom()&3)) {
+			Bit8u prefix=fuzz_prefixes[FuzzRandom()%sizeof(fuzz_prefixes)];
+			// the disassembler toggles the size on a repeated 66 or 67
+			if (len && inst[len-1]==prefix) continue;
+			if (prefix==0x66) opsize=true;
+			inst[len++]=prefix;
+		}
+		twobyte=(FuzzRandom()&3)==0;
+		if (twobyte) inst[len++]=0x0f;
+		op_pos=len;
+		if (twobyte && CPU_ArchitectureType>=CPU_ARCHTYPE_PMMXSLOW && (FuzzRandom()&1)) {
+			inst[len++]=fuzz_opcodes_mmx[FuzzRandom()%sizeof(fuzz_opcodes_mmx)];
+		} else if (twobyte) inst[len++]=fuzz_opcodes_0f[FuzzRandom()%sizeof(fuzz_opcodes_0f)];
+		else inst[len++]=fuzz_opcodes[FuzzRandom()%sizeof(fuzz_opcodes)];
+		while (len<16) inst[len++]=(Bit8u)FuzzRandom();
+
+		// keep the groups to their arithmetic forms (fe /7 is the callback opcode)
+		Bit8u & modrm=inst[op_pos+1];
+		if (!twobyte) switch (inst[op_pos]) {
+			case 0xfe: modrm&=0xcf; break;									// inc/dec
+			case 0xff: if (modrm&0x30) modrm=(modrm&0xc7)|0x30; break;		// inc/dec/push
+			case 0xc6: case 0xc7: modrm&=0xc7; break;						// mov
+			case 0x8c: if ((modrm&0x38)>=0x30) modrm&=0xef; break;			// valid segment
+		}
+		else switch (inst[op_pos]) {
+			case 0xba: modrm|=0x20; break;										// bt group
+			case 0x71: case 0x72: modrm=0xc0|((2+2*((modrm>>3)%3))<<3)|(modrm&7); break;	// mmx shifts
+			case 0x73: modrm=0xc0|(modrm&0x27)|0x10; break;						// no psraq
+		}
+
+		// nothing may depend on the flags an earlier instruction left undefined
+		bool reads;
+		bool big_op=(fuzz.mode==FUZZ_PROT32)!=opsize;
+		if (!FuzzFlagUse(inst[op_pos],twobyte,modrm,big_op,undefined,reads)) continue;
+		if (reads && fuzz.undefined[fuzz.count]) continue;
+		break;
+	}
+
+	Bitu pos=fuzz.ends[fuzz.count];
+	if (!FuzzWriteStream(inst,16,fuzz.start+pos)) return false;
+	OpInfo opInfo;
+	len=DasmI386(&opInfo,fuzz.start+pos,FUZZ_IP+pos,fuzz.mode==FUZZ_PROT32);
+	memcpy(&fuzz.code[pos],inst,len);
+	fuzz.undefined[fuzz.count+1]=fuzz.undefined[fuzz.count]|undefined;
+	fuzz.ends[++fuzz.count]=pos+len;
+	return true;
+}
+
+static void FuzzEmit(Bitu & pos,Bit32u val,Bitu bytes) {
+	for (Bitu i=0;i<bytes;i++) fuzz.code[pos++]=(Bit8u)(val>>(i*8));
+}
+
+// a loop case as a single instruction stream: a random compare, arithmetic
+// or logical operation followed by a random conditional branch over a
+// counter, some registers are mixed for the next round and bp counts down
+static bool FuzzGenerateLoop(void) {
+	static const Bit8u loop_regs[6]={0,1,2,3,6,7};		// no sp or bp
+	bool big=(fuzz.mode==FUZZ_PROT32);
+	Bitu imm_size=big ? 4 : 2;
+	Bitu pos=0;
+	FuzzEmit(pos,0xbd,1);										// mov bp,rounds
+	FuzzEmit(pos,1+FuzzRandom()%64,imm_size);
+	Bitu top=pos;
+
+	Bitu size=FuzzRandom()%3;		// byte, word or dword
+	if (size && (size==2)!=big) FuzzEmit(pos,0x66,1);
+	Bitu op=FuzzRandom()%9;			// the dual operations and test
+	Bitu reg=size ? loop_regs[FuzzRandom()%6] : FuzzRandom()%8;
+	Bitu rm=size ? loop_regs[FuzzRandom()%6] : FuzzRandom()%8;
+	bool memory=(FuzzRandom()&3)==0;
+	Bitu modrm=memory ? (big ? 0x05 : 0x06) : (0xc0|rm);
+	if (FuzzRandom()&1) {
+		// op E,imm
+		Bitu opcode=size ? 0x81 : 0x80;
+		Bitu imm=size ? size*2 : 1;
+		if (op==8) opcode=size ? 0xf7 : 0xf6;
+		else if (size && (FuzzRandom()&1)) {
+			opcode=0x83;		// sign extended imm8
+			imm=1;
+		}
+		FuzzEmit(pos,opcode,1);
+		FuzzEmit(pos,modrm|((op&7)<<3),1);
+		if (memory) FuzzEmit(pos,0x100+FuzzRandom()%0xe00,big ? 4 : 2);
+		FuzzEmit(pos,FuzzRandom(),imm);
+	} else {
+		// op E,G or op G,E
+		if (op==8) FuzzEmit(pos,size ? 0x85 : 0x84,1);
+		else FuzzEmit(pos,op*8+(size ? 1 : 0)+((FuzzRandom()&1) ? 2 : 0),1);
+		FuzzEmit(pos,modrm|(reg<<3),1);
+		if (memory) FuzzEmit(pos,0x100+FuzzRandom()%0xe00,big ? 4 : 2);
+	}
+
+	// jcc over an add di,1 (short or near)
+	Bitu cond=FuzzRandom()%16;
+	if (FuzzRandom()&1) {
+		FuzzEmit(pos,0x70+cond,1);
+		FuzzEmit(pos,3,1);
+	} else {
+		FuzzEmit(pos,0x0f,1);
+		FuzzEmit(pos,0x80+cond,1);
+		FuzzEmit(pos,3,imm_size);
+	}
+	FuzzEmit(pos,0x01c783,3);									// add di,1
+
+	FuzzEmit(pos,0x05,1);										// add ax,imm
+	FuzzEmit(pos,FuzzRandom(),imm_size);
+	FuzzEmit(pos,0xc101,2);										// add cx,ax
+	FuzzEmit(pos,0xca31,2);										// xor dx,cx
+	FuzzEmit(pos,0xd301,2);										// add bx,dx
+	FuzzEmit(pos,0xc681,2);										// add si,imm
+	FuzzEmit(pos,FuzzRandom(),imm_size);
+	FuzzEmit(pos,0x01ed83,3);									// sub bp,1
+	FuzzEmit(pos,0x75,1);										// jnz top
+	FuzzEmit(pos,(Bit32u)(top-(pos+1)),1);
+
+	if (!FuzzWriteStream(fuzz.code,pos,fuzz.start)) return false;
+	fuzz.count=1;
+	fuzz.ends[1]=pos;
+	fuzz.undefined[1]=0;		// the last sub sets all flags
+	return true;
+}
+
+// run a core until it leaves the stream or reaches the jmp $ at its end
+static Bits FuzzRunCore(CPU_Decoder * decoder,Bitu count) {
+	PhysPt end=fuzz.start+fuzz.ends[count];
+	Bits ret=CBRET_NONE;
+	for (Bitu steps=0;steps<FUZZ_MAX_STEPS;steps++) {
+		PhysPt ip=SegPhys(cs)+reg_eip;
+		if (steps && (ip<fuzz.start || ip>=end)) break;
+		cpudecoder=decoder;
+#if C_HEAVY_DEBUG
+		skipFirstInstruction=true;
+#endif
+		CPU_Cycles=fuzz.cycles;
+		ret=(*decoder)();
+		// callbacks are not run, the stream stops at them
+		if (ret!=CBRET_NONE) break;
+	}
+	FillFlags();
+	return ret;
+}
+
+// the normal core steps on if the tested core ran further (a dynamic
+// core executes whole blocks, even when they leave the stream)
+static Bits FuzzCatchUp(Bits ret,Bit16u target_cs,Bit32u target_eip) {
+	for (Bitu steps=0;ret==CBRET_NONE && steps<FUZZ_MAX_STEPS;steps++) {
+		if (SegValue(cs)==target_cs && reg_eip==target_eip) break;
+#if C_HEAVY_DEBUG
+		skipFirstInstruction=true;
+#endif
+		cpudecoder=&CPU_Core_Normal_Run;
+		CPU_Cycles=1;
+		ret=CPU_Core_Normal_Run();
+	}
+	FillFlags();
+	return ret;
+}
+
+// a fresh scratch machine holding the first count instructions, in the state init
+static void FuzzPrepare(const FuzzState & init,Bitu count) {
+	FuzzRestoreMemory();
+	FuzzWriteMachine();
+	FuzzWriteStream(fuzz.code,fuzz.ends[count],fuzz.start);
+	fuzz.overwritten=false;
+	FuzzLoadState(init);
+	CPU_Core_Prefetch_Invalidate();
+}
+
+#if C_FPU
+// an MMX register of a saved fpu, the significand of a physical register
+static Bit64u FuzzMMX(const FPU_rec & state,Bitu reg) {
+	return *(const Bit64u *)((const Bit8u *)&state+((Bit8u *)mmx.regs[reg]-(Bit8u *)&fpu));
+}
+
+static Bit16u FuzzTags(const FPU_rec & state) {
+	Bit16u tags=0;
+	for (Bitu i=0;i<8;i++) tags|=(state.tags[i]&3)<<(2*i);
+	return tags;
+}
+#endif
+
+// run the first count instructions of the stream from init on the core and
+// on the normal core, true if both end in the same state
+static bool FuzzCase(const FuzzCore & core,const FuzzState & init,Bitu count,bool report) {
+	static const char * regnames[8]={"EAX","ECX","EDX","EBX","ESP","EBP","ESI","EDI"};
+	static const char * segnames[6]={"ES","CS","SS","DS","FS","GS"};
+
+	FuzzPrepare(init,count);
+	Bits test_ret=FuzzRunCore(core.decoder,count);
+	bool overwritten=fuzz.overwritten;
+	FuzzState test;
+	FuzzSaveState(test);
+	fuzz.test_dirty=fuzz.dirty;
+	if (fuzz.test_images.size()<fuzz.dirty.size()*MEM_PAGESIZE) fuzz.test_images.resize(fuzz.dirty.size()*MEM_PAGESIZE);
+	for (Bitu i=0;i<fuzz.dirty.size();i++) {
+		memcpy(&fuzz.test_images[i*MEM_PAGESIZE],MemBase+fuzz.dirty[i]*MEM_PAGESIZE,MEM_PAGESIZE);
+	}
+
+	FuzzPrepare(init,count);
+	Bits ref_ret=FuzzRunCore(&CPU_Core_Normal_Run,count);
+	ref_ret=FuzzCatchUp(ref_ret,test.segs.val[cs],test.regs.ip.dword[0]);
+	if (overwritten || fuzz.overwritten) return true;
+
+	bool same=true;
+	for (Bitu r=0;r<8;r++) {
+		if (test.regs.regs[r].dword[0]==cpu_regs.regs[r].dword[0]) continue;
+		if (report) fuzz.print("FUZZ: %s %s=%08X, normal %08X\n",core.name,regnames[r],test.regs.regs[r].dword[0],cpu_regs.regs[r].dword[0]);
+		same=false;
+	}
+	if (test.regs.ip.dword[0]!=reg_eip) {
+		if (report) fuzz.print("FUZZ: %s EIP=%08X, normal %08X\n",core.name,test.regs.ip.dword[0],reg_eip);
+		same=false;
+	}
+	if ((test.regs.flags^reg_flags)&~fuzz.undefined[count]) {
+		if (report) fuzz.print("FUZZ: %s FLAGS=%08X, normal %08X\n",core.name,(Bit32u)test.regs.flags,(Bit32u)reg_flags);
+		same=false;
+	}
+	for (Bitu s=0;s<6;s++) {
+		if (test.segs.val[s]==Segs.val[s] && test.segs.phys[s]==Segs.phys[s]) continue;
+		if (report) fuzz.print("FUZZ: %s %s=%04X (%08X), normal %04X (%08X)\n",core.name,segnames[s],test.segs.val[s],test.segs.phys[s],Segs.val[s],Segs.phys[s]);
+		same=false;
+	}
+#if C_FPU
+	for (Bitu m=0;m<8;m++) {
+		Bit64u val=FuzzMMX(test.fpu,m);
+		if (val==*mmx.regs[m]) continue;
+		if (report) fuzz.print("FUZZ: %s MM%d=%08X%08X, normal %08X%08X\n",core.name,(int)m,(Bit32u)(val>>32),(Bit32u)val,(Bit32u)(*mmx.regs[m]>>32),(Bit32u)*mmx.regs[m]);
+		same=false;
+	}
+	if (test.fpu.top!=fpu.top || FuzzTags(test.fpu)!=FuzzTags(fpu)) {
+		if (report) fuzz.print("FUZZ: %s TOP=%d TAGS=%04X, normal %d %04X\n",core.name,(int)test.fpu.top,FuzzTags(test.fpu),(int)fpu.top,FuzzTags(fpu));
+		same=false;
+	}
+#endif
+	if (test_ret!=ref_ret) {
+		if (report) fuzz.print("FUZZ: %s returned %X, normal %X\n",core.name,(Bit32u)test_ret,(Bit32u)ref_ret);
+		same=false;
+	}
+
+	// the pages written by either core, a page only one of them wrote
+	// still has its first image on the other side
+	for (Bitu i=0;i<fuzz.test_dirty.size()+fuzz.dirty.size() && same;i++) {
+		const Bit8u * test_page;
+		Bitu page;
+		if (i<fuzz.test_dirty.size()) {
+			page=fuzz.test_dirty[i];
+			test_page=&fuzz.test_images[i*MEM_PAGESIZE];
+		} else {
+			Bitu slot=i-fuzz.test_dirty.size();
+			page=fuzz.dirty[slot];
+			bool seen=false;
+			for (Bitu t=0;t<fuzz.test_dirty.size();t++) seen|=(fuzz.test_dirty[t]==page);
+			if (seen) continue;
+			test_page=&fuzz.images[slot*MEM_PAGESIZE];
+		}
+		const Bit8u * ref_page=MemBase+page*MEM_PAGESIZE;
+		if (!memcmp(test_page,ref_page,MEM_PAGESIZE)) continue;
+		if (report) {
+			Bitu ofs=0;
+			while (test_page[ofs]==ref_page[ofs]) ofs++;
+			fuzz.print("FUZZ: %s memory %08X=%02X, normal %02X\n",core.name,(Bit32u)(page*MEM_PAGESIZE+ofs),test_page[ofs],ref_page[ofs]);
+		}
+		same=false;
+	}
+	return same;
+}
+
+// shrink a failing case to the fewest instructions and nonzero registers
+// that still make the core differ from the normal core, then report it
+static void FuzzReport(const FuzzCore & core,FuzzState & init,Bitu index) {
+	Bitu count=1;
+	while (count<fuzz.count && FuzzCase(core,init,count,false)) count++;
+	for (Bitu r=0;r<8;r++) {
+		Bit32u val=init.regs.regs[r].dword[0];
+		if (r==REGI_SP || !val) continue;
+		init.regs.regs[r].dword[0]=0;
+		if (FuzzCase(core,init,count,false)) init.regs.regs[r].dword[0]=val;
+	}
+
+	fuzz.print("FUZZ: Case %X, %s differs from the normal core in %s:\n",(Bit32u)index,core.name,fuzz_modenames[fuzz.mode]);
+	char line[FUZZ_MAX_OPCODES*16*3+1];
+	for (Bitu i=0;i<fuzz.ends[count];i++) sprintf(&line[i*3],"%02X ",fuzz.code[i]);
+	fuzz.print("FUZZ: Code %s\n",line);
+	fuzz.print("FUZZ: EAX=%08X ECX=%08X EDX=%08X EBX=%08X\n",init.regs.regs[0].dword[0],init.regs.regs[1].dword[0],init.regs.regs[2].dword[0],init.regs.regs[3].dword[0]);
+	fuzz.print("FUZZ: ESP=%08X EBP=%08X ESI=%08X EDI=%08X FLAGS=%08X\n",init.regs.regs[4].dword[0],init.regs.regs[5].dword[0],init.regs.regs[6].dword[0],init.regs.regs[7].dword[0],(Bit32u)init.regs.flags);
+	FuzzCase(core,init,count,true);
+}
+
+Bitu FUZZ_Cores(Bitu cases,Bit32u & seed,FUZZ_Print print) {
+	FuzzCore cores[5];
+	Bitu core_count=0;
+	cores[core_count].name="full";cores[core_count++].decoder=&CPU_Core_Full_Run;
+	cores[core_count].name="simple";cores[core_count++].decoder=&CPU_Core_Simple_Run;
+	cores[core_count].name="prefetch";cores[core_count++].decoder=&CPU_Core_Prefetch_Run;
+	cores[core_count].name="threaded";cores[core_count++].decoder=&CPU_Core_Threaded_Run;
+#if C_DYNREC
+	CPU_Core_Dynrec_Cache_Init(true);
+	cores[core_count].name="dynamic";cores[core_count++].decoder=&CPU_Core_Dynrec_Run;
+#endif
+
+	FuzzState base;
+	FillFlags();
+	FuzzSaveState(base);
+	// the prefetch core runs with the queue of a 386 unless a prefetch cputype is set
+	Bitu queue_size=CPU_PrefetchQueueSize;
+	if (!queue_size) CPU_PrefetchQueueSize=16;
+	bool paging=PAGING_Enabled();
+	PAGING_Enable(false);
+	FuzzTrackWrites(true);
+	fuzz.print=print;
+	fuzz.seed=seed ? seed : 1;
+	fuzz.start=FUZZ_CODE+FUZZ_IP;
+
+	Bitu failures=0;
+	for (Bitu index=0;index<cases;index++) {
+		// a random mode, registers (but the stack pointer) and arithmetic flags
+		fuzz.mode=(FuzzMode)(FuzzRandom()%FUZZ_MODES);
+		FuzzRestoreMemory();
+		FuzzWriteMachine();
+		FuzzLoadState(base);
+		FuzzEnterMode(fuzz.mode,(FuzzRandom()&1)!=0);
+		for (Bitu r=0;r<8;r++) {
+			if (r==REGI_SP) continue;
+			Bit32u val=FuzzRandom();
+			switch (val&3) {
+				case 0: val=0; break;
+				case 1: val=FuzzRandom()&0xff; break;
+				case 2: val=FuzzRandom()&0xffff; break;
+				default: val=FuzzRandom(); break;
+			}
+			cpu_regs.regs[r].dword[0]=val;
+		}
+#if C_FPU
+		if (CPU_ArchitectureType>=CPU_ARCHTYPE_PMMXSLOW) {
+			for (Bitu m=0;m<8;m++) *mmx.regs[m]=FuzzRandom() | ((Bit64u)FuzzRandom() << 32);
+		}
+#endif
+		reg_flags=(reg_flags&~(FMASK_TEST|FLAG_DF))|(FuzzRandom()&(FMASK_TEST|FLAG_DF));
+		cpu.direction=1-((reg_flags & FLAG_DF) >> 9);
+		lflags.type=t_UNKNOWN;
+		FuzzState init;
+		FuzzSaveState(init);
+
+		fuzz.count=0;
+		fuzz.ends[0]=0;
+		fuzz.undefined[0]=0;
+		Bitu count=1+FuzzRandom()%FUZZ_MAX_OPCODES;
+		fuzz.cycles=1;
+		if (!(FuzzRandom()&7)) {
+			fuzz.cycles=FUZZ_LOOP_CYCLES;
+			count=1;
+			FuzzGenerateLoop();
+		} else while (fuzz.count<count) {
+			if (!FuzzGenerate()) break;
+		}
+		if (fuzz.count<count) {
+			fuzz.print("FUZZ: The scratch code segment can't be written.\n");
+			break;
+		}
+
+		for (Bitu c=0;c<core_count;c++) {
+			if (FuzzCase(cores[c],init,fuzz.count,false)) continue;
+			FuzzReport(cores[c],init,index);
+			failures++;
+		}
+	}
+
+	FuzzRestoreMemory();
+	FuzzTrackWrites(false);
+	FuzzLoadState(base);
+	PAGING_Enable(paging);
+	CPU_PrefetchQueueSize=queue_size;
+	seed=fuzz.seed;
+	return failures;
+}
+
+#endif
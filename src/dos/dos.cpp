@@ -1158,6 +1158,31 @@ static Bitu DOS_21Handler(void) {
 	return CBRET_NONE;
 }
 
+/* Requests that programs issue in tight loops, served without leaving the cpu core.
+   Devices can wait for input or call the bios, so only handles of files on a drive qualify. */
+static bool DOS_21Leaf(void) {
+	switch (reg_ah) {
+	case 0x19:		/* Get current default drive */
+	case 0x2f:		/* Get Disk Transfer Area */
+	case 0x51:		/* Get current PSP */
+	case 0x62:		/* Get Current PSP Address */
+		break;
+	case 0x3f:		/* READ Read from file */
+	case 0x40:		/* WRITE Write to file */
+	case 0x42:		/* LSEEK Set current file position */
+		{
+			Bit8u handle=RealHandle(reg_bx);
+			if (handle>=DOS_FILES || !Files[handle] || !Files[handle]->IsOpen()) return false;
+			if (Files[handle]->GetInformation() & 0x80) return false;
+		}
+		break;
+	default:
+		return false;
+	}
+	DOS_21Handler();
+	return true;
+}
+
 
 static Bitu DOS_20Handler(void) {
 	reg_ah=0x00;
@@ -1217,6 +1242,7 @@ public:
 
 		callback[1].Install(DOS_21Handler,CB_INT21,"DOS Int 21");
 		callback[1].Set_RealVec(0x21);
+		CALLBACK_SetLeaf(callback[1].Get_callback(),DOS_21Leaf);
 	//Pseudo code for int 21
 	// sti
 	// callback 
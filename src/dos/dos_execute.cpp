@@ -19,6 +19,7 @@
 
 #include <string.h>
 #include <ctype.h>
+#include <map>
 #include "dosbox.h"
 #include "mem.h"
 #include "dos_inc.h"
@@ -28,6 +29,16 @@
 #include "cpu.h"
 
 const char * RunningProgram="DOSBOX";
+/* Identifies the image of the running program beyond its name, 0 when unknown */
+Bit32u RunningProgramHash=0;
+static std::map<Bit16u,Bit32u> psp_hashes;
+
+/* FNV-1a */
+static Bit32u DOS_HashImage(const Bit8u * data,Bitu size) {
+	Bit32u hash=2166136261u;
+	for (Bitu i=0;i<size;i++) hash=(hash ^ data[i])*16777619u;
+	return hash;
+}
 
 #ifdef _MSC_VER
 #pragma pack(1)
@@ -100,6 +111,8 @@ void DOS_UpdatePSPName(void) {
 		if ( !isprint(*reinterpret_cast<unsigned char*>(&name[i])) ) name[i] = '?';
 	}
 	RunningProgram = name;
+	std::map<Bit16u,Bit32u>::const_iterator it=psp_hashes.find(dos.psp());
+	RunningProgramHash = (it!=psp_hashes.end()) ? it->second : 0;
 	GFX_SetTitle(-1,-1,false);
 }
 
@@ -138,6 +151,8 @@ void DOS_Terminate(Bit16u pspseg,bool tsr,Bit8u exitcode)
 	mem_writew(SegPhys(ss)+reg_sp+4,0x7202);
 	// Free memory owned by process
 	if (!tsr) DOS_FreeProcessMemory(pspseg);
+	/* The image of a TSR stays but it is no longer the running program */
+	psp_hashes.erase(pspseg);
 	DOS_UpdatePSPName();
 
 	if ((!(CPU_AutoDetermineMode>>CPU_AUTODETERMINE_SHIFT)) || (cpu.pmode)) return;
@@ -210,6 +225,7 @@ static bool MakeEnv(char * name,Bit16u * segment) {
 bool DOS_NewPSP(Bit16u segment, Bit16u size) {
 	DOS_PSP psp(segment);
 	psp.MakeNew(size);
+	psp_hashes.erase(segment);
 	Bit16u parent_psp_seg=psp.GetParent();
 	DOS_PSP psp_parent(parent_psp_seg);
 	psp.CopyFileTable(&psp_parent,false);
@@ -221,6 +237,7 @@ bool DOS_NewPSP(Bit16u segment, Bit16u size) {
 bool DOS_ChildPSP(Bit16u segment, Bit16u size) {
 	DOS_PSP psp(segment);
 	psp.MakeNew(size);
+	psp_hashes.erase(segment);
 	Bit16u parent_psp_seg = psp.GetParent();
 	DOS_PSP psp_parent(parent_psp_seg);
 	psp.CopyFileTable(&psp_parent,true);
@@ -287,6 +304,7 @@ bool DOS_Execute(char * name,PhysPt block_pt,Bit8u flags) {
 		DOS_CloseFile(fhandle);
 		return false;
 	}
+	Bit32u imagehash=DOS_HashImage((Bit8u *)&head,len);
 	if (len<sizeof(EXE_Header)) {
 		if (len==0) {
 			/* Prevent executing zero byte files */
@@ -376,6 +394,7 @@ bool DOS_Execute(char * name,PhysPt block_pt,Bit8u flags) {
 		readsize=0xffff-256;
 		DOS_ReadFile(fhandle,loadbuf,&readsize);
 		MEM_BlockWrite(loadaddress,loadbuf,readsize);
+		imagehash=DOS_HashImage(loadbuf,readsize);
 	} else {	/* EXE Load in 32kb blocks and then relocate */
 		pos=headersize;DOS_SeekFile(fhandle,&pos,DOS_SEEK_SET);	
 		while (imagesize>0x7FFF) {
@@ -409,6 +428,7 @@ bool DOS_Execute(char * name,PhysPt block_pt,Bit8u flags) {
 		// Create psp after closing exe, to avoid dead file handle of exe in copied psp
 		SetupPSP(pspseg,memsize,envseg);
 		SetupCMDLine(pspseg,block);
+		psp_hashes[pspseg]=imagehash;
 	};
 	CALLBACK_SCF(false);		/* Carry flag cleared for caller if successfull */
 	if (flags==OVERLAY) return true;			/* Everything done for overlays */
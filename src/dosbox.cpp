@@ -22,6 +22,9 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <math.h>
+#include <map>
+#include <string>
 #include "dosbox.h"
 #include "debug.h"
 #include "cpu.h"
@@ -42,6 +45,7 @@
 #include "ints/int10.h"
 #include "render.h"
 #include "pci_bus.h"
+#include "perf_stats.h"
 
 Config * control;
 MachineType machine;
@@ -130,12 +134,30 @@ Bit32u ticksScheduled;
 bool ticksLocked;
 void increaseticks();
 
+#if C_PERF_STATS
+PerfStats_t perf_stats;
+
+void PERF_TakeSnapshot(PerfStats_t & snapshot) {
+	// Charge the running scope up to now so the snapshot is complete
+	PERF_SwitchTimer(perf_stats.active);
+	// The audio thread adds to its timer with the audio device locked
+	SDL_LockAudio();
+	snapshot = perf_stats;
+	memset(perf_stats.timers, 0, sizeof(perf_stats.timers));
+	memset(perf_stats.counters, 0, sizeof(perf_stats.counters));
+	SDL_UnlockAudio();
+}
+#endif
+
 static Bitu Normal_Loop(void) {
 	Bits ret;
 	while (1) 
 	{
 		if (PIC_RunQueue()) {
-			ret = (*cpudecoder)();
+			{
+				PERF_SCOPE(PERF_TIMER_CPU);
+				ret = (*cpudecoder)();
+			}
 			if (GCC_UNLIKELY(ret < 0))
 			{
 				return 1;
@@ -146,6 +168,7 @@ static Bitu Normal_Loop(void) {
 				{
 					return 0;
 				}
+				CallBack_Calls[ret]++;
 				Bitu blah = (*CallBack_Handlers[ret])();
 				if (GCC_UNLIKELY(blah))
 				{
@@ -165,6 +188,8 @@ static Bitu Normal_Loop(void) {
 			Debug_UpdateAndDraw(); // Draw at 30fps to make everything smooth and to draw when dosbox is not drawing anything
 			if (ticksRemain>0)
 			{
+				PERF_COUNT(PERF_COUNTER_TICKS, 1);
+				PERF_COUNT(PERF_COUNTER_CYCLES, CPU_CycleMax);
 				TIMER_AddTick();
 				ticksRemain--;
 			} 
@@ -178,7 +203,168 @@ static Bitu Normal_Loop(void) {
 }
 
 //For trying other delays
-#define wrap_delay(a) SDL_Delay(a)
+static void wrap_delay(Bit32u ms) {
+	PERF_SCOPE(PERF_TIMER_IDLE);
+	SDL_Delay(ms);
+}
+
+extern const char* RunningProgram;
+extern Bit32u RunningProgramHash;
+
+/* Cycle governor: a PID controller in velocity form steering the logarithm of the cycles,
+   fed with the smoothed share of host time spent emulating, the mixer buffer fill and underruns */
+#define GOVERNOR_SMOOTHING		0.5		// Weight of a new load or buffer fill measurement
+#define GOVERNOR_KP				0.3
+#define GOVERNOR_KI				0.4		// Per window of 50 ms
+#define GOVERNOR_KD				0.1
+#define GOVERNOR_DEADBAND		0.05	// Log errors the integral part ignores
+#define GOVERNOR_MAX_ERROR		0.7
+#define GOVERNOR_LOW_FILL		0.15	// Mixer buffer fill below which the cycles are lowered, under the usual prebuffer
+#define GOVERNOR_FILL_GAIN		2.0		// Log error per missing share of the buffer
+#define GOVERNOR_LEARN_WINDOWS	40		// Stable windows before a profile is saved
+#define GOVERNOR_SAVE_WINDOWS	1200	// Stable windows between saves of a long running program
+
+static struct {
+	double load;			// Smoothed share of host time spent emulating
+	double fill;			// Smoothed mixer buffer fill
+	double error[2];		// Log errors of the two previous windows
+	double learned;			// Smoothed cycles while the load was on target
+	Bitu stable;			// Windows spent near the target for the running program
+	Bitu underruns;			// Mixer underruns seen so far
+	std::string program;	// Profile key of the running program
+	std::map<std::string,Bit32s> profiles;
+	bool loaded;
+	bool filled;			// The mixer buffer was seen filled, there is an audio device
+} governor;
+
+static std::string GOVERNOR_ProfilePath(void) {
+	std::string path;
+	Cross::CreatePlatformConfigDir(path);
+	return path + "cycleprofiles.txt";
+}
+
+static void GOVERNOR_LoadProfiles(void) {
+	governor.loaded = true;
+	FILE * f = fopen(GOVERNOR_ProfilePath().c_str(),"r");
+	if (!f) return;
+	char name[16];
+	Bit32u hash;
+	long cycles;
+	while (fscanf(f,"%15s %x %ld",name,&hash,&cycles) == 3) {
+		char key[32];
+		sprintf(key,"%s:%08x",name,hash);
+		if (cycles >= CPU_CYCLES_LOWER_LIMIT) governor.profiles[key] = (Bit32s)cycles;
+	}
+	fclose(f);
+}
+
+static void GOVERNOR_SaveProfiles(void) {
+	FILE * f = fopen(GOVERNOR_ProfilePath().c_str(),"w");
+	if (!f) return;
+	for (std::map<std::string,Bit32s>::const_iterator it = governor.profiles.begin(); it != governor.profiles.end(); ++it) {
+		std::string::size_type colon = it->first.rfind(':');
+		fprintf(f,"%s %s %d\n",it->first.substr(0,colon).c_str(),it->first.substr(colon+1).c_str(),it->second);
+	}
+	fclose(f);
+}
+
+static void GOVERNOR_ClampCycles(void) {
+	if (CPU_CycleMax < CPU_CYCLES_LOWER_LIMIT)
+		CPU_CycleMax = CPU_CYCLES_LOWER_LIMIT;
+	if (CPU_CycleLimit > 0) {
+		if (CPU_CycleMax > CPU_CycleLimit) CPU_CycleMax = CPU_CycleLimit;
+	} else if (CPU_CycleMax > 2000000) CPU_CycleMax = 2000000;
+}
+
+static void GOVERNOR_Remember(void) {
+	if (governor.program.empty() || governor.stable < GOVERNOR_LEARN_WINDOWS) return;
+	governor.profiles[governor.program] = (Bit32s)governor.learned;
+	GOVERNOR_SaveProfiles();
+}
+
+/* Remember the cycles of the program that stopped and start the new one at its known speed */
+static void GOVERNOR_CheckProgram(void) {
+	if (!governor.loaded) GOVERNOR_LoadProfiles();
+	std::string program;
+	if (RunningProgramHash) {
+		char key[32];
+		sprintf(key,"%s:%08x",RunningProgram,RunningProgramHash);
+		program = key;
+	}
+	if (program == governor.program) return;
+
+	GOVERNOR_Remember();
+	governor.program = program;
+	std::map<std::string,Bit32s>::const_iterator it = governor.profiles.find(program);
+	if (it != governor.profiles.end()) {
+		CPU_CycleMax = it->second;
+		GOVERNOR_ClampCycles();
+		LOG_MSG("CPU speed: starting %s at its known %d cycles.",RunningProgram,CPU_CycleMax);
+	}
+	governor.learned = CPU_CycleMax;
+	governor.stable = 0;
+	governor.error[0] = governor.error[1] = 0.0;
+	governor.load = -1.0;
+}
+
+static void GOVERNOR_Adjust(Bit32s done,Bit32u scheduled,Bit32u added) {
+	GOVERNOR_CheckProgram();
+	if (done < 1) done = 1;
+	double load = (double)done / (double)scheduled;
+	/* Cycles added by the IO delay code did not run any instructions */
+	Bit64s cproc = (Bit64s)CPU_CycleMax * (Bit64s)scheduled;
+	if (cproc > 0) {
+		double removed = (double)CPU_IODelayRemoved / (double)cproc;
+		if (removed < 0.9) load /= 1.0 - removed;
+	}
+	if (governor.load < 0.0) governor.load = load;
+	else governor.load += GOVERNOR_SMOOTHING * (load - governor.load);
+
+	/* ratio we are aiming for is around 90% usage */
+	double target = CPU_CyclePercUsed * 0.9 / 100.0;
+	double error = log(target / governor.load);
+	if (error > GOVERNOR_MAX_ERROR) error = GOVERNOR_MAX_ERROR;
+	if (error < -GOVERNOR_MAX_ERROR) error = -GOVERNOR_MAX_ERROR;
+	/* The audio runs low on samples, whatever the load says. Without an audio
+	   device the mixer reports an empty buffer, so it counts once seen filled */
+	double fill = MIXER_GetBufferFill();
+	if (governor.filled) governor.fill += GOVERNOR_SMOOTHING * (fill - governor.fill);
+	else if (fill > 0.0) {
+		governor.fill = fill;
+		governor.filled = true;
+	}
+	if (governor.filled && governor.fill < GOVERNOR_LOW_FILL) {
+		double drain = GOVERNOR_FILL_GAIN * (GOVERNOR_LOW_FILL - governor.fill);
+		if (error > -drain) error = -drain;
+	}
+	/* The audio ran dry or the host fell far behind */
+	Bitu underruns = MIXER_GetUnderruns();
+	if (underruns != governor.underruns && error > -0.1) error = -0.1;
+	governor.underruns = underruns;
+	if (added > 15) error = -GOVERNOR_MAX_ERROR;
+
+	double integral = (fabs(error) < GOVERNOR_DEADBAND) ? 0.0 : error;
+	double window = scheduled / 50.0;
+	if (window > 2.0) window = 2.0;
+	double step = GOVERNOR_KP * (error - governor.error[0]) +
+		GOVERNOR_KI * window * integral +
+		GOVERNOR_KD * (error - 2.0 * governor.error[0] + governor.error[1]);
+	governor.error[1] = governor.error[0];
+	governor.error[0] = error;
+	/* Back off faster than speeding up, dropouts are worse than idle time */
+	if (step > 0.4) step = 0.4;
+	if (step < -GOVERNOR_MAX_ERROR) step = -GOVERNOR_MAX_ERROR;
+
+	CPU_CycleMax = (Bit32s)(CPU_CycleMax * exp(step));
+	GOVERNOR_ClampCycles();
+
+	if (fabs(error) < 2.0 * GOVERNOR_DEADBAND) {
+		governor.learned += 0.1 * (CPU_CycleMax - governor.learned);
+		governor.stable++;
+		/* Programs are often left by closing DOSBox */
+		if ((governor.stable % GOVERNOR_SAVE_WINDOWS) == GOVERNOR_LEARN_WINDOWS) GOVERNOR_Remember();
+	}
+}
 
 void increaseticks() { //Make it return ticksRemain and set it in the function above to remove the global variable.
 	if (GCC_UNLIKELY(ticksLocked)) { // For Fast Forward Mode
@@ -245,6 +431,19 @@ void increaseticks() { //Make it return ticksRemain and set it in the function a
 
 	// Is the system in auto cycle mode guessing ? If not just exit. (It can be temporary disabled)
 	if (!CPU_CycleAutoAdjust || CPU_SkipCycleAutoAdjust) return;
+
+	if (CPU_CycleGovernor) {
+		// Shorter windows than the guessing below, the controller smooths the measurements itself
+		if (ticksScheduled >= 50 || ticksDone >= 250 || (ticksAdded > 15 && ticksScheduled >= 5)) {
+			GOVERNOR_Adjust(ticksDone,ticksScheduled,ticksAdded);
+			CPU_IODelayRemoved = 0;
+			ticksDone = 0;
+			ticksScheduled = 0;
+			lastsleepDone = -1;
+			sleep1count = 0;
+		}
+		return;
+	}
 	
 	if (ticksScheduled >= 250 || ticksDone >= 250 || (ticksAdded > 15 && ticksScheduled >= 5) ) {
 		if(ticksDone < 1) ticksDone = 1; // Protect against div by zero
@@ -411,6 +610,10 @@ void DOSBOX_Init(void) {
 	Prop_int* Pint;
 	Prop_hex* Phex;
 	Prop_string* Pstring;
+#if C_PERF_STATS
+	// The first switch charges the time since the last one to the active timer
+	perf_stats.last = PERF_GetTime();
+#endif
 	Prop_bool* Pbool;
 	Prop_multival* Pmulti;
 	Prop_multival_remain* Pmulti_remain;
@@ -453,12 +656,13 @@ void DOSBOX_Init(void) {
 	secprop->AddInitFunction(&MEM_Init);//done
 	secprop->AddInitFunction(&HARDWARE_Init);//done
 	Pint = secprop->Add_int("memsize", Property::Changeable::WhenIdle,16);
-	Pint->SetMinMax(1,63);
+	Pint->SetMinMax(1,3583);
 	Pint->Set_help(
 		"Amount of memory DOSBox has in megabytes.\n"
 		"This value is best left at its default to avoid problems with some games,\n"
 		"though few games might require a higher value.\n"
-		"There is generally no speed advantage when raising this value.");
+		"There is generally no speed advantage when raising this value.\n"
+		"Host memory is only used for the parts the guest actually touches.");
 	secprop->AddInitFunction(&CALLBACK_Init);
 	secprop->AddInitFunction(&PIC_Init);//done
 	secprop->AddInitFunction(&PROGRAMS_Init);
@@ -501,13 +705,13 @@ void DOSBOX_Init(void) {
 #if (C_DYNAMIC_X86) || (C_DYNREC)
 		"dynamic",
 #endif
-		"normal", "simple",0 };
+		"normal", "simple", "threaded",0 };
 	Pstring = secprop->Add_string("core",Property::Changeable::WhenIdle,"auto");
 	Pstring->Set_values(cores);
 	Pstring->Set_help("CPU Core used in emulation. auto will switch to dynamic if available and\n"
-		"appropriate.");
+		"appropriate. threaded runs instructions decoded once and kept in a cache.");
 
-	const char* cputype_values[] = { "auto", "386", "386_slow", "486_slow", "pentium_slow", "386_prefetch", 0};
+	const char* cputype_values[] = { "auto", "386", "386_slow", "486_slow", "pentium_slow", "pentium_mmx", "386_prefetch", 0};
 	Pstring = secprop->Add_string("cputype",Property::Changeable::Always,"auto");
 	Pstring->Set_values(cputype_values);
 	Pstring->Set_help("CPU Type used in emulation. auto is the fastest choice.");
@@ -517,15 +721,18 @@ void DOSBOX_Init(void) {
 	Pmulti_remain->Set_help(
 		"Amount of instructions DOSBox tries to emulate each millisecond.\n"
 		"Setting this value too high results in sound dropouts and lags.\n"
-		"Cycles can be set in 3 ways:\n"
+		"Cycles can be set in 4 ways:\n"
 		"  'auto'          tries to guess what a game needs.\n"
 		"                  It usually works, but can fail for certain games.\n"
 		"  'fixed #number' will set a fixed amount of cycles. This is what you usually\n"
 		"                  need if 'auto' fails (Example: fixed 4000).\n"
 		"  'max'           will allocate as much cycles as your computer is able to\n"
-		"                  handle.");
+		"                  handle.\n"
+		"  'governor'      like max, but steadier. The cycles learned for each program are\n"
+		"                  kept in cycleprofiles.txt next to the configuration file, so a\n"
+		"                  program starts at its known speed the next time.");
 
-	const char* cyclest[] = { "auto","fixed","max","%u",0 };
+	const char* cyclest[] = { "auto","fixed","max","governor","%u",0 };
 	Pstring = Pmulti_remain->GetSection()->Add_string("type",Property::Changeable::Always,"auto");
 	Pmulti_remain->SetValue("auto");
 	Pstring->Set_values(cyclest);
@@ -540,7 +747,20 @@ void DOSBOX_Init(void) {
 	Pint->SetMinMax(1,1000000);
 	Pint->Set_help("Setting it lower than 100 will be a percentage.");
 
+#if (C_DYNREC)
+	Pint = secprop->Add_int("dynrec_cache",Property::Changeable::OnlyAtStart,8);
+	Pint->SetMinMax(1,256);
+	Pint->Set_help("Size of the dynamic core code cache in MB. Large protected mode games can need more\n"
+		"to keep their code from being translated again. ARMv8 hosts use at most 127.");
+#endif
+
 #if C_FPU
+	const char* fpu_modes[] = { "double", "softfloat", 0 };
+	Pstring = secprop->Add_string("fpu",Property::Changeable::OnlyAtStart,"double");
+	Pstring->Set_values(fpu_modes);
+	Pstring->Set_help("How the FPU registers are emulated. double is the fastest and uses the host double\n"
+		"precision (SSE2 on x86-64). softfloat keeps the full 80-bit x87 precision and rounding\n"
+		"for programs that depend on it. Builds using the host x87 are always 80-bit.");
 	secprop->AddInitFunction(&FPU_Init);
 #endif
 	secprop->AddInitFunction(&DMA_Init);//done
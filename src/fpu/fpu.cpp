@@ -26,8 +26,11 @@
 #include "mem.h"
 #include "fpu.h"
 #include "cpu.h"
+#include "setup.h"
+#include "mmx.h"
 
 FPU_rec fpu;
+MMX_Block mmx;
 
 void FPU_FLDCW(PhysPt addr){
 	Bit16u temp = mem_readw(addr);
@@ -47,6 +50,29 @@ Bit16u FPU_GetTag(void){
 #include "fpu_instructions.h"
 #endif
 
+/* Takes over the environment and registers of a 32-bit FSAVE image in host
+   memory, cw replaces the control word of the image */
+void FPU_LoadHostImage(HostPt image,Bitu cw) {
+	FPU_SetCW(cw);
+	fpu.sw=host_readw(image+4);
+	FPU_SetTag(host_readw(image+8));
+	TOP=FPU_GET_TOP();
+	for (Bitu i=0;i<8;i++) {
+		HostPt reg=image+28+10*i;
+#if C_FPU_X86
+		fpu.p_regs[STV(i)].m1=host_readd(reg);
+		fpu.p_regs[STV(i)].m2=host_readd(reg+4);
+		fpu.p_regs[STV(i)].m3=host_readw(reg+8);
+#else
+		FPU_Ext val;
+		val.mant=host_readd(reg) | ((Bit64u)host_readd(reg+4) << 32);
+		val.exp=host_readw(reg+8);
+		if (fpu.softfloat) fpu.regs_80[STV(i)]=val;
+		else fpu.regs[STV(i)].d=FPU_Ext_ToDouble(val);
+#endif
+	}
+}
+
 /* WATCHIT : ALWAYS UPDATE REGISTERS BEFORE AND AFTER USING THEM 
 			STATUS WORD =>	FPU_SET_TOP(TOP) BEFORE a read
 			TOP=FPU_GET_TOP() after a write;
@@ -623,8 +649,31 @@ void FPU_ESC7_Normal(Bitu rm) {
 }
 
 
-void FPU_Init(Section*) {
+void FPU_Init(Section* sec) {
+#if C_FPU_X86
+	//the host x87 already works on 80-bit registers
+	fpu.softfloat = false;
+#else
+	Section_prop * section=static_cast<Section_prop *>(sec);
+	std::string mode(section->Get_string("fpu"));
+	fpu.softfloat = (mode == "softfloat");
+#endif
 	FPU_FINIT();
+	for (Bitu i=0;i<8;i++) {
+#if C_FPU_X86
+		mmx.regs[i]=(Bit64u *)&fpu.p_regs[i].m1;
+		mmx.exps[i]=&fpu.p_regs[i].m3;
+#else
+		if (fpu.softfloat) {
+			mmx.regs[i]=&fpu.regs_80[i].mant;
+			mmx.exps[i]=&fpu.regs_80[i].exp;
+		} else {
+			/* The register values are lost when converted to an 80-bit memory image */
+			mmx.regs[i]=(Bit64u *)&fpu.regs[i].ll;
+			mmx.exps[i]=&mmx.no_exp;
+		}
+#endif
+	}
 }
 
 #endif
@@ -17,6 +17,7 @@
  */
 
 
+#include "fpu_softfloat.h"
 
 static void FPU_FINIT(void) {
 	FPU_SetCW(0x37F);
@@ -54,6 +55,11 @@ static void FPU_PUSH(double in){
 	return;
 }
 
+static void FPU_PUSH_Ext(const FPU_Ext & in){
+	FPU_PREP_PUSH();
+	fpu.regs_80[TOP] = in;
+}
+
 
 static void FPU_FPOP(void){
 	if (GCC_UNLIKELY(fpu.tags[TOP] == TAG_Empty)) E_Exit("FPU stack underflow");
@@ -140,31 +146,68 @@ static void FPU_ST80(PhysPt addr,Bitu reg) {
 }
 
 
+static FPU_Ext FPU_FLD80_Ext(PhysPt addr) {
+	FPU_Ext val;
+	val.mant = mem_readd(addr) | ((Bit64u)mem_readd(addr+4) << 32);
+	val.exp = mem_readw(addr+8);
+	return val;
+}
+
+static void FPU_ST80_Ext(PhysPt addr,Bitu reg) {
+	mem_writed(addr,(Bit32u)fpu.regs_80[reg].mant);
+	mem_writed(addr+4,(Bit32u)(fpu.regs_80[reg].mant >> 32));
+	mem_writew(addr+8,fpu.regs_80[reg].exp);
+}
+
+
 static void FPU_FLD_F32(PhysPt addr,Bitu store_to) {
 	union {
 		float f;
 		Bit32u l;
 	}	blah;
 	blah.l = mem_readd(addr);
+	if (fpu.softfloat) {
+		fpu.regs_80[store_to] = FPU_Ext_FromDouble(static_cast<Real64>(blah.f));
+		return;
+	}
 	fpu.regs[store_to].d = static_cast<Real64>(blah.f);
 }
 
 static void FPU_FLD_F64(PhysPt addr,Bitu store_to) {
+	if (fpu.softfloat) {
+		FPU_Reg blah;
+		blah.l.lower = mem_readd(addr);
+		blah.l.upper = mem_readd(addr+4);
+		fpu.regs_80[store_to] = FPU_Ext_FromDouble(blah.d);
+		return;
+	}
 	fpu.regs[store_to].l.lower = mem_readd(addr);
 	fpu.regs[store_to].l.upper = mem_readd(addr+4);
 }
 
 static void FPU_FLD_F80(PhysPt addr) {
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_FLD80_Ext(addr);
+		return;
+	}
 	fpu.regs[TOP].d = FPU_FLD80(addr);
 }
 
 static void FPU_FLD_I16(PhysPt addr,Bitu store_to) {
 	Bit16s blah = mem_readw(addr);
+	if (fpu.softfloat) {
+		fpu.regs_80[store_to] = FPU_Ext_FromInt64(blah);
+		return;
+	}
 	fpu.regs[store_to].d = static_cast<Real64>(blah);
 }
 
 static void FPU_FLD_I32(PhysPt addr,Bitu store_to) {
 	Bit32s blah = mem_readd(addr);
+	if (fpu.softfloat) {
+		fpu.regs_80[store_to] = FPU_Ext_FromInt64(blah);
+		return;
+	}
 	fpu.regs[store_to].d = static_cast<Real64>(blah);
 }
 
@@ -172,6 +215,10 @@ static void FPU_FLD_I64(PhysPt addr,Bitu store_to) {
 	FPU_Reg blah;
 	blah.l.lower = mem_readd(addr);
 	blah.l.upper = mem_readd(addr+4);
+	if (fpu.softfloat) {
+		fpu.regs_80[store_to] = FPU_Ext_FromInt64(blah.ll);
+		return;
+	}
 	fpu.regs[store_to].d = static_cast<Real64>(blah.ll);
 }
 
@@ -189,8 +236,14 @@ static void FPU_FBLD(PhysPt addr,Bitu store_to) {
 
 	//last number, only now convert to float in order to get
 	//the best signification
-	Real64 temp = static_cast<Real64>(val);
 	in = mem_readb(addr + 9);
+	if (fpu.softfloat) {
+		//18 digits always fit in 64 bits
+		val += (in&0xf) * base;
+		fpu.regs_80[store_to] = FPU_Ext_FromInt64((in&0x80) ? -static_cast<Bit64s>(val) : static_cast<Bit64s>(val));
+		return;
+	}
+	Real64 temp = static_cast<Real64>(val);
 	temp += ( (in&0xf) * base );
 	if(in&0x80) temp *= -1.0;
 	fpu.regs[store_to].d = temp;
@@ -217,35 +270,80 @@ static void FPU_FST_F32(PhysPt addr) {
 		Bit32u l;
 	}	blah;
 	//should depend on rounding method
-	blah.f = static_cast<float>(fpu.regs[TOP].d);
+	if (fpu.softfloat) blah.f = FPU_Ext_ToFloat(fpu.regs_80[TOP]);
+	else blah.f = static_cast<float>(fpu.regs[TOP].d);
 	mem_writed(addr,blah.l);
 }
 
 static void FPU_FST_F64(PhysPt addr) {
+	if (fpu.softfloat) {
+		FPU_Reg blah;
+		blah.d = FPU_Ext_ToDouble(fpu.regs_80[TOP]);
+		mem_writed(addr,blah.l.lower);
+		mem_writed(addr+4,blah.l.upper);
+		return;
+	}
 	mem_writed(addr,fpu.regs[TOP].l.lower);
 	mem_writed(addr+4,fpu.regs[TOP].l.upper);
 }
 
 static void FPU_FST_F80(PhysPt addr) {
+	if (fpu.softfloat) {
+		FPU_ST80_Ext(addr,TOP);
+		return;
+	}
 	FPU_ST80(addr,TOP);
 }
 
 static void FPU_FST_I16(PhysPt addr) {
+	if (fpu.softfloat) {
+		//out of range gives the integer indefinite
+		Bit64s val = FPU_Ext_ToInt64(fpu.regs_80[TOP],fpu.round);
+		mem_writew(addr,(val < -0x8000 || val > 0x7fff) ? 0x8000 : static_cast<Bit16u>(val));
+		return;
+	}
 	mem_writew(addr,static_cast<Bit16s>(FROUND(fpu.regs[TOP].d)));
 }
 
 static void FPU_FST_I32(PhysPt addr) {
+	if (fpu.softfloat) {
+		Bit64s val = FPU_Ext_ToInt64(fpu.regs_80[TOP],fpu.round);
+		mem_writed(addr,(val < -LONGTYPE(0x80000000) || val > 0x7fffffff) ? 0x80000000 : static_cast<Bit32u>(val));
+		return;
+	}
 	mem_writed(addr,static_cast<Bit32s>(FROUND(fpu.regs[TOP].d)));
 }
 
 static void FPU_FST_I64(PhysPt addr) {
 	FPU_Reg blah;
-	blah.ll = static_cast<Bit64s>(FROUND(fpu.regs[TOP].d));
+	if (fpu.softfloat) blah.ll = FPU_Ext_ToInt64(fpu.regs_80[TOP],fpu.round);
+	else blah.ll = static_cast<Bit64s>(FROUND(fpu.regs[TOP].d));
 	mem_writed(addr,blah.l.lower);
 	mem_writed(addr+4,blah.l.upper);
 }
 
 static void FPU_FBST(PhysPt addr) {
+	if (fpu.softfloat) {
+		Bit64s ival = FPU_Ext_ToInt64(fpu.regs_80[TOP],fpu.round);
+		Bit64u mag = (ival < 0) ? (0 - static_cast<Bit64u>(ival)) : static_cast<Bit64u>(ival);
+		if (FPU_Ext_IsNaN(fpu.regs_80[TOP]) || mag > LONGTYPE(999999999999999999)) {
+			//packed BCD indefinite
+			for (Bitu i = 0;i < 7;i++) mem_writeb(addr+i,0);
+			mem_writeb(addr+7,0xc0);
+			mem_writeb(addr+8,0xff);
+			mem_writeb(addr+9,0xff);
+			return;
+		}
+		for (Bitu i = 0;i < 9;i++) {
+			Bitu p = static_cast<Bitu>(mag % 10);
+			mag /= 10;
+			p |= static_cast<Bitu>(mag % 10) << 4;
+			mag /= 10;
+			mem_writeb(addr+i,p);
+		}
+		mem_writeb(addr+9,FPU_Ext_Sign(fpu.regs_80[TOP]) ? 0x80 : 0);
+		return;
+	}
 	FPU_Reg val = fpu.regs[TOP];
 	bool sign = false;
 	if(fpu.regs[TOP].ll & LONGTYPE(0x8000000000000000)) { //sign
@@ -274,19 +372,31 @@ static void FPU_FBST(PhysPt addr) {
 }
 
 static void FPU_FADD(Bitu op1, Bitu op2){
+	if (fpu.softfloat) {
+		fpu.regs_80[op1] = FPU_Ext_Add(fpu.regs_80[op1],fpu.regs_80[op2]);
+		return;
+	}
 	fpu.regs[op1].d+=fpu.regs[op2].d;
 	//flags and such :)
 	return;
 }
 
 static void FPU_FSIN(void){
-	fpu.regs[TOP].d = sin(fpu.regs[TOP].d);
+	if (fpu.softfloat) fpu.regs_80[TOP] = FPU_Ext_FromHost(sinl(FPU_Ext_ToHost(fpu.regs_80[TOP])));
+	else fpu.regs[TOP].d = sin(fpu.regs[TOP].d);
 	FPU_SET_C2(0);
 	//flags and such :)
 	return;
 }
 
 static void FPU_FSINCOS(void){
+	if (fpu.softfloat) {
+		long double val = FPU_Ext_ToHost(fpu.regs_80[TOP]);
+		fpu.regs_80[TOP] = FPU_Ext_FromHost(sinl(val));
+		FPU_PUSH_Ext(FPU_Ext_FromHost(cosl(val)));
+		FPU_SET_C2(0);
+		return;
+	}
 	Real64 temp = fpu.regs[TOP].d;
 	fpu.regs[TOP].d = sin(temp);
 	FPU_PUSH(cos(temp));
@@ -296,24 +406,36 @@ static void FPU_FSINCOS(void){
 }
 
 static void FPU_FCOS(void){
-	fpu.regs[TOP].d = cos(fpu.regs[TOP].d);
+	if (fpu.softfloat) fpu.regs_80[TOP] = FPU_Ext_FromHost(cosl(FPU_Ext_ToHost(fpu.regs_80[TOP])));
+	else fpu.regs[TOP].d = cos(fpu.regs[TOP].d);
 	FPU_SET_C2(0);
 	//flags and such :)
 	return;
 }
 
 static void FPU_FSQRT(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_Ext_Sqrt(fpu.regs_80[TOP]);
+		return;
+	}
 	fpu.regs[TOP].d = sqrt(fpu.regs[TOP].d);
 	//flags and such :)
 	return;
 }
 static void FPU_FPATAN(void){
-	fpu.regs[STV(1)].d = atan2(fpu.regs[STV(1)].d,fpu.regs[TOP].d);
+	if (fpu.softfloat) fpu.regs_80[STV(1)] = FPU_Ext_FromHost(atan2l(FPU_Ext_ToHost(fpu.regs_80[STV(1)]),FPU_Ext_ToHost(fpu.regs_80[TOP])));
+	else fpu.regs[STV(1)].d = atan2(fpu.regs[STV(1)].d,fpu.regs[TOP].d);
 	FPU_FPOP();
 	//flags and such :)
 	return;
 }
 static void FPU_FPTAN(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_Ext_FromHost(tanl(FPU_Ext_ToHost(fpu.regs_80[TOP])));
+		FPU_PUSH_Ext(FPU_Ext_Pack(false,EXT_BIAS,EXT_INT_BIT));
+		FPU_SET_C2(0);
+		return;
+	}
 	fpu.regs[TOP].d = tan(fpu.regs[TOP].d);
 	FPU_PUSH(1.0);
 	FPU_SET_C2(0);
@@ -321,30 +443,50 @@ static void FPU_FPTAN(void){
 	return;
 }
 static void FPU_FDIV(Bitu st, Bitu other){
+	if (fpu.softfloat) {
+		fpu.regs_80[st] = FPU_Ext_Div(fpu.regs_80[st],fpu.regs_80[other]);
+		return;
+	}
 	fpu.regs[st].d= fpu.regs[st].d/fpu.regs[other].d;
 	//flags and such :)
 	return;
 }
 
 static void FPU_FDIVR(Bitu st, Bitu other){
+	if (fpu.softfloat) {
+		fpu.regs_80[st] = FPU_Ext_Div(fpu.regs_80[other],fpu.regs_80[st]);
+		return;
+	}
 	fpu.regs[st].d= fpu.regs[other].d/fpu.regs[st].d;
 	// flags and such :)
 	return;
 }
 
 static void FPU_FMUL(Bitu st, Bitu other){
+	if (fpu.softfloat) {
+		fpu.regs_80[st] = FPU_Ext_Mul(fpu.regs_80[st],fpu.regs_80[other]);
+		return;
+	}
 	fpu.regs[st].d*=fpu.regs[other].d;
 	//flags and such :)
 	return;
 }
 
 static void FPU_FSUB(Bitu st, Bitu other){
+	if (fpu.softfloat) {
+		fpu.regs_80[st] = FPU_Ext_Sub(fpu.regs_80[st],fpu.regs_80[other]);
+		return;
+	}
 	fpu.regs[st].d = fpu.regs[st].d - fpu.regs[other].d;
 	//flags and such :)
 	return;
 }
 
 static void FPU_FSUBR(Bitu st, Bitu other){
+	if (fpu.softfloat) {
+		fpu.regs_80[st] = FPU_Ext_Sub(fpu.regs_80[other],fpu.regs_80[st]);
+		return;
+	}
 	fpu.regs[st].d= fpu.regs[other].d - fpu.regs[st].d;
 	//flags and such :)
 	return;
@@ -353,15 +495,19 @@ static void FPU_FSUBR(Bitu st, Bitu other){
 static void FPU_FXCH(Bitu st, Bitu other){
 	FPU_Tag tag = fpu.tags[other];
 	FPU_Reg reg = fpu.regs[other];
+	FPU_Ext reg_80 = fpu.regs_80[other];
 	fpu.tags[other] = fpu.tags[st];
 	fpu.regs[other] = fpu.regs[st];
+	fpu.regs_80[other] = fpu.regs_80[st];
 	fpu.tags[st] = tag;
 	fpu.regs[st] = reg;
+	fpu.regs_80[st] = reg_80;
 }
 
 static void FPU_FST(Bitu st, Bitu other){
 	fpu.tags[other] = fpu.tags[st];
 	fpu.regs[other] = fpu.regs[st];
+	fpu.regs_80[other] = fpu.regs_80[st];
 }
 
 
@@ -370,6 +516,14 @@ static void FPU_FCOM(Bitu st, Bitu other){
 		((fpu.tags[other] != TAG_Valid) && (fpu.tags[other] != TAG_Zero))){
 		FPU_SET_C3(1);FPU_SET_C2(1);FPU_SET_C0(1);return;
 	}
+	if (fpu.softfloat) {
+		switch (FPU_Ext_Compare(fpu.regs_80[st],fpu.regs_80[other])) {
+		case 0:  FPU_SET_C3(1);FPU_SET_C2(0);FPU_SET_C0(0);return;
+		case -1: FPU_SET_C3(0);FPU_SET_C2(0);FPU_SET_C0(1);return;
+		case 1:  FPU_SET_C3(0);FPU_SET_C2(0);FPU_SET_C0(0);return;
+		default: FPU_SET_C3(1);FPU_SET_C2(1);FPU_SET_C0(1);return;
+		}
+	}
 	if(fpu.regs[st].d == fpu.regs[other].d){
 		FPU_SET_C3(1);FPU_SET_C2(0);FPU_SET_C0(0);return;
 	}
@@ -386,11 +540,30 @@ static void FPU_FUCOM(Bitu st, Bitu other){
 }
 
 static void FPU_FRNDINT(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_Ext_RoundToInt(fpu.regs_80[TOP],fpu.round);
+		return;
+	}
 	Bit64s temp= static_cast<Bit64s>(FROUND(fpu.regs[TOP].d));
 	fpu.regs[TOP].d=static_cast<double>(temp);
 }
 
+static void FPU_FPREM_Ext(bool nearest){
+	Bit64u quot;
+	bool partial;
+	fpu.regs_80[TOP] = FPU_Ext_Rem(fpu.regs_80[TOP],fpu.regs_80[STV(1)],nearest,quot,partial);
+	if (partial) quot = 0;
+	FPU_SET_C0(static_cast<Bitu>(quot&4));
+	FPU_SET_C3(static_cast<Bitu>(quot&2));
+	FPU_SET_C1(static_cast<Bitu>(quot&1));
+	FPU_SET_C2(partial);
+}
+
 static void FPU_FPREM(void){
+	if (fpu.softfloat) {
+		FPU_FPREM_Ext(false);
+		return;
+	}
 	Real64 valtop = fpu.regs[TOP].d;
 	Real64 valdiv = fpu.regs[STV(1)].d;
 	Bit64s ressaved = static_cast<Bit64s>( (valtop/valdiv) );
@@ -405,6 +578,10 @@ static void FPU_FPREM(void){
 }
 
 static void FPU_FPREM1(void){
+	if (fpu.softfloat) {
+		FPU_FPREM_Ext(true);
+		return;
+	}
 	Real64 valtop = fpu.regs[TOP].d;
 	Real64 valdiv = fpu.regs[STV(1)].d;
 	double quot = valtop/valdiv;
@@ -420,7 +597,29 @@ static void FPU_FPREM1(void){
 	FPU_SET_C2(0);
 }
 
+static void FPU_FXAM_Ext(void){
+	const FPU_Ext & val = fpu.regs_80[TOP];
+	FPU_SET_C1(FPU_Ext_Sign(val));
+	if(fpu.tags[TOP] == TAG_Empty) {
+		FPU_SET_C3(1);FPU_SET_C2(0);FPU_SET_C0(1);
+	} else if (FPU_Ext_IsNaN(val)) {
+		FPU_SET_C3(0);FPU_SET_C2(0);FPU_SET_C0(1);
+	} else if (FPU_Ext_IsInf(val)) {
+		FPU_SET_C3(0);FPU_SET_C2(1);FPU_SET_C0(1);
+	} else if (FPU_Ext_IsZero(val)) {
+		FPU_SET_C3(1);FPU_SET_C2(0);FPU_SET_C0(0);
+	} else if (FPU_Ext_Exp(val) == 0) {	//denormal
+		FPU_SET_C3(1);FPU_SET_C2(1);FPU_SET_C0(0);
+	} else {
+		FPU_SET_C3(0);FPU_SET_C2(1);FPU_SET_C0(0);
+	}
+}
+
 static void FPU_FXAM(void){
+	if (fpu.softfloat) {
+		FPU_FXAM_Ext();
+		return;
+	}
 	if(fpu.regs[TOP].ll & LONGTYPE(0x8000000000000000))	//sign
 	{ 
 		FPU_SET_C1(1);
@@ -445,24 +644,45 @@ static void FPU_FXAM(void){
 }
 
 
+//ln(2) for the host long double helpers
+#define LN2_L	0.693147180559945309417232121458176568L
+
 static void FPU_F2XM1(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_Ext_FromHost(expm1l(FPU_Ext_ToHost(fpu.regs_80[TOP])*LN2_L));
+		return;
+	}
 	fpu.regs[TOP].d = pow(2.0,fpu.regs[TOP].d) - 1;
 	return;
 }
 
 static void FPU_FYL2X(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[STV(1)] = FPU_Ext_FromHost(FPU_Ext_ToHost(fpu.regs_80[STV(1)])*log2l(FPU_Ext_ToHost(fpu.regs_80[TOP])));
+		FPU_FPOP();
+		return;
+	}
 	fpu.regs[STV(1)].d*=log(fpu.regs[TOP].d)/log(static_cast<Real64>(2.0));
 	FPU_FPOP();
 	return;
 }
 
 static void FPU_FYL2XP1(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[STV(1)] = FPU_Ext_FromHost(FPU_Ext_ToHost(fpu.regs_80[STV(1)])*log1pl(FPU_Ext_ToHost(fpu.regs_80[TOP]))/LN2_L);
+		FPU_FPOP();
+		return;
+	}
 	fpu.regs[STV(1)].d*=log(fpu.regs[TOP].d+1.0)/log(static_cast<Real64>(2.0));
 	FPU_FPOP();
 	return;
 }
 
 static void FPU_FSCALE(void){
+	if (fpu.softfloat) {
+		fpu.regs_80[TOP] = FPU_Ext_Scale(fpu.regs_80[TOP],fpu.regs_80[STV(1)]);
+		return;
+	}
 	fpu.regs[TOP].d *= pow(2.0,static_cast<Real64>(static_cast<Bit64s>(fpu.regs[STV(1)].d)));
 	return; //2^x where x is chopped.
 }
@@ -503,7 +723,8 @@ static void FPU_FSAVE(PhysPt addr){
 	FPU_FSTENV(addr);
 	Bitu start = (cpu.code.big?28:14);
 	for(Bitu i = 0;i < 8;i++){
-		FPU_ST80(addr+start,STV(i));
+		if (fpu.softfloat) FPU_ST80_Ext(addr+start,STV(i));
+		else FPU_ST80(addr+start,STV(i));
 		start += 10;
 	}
 	FPU_FINIT();
@@ -513,7 +734,8 @@ static void FPU_FRSTOR(PhysPt addr){
 	FPU_FLDENV(addr);
 	Bitu start = (cpu.code.big?28:14);
 	for(Bitu i = 0;i < 8;i++){
-		fpu.regs[STV(i)].d = FPU_FLD80(addr+start);
+		if (fpu.softfloat) fpu.regs_80[STV(i)] = FPU_FLD80_Ext(addr+start);
+		else fpu.regs[STV(i)].d = FPU_FLD80(addr+start);
 		start += 10;
 	}
 }
@@ -522,7 +744,24 @@ static void FPU_FXTRACT(void) {
 	// function stores real bias in st and 
 	// pushes the significant number onto the stack
 	// if double ever uses a different base please correct this function
-
+	if (fpu.softfloat) {
+		FPU_Ext val = fpu.regs_80[TOP];
+		if (FPU_Ext_IsNaN(val)) {
+			FPU_PUSH_Ext(val);
+		} else if (FPU_Ext_IsInf(val)) {
+			fpu.regs_80[TOP] = FPU_Ext_Inf(false);
+			FPU_PUSH_Ext(val);
+		} else if (FPU_Ext_IsZero(val)) {
+			fpu.regs_80[TOP] = FPU_Ext_Inf(true);
+			FPU_PUSH_Ext(val);
+		} else {
+			Bit32s exp = FPU_Ext_Exp(val);
+			if (exp == 0) FPU_Ext_Normalize(exp,val.mant);
+			fpu.regs_80[TOP] = FPU_Ext_FromInt64(exp - EXT_BIAS);
+			FPU_PUSH_Ext(FPU_Ext_Pack(FPU_Ext_Sign(val),EXT_BIAS,val.mant));
+		}
+		return;
+	}
 	FPU_Reg test = fpu.regs[TOP];
 	Bit64s exp80 =  test.ll&LONGTYPE(0x7ff0000000000000);
 	Bit64s exp80final = (exp80>>52) - BIAS64;
@@ -532,51 +771,61 @@ static void FPU_FXTRACT(void) {
 }
 
 static void FPU_FCHS(void){
+	fpu.regs_80[TOP].exp ^= 0x8000;
 	fpu.regs[TOP].d = -1.0*(fpu.regs[TOP].d);
 }
 
 static void FPU_FABS(void){
+	fpu.regs_80[TOP].exp &= 0x7fff;
 	fpu.regs[TOP].d = fabs(fpu.regs[TOP].d);
 }
 
 static void FPU_FTST(void){
 	fpu.regs[8].d = 0.0;
+	fpu.regs_80[8] = FPU_Ext_Pack(false,0,0);
 	FPU_FCOM(TOP,8);
 }
 
 static void FPU_FLD1(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = 1.0;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,EXT_BIAS,EXT_INT_BIT);
 }
 
 static void FPU_FLDL2T(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = L2T;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0x4000,LONGTYPE(0xd49a784bcd1b8afe));
 }
 
 static void FPU_FLDL2E(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = L2E;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0x3fff,LONGTYPE(0xb8aa3b295c17f0bc));
 }
 
 static void FPU_FLDPI(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = PI;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0x4000,LONGTYPE(0xc90fdaa22168c235));
 }
 
 static void FPU_FLDLG2(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = LG2;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0x3ffd,LONGTYPE(0x9a209a84fbcff799));
 }
 
 static void FPU_FLDLN2(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = LN2;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0x3ffe,LONGTYPE(0xb17217f7d1cf79ac));
 }
 
 static void FPU_FLDZ(void){
 	FPU_PREP_PUSH();
 	fpu.regs[TOP].d = 0.0;
+	fpu.regs_80[TOP] = FPU_Ext_Pack(false,0,0);
 	fpu.tags[TOP] = TAG_Zero;
 }
 
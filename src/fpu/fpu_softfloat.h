@@ -0,0 +1,660 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Extended precision arithmetic for fpu=softfloat. Values are kept in the x87
+ * register format (explicit integer bit, 15 bit exponent) so 80-bit loads and
+ * stores are exact. Add, sub, mul, div, sqrt and the integer conversions round
+ * like a real x87 following the rounding and precision control of the control
+ * word. The rounding is based on the SoftFloat package by John R. Hauser.
+ * Transcendental functions go through the host long double libm. */
+
+#define EXT_BIAS		0x3fff
+#define EXT_EXP_MAX		0x7fff
+#define EXT_INT_BIT		LONGTYPE(0x8000000000000000)
+#define EXT_QUIET_BIT	LONGTYPE(0x4000000000000000)
+
+static INLINE FPU_Ext FPU_Ext_Pack(bool sign,Bit32s exp,Bit64u mant) {
+	FPU_Ext r;
+	r.mant = mant;
+	r.exp = (Bit16u)((sign ? 0x8000 : 0) | exp);
+	return r;
+}
+
+static INLINE bool FPU_Ext_Sign(const FPU_Ext & a) {
+	return (a.exp & 0x8000) != 0;
+}
+
+static INLINE Bit32s FPU_Ext_Exp(const FPU_Ext & a) {
+	return a.exp & EXT_EXP_MAX;
+}
+
+static INLINE bool FPU_Ext_IsNaN(const FPU_Ext & a) {
+	return FPU_Ext_Exp(a) == EXT_EXP_MAX && (a.mant << 1) != 0;
+}
+
+static INLINE bool FPU_Ext_IsInf(const FPU_Ext & a) {
+	return FPU_Ext_Exp(a) == EXT_EXP_MAX && (a.mant << 1) == 0;
+}
+
+static INLINE bool FPU_Ext_IsZero(const FPU_Ext & a) {
+	return FPU_Ext_Exp(a) == 0 && a.mant == 0;
+}
+
+/* The real indefinite returned by invalid operations */
+static INLINE FPU_Ext FPU_Ext_DefaultNaN(void) {
+	return FPU_Ext_Pack(true,EXT_EXP_MAX,EXT_INT_BIT | EXT_QUIET_BIT);
+}
+
+static INLINE FPU_Ext FPU_Ext_Inf(bool sign) {
+	return FPU_Ext_Pack(sign,EXT_EXP_MAX,EXT_INT_BIT);
+}
+
+/* Of two NaNs the x87 returns a quiet one over a signaling one, else the one
+ * with the larger significand, else the positive one */
+static FPU_Ext FPU_Ext_PropagateNaN(const FPU_Ext & a,const FPU_Ext & b) {
+	FPU_Ext r = a;
+	if (!FPU_Ext_IsNaN(a)) r = b;
+	else if (FPU_Ext_IsNaN(b)) {
+		bool a_quiet = (a.mant & EXT_QUIET_BIT) != 0;
+		bool b_quiet = (b.mant & EXT_QUIET_BIT) != 0;
+		if (a_quiet != b_quiet) r = a_quiet ? a : b;
+		else if ((b.mant << 1) > (a.mant << 1) || ((b.mant << 1) == (a.mant << 1) && !FPU_Ext_Sign(b))) r = b;
+	}
+	r.mant |= EXT_INT_BIT | EXT_QUIET_BIT;
+	return r;
+}
+
+static INLINE Bitu FPU_Ext_CLZ(Bit64u a) {
+	Bitu n = 0;
+	if (!(a & LONGTYPE(0xffffffff00000000))) { n += 32; a <<= 32; }
+	if (!(a & LONGTYPE(0xffff000000000000))) { n += 16; a <<= 16; }
+	if (!(a & LONGTYPE(0xff00000000000000))) { n += 8; a <<= 8; }
+	if (!(a & LONGTYPE(0xf000000000000000))) { n += 4; a <<= 4; }
+	if (!(a & LONGTYPE(0xc000000000000000))) { n += 2; a <<= 2; }
+	if (!(a & LONGTYPE(0x8000000000000000))) { n += 1; }
+	return n;
+}
+
+/* Denormals get their integer bit back with an exponent that can go below 1 */
+static INLINE void FPU_Ext_Normalize(Bit32s & exp,Bit64u & mant) {
+	Bitu shift = FPU_Ext_CLZ(mant);
+	mant <<= shift;
+	exp = 1 - (Bit32s)shift;
+}
+
+static INLINE void FPU_Ext_Add128(Bit64u a0,Bit64u a1,Bit64u b0,Bit64u b1,Bit64u & z0,Bit64u & z1) {
+	Bit64u low = a1 + b1;
+	z0 = a0 + b0 + (low < a1);
+	z1 = low;
+}
+
+static INLINE void FPU_Ext_Sub128(Bit64u a0,Bit64u a1,Bit64u b0,Bit64u b1,Bit64u & z0,Bit64u & z1) {
+	z0 = a0 - b0 - (a1 < b1);
+	z1 = a1 - b1;
+}
+
+static INLINE void FPU_Ext_Mul64(Bit64u a,Bit64u b,Bit64u & z0,Bit64u & z1) {
+	Bit64u a_lo = (Bit32u)a, a_hi = a >> 32;
+	Bit64u b_lo = (Bit32u)b, b_hi = b >> 32;
+	Bit64u low = a_lo * b_lo;
+	Bit64u mid_a = a_lo * b_hi;
+	Bit64u mid_b = a_hi * b_lo;
+	Bit64u high = a_hi * b_hi;
+	mid_a += mid_b;
+	high += ((Bit64u)(mid_a < mid_b) << 32) + (mid_a >> 32);
+	mid_a <<= 32;
+	low += mid_a;
+	high += (low < mid_a);
+	z0 = high;
+	z1 = low;
+}
+
+/* Shift a0:a1 right, bits shifted out of a1 are or'ed into its lowest bit */
+static void FPU_Ext_ShiftRightJam128(Bit64u a0,Bit64u a1,Bit32s count,Bit64u & z0,Bit64u & z1) {
+	if (count == 0) {
+		z0 = a0;
+		z1 = a1;
+	} else if (count < 64) {
+		z1 = (a0 << (64 - count)) | (a1 >> count) | ((a1 << (64 - count)) != 0);
+		z0 = a0 >> count;
+	} else {
+		if (count == 64) z1 = a0 | (a1 != 0);
+		else if (count < 128) z1 = (a0 >> (count & 63)) | (((a0 << (128 - count)) | a1) != 0);
+		else z1 = ((a0 | a1) != 0);
+		z0 = 0;
+	}
+}
+
+static INLINE void FPU_Ext_ShiftLeft128(Bit64u a0,Bit64u a1,Bitu count,Bit64u & z0,Bit64u & z1) {
+	z0 = count ? ((a0 << count) | (a1 >> (64 - count))) : a0;
+	z1 = a1 << count;
+}
+
+/* Significand bits kept by the precision control field of the control word */
+static INLINE Bitu FPU_Ext_Precision(void) {
+	switch ((fpu.cw >> 8) & 3) {
+	case 0: return 24;
+	case 2: return 53;
+	default: return 64;
+	}
+}
+
+/* Round sig0:sig1 to the given precision and pack it, handling overflow to
+ * infinity and underflow to denormals like the x87 does with masked exceptions */
+static FPU_Ext FPU_Ext_RoundPack(Bitu precision,bool sign,Bit32s exp,Bit64u sig0,Bit64u sig1) {
+	const FPU_Round mode = fpu.round;
+	const bool nearest = (mode == ROUND_Nearest);
+	if (precision != 64) {
+		Bit64u round_mask = (precision == 53) ? LONGTYPE(0x7ff) : LONGTYPE(0xffffffffff);
+		Bit64u round_increment = (round_mask + 1) >> 1;
+		sig0 |= (sig1 != 0);
+		if (!nearest) {
+			if (mode == ROUND_Chop) round_increment = 0;
+			else {
+				round_increment = round_mask;
+				if (sign ? (mode == ROUND_Up) : (mode == ROUND_Down)) round_increment = 0;
+			}
+		}
+		if ((Bit32u)(exp - 1) >= 0x7ffd) {
+			if (exp > 0x7ffe || (exp == 0x7ffe && sig0 + round_increment < sig0)) {
+				if (mode == ROUND_Chop || (sign ? (mode == ROUND_Up) : (mode == ROUND_Down)))
+					return FPU_Ext_Pack(sign,0x7ffe,~round_mask);
+				return FPU_Ext_Inf(sign);
+			}
+			if (exp <= 0) {
+				FPU_Ext_ShiftRightJam128(sig0,0,1 - exp,sig0,sig1);
+				sig0 |= (sig1 != 0);
+				Bit64u round_bits = sig0 & round_mask;
+				sig0 += round_increment;
+				exp = (sig0 & EXT_INT_BIT) ? 1 : 0;
+				round_increment = round_mask + 1;
+				if (nearest && (round_bits << 1) == round_increment) round_mask |= round_increment;
+				sig0 &= ~round_mask;
+				return FPU_Ext_Pack(sign,exp,sig0);
+			}
+		}
+		Bit64u round_bits = sig0 & round_mask;
+		sig0 += round_increment;
+		if (sig0 < round_increment) {
+			exp++;
+			sig0 = EXT_INT_BIT;
+		}
+		round_increment = round_mask + 1;
+		if (nearest && (round_bits << 1) == round_increment) round_mask |= round_increment;
+		sig0 &= ~round_mask;
+		if (sig0 == 0) exp = 0;
+		return FPU_Ext_Pack(sign,exp,sig0);
+	}
+
+	bool increment;
+	if (nearest) increment = (sig1 & EXT_INT_BIT) != 0;
+	else if (mode == ROUND_Chop) increment = false;
+	else increment = (sig1 != 0) && (sign ? (mode == ROUND_Down) : (mode == ROUND_Up));
+	if ((Bit32u)(exp - 1) >= 0x7ffd) {
+		if (exp > 0x7ffe || (exp == 0x7ffe && sig0 == LONGTYPE(0xffffffffffffffff) && increment)) {
+			if (mode == ROUND_Chop || (sign ? (mode == ROUND_Up) : (mode == ROUND_Down)))
+				return FPU_Ext_Pack(sign,0x7ffe,LONGTYPE(0xffffffffffffffff));
+			return FPU_Ext_Inf(sign);
+		}
+		if (exp <= 0) {
+			FPU_Ext_ShiftRightJam128(sig0,sig1,1 - exp,sig0,sig1);
+			if (nearest) increment = (sig1 & EXT_INT_BIT) != 0;
+			else if (mode == ROUND_Chop) increment = false;
+			else increment = (sig1 != 0) && (sign ? (mode == ROUND_Down) : (mode == ROUND_Up));
+			if (increment) {
+				sig0++;
+				if (nearest && (sig1 << 1) == 0) sig0 &= ~(Bit64u)1;
+			}
+			return FPU_Ext_Pack(sign,(sig0 & EXT_INT_BIT) ? 1 : 0,sig0);
+		}
+	}
+	if (increment) {
+		sig0++;
+		if (sig0 == 0) {
+			exp++;
+			sig0 = EXT_INT_BIT;
+		} else if (nearest && (sig1 << 1) == 0) sig0 &= ~(Bit64u)1;
+	} else if (sig0 == 0) exp = 0;
+	return FPU_Ext_Pack(sign,exp,sig0);
+}
+
+static FPU_Ext FPU_Ext_NormalizeRoundPack(Bitu precision,bool sign,Bit32s exp,Bit64u sig0,Bit64u sig1) {
+	if (sig0 == 0) {
+		if (sig1 == 0) return FPU_Ext_Pack(sign,0,0);
+		sig0 = sig1;
+		sig1 = 0;
+		exp -= 64;
+	}
+	Bitu shift = FPU_Ext_CLZ(sig0);
+	FPU_Ext_ShiftLeft128(sig0,sig1,shift,sig0,sig1);
+	return FPU_Ext_RoundPack(precision,sign,exp - (Bit32s)shift,sig0,sig1);
+}
+
+static FPU_Ext FPU_Ext_AddSigs(const FPU_Ext & a,const FPU_Ext & b,bool sign) {
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bit64u a_sig = a.mant, b_sig = b.mant;
+	Bit64u z_sig0, z_sig1;
+	Bit32s z_exp;
+	Bit32s diff = a_exp - b_exp;
+	if (diff > 0) {
+		if (a_exp == EXT_EXP_MAX) return ((a_sig << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : a;
+		if (b_exp == 0) diff--;
+		FPU_Ext_ShiftRightJam128(b_sig,0,diff,b_sig,z_sig1);
+		z_exp = a_exp;
+	} else if (diff < 0) {
+		if (b_exp == EXT_EXP_MAX) return ((b_sig << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : FPU_Ext_Inf(sign);
+		if (a_exp == 0) diff++;
+		FPU_Ext_ShiftRightJam128(a_sig,0,-diff,a_sig,z_sig1);
+		z_exp = b_exp;
+	} else {
+		if (a_exp == EXT_EXP_MAX) return (((a_sig | b_sig) << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : a;
+		z_sig0 = a_sig + b_sig;
+		if (a_exp == 0) {
+			// Two denormals, the sum might carry into the integer bit
+			if (z_sig0 < a_sig) return FPU_Ext_RoundPack(FPU_Ext_Precision(),sign,1,(z_sig0 >> 1) | EXT_INT_BIT,(z_sig0 << 63));
+			return FPU_Ext_NormalizeRoundPack(FPU_Ext_Precision(),sign,1,z_sig0,0);
+		}
+		FPU_Ext_ShiftRightJam128(z_sig0,0,1,z_sig0,z_sig1);
+		return FPU_Ext_RoundPack(FPU_Ext_Precision(),sign,a_exp + 1,z_sig0 | EXT_INT_BIT,z_sig1);
+	}
+	z_sig0 = a_sig + b_sig;
+	if (z_sig0 < a_sig) {
+		FPU_Ext_ShiftRightJam128(z_sig0,z_sig1,1,z_sig0,z_sig1);
+		z_sig0 |= EXT_INT_BIT;
+		z_exp++;
+	}
+	return FPU_Ext_RoundPack(FPU_Ext_Precision(),sign,z_exp,z_sig0,z_sig1);
+}
+
+static FPU_Ext FPU_Ext_SubSigs(const FPU_Ext & a,const FPU_Ext & b,bool sign) {
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bit64u a_sig = a.mant, b_sig = b.mant;
+	Bit64u z_sig0, z_sig1 = 0;
+	Bit32s diff = a_exp - b_exp;
+	if (diff > 0) {
+		if (a_exp == EXT_EXP_MAX) return ((a_sig << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : a;
+		if (b_exp == 0) diff--;
+		FPU_Ext_ShiftRightJam128(b_sig,0,diff,b_sig,z_sig1);
+	} else if (diff < 0) {
+		if (b_exp == EXT_EXP_MAX) return ((b_sig << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : FPU_Ext_Inf(!sign);
+		if (a_exp == 0) diff++;
+		FPU_Ext_ShiftRightJam128(a_sig,0,-diff,a_sig,z_sig1);
+		FPU_Ext_Sub128(b_sig,0,a_sig,z_sig1,z_sig0,z_sig1);
+		return FPU_Ext_NormalizeRoundPack(FPU_Ext_Precision(),!sign,b_exp,z_sig0,z_sig1);
+	} else {
+		if (a_exp == EXT_EXP_MAX) return (((a_sig | b_sig) << 1) != 0) ? FPU_Ext_PropagateNaN(a,b) : FPU_Ext_DefaultNaN();
+		if (a_exp == 0) a_exp = 1;
+		if (a_sig == b_sig) return FPU_Ext_Pack(fpu.round == ROUND_Down,0,0);
+		if (a_sig < b_sig) return FPU_Ext_NormalizeRoundPack(FPU_Ext_Precision(),!sign,a_exp,b_sig - a_sig,0);
+	}
+	FPU_Ext_Sub128(a_sig,0,b_sig,z_sig1,z_sig0,z_sig1);
+	return FPU_Ext_NormalizeRoundPack(FPU_Ext_Precision(),sign,a_exp,z_sig0,z_sig1);
+}
+
+static FPU_Ext FPU_Ext_Add(const FPU_Ext & a,const FPU_Ext & b) {
+	bool sign = FPU_Ext_Sign(a);
+	if (sign == FPU_Ext_Sign(b)) return FPU_Ext_AddSigs(a,b,sign);
+	return FPU_Ext_SubSigs(a,b,sign);
+}
+
+static FPU_Ext FPU_Ext_Sub(const FPU_Ext & a,const FPU_Ext & b) {
+	bool sign = FPU_Ext_Sign(a);
+	if (sign == FPU_Ext_Sign(b)) return FPU_Ext_SubSigs(a,b,sign);
+	return FPU_Ext_AddSigs(a,b,sign);
+}
+
+static FPU_Ext FPU_Ext_Mul(const FPU_Ext & a,const FPU_Ext & b) {
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bit64u a_sig = a.mant, b_sig = b.mant;
+	bool sign = FPU_Ext_Sign(a) != FPU_Ext_Sign(b);
+	if (FPU_Ext_IsNaN(a) || FPU_Ext_IsNaN(b)) return FPU_Ext_PropagateNaN(a,b);
+	if (a_exp == EXT_EXP_MAX || b_exp == EXT_EXP_MAX) {
+		if (FPU_Ext_IsZero(a) || FPU_Ext_IsZero(b)) return FPU_Ext_DefaultNaN();
+		return FPU_Ext_Inf(sign);
+	}
+	if (a_exp == 0) {
+		if (a_sig == 0) return FPU_Ext_Pack(sign,0,0);
+		FPU_Ext_Normalize(a_exp,a_sig);
+	}
+	if (b_exp == 0) {
+		if (b_sig == 0) return FPU_Ext_Pack(sign,0,0);
+		FPU_Ext_Normalize(b_exp,b_sig);
+	}
+	Bit64u z_sig0, z_sig1;
+	Bit32s z_exp = a_exp + b_exp - 0x3ffe;
+	FPU_Ext_Mul64(a_sig,b_sig,z_sig0,z_sig1);
+	if (!(z_sig0 & EXT_INT_BIT)) {
+		FPU_Ext_ShiftLeft128(z_sig0,z_sig1,1,z_sig0,z_sig1);
+		z_exp--;
+	}
+	return FPU_Ext_RoundPack(FPU_Ext_Precision(),sign,z_exp,z_sig0,z_sig1);
+}
+
+static FPU_Ext FPU_Ext_Div(const FPU_Ext & a,const FPU_Ext & b) {
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bit64u a_sig = a.mant, b_sig = b.mant;
+	bool sign = FPU_Ext_Sign(a) != FPU_Ext_Sign(b);
+	if (FPU_Ext_IsNaN(a) || FPU_Ext_IsNaN(b)) return FPU_Ext_PropagateNaN(a,b);
+	if (a_exp == EXT_EXP_MAX) return (b_exp == EXT_EXP_MAX) ? FPU_Ext_DefaultNaN() : FPU_Ext_Inf(sign);
+	if (b_exp == EXT_EXP_MAX) return FPU_Ext_Pack(sign,0,0);
+	if (b_exp == 0) {
+		if (b_sig == 0) return (FPU_Ext_IsZero(a)) ? FPU_Ext_DefaultNaN() : FPU_Ext_Inf(sign);
+		FPU_Ext_Normalize(b_exp,b_sig);
+	}
+	if (a_exp == 0) {
+		if (a_sig == 0) return FPU_Ext_Pack(sign,0,0);
+		FPU_Ext_Normalize(a_exp,a_sig);
+	}
+	Bit32s z_exp = a_exp - b_exp + 0x3ffe;
+	/* Long division, one quotient bit per step plus a round bit and a sticky bit */
+	Bit64u rem = a_sig, quot = 1;
+	bool carry;
+	if (rem >= b_sig) {
+		z_exp++;
+	} else {
+		rem <<= 1;
+	}
+	rem -= b_sig;
+	for (Bitu i = 0;i < 63;i++) {
+		carry = (rem & EXT_INT_BIT) != 0;
+		rem <<= 1;
+		quot <<= 1;
+		if (carry || rem >= b_sig) {
+			rem -= b_sig;
+			quot |= 1;
+		}
+	}
+	Bit64u z_sig1 = 0;
+	carry = (rem & EXT_INT_BIT) != 0;
+	rem <<= 1;
+	if (carry || rem >= b_sig) {
+		rem -= b_sig;
+		z_sig1 = EXT_INT_BIT;
+	}
+	if (rem) z_sig1 |= 1;
+	return FPU_Ext_RoundPack(FPU_Ext_Precision(),sign,z_exp,quot,z_sig1);
+}
+
+/* Integer square root of the 128 bit value a0:a1, leaves the remainder in a0:a1 */
+static Bit64u FPU_Ext_ISqrt128(Bit64u & a0,Bit64u & a1) {
+	Bit64u res0 = 0, res1 = 0;
+	Bit64u bit0 = LONGTYPE(0x4000000000000000), bit1 = 0;
+	while (bit0 | bit1) {
+		Bit64u t0, t1;
+		FPU_Ext_Add128(res0,res1,bit0,bit1,t0,t1);
+		// res >>= 1
+		res1 = (res1 >> 1) | (res0 << 63);
+		res0 >>= 1;
+		if (a0 > t0 || (a0 == t0 && a1 >= t1)) {
+			FPU_Ext_Sub128(a0,a1,t0,t1,a0,a1);
+			FPU_Ext_Add128(res0,res1,bit0,bit1,res0,res1);
+		}
+		// bit >>= 2
+		bit1 = (bit1 >> 2) | (bit0 << 62);
+		bit0 >>= 2;
+	}
+	return res1;
+}
+
+static FPU_Ext FPU_Ext_Sqrt(const FPU_Ext & a) {
+	Bit32s a_exp = FPU_Ext_Exp(a);
+	Bit64u a_sig = a.mant;
+	if (FPU_Ext_IsNaN(a)) return FPU_Ext_PropagateNaN(a,a);
+	if (FPU_Ext_IsZero(a)) return a;
+	if (FPU_Ext_Sign(a)) return FPU_Ext_DefaultNaN();
+	if (a_exp == EXT_EXP_MAX) return a;
+	if (a_exp == 0) FPU_Ext_Normalize(a_exp,a_sig);
+	/* Unbiased exponent e, value = sig*2^(e-63). Take the root of sig*2^63 or
+	 * sig*2^64 so the exponent left over is even and the root has 64 bits */
+	Bit32s e = a_exp - EXT_BIAS;
+	Bit64u r0, r1;
+	if (e & 1) {
+		r0 = a_sig;
+		r1 = 0;
+		e -= 1;
+	} else {
+		r0 = a_sig >> 1;
+		r1 = a_sig << 63;
+	}
+	Bit64u root = FPU_Ext_ISqrt128(r0,r1);
+	// The remainder decides the round bit: sqrt >= root+0.5 when rem > root
+	Bit64u z_sig1 = 0;
+	if (r0 | r1) z_sig1 = (r0 || r1 > root) ? (EXT_INT_BIT | 1) : 1;
+	return FPU_Ext_RoundPack(FPU_Ext_Precision(),false,(e >> 1) + EXT_BIAS,root,z_sig1);
+}
+
+/* -1, 0 or 1 for less, equal or greater, 2 when unordered */
+static Bits FPU_Ext_Compare(const FPU_Ext & a,const FPU_Ext & b) {
+	if (FPU_Ext_IsNaN(a) || FPU_Ext_IsNaN(b)) return 2;
+	if (FPU_Ext_IsZero(a) && FPU_Ext_IsZero(b)) return 0;
+	bool a_sign = FPU_Ext_Sign(a);
+	if (a_sign != FPU_Ext_Sign(b)) return a_sign ? -1 : 1;
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bits res;
+	if (a_exp != b_exp) res = (a_exp < b_exp) ? -1 : 1;
+	else if (a.mant != b.mant) res = (a.mant < b.mant) ? -1 : 1;
+	else return 0;
+	return a_sign ? -res : res;
+}
+
+static FPU_Ext FPU_Ext_RoundToInt(const FPU_Ext & a,FPU_Round mode) {
+	Bit32s a_exp = FPU_Ext_Exp(a);
+	bool sign = FPU_Ext_Sign(a);
+	if (a_exp >= 0x403e) {
+		if (FPU_Ext_IsNaN(a)) return FPU_Ext_PropagateNaN(a,a);
+		return a;
+	}
+	if (a_exp < EXT_BIAS) {
+		if (a.mant == 0) return a;
+		switch (mode) {
+		case ROUND_Nearest:
+			if (a_exp == EXT_BIAS - 1 && (a.mant << 1) != 0) return FPU_Ext_Pack(sign,EXT_BIAS,EXT_INT_BIT);
+			break;
+		case ROUND_Down:
+			return sign ? FPU_Ext_Pack(true,EXT_BIAS,EXT_INT_BIT) : FPU_Ext_Pack(false,0,0);
+		case ROUND_Up:
+			return sign ? FPU_Ext_Pack(true,0,0) : FPU_Ext_Pack(false,EXT_BIAS,EXT_INT_BIT);
+		default:
+			break;
+		}
+		return FPU_Ext_Pack(sign,0,0);
+	}
+	Bit64u last_bit = (Bit64u)1 << (0x403e - a_exp);
+	Bit64u round_bits = last_bit - 1;
+	FPU_Ext z = a;
+	if (mode == ROUND_Nearest) {
+		z.mant += last_bit >> 1;
+		if ((z.mant & round_bits) == 0) z.mant &= ~last_bit;
+	} else if (mode != ROUND_Chop) {
+		if (sign != (mode == ROUND_Up)) z.mant += round_bits;
+	}
+	z.mant &= ~round_bits;
+	if (z.mant == 0) {
+		z.exp++;
+		z.mant = EXT_INT_BIT;
+	}
+	return z;
+}
+
+/* Out of range values and NaNs give the integer indefinite like on a real x87 */
+static Bit64s FPU_Ext_ToInt64(const FPU_Ext & a,FPU_Round mode) {
+	FPU_Ext r = FPU_Ext_RoundToInt(a,mode);
+	Bit32s exp = FPU_Ext_Exp(r);
+	bool sign = FPU_Ext_Sign(r);
+	if (exp < EXT_BIAS) return 0;
+	if (exp > 0x403e || (exp == 0x403e && !(sign && r.mant == EXT_INT_BIT)))
+		return (Bit64s)EXT_INT_BIT;
+	Bit64u mag = r.mant >> (0x403e - exp);
+	return sign ? (Bit64s)(0 - mag) : (Bit64s)mag;
+}
+
+static FPU_Ext FPU_Ext_FromInt64(Bit64s val) {
+	if (val == 0) return FPU_Ext_Pack(false,0,0);
+	bool sign = val < 0;
+	Bit64u mag = sign ? (0 - (Bit64u)val) : (Bit64u)val;
+	Bitu shift = FPU_Ext_CLZ(mag);
+	return FPU_Ext_Pack(sign,EXT_BIAS + 63 - (Bit32s)shift,mag << shift);
+}
+
+static FPU_Ext FPU_Ext_FromDouble(double val) {
+	FPU_Reg in;
+	in.d = val;
+	Bit64u bits = (Bit64u)in.ll;
+	bool sign = (bits >> 63) != 0;
+	Bit32s exp = (Bit32s)((bits >> 52) & 0x7ff);
+	Bit64u mant = bits & LONGTYPE(0xfffffffffffff);
+	if (exp == 0x7ff) return FPU_Ext_Pack(sign,EXT_EXP_MAX,EXT_INT_BIT | (mant << 11));
+	if (exp == 0) {
+		if (mant == 0) return FPU_Ext_Pack(sign,0,0);
+		Bitu shift = FPU_Ext_CLZ(mant);
+		return FPU_Ext_Pack(sign,EXT_BIAS + 63 - 1074 - (Bit32s)shift,mant << shift);
+	}
+	return FPU_Ext_Pack(sign,exp - 1023 + EXT_BIAS,EXT_INT_BIT | (mant << 11));
+}
+
+/* Round a value for a store to a narrower format with the given significand bits
+ * and exponent range, overflows and denormals follow the rounding mode. What is
+ * left is exact in a host double */
+static double FPU_Ext_RoundNarrow(const FPU_Ext & a,Bitu precision,Bit32s emin,Bit32s emax,double max) {
+	bool sign = FPU_Ext_Sign(a);
+	if (FPU_Ext_Exp(a) == EXT_EXP_MAX) {
+		FPU_Reg out;
+		out.ll = (Bit64s)(((Bit64u)sign << 63) | LONGTYPE(0x7ff0000000000000) | ((a.mant << 1) >> 12));
+		if (FPU_Ext_IsNaN(a)) out.ll |= LONGTYPE(0x8000000000000);
+		return out.d;
+	}
+	if (a.mant == 0) return sign ? -0.0 : 0.0;
+	Bit32s exp = FPU_Ext_Exp(a);
+	Bit64u mant = a.mant, sig1 = 0;
+	if (exp == 0) FPU_Ext_Normalize(exp,mant);
+	if (exp - EXT_BIAS < emin) {
+		FPU_Ext_ShiftRightJam128(mant,0,emin - (exp - EXT_BIAS),mant,sig1);
+		exp = emin + EXT_BIAS;
+	}
+	FPU_Ext r = FPU_Ext_RoundPack(precision,sign,exp,mant,sig1);
+	double val;
+	if (FPU_Ext_Exp(r) - EXT_BIAS > emax) {
+		if (fpu.round == ROUND_Chop || (sign ? (fpu.round == ROUND_Up) : (fpu.round == ROUND_Down))) val = max;
+		else val = HUGE_VAL;
+	} else val = ldexp(static_cast<double>(r.mant),FPU_Ext_Exp(r) - EXT_BIAS - 63);
+	return sign ? -val : val;
+}
+
+static double FPU_Ext_ToDouble(const FPU_Ext & a) {
+	return FPU_Ext_RoundNarrow(a,53,-1022,1023,DBL_MAX);
+}
+
+static float FPU_Ext_ToFloat(const FPU_Ext & a) {
+	return static_cast<float>(FPU_Ext_RoundNarrow(a,24,-126,127,FLT_MAX));
+}
+
+static long double FPU_Ext_ToHost(const FPU_Ext & a) {
+	bool sign = FPU_Ext_Sign(a);
+	if (FPU_Ext_IsNaN(a)) return static_cast<long double>(FPU_Ext_ToDouble(a));
+	if (FPU_Ext_IsInf(a)) return sign ? -HUGE_VALL : HUGE_VALL;
+	Bit32s exp = FPU_Ext_Exp(a);
+	if (exp == 0) exp = 1;
+	long double val = ldexpl(static_cast<long double>(a.mant),exp - EXT_BIAS - 63);
+	return sign ? -val : val;
+}
+
+static FPU_Ext FPU_Ext_FromHost(long double val) {
+	if (val != val) return FPU_Ext_DefaultNaN();
+	bool sign = signbit(val) != 0;
+	if (val == 0) return FPU_Ext_Pack(sign,0,0);
+	val = fabsl(val);
+	if (val > LDBL_MAX) return FPU_Ext_Inf(sign);
+	int exp;
+	long double frac = ldexpl(frexpl(val,&exp),64);
+	long double high = floorl(frac);
+	Bit64u z_sig0 = static_cast<Bit64u>(high);
+	// A long double wider than 64 bits keeps some bits for the rounding
+	Bit64u z_sig1 = static_cast<Bit64u>(ldexpl(frac - high,64));
+	return FPU_Ext_RoundPack(64,sign,exp - 1 + EXT_BIAS,z_sig0,z_sig1);
+}
+
+/* Remainder of a/b with a truncated (FPREM) or rounded (FPREM1) quotient, the low
+ * quotient bits are returned for the condition codes. Like the x87 exponents that
+ * differ by 64 or more are only partially reduced, software loops on C2 */
+static FPU_Ext FPU_Ext_Rem(const FPU_Ext & a,const FPU_Ext & b,bool nearest,Bit64u & quot,bool & partial) {
+	quot = 0;
+	partial = false;
+	if (FPU_Ext_IsNaN(a) || FPU_Ext_IsNaN(b)) return FPU_Ext_PropagateNaN(a,b);
+	if (FPU_Ext_Exp(a) == EXT_EXP_MAX || FPU_Ext_IsZero(b)) return FPU_Ext_DefaultNaN();
+	if (FPU_Ext_Exp(b) == EXT_EXP_MAX || FPU_Ext_IsZero(a)) return a;
+	bool sign = FPU_Ext_Sign(a);
+	Bit32s a_exp = FPU_Ext_Exp(a), b_exp = FPU_Ext_Exp(b);
+	Bit64u a_sig = a.mant, b_sig = b.mant;
+	if (a_exp == 0) FPU_Ext_Normalize(a_exp,a_sig);
+	if (b_exp == 0) FPU_Ext_Normalize(b_exp,b_sig);
+	Bit32s diff = a_exp - b_exp;
+	if (diff >= 64) {
+		// reduce by a multiple of b*2^(diff-n) with a truncated quotient,
+		// n is in 32..63 taken from the low bits of the difference
+		Bit32s n = (diff & 31) | 32;
+		b_exp += diff - n;
+		diff = n;
+		nearest = false;
+		partial = true;
+	}
+	if (diff < 0) {
+		// |a| < |b|, only FPREM1 can round the quotient up to 1 when 2|a| > |b|
+		if (!nearest || diff < -1 || a_sig <= b_sig) return a;
+		quot = 1;
+		return FPU_Ext_NormalizeRoundPack(64,!sign,a_exp,b_sig - (a_sig - b_sig),0);
+	}
+	Bit64u rem = a_sig;
+	bool carry = false;
+	for (Bit32s i = 0;;i++) {
+		quot <<= 1;
+		if (carry || rem >= b_sig) {
+			rem -= b_sig;
+			quot |= 1;
+		}
+		if (i == diff) break;
+		carry = (rem & EXT_INT_BIT) != 0;
+		rem <<= 1;
+	}
+	if (nearest) {
+		bool above = (rem & EXT_INT_BIT) || (rem << 1) > b_sig;
+		if (above || ((rem << 1) == b_sig && (quot & 1))) {
+			rem = b_sig - rem;
+			sign = !sign;
+			quot++;
+		}
+	}
+	return FPU_Ext_NormalizeRoundPack(64,sign,b_exp,rem,0);
+}
+
+/* a*2^n with n the chopped integer value of b */
+static FPU_Ext FPU_Ext_Scale(const FPU_Ext & a,const FPU_Ext & b) {
+	if (FPU_Ext_IsNaN(a) || FPU_Ext_IsNaN(b)) return FPU_Ext_PropagateNaN(a,b);
+	if (FPU_Ext_IsInf(b)) {
+		if (FPU_Ext_Sign(b)) return FPU_Ext_IsInf(a) ? FPU_Ext_DefaultNaN() : FPU_Ext_Pack(FPU_Ext_Sign(a),0,0);
+		return FPU_Ext_IsZero(a) ? FPU_Ext_DefaultNaN() : FPU_Ext_Inf(FPU_Ext_Sign(a));
+	}
+	if (FPU_Ext_Exp(a) == EXT_EXP_MAX || FPU_Ext_IsZero(a)) return a;
+	// Anything past 2^16 already over- or underflows every finite value
+	Bit64s n;
+	if (FPU_Ext_Exp(b) >= EXT_BIAS + 16) n = FPU_Ext_Sign(b) ? -0x10000 : 0x10000;
+	else n = FPU_Ext_ToInt64(b,ROUND_Chop);
+	Bit32s exp = FPU_Ext_Exp(a);
+	Bit64u mant = a.mant;
+	if (exp == 0) FPU_Ext_Normalize(exp,mant);
+	return FPU_Ext_RoundPack(64,FPU_Ext_Sign(a),exp + (Bit32s)n,mant,0);
+}
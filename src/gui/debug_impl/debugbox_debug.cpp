@@ -6,6 +6,10 @@
 #include "mem.h"
 #include "cpu.h"
 #include "mapper.h"
+#include "pic.h"
+#include "mixer.h"
+#include "perf_stats.h"
+#include "callback.h"
 #include "debug/debug_inc.h"
 
 #include "gui/debug_impl/imgui/imgui.h"
@@ -15,6 +19,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <algorithm>
 #include <SDL.h>
 
 #pragma region Memory
@@ -71,8 +76,6 @@ void CopyMemorySegmentIntoClipboard()
 
 void DrawMemoryEditor()
 {
-	ImGui::Begin("RAM");
-
 	ImGui::InputInt("Segment", (int*)&dataSeg, 1, 100, "%04X", ImGuiInputTextFlags_CharsHexadecimal);
 	ImGui::InputInt("Offset", (int*)&dataOfs, 1, 100, "%04X", ImGuiInputTextFlags_CharsHexadecimal);
 	if (ImGui::Button("Copy Content"))
@@ -83,8 +86,6 @@ void DrawMemoryEditor()
 	ImGui::Separator();
 
 	mem_edit.DrawContents(0, 0xFFFF /*max segment offset*/, dataOfs);
-	
-	ImGui::End();
 }
 #pragma endregion
 
@@ -227,14 +228,6 @@ inline const ImVec4& GetColor(OldValues::Value& val)
 
 void DrawRegisters()
 {
-	if (ImGui::Begin("Registers", nullptr, ImGuiWindowFlags_AlwaysAutoResize) == false)
-	{
-		ImGui::End();
-		return;
-	}
-
-	RefreshRegisters();
-
 	ImVec2 rectMinPos;
 	ImVec2 rectMaxPos;
 	
@@ -333,8 +326,6 @@ void DrawRegisters()
 	ImGui::Text("CycleCount=%u", cycle_count);
 	GetRegisterRectangleWithPadding(rectMinPos, rectMaxPos, true);
 	ImGui::GetWindowDrawList()->AddRect(rectMinPos, rectMaxPos, IM_COL32_WHITE, 5.0f);
-
-	ImGui::End();
 }
 #pragma endregion
 
@@ -355,14 +346,26 @@ void CopyPaletteIntoClipboard()
 	delete[] paletteContent;
 }
 
-void DrawPalette()
+static decltype(RenderPal_t::rgb) PaletteSnapshot;
+static ImVec4 PaletteColors[256];
+
+bool HasPaletteChanged()
 {
-	if (ImGui::Begin("Palette Display", nullptr, ImGuiWindowFlags_AlwaysAutoResize) == false)
+	return memcmp(PaletteSnapshot, render.pal.rgb, sizeof(PaletteSnapshot)) != 0;
+}
+
+void RefreshPalette()
+{
+	memcpy(PaletteSnapshot, render.pal.rgb, sizeof(PaletteSnapshot));
+	for (int i = 0; i < 256; ++i)
 	{
-		ImGui::End();
-		return;
+		auto& palCol = PaletteSnapshot[i];
+		PaletteColors[i] = ImVec4(palCol.red / 255.f, palCol.green / 255.f, palCol.blue / 255.f, 1.0f);
 	}
+}
 
+void DrawPalette()
+{
 	if (ImGui::Button("Copy Palette To Clipboard"))
 	{
 		CopyPaletteIntoClipboard();
@@ -373,9 +376,7 @@ void DrawPalette()
 	int x = 0;
 	for (int i = 0; i < 256; ++i)
 	{
-		auto& palCol = render.pal.rgb[i];
-		const ImVec4 col_v4(palCol.red / 255.f, palCol.green / 255.f, palCol.blue / 255.f, 1.0f);
-		if (ImGui::ColorButton("##ColorButton", col_v4, 0))
+		if (ImGui::ColorButton("##ColorButton", PaletteColors[i], 0))
 		{
 			;
 		}
@@ -388,8 +389,6 @@ void DrawPalette()
 			x = 0;
 		}
 	}
-
-	ImGui::End();
 }
 #pragma endregion
 
@@ -412,126 +411,125 @@ static std::deque<LineOfCode> LinesOfCode;
 static std::vector<CodeSyncPoint> CodeSyncPoints;
 
 static bool ForceGoTo = false;
+static bool hasScrolled = false;
 static int GoToOffset = 0;
 
-void DrawCode()
+// Rebuild the disassembly when the debugger breaks into another code segment
+void RefreshCode()
 {
-	if (ImGui::Begin("Code Display", nullptr, ImGuiWindowFlags_None) == false)
+	static Bit16u lastCS = 0xFFFF;
+	if (lastCS != codeViewData.useCS && DEBUG_IsDebugging())
 	{
-		ImGui::End();
-		return;
-	}
-
-	bool shouldGoTo = ForceGoTo;
-	ForceGoTo = false;
-	if (ImGui::Button("GoTo"))
-	{
-		shouldGoTo = true;
-	}
-	ImGui::SameLine();
-	if (ImGui::InputInt("Offset", (int*)&GoToOffset, 1, 100, "%04X", ImGuiInputTextFlags_CharsHexadecimal))
-	{
-		shouldGoTo = true;
-	}
-	ImGui::Separator();
-
-	{
-		ImGui::BeginChild(ImGui::GetID("CodeContent"));
-
-		static bool hasScrolled = false;
-		static Bit16u lastCS = 0xFFFF;
-		if (lastCS != codeViewData.useCS && DEBUG_IsDebugging())
+		LinesOfCode.clear();
+		CodeSyncPoints.clear();
+
+		Bit32u disEIP = codeViewData.useEIP;
+		PhysPt start = GetAddress(codeViewData.useCS, codeViewData.useEIP);
+		Bitu size;
+		static char line20[21] = "                    ";
+		char buffer[512];
+		Bitu totalSize = 0;
+		OpInfo opInfo;
+		while (totalSize < 0xFFFF)
 		{
-			LinesOfCode.clear();
-
-			Bit32u disEIP = codeViewData.useEIP;
-			PhysPt start = GetAddress(codeViewData.useCS, codeViewData.useEIP);
-			Bitu size;
-			static char line20[21] = "                    ";
-			char buffer[512];
-			Bitu totalSize = 0;
-			OpInfo opInfo;
-			while (totalSize < 0xFFFF)
-			{
-				Bitu drawsize = size = DasmI386(&opInfo, start, disEIP, cpu.code.big);
-				sprintf(buffer, "%04X:%04X  %s", codeViewData.useCS, disEIP, opInfo.dline);
+			Bitu drawsize = size = DasmI386(&opInfo, start, disEIP, cpu.code.big);
+			sprintf(buffer, "%04X:%04X  %s", codeViewData.useCS, disEIP, opInfo.dline);
 
-				if (opInfo.IsCallOrJmp)
-				{
-					// TODO : Add code sync point
-					CodeSyncPoints.emplace_back(opInfo.callOrJmpOffset);
-					opInfo.IsCallOrJmp = false;
-				}
+			if (opInfo.IsCallOrJmp)
+			{
+				// TODO : Add code sync point
+				CodeSyncPoints.emplace_back(opInfo.callOrJmpOffset);
+				opInfo.IsCallOrJmp = false;
+			}
 
-				LineOfCode line;
-				line.Code = buffer;
-				line.EIPOffset = disEIP;
-				LinesOfCode.push_back(line);
+			LineOfCode line;
+			line.Code = buffer;
+			line.EIPOffset = disEIP;
+			LinesOfCode.push_back(line);
 
-				start += size;
-				disEIP += size;
-				totalSize += size;
-			}
+			start += size;
+			disEIP += size;
+			totalSize += size;
+		}
 
-			// Patch using Code Sync Points
-			for (CodeSyncPoint& codeSyncPoint : CodeSyncPoints)
+		// Patch using Code Sync Points
+		for (CodeSyncPoint& codeSyncPoint : CodeSyncPoints)
+		{
+			Bit32u index = 0;
+			for (LineOfCode& line : LinesOfCode)
 			{
-				Bit32u index = 0;
-				for (LineOfCode& line : LinesOfCode)
+				if (line.EIPOffset > codeSyncPoint.Offset)
 				{
-					if (line.EIPOffset > codeSyncPoint.Offset)
+					if (index > 0)
 					{
-						if (index > 0)
+						if (LinesOfCode[index - 1].EIPOffset != codeSyncPoint.Offset)
 						{
-							if (LinesOfCode[index - 1].EIPOffset != codeSyncPoint.Offset)
+							OpInfo opInfo;
+							PhysPt start = GetAddress(codeViewData.useCS, codeSyncPoint.Offset);
+							Bitu size = DasmI386(&opInfo, start, codeSyncPoint.Offset, cpu.code.big);
+							sprintf(buffer, "%04X:%04X  %s", codeViewData.useCS, codeSyncPoint.Offset, opInfo.dline);
+
+							if (codeSyncPoint.Offset + size == line.EIPOffset)
+							{
+								// Missing a line, we add it now
+								LineOfCode line;
+								line.Code = buffer;
+								line.EIPOffset = codeSyncPoint.Offset;
+								LinesOfCode.insert(LinesOfCode.begin() + index, line);
+							}
+							else
 							{
-								OpInfo opInfo;
-								PhysPt start = GetAddress(codeViewData.useCS, codeSyncPoint.Offset);
-								Bitu size = DasmI386(&opInfo, start, codeSyncPoint.Offset, cpu.code.big);
-								sprintf(buffer, "%04X:%04X  %s", codeViewData.useCS, codeSyncPoint.Offset, opInfo.dline);
+								// Replace current line because its invalid anyway
+								line.Code = buffer;
+								line.EIPOffset = codeSyncPoint.Offset;
 
-								if (codeSyncPoint.Offset + size == line.EIPOffset)
+								// Check and patch next instructions
+								for (Bit32u nextInstructionIndex = index+1; nextInstructionIndex < LinesOfCode.size(); ++nextInstructionIndex)
 								{
-									// Missing a line, we add it now
-									LineOfCode line;
-									line.Code = buffer;
-									line.EIPOffset = codeSyncPoint.Offset;
-									LinesOfCode.insert(LinesOfCode.begin() + index, line);
-								}
-								else
-								{
-									// Replace current line because its invalid anyway
-									line.Code = buffer;
-									line.EIPOffset = codeSyncPoint.Offset;
-
-									// Check and patch next instructions
-									for (Bit32u nextInstructionIndex = index+1; nextInstructionIndex < LinesOfCode.size(); ++nextInstructionIndex)
+									LineOfCode& nextInstruction = LinesOfCode[nextInstructionIndex];
+									if (line.EIPOffset + size == nextInstruction.EIPOffset)
+									{
+										break;
+									}
+									else
 									{
-										LineOfCode& nextInstruction = LinesOfCode[nextInstructionIndex];
-										if (line.EIPOffset + size == nextInstruction.EIPOffset)
-										{
-											break;
-										}
-										else
-										{
-											// Need to implement patching on multiple lines. Never happened yet
-											// TODO: clean that patching code when implementing that, and optimize
-											break;
-										}
+										// Need to implement patching on multiple lines. Never happened yet
+										// TODO: clean that patching code when implementing that, and optimize
+										break;
 									}
 								}
 							}
 						}
-						break;
 					}
-					++index;
+					break;
 				}
+				++index;
 			}
+		}
 
-			lastCS = codeViewData.useCS;
+		lastCS = codeViewData.useCS;
 
-			hasScrolled = false;
-		}
+		hasScrolled = false;
+	}
+}
+
+void DrawCode()
+{
+	bool shouldGoTo = ForceGoTo;
+	ForceGoTo = false;
+	if (ImGui::Button("GoTo"))
+	{
+		shouldGoTo = true;
+	}
+	ImGui::SameLine();
+	if (ImGui::InputInt("Offset", (int*)&GoToOffset, 1, 100, "%04X", ImGuiInputTextFlags_CharsHexadecimal))
+	{
+		shouldGoTo = true;
+	}
+	ImGui::Separator();
+
+	{
+		ImGui::BeginChild(ImGui::GetID("CodeContent"));
 
 		static Bit32u lastEIP = 0xFFFF;
 		static int CurrentEIPIndex = 0;
@@ -644,8 +642,6 @@ void DrawCode()
 
 		ImGui::EndChild();
 	}
-
-	ImGui::End();
 }
 
 #pragma endregion
@@ -653,12 +649,6 @@ void DrawCode()
 #pragma region(Help Window)
 void DrawHelpWindow()
 {
-	if (!ImGui::Begin("Help"))
-	{
-		ImGui::End();
-		return;
-	}
-	
 	if (!DosboxWindowIsFocused)
 	{
 		ImGui::Text("Debug mode:");
@@ -671,7 +661,6 @@ void DrawHelpWindow()
 		ImGui::Text("Dosbox Window is focused");
 		ImGui::Text("All inputs are captured");	
 	}
-	ImGui::End();
 }
 #pragma endregion
 
@@ -703,14 +692,8 @@ struct ExampleAppLog
 		ScrollToBottom = true;
 	}
 
-	void    Draw(const char* title, bool* p_open = NULL)
+	void    Draw()
 	{
-		ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
-		if (!ImGui::Begin(title, p_open))
-		{
-			ImGui::End();
-			return;
-		}
 		if (ImGui::Button("Clear")) Clear();
 		ImGui::SameLine();
 		bool copy = ImGui::Button("Copy");
@@ -741,7 +724,6 @@ struct ExampleAppLog
 			ImGui::SetScrollHereY(1.0f);
 		ScrollToBottom = false;
 		ImGui::EndChild();
-		ImGui::End();
 	}
 } s_Log;
 
@@ -755,20 +737,13 @@ void DEBUG_ShowMsg(char const* format, ...)
 
 void DrawLogWindow()
 {
-	bool isOpen = true;
-	s_Log.Draw("Example: Log", &isOpen);
+	s_Log.Draw();
 }
 #pragma endregion
 
 #pragma region(CallStack)
 void DrawCallStackWindow()
 {
-	if (!ImGui::Begin("CallStack"))
-	{
-		ImGui::End();
-		return;
-	}
-
 	if (!DosboxWindowIsFocused)
 	{
 		const std::deque<CallFunction*>& callstack = CallFunction::GetCallStack();
@@ -781,19 +756,12 @@ void DrawCallStackWindow()
 	{
 		ImGui::Text("CallStack only displayed when breaked");
 	}
-	ImGui::End();
 }
 #pragma endregion
 
 #pragma region(Breakpoints)
 void DrawBreakPoints()
 {
-	if (!ImGui::Begin("Breakpoints"))
-	{
-		ImGui::End();
-		return;
-	}
-
 	Bit32s indexToRemove = -1;
 	auto& list = CBreakpoint::GetBreakPointList();
 	Bit32s nr = 0;
@@ -843,22 +811,430 @@ void DrawBreakPoints()
 		CBreakpoint::SerializeAll(RunningProgram, false);
 		indexToRemove = -1;
 	}
+}
+#pragma endregion
 
-	ImGui::End();
+static float CounterToMs(Uint64 counter)
+{
+	static const double frequency = (double)SDL_GetPerformanceFrequency();
+	return (float)(counter * 1000.0 / frequency);
+}
+
+#pragma region(Performance)
+extern Bit32s ticksDone;
+extern Bit32u ticksScheduled;
+
+struct PerfHistory
+{
+	static constexpr int Size = 120;
+	float Values[Size] = {};
+	int Offset = 0;
+
+	void Add(float value)
+	{
+		Values[Offset] = value;
+		Offset = (Offset + 1) % Size;
+	}
+
+	float Latest() const { return Values[(Offset + Size - 1) % Size]; }
+
+	void Plot(const char* label, const char* format, float scaleMax = FLT_MAX) const
+	{
+		char overlay[64];
+		sprintf(overlay, format, Latest());
+		ImGui::PlotLines(label, Values, Size, Offset, overlay, 0.0f, scaleMax, ImVec2(0, 40));
+	}
+};
+
+static PerfHistory CyclesExecutedHistory;
+static PerfHistory CyclesScheduledHistory;
+static PerfHistory TimerHistories[PERF_TIMER_MAX];
+static PerfHistory CacheHitHistory;
+static PerfHistory CacheMissHistory;
+static PerfHistory CacheFlushHistory;
+static PerfHistory CacheEvictHistory;
+static PerfHistory CacheKeptHistory;
+static PerfHistory CacheTraceHistory;
+static PerfHistory TargetHitHistory;
+static PerfHistory TargetMissHistory;
+static PerfHistory TlbFillHistory;
+static PerfHistory TlbRestoreHistory;
+static PerfHistory XmsMovedHistory;
+static PerfHistory EmsMovedHistory;
+static PerfHistory EmsMappedHistory;
+static PerfHistory AudioFillHistory;
+
+static const char* TimerNames[PERF_TIMER_MAX] =
+{
+	"Other", "CPU core", "PIC events", "VGA drawing", "Mixer", "ImGui", "Idle", "Mixer callback"
+};
+
+// Called once per UI frame, even when the window is hidden, so every sample covers one frame
+void UpdatePerformanceStats()
+{
+#if C_PERF_STATS
+	static Bit64u lastSnapshotTime = 0;
+	PerfStats_t snapshot;
+	PERF_TakeSnapshot(snapshot);
+
+	float frameMs = lastSnapshotTime ? CounterToMs(snapshot.last - lastSnapshotTime) : 0.0f;
+	lastSnapshotTime = snapshot.last;
+
+	CyclesExecutedHistory.Add(snapshot.counters[PERF_COUNTER_CYCLES] / 1000.0f);
+	CyclesScheduledHistory.Add(frameMs * CPU_CycleMax / 1000.0f);
+	for (int i = 0; i < PERF_TIMER_MAX; ++i)
+	{
+		TimerHistories[i].Add(CounterToMs(snapshot.timers[i]));
+	}
+	CacheHitHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_HIT]);
+	CacheMissHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_MISS]);
+	CacheFlushHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_FLUSH]);
+	CacheEvictHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_EVICT]);
+	CacheKeptHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_KEPT]);
+	CacheTraceHistory.Add((float)snapshot.counters[PERF_COUNTER_CACHE_TRACE]);
+	TargetHitHistory.Add((float)snapshot.counters[PERF_COUNTER_TARGET_HIT]);
+	TargetMissHistory.Add((float)snapshot.counters[PERF_COUNTER_TARGET_MISS]);
+	TlbFillHistory.Add((float)snapshot.counters[PERF_COUNTER_TLB_FILL]);
+	TlbRestoreHistory.Add((float)snapshot.counters[PERF_COUNTER_TLB_RESTORE]);
+	XmsMovedHistory.Add(snapshot.counters[PERF_COUNTER_XMS_MOVED] / 1024.0f);
+	EmsMovedHistory.Add(snapshot.counters[PERF_COUNTER_EMS_MOVED] / 1024.0f);
+	EmsMappedHistory.Add((float)snapshot.counters[PERF_COUNTER_EMS_MAPPED]);
+	AudioFillHistory.Add(MIXER_GetBufferFill() * 100.0f);
+#endif
+}
+
+void DrawPerformance()
+{
+#if C_PERF_STATS
+	ImGui::Text("CPU_CycleMax=%d ticksDone=%d ticksScheduled=%u", CPU_CycleMax, ticksDone, ticksScheduled);
+	ImGui::Separator();
+
+	ImGui::Text("Cycles per frame (k)");
+	CyclesExecutedHistory.Plot("Executed", "%.1f k");
+	CyclesScheduledHistory.Plot("Scheduled", "%.1f k");
+	ImGui::Separator();
+
+	ImGui::Text("Host time per frame (ms)");
+	for (int i = 0; i < PERF_TIMER_MAX; ++i)
+	{
+		TimerHistories[i].Plot(TimerNames[i], "%.3f ms");
+	}
+	ImGui::Separator();
+
+	ImGui::Text("Recompiler cache per frame");
+	CacheHitHistory.Plot("Hits", "%.0f");
+	CacheMissHistory.Plot("Misses", "%.0f");
+	CacheFlushHistory.Plot("Wraps", "%.0f");
+	CacheEvictHistory.Plot("Evicted", "%.0f");
+	CacheKeptHistory.Plot("Kept hot", "%.0f");
+	CacheTraceHistory.Plot("Traces", "%.0f");
+	TargetHitHistory.Plot("Indirect chained", "%.0f");
+	TargetMissHistory.Plot("Indirect to core", "%.0f");
+	ImGui::Separator();
+
+	ImGui::Text("Paging per frame");
+	TlbFillHistory.Plot("Pages filled", "%.0f");
+	TlbRestoreHistory.Plot("Pages restored", "%.0f");
+	ImGui::Separator();
+
+	ImGui::Text("XMS/EMS per frame");
+	XmsMovedHistory.Plot("XMS moved", "%.1f KB");
+	EmsMovedHistory.Plot("EMS moved", "%.1f KB");
+	EmsMappedHistory.Plot("EMS pages mapped", "%.0f");
+	ImGui::Separator();
+
+	AudioFillHistory.Plot("Audio buffer", "%.0f %%", 100.0f);
+#else
+	ImGui::Text("Performance counters are compiled out of release builds");
+#endif
 }
 #pragma endregion
 
+#pragma region(Callbacks)
+struct CallbackRow
+{
+	Bitu Number;
+	float CallsPerSecond;
+	float LeafPercent;		// Calls served inside the cpu core
+	Bit64u Total;
+};
+
+static std::vector<CallbackRow> CallbackRows;
+
+// Rates are measured over half a second so they stay readable, this also covers the frames a hidden window skipped
+void RefreshCallbacks()
+{
+	static Bit64u lastCalls[CB_MAX];
+	static Bit64u lastLeafCalls[CB_MAX];
+	static Uint64 lastTime = 0;
+
+	Uint64 now = SDL_GetPerformanceCounter();
+	float seconds = CounterToMs(now - lastTime) / 1000.0f;
+	if (lastTime && seconds < 0.5f)
+		return;
+
+	CallbackRows.clear();
+	for (Bitu i = 0; i < CB_MAX; ++i)
+	{
+		// The counters restart with the machine
+		if (CallBack_Calls[i] < lastCalls[i] || CallBack_LeafCalls[i] < lastLeafCalls[i])
+		{
+			lastCalls[i] = lastLeafCalls[i] = 0;
+		}
+		Bit64u calls = CallBack_Calls[i] - lastCalls[i];
+		Bit64u leafCalls = CallBack_LeafCalls[i] - lastLeafCalls[i];
+		lastCalls[i] = CallBack_Calls[i];
+		lastLeafCalls[i] = CallBack_LeafCalls[i];
+		if (!CallBack_Calls[i])
+			continue;
+
+		CallbackRow row;
+		row.Number = i;
+		row.CallsPerSecond = lastTime ? calls / seconds : 0.0f;
+		row.LeafPercent = calls ? leafCalls * 100.0f / calls : 0.0f;
+		row.Total = CallBack_Calls[i];
+		CallbackRows.push_back(row);
+	}
+	lastTime = now;
+
+	std::sort(CallbackRows.begin(), CallbackRows.end(), [](const CallbackRow& a, const CallbackRow& b)
+	{
+		if (a.CallsPerSecond != b.CallsPerSecond)
+			return a.CallsPerSecond > b.CallsPerSecond;
+		return a.Total > b.Total;
+	});
+}
+
+void DrawCallbacks()
+{
+	ImGui::Columns(5, "Callbacks");
+	ImGui::Text("Nr"); ImGui::NextColumn();
+	ImGui::Text("Description"); ImGui::NextColumn();
+	ImGui::Text("Calls/s"); ImGui::NextColumn();
+	ImGui::Text("In core"); ImGui::NextColumn();
+	ImGui::Text("Total"); ImGui::NextColumn();
+	ImGui::Separator();
+	for (const CallbackRow& row : CallbackRows)
+	{
+		const char* description = CALLBACK_GetDescription(row.Number);
+		ImGui::Text("%3d", (int)row.Number); ImGui::NextColumn();
+		if (CallBack_Leaves[row.Number])
+		{
+			ImGui::Text("%s", description ? description : "");
+		}
+		else
+		{
+			ImGui::TextDisabled("%s", description ? description : "");
+		}
+		ImGui::NextColumn();
+		ImGui::Text("%.0f", row.CallsPerSecond); ImGui::NextColumn();
+		ImGui::Text("%.0f%%", row.LeafPercent); ImGui::NextColumn();
+		ImGui::Text("%llu", (unsigned long long)row.Total); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+#pragma endregion
+
+#pragma region(Scheduler)
+// When the cached state of a window has to be rebuilt
+enum EWindowRefresh
+{
+	WINDOW_REFRESH_ON_BREAK,		// Once per break (cycle_count moved while debugging)
+	WINDOW_REFRESH_PER_FRAME,		// Every drawn frame
+	WINDOW_REFRESH_ON_DATA_CHANGE	// When HasDataChanged reports new data
+};
+
+struct SDebugWindow
+{
+	const char* Name;
+	ImGuiWindowFlags Flags;
+	EWindowRefresh Refresh;
+	void (*RefreshFn)();		// Can be null if the window has no cached state
+	bool (*HasDataChangedFn)();	// Only used by WINDOW_REFRESH_ON_DATA_CHANGE
+	void (*DrawFn)();
+	ImVec2 DefaultSize;
+
+	bool IsOpen;
+	bool WasVisible;
+	Bitu LastRefreshCycle;
+
+	// Cost of the last frame and smoothed average, in ms
+	float LastCostMs;
+	float AverageCostMs;
+
+	SDebugWindow(const char* name, ImGuiWindowFlags flags, EWindowRefresh refresh, void (*refreshFn)(), bool (*hasDataChangedFn)(), void (*drawFn)(), ImVec2 defaultSize = ImVec2(0, 0))
+		: Name(name), Flags(flags), Refresh(refresh), RefreshFn(refreshFn), HasDataChangedFn(hasDataChangedFn), DrawFn(drawFn), DefaultSize(defaultSize),
+		IsOpen(true), WasVisible(false), LastRefreshCycle(0), LastCostMs(0.0f), AverageCostMs(0.0f)
+	{}
+};
+
+static SDebugWindow DebugWindows[] =
+{
+	SDebugWindow("RAM",				ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawMemoryEditor),
+	SDebugWindow("Registers",		ImGuiWindowFlags_AlwaysAutoResize,	WINDOW_REFRESH_ON_BREAK,		&RefreshRegisters,	nullptr,			&DrawRegisters),
+	SDebugWindow("Palette Display",	ImGuiWindowFlags_AlwaysAutoResize,	WINDOW_REFRESH_ON_DATA_CHANGE,	&RefreshPalette,	&HasPaletteChanged,	&DrawPalette),
+	SDebugWindow("Code Display",	ImGuiWindowFlags_None,				WINDOW_REFRESH_ON_BREAK,		&RefreshCode,		nullptr,			&DrawCode),
+	SDebugWindow("Help",			ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawHelpWindow),
+	SDebugWindow("Example: Log",	ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawLogWindow, ImVec2(500, 400)),
+	SDebugWindow("CallStack",		ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawCallStackWindow),
+	SDebugWindow("Breakpoints",		ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawBreakPoints),
+	SDebugWindow("Performance",		ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		nullptr,			nullptr,			&DrawPerformance, ImVec2(400, 700)),
+	SDebugWindow("Callbacks",		ImGuiWindowFlags_None,				WINDOW_REFRESH_PER_FRAME,		&RefreshCallbacks,	nullptr,			&DrawCallbacks, ImVec2(450, 300)),
+};
+
+static bool ShowStatsOverlay = false;
+static bool ShowImGuiDemo = false;
+static float LastFrameCostMs = 0.0f;
+static float AverageFrameCostMs = 0.0f;
+
+static void AddCostSample(float& average, float sample)
+{
+	static constexpr float smoothing = 0.05f;
+	average += (sample - average) * smoothing;
+}
+
+static bool ShouldRefresh(SDebugWindow& window)
+{
+	// A window that was collapsed or closed skipped its refreshes, catch up now
+	if (!window.WasVisible)
+		return true;
+
+	switch (window.Refresh)
+	{
+	case WINDOW_REFRESH_ON_BREAK:
+		return DEBUG_IsDebugging() && window.LastRefreshCycle != cycle_count;
+	case WINDOW_REFRESH_ON_DATA_CHANGE:
+		return window.HasDataChangedFn();
+	case WINDOW_REFRESH_PER_FRAME:
+	default:
+		return true;
+	}
+}
+
+static void DrawDebugWindow(SDebugWindow& window)
+{
+	if (!window.IsOpen)
+	{
+		window.WasVisible = false;
+		window.LastCostMs = 0.0f;
+		return;
+	}
+
+	Uint64 startTime = SDL_GetPerformanceCounter();
+
+	if (window.DefaultSize.x > 0.0f)
+	{
+		ImGui::SetNextWindowSize(window.DefaultSize, ImGuiCond_FirstUseEver);
+	}
+
+	// Begin returns false when the window is collapsed or fully clipped: skip refresh and content
+	bool isVisible = ImGui::Begin(window.Name, &window.IsOpen, window.Flags);
+	if (isVisible)
+	{
+		if (window.RefreshFn && ShouldRefresh(window))
+		{
+			window.RefreshFn();
+			window.LastRefreshCycle = cycle_count;
+		}
+		window.DrawFn();
+	}
+	ImGui::End();
+	window.WasVisible = isVisible;
+
+	window.LastCostMs = CounterToMs(SDL_GetPerformanceCounter() - startTime);
+	AddCostSample(window.AverageCostMs, window.LastCostMs);
+}
+
+static void DrawDebugMenuBar()
+{
+	if (!ImGui::BeginMainMenuBar())
+		return;
+
+	if (ImGui::BeginMenu("Windows"))
+	{
+		for (SDebugWindow& window : DebugWindows)
+		{
+			ImGui::MenuItem(window.Name, nullptr, &window.IsOpen);
+		}
+		ImGui::Separator();
+		ImGui::MenuItem("Debugger Stats", nullptr, &ShowStatsOverlay);
+		ImGui::MenuItem("ImGui Demo", nullptr, &ShowImGuiDemo);
+		ImGui::EndMenu();
+	}
+
+	ImGui::EndMainMenuBar();
+}
+
+static void DrawStatsOverlay()
+{
+	ImGui::SetNextWindowBgAlpha(0.6f);
+	if (!ImGui::Begin("Debugger Stats", &ShowStatsOverlay, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing))
+	{
+		ImGui::End();
+		return;
+	}
+
+	const float framerate = ImGui::GetIO().Framerate;
+	ImGui::Text("UI frame: %.3f ms (avg %.3f ms) at %.1f FPS", LastFrameCostMs, AverageFrameCostMs, framerate);
+	ImGui::Text("UI overhead: %.1f ms/s (%.1f%%)", AverageFrameCostMs * framerate, AverageFrameCostMs * framerate / 10.0f);
+	ImGui::Separator();
+
+	ImGui::Columns(3, "WindowCosts");
+	ImGui::Text("Window"); ImGui::NextColumn();
+	ImGui::Text("Last ms"); ImGui::NextColumn();
+	ImGui::Text("Avg ms"); ImGui::NextColumn();
+	ImGui::Separator();
+	float totalMs = 0.0f;
+	for (const SDebugWindow& window : DebugWindows)
+	{
+		if (window.IsOpen)
+		{
+			ImGui::Text("%s", window.Name);
+		}
+		else
+		{
+			ImGui::TextDisabled("%s", window.Name);
+		}
+		ImGui::NextColumn();
+		ImGui::Text("%.3f", window.LastCostMs); ImGui::NextColumn();
+		ImGui::Text("%.3f", window.AverageCostMs); ImGui::NextColumn();
+		totalMs += window.LastCostMs;
+	}
+	ImGui::Separator();
+	ImGui::Text("Total"); ImGui::NextColumn();
+	ImGui::Text("%.3f", totalMs); ImGui::NextColumn();
+	ImGui::NextColumn();
+	ImGui::Columns(1);
+
+	ImGui::End();
+}
+
+void ReportDebugFrameCost(Uint64 frameCost)
+{
+	LastFrameCostMs = CounterToMs(frameCost);
+	AddCostSample(AverageFrameCostMs, LastFrameCostMs);
+}
+
 void DrawDebugWindows()
 {
-	DrawMemoryEditor();
-	DrawRegisters();
-	DrawPalette();
-	DrawCode();
-	DrawHelpWindow();
-	DrawLogWindow();
-	DrawCallStackWindow();
-	DrawBreakPoints();
+	DrawDebugMenuBar();
+
+	for (SDebugWindow& window : DebugWindows)
+	{
+		DrawDebugWindow(window);
+	}
+
+	if (ShowStatsOverlay)
+	{
+		DrawStatsOverlay();
+	}
+
+	if (ShowImGuiDemo)
+	{
+		ImGui::ShowDemoWindow(&ShowImGuiDemo);
+	}
 }
+#pragma endregion
 
 void InitDebug()
 {
@@ -873,6 +1249,8 @@ void DEBUG_OnDebugEnable()
 
 void UpdateDebugWindows()
 {
+	UpdatePerformanceStats();
+
 	static bool wasFocused = false;
 	if (!wasFocused && DosboxWindowIsFocused)
 	{
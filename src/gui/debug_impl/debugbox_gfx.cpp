@@ -27,17 +27,31 @@ void GFX_SetTitle(Bit32s cycles, Bits frameskip, bool paused)
 	s_Sdl.DosBoxWindowTitle = title;
 }
 
+// Only the entries changed by RENDER_SetPal are sent, the lookup happens in the shaders
 void GFX_SetPalette(Bitu start, Bitu count, GFX_PalEntry * entries)
 {
-	//if (!SDL_SetPaletteColors(sdl.surface->format->palette, (SDL_Color *)entries, start, count)) {
-	//	E_Exit("SDL:Can't set palette");
-	//}
+	if (s_Sdl.Opengl.shader == GL_SHADER_NONE)
+		return;
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.Opengl.palette_texture);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, start, 0, count, 1, GL_RGBA, GL_UNSIGNED_BYTE, entries);
+	s_Sdl.Opengl.output_dirty = true;
 }
 
 Bitu GFX_GetBestMode(Bitu flags) 
 {
 	flags |= GFX_SCALING;
-	flags &= ~(GFX_CAN_8 | GFX_CAN_15 | GFX_CAN_16);
+	if (s_Sdl.Opengl.shader != GL_SHADER_NONE)
+	{
+		// Indexed frames are uploaded as is
+		flags |= GFX_SHADER;
+		flags &= ~(GFX_CAN_15 | GFX_CAN_16);
+		if (flags & GFX_CAN_8)
+			flags &= ~GFX_CAN_32;
+	}
+	else
+	{
+		flags &= ~(GFX_CAN_8 | GFX_CAN_15 | GFX_CAN_16);
+	}
 	return flags;
 }
 
@@ -48,6 +62,240 @@ Bitu GFX_GetRGB(Bit8u red, Bit8u green, Bit8u blue)
 	return ((blue << 0) | (green << 8) | (red << 16)) | (255 << 24);
 }
 
+// Output shaders, GLSL 150 to match the 3.2 core context (also runs on Mesa llvmpipe)
+static const char* ShaderVertexSource =
+	"#version 150\n"
+	"out vec2 v_texCoord;\n"
+	"void main() {\n"
+	"	// Single triangle covering the whole output\n"
+	"	vec2 pos = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+	"	v_texCoord = pos;\n"
+	"	gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);\n"
+	"}\n";
+
+// Shared by the fragment shaders, fetch() reads a source pixel and resolves
+// indexed frames through the palette texture
+static const char* ShaderFragmentHeader =
+	"#version 150\n"
+	"uniform sampler2D u_source;\n"
+	"uniform sampler2D u_palette;\n"
+	"uniform bool u_indexed;\n"
+	"uniform vec2 u_sourceSize;\n"
+	"in vec2 v_texCoord;\n"
+	"out vec4 fragColor;\n"
+	"vec3 fetch(vec2 pos) {\n"
+	"	vec4 texel = texture(u_source, pos / u_sourceSize);\n"
+	"	if (u_indexed)\n"
+	"		return texture(u_palette, vec2((texel.r * 255.0 + 0.5) / 256.0, 0.5)).rgb;\n"
+	"	return texel.rgb;\n"
+	"}\n";
+
+// Bilinear filters after the palette lookup since indices can't be interpolated
+static const char* ShaderCopySource =
+	"uniform bool u_bilinear;\n"
+	"void main() {\n"
+	"	vec2 pos = v_texCoord * u_sourceSize;\n"
+	"	if (!u_bilinear) {\n"
+	"		fragColor = vec4(fetch(pos), 1.0);\n"
+	"		return;\n"
+	"	}\n"
+	"	vec2 base = floor(pos - 0.5) + 0.5;\n"
+	"	vec2 f = pos - base;\n"
+	"	vec3 top = mix(fetch(base), fetch(base + vec2(1.0, 0.0)), f.x);\n"
+	"	vec3 bottom = mix(fetch(base + vec2(0.0, 1.0)), fetch(base + vec2(1.0, 1.0)), f.x);\n"
+	"	fragColor = vec4(mix(top, bottom, f.y), 1.0);\n"
+	"}\n";
+
+// Edge interpolation in the spirit of hqx: each output pixel looks at the source
+// neighbours of its quadrant and blends toward them when they form an edge
+static const char* ShaderHqxSource =
+	"vec3 toYuv(vec3 c) {\n"
+	"	return vec3(dot(c, vec3(0.299, 0.587, 0.114)), dot(c, vec3(-0.169, -0.331, 0.5)), dot(c, vec3(0.5, -0.419, -0.081)));\n"
+	"}\n"
+	"bool similar(vec3 a, vec3 b) {\n"
+	"	// Same thresholds as the hqx yuv compare (48, 7, 6)\n"
+	"	return all(lessThanEqual(abs(toYuv(a) - toYuv(b)), vec3(0.188, 0.027, 0.024)));\n"
+	"}\n"
+	"void main() {\n"
+	"	vec2 pos = v_texCoord * u_sourceSize;\n"
+	"	vec2 center = floor(pos) + 0.5;\n"
+	"	vec2 quadrant = sign(pos - center);\n"
+	"	vec3 c = fetch(center);\n"
+	"	vec3 h = fetch(center + vec2(quadrant.x, 0.0));\n"
+	"	vec3 v = fetch(center + vec2(0.0, quadrant.y));\n"
+	"	vec3 hOpposite = fetch(center - vec2(quadrant.x, 0.0));\n"
+	"	vec3 vOpposite = fetch(center - vec2(0.0, quadrant.y));\n"
+	"	vec3 color = c;\n"
+	"	if (similar(h, v) && !similar(c, h) && !similar(h, vOpposite) && !similar(v, hOpposite))\n"
+	"		color = mix(c, (h + v) * 0.5, 0.75);\n"
+	"	fragColor = vec4(color, 1.0);\n"
+	"}\n";
+
+// Horizontal beam blur, scanlines between source lines and an aperture grille
+static const char* ShaderCrtSource =
+	"void main() {\n"
+	"	vec2 pos = v_texCoord * u_sourceSize;\n"
+	"	vec2 center = vec2(floor(pos.x) + 0.5, floor(pos.y) + 0.5);\n"
+	"	vec3 color = fetch(center) * 0.5\n"
+	"		+ (fetch(center - vec2(1.0, 0.0)) + fetch(center + vec2(1.0, 0.0))) * 0.25;\n"
+	"	float line = fract(pos.y) - 0.5;\n"
+	"	color *= 1.0 - 2.4 * line * line;\n"
+	"	float mask = mod(floor(gl_FragCoord.x), 3.0);\n"
+	"	color *= mix(vec3(0.8), vec3(1.0), vec3(equal(vec3(mask), vec3(0.0, 1.0, 2.0))));\n"
+	"	fragColor = vec4(color * 1.2, 1.0);\n"
+	"}\n";
+
+static GLuint GFX_CompileShader(GLenum type, const char* header, const char* source)
+{
+	const char* sources[] = { header, source };
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 2, sources, nullptr);
+	glCompileShader(shader);
+
+	GLint status = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status != GL_TRUE)
+	{
+		char log[1024];
+		glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+		LOG_MSG("SDL:OPENGL: Can't compile shader: %s", log);
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+// Build the output pass, falls back to the CPU scalers when the shader can't be used
+static void GFX_InitShader(GL_SHADERS type)
+{
+	s_Sdl.Opengl.shader = GL_SHADER_NONE;
+	if (type == GL_SHADER_NONE)
+		return;
+
+	const char* fragmentSource = ShaderCopySource;
+	if (type == GL_SHADER_HQX) fragmentSource = ShaderHqxSource;
+	else if (type == GL_SHADER_CRT) fragmentSource = ShaderCrtSource;
+
+	GLuint vertexShader = GFX_CompileShader(GL_VERTEX_SHADER, "", ShaderVertexSource);
+	GLuint fragmentShader = GFX_CompileShader(GL_FRAGMENT_SHADER, ShaderFragmentHeader, fragmentSource);
+	if (vertexShader == 0 || fragmentShader == 0)
+	{
+		if (vertexShader) glDeleteShader(vertexShader);
+		if (fragmentShader) glDeleteShader(fragmentShader);
+		return;
+	}
+
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragmentShader);
+	glLinkProgram(program);
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+
+	GLint status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status != GL_TRUE)
+	{
+		char log[1024];
+		glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+		LOG_MSG("SDL:OPENGL: Can't link shader: %s", log);
+		glDeleteProgram(program);
+		return;
+	}
+
+	glUseProgram(program);
+	glUniform1i(glGetUniformLocation(program, "u_source"), 0);
+	glUniform1i(glGetUniformLocation(program, "u_palette"), 1);
+	glUniform1i(glGetUniformLocation(program, "u_bilinear"), type == GL_SHADER_BILINEAR);
+	glUseProgram(0);
+	s_Sdl.Opengl.program = program;
+	s_Sdl.Opengl.source_size_location = glGetUniformLocation(program, "u_sourceSize");
+	s_Sdl.Opengl.indexed_location = glGetUniformLocation(program, "u_indexed");
+
+	glGenTextures(1, &s_Sdl.Opengl.palette_texture);
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.Opengl.palette_texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+	// Core profile needs a bound vertex array even without attributes
+	glGenVertexArrays(1, &s_Sdl.Opengl.vertex_array);
+	glGenFramebuffers(1, &s_Sdl.Opengl.output_framebuffer);
+	glGenTextures(1, &s_Sdl.Opengl.output_texture);
+	s_Sdl.Opengl.shader = type;
+}
+
+static void GFX_ShutDownShader()
+{
+	if (s_Sdl.Opengl.shader == GL_SHADER_NONE)
+		return;
+	glDeleteProgram(s_Sdl.Opengl.program);
+	glDeleteVertexArrays(1, &s_Sdl.Opengl.vertex_array);
+	glDeleteFramebuffers(1, &s_Sdl.Opengl.output_framebuffer);
+	glDeleteTextures(1, &s_Sdl.Opengl.output_texture);
+	glDeleteTextures(1, &s_Sdl.Opengl.palette_texture);
+	s_Sdl.Opengl.shader = GL_SHADER_NONE;
+}
+
+// The output is the native frame with the aspect and doubling scale applied
+static void GFX_ResizeShaderOutput()
+{
+	s_Sdl.Opengl.output_width = (Bit32u)(s_Sdl.Draw.width * s_Sdl.Draw.scalex + 0.5);
+	s_Sdl.Opengl.output_height = (Bit32u)(s_Sdl.Draw.height * s_Sdl.Draw.scaley + 0.5);
+	if (s_Sdl.Opengl.shader == GL_SHADER_HQX || s_Sdl.Opengl.shader == GL_SHADER_CRT)
+	{
+		// Interpolation and scanlines need room between the source pixels
+		if (s_Sdl.Opengl.output_width < s_Sdl.Draw.width * 2) s_Sdl.Opengl.output_width = s_Sdl.Draw.width * 2;
+		if (s_Sdl.Opengl.output_height < s_Sdl.Draw.height * 2) s_Sdl.Opengl.output_height = s_Sdl.Draw.height * 2;
+	}
+
+	// Filtering is done by the shaders
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.DosBoxRenderTextureId);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.Opengl.output_texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, s_Sdl.Opengl.output_width, s_Sdl.Opengl.output_height, 0, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, s_Sdl.Opengl.output_framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s_Sdl.Opengl.output_texture, 0);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		LOG_MSG("SDL:OPENGL: Shader output of %dx%d is not supported", (int)s_Sdl.Opengl.output_width, (int)s_Sdl.Opengl.output_height);
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void GFX_RenderShaderOutput()
+{
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, s_Sdl.Opengl.output_framebuffer);
+	glViewport(0, 0, s_Sdl.Opengl.output_width, s_Sdl.Opengl.output_height);
+	glDisable(GL_BLEND);
+	glDisable(GL_SCISSOR_TEST);
+	glUseProgram(s_Sdl.Opengl.program);
+	glUniform2f(s_Sdl.Opengl.source_size_location, (float)s_Sdl.Draw.width, (float)s_Sdl.Draw.height);
+	glUniform1i(s_Sdl.Opengl.indexed_location, s_Sdl.Draw.bpp == 8);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.Opengl.palette_texture);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, s_Sdl.DosBoxRenderTextureId);
+	glBindVertexArray(s_Sdl.Opengl.vertex_array);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	s_Sdl.Opengl.output_dirty = false;
+}
+
 static int int_log2(int val) {
 	int log = 0;
 	while ((val >>= 1) != 0)
@@ -80,7 +328,9 @@ Bitu GFX_SetSize(Bitu width, Bitu height, Bitu flags, double scalex, double scal
 		}
 		s_Sdl.Opengl.framebuf = 0;
 
-		if ((flags&GFX_CAN_32) == 0)
+		// 8 bits only comes with the shaders doing the palette lookup
+		s_Sdl.Draw.bpp = (flags & GFX_CAN_8) ? 8 : 32;
+		if (s_Sdl.Draw.bpp == 32 && (flags&GFX_CAN_32) == 0)
 		{
 			E_Exit("SDL:OPENGL: Only support 32bits color (?)");
 		}
@@ -104,19 +354,25 @@ Bitu GFX_SetSize(Bitu width, Bitu height, Bitu flags, double scalex, double scal
 		{
 			glGenBuffers(1, &s_Sdl.Opengl.buffer);
 			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_Sdl.Opengl.buffer);
-			glBufferData(GL_PIXEL_UNPACK_BUFFER, width*height * 4, NULL, GL_STREAM_DRAW);
+			glBufferData(GL_PIXEL_UNPACK_BUFFER, width*height * (s_Sdl.Draw.bpp / 8), NULL, GL_STREAM_DRAW);
 			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 		}
 		else 
 		{
-			s_Sdl.Opengl.framebuf = malloc(width*height * 4);		//32 bit color
+			s_Sdl.Opengl.framebuf = malloc(width*height * (s_Sdl.Draw.bpp / 8));		//32 bit color or 8 bit index
 		}
-		s_Sdl.Opengl.pitch = width * 4;
+		s_Sdl.Opengl.pitch = width * (s_Sdl.Draw.bpp / 8);
 
 		glBindTexture(GL_TEXTURE_2D, s_Sdl.DosBoxRenderTextureId);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+		if (s_Sdl.Draw.bpp == 8)
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, 0);
+		else
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+
+		if (s_Sdl.Opengl.shader != GL_SHADER_NONE)
+			GFX_ResizeShaderOutput();
 
-		retFlags = GFX_CAN_32 | GFX_SCALING;
+		retFlags = (s_Sdl.Draw.bpp == 8 ? GFX_CAN_8 : GFX_CAN_32) | GFX_SCALING;
 		if (s_Sdl.Opengl.pixel_buffer_object)
 			retFlags |= GFX_HARDWARE;
 
@@ -155,6 +411,8 @@ void GFX_EndUpdate(const Bit16u *changedLines)
 	{
 		Bitu y = 0, index = 0;
 		glBindTexture(GL_TEXTURE_2D, s_Sdl.DosBoxRenderTextureId);
+		// Index rows are not 4 byte aligned
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 		while (y < s_Sdl.Draw.height) {
 			if (!(index & 1)) 
 			{
@@ -164,14 +422,22 @@ void GFX_EndUpdate(const Bit16u *changedLines)
 			{
 				Bit8u *pixels = (Bit8u *)s_Sdl.Opengl.framebuf + y * s_Sdl.Opengl.pitch;
 				Bitu height = changedLines[index];
-				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y,
-					s_Sdl.Draw.width, height, GL_BGRA,
-					GL_UNSIGNED_INT_8_8_8_8_REV, pixels);
+				if (s_Sdl.Draw.bpp == 8)
+					glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y,
+						s_Sdl.Draw.width, height, GL_RED,
+						GL_UNSIGNED_BYTE, pixels);
+				else
+					glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y,
+						s_Sdl.Draw.width, height, GL_BGRA,
+						GL_UNSIGNED_INT_8_8_8_8_REV, pixels);
 
 				y += height;
 			}
 			index++;
 		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		s_Sdl.Opengl.output_dirty = true;
 	}
 
 	Debug_UpdateAndDraw(true);
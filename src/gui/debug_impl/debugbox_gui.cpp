@@ -65,6 +65,13 @@ void GUI_StartUp(Section * sec)
 	glGetIntegerv (GL_MAX_TEXTURE_SIZE, &s_Sdl.Opengl.max_texsize);
 	s_Sdl.Opengl.packed_pixel = s_Sdl.Opengl.paletted_texture = false;
 
+	std::string glshader = section->Get_string("glshader");
+	if (glshader == "nearest") { GFX_InitShader(GL_SHADER_NEAREST); }
+	else if (glshader == "bilinear") { GFX_InitShader(GL_SHADER_BILINEAR); }
+	else if (glshader == "hqx") { GFX_InitShader(GL_SHADER_HQX); }
+	else if (glshader == "crt") { GFX_InitShader(GL_SHADER_CRT); }
+	else { GFX_InitShader(GL_SHADER_NONE); }
+
 	GFX_Stop();
 
 	// Draw Splash screen
@@ -112,6 +119,7 @@ void GUI_StartUp(Section * sec)
 
 static void GUI_ShutDown(Section * /*sec*/) {
 	GFX_Stop();
+	GFX_ShutDownShader();
 	//if (sdl.draw.callback) (sdl.draw.callback)(GFX_CallBackStop);
 	//if (sdl.mouse.locked) GFX_CaptureMouse();
 	//if (sdl.desktop.fullscreen) GFX_SwitchFullScreen();
@@ -18,6 +18,7 @@
 #include "render.h"
 #include "timer.h"
 #include "video.h"
+#include "perf_stats.h"
 
 #include "SDL.h"
 #include <GL/gl3w.h>
@@ -39,6 +40,15 @@ enum PRIORITY_LEVELS
 	PRIORITY_LEVEL_HIGHEST
 };
 
+enum GL_SHADERS
+{
+	GL_SHADER_NONE,			// Scaled on the CPU by the render scalers
+	GL_SHADER_NEAREST,
+	GL_SHADER_BILINEAR,
+	GL_SHADER_HQX,
+	GL_SHADER_CRT
+};
+
 struct SDL_Block 
 {
 	bool inited;
@@ -69,6 +79,18 @@ struct SDL_Block
 		bool packed_pixel;
 		bool paletted_texture;
 		bool pixel_buffer_object;
+		// Output pass when the frame is scaled on the GPU
+		GL_SHADERS shader;
+		GLuint program;
+		GLint source_size_location;
+		GLint indexed_location;
+		GLuint palette_texture;
+		bool output_dirty;					// Frame or palette changed since the last pass
+		GLuint vertex_array;
+		GLuint output_framebuffer;
+		GLuint output_texture;
+		Bit32u output_width;
+		Bit32u output_height;
 	} Opengl;
 	SDL_Rect clip;
 
@@ -108,6 +130,7 @@ unsigned char my_image_data[my_image_height * my_image_width * 4];
 void InitDebug();
 void UpdateDebugWindows();
 void DrawDebugWindows();
+void ReportDebugFrameCost(Uint64 frameCost);
 
 // debugbox blobs
 #include "gui/debug_impl/debugbox_gfx.cpp"
@@ -215,6 +238,9 @@ void Debug_UpdateAndDraw(bool forceUpdate)
 		LatestTime = SDL_GetPerformanceCounter();
 	}
 
+	PERF_SCOPE(PERF_TIMER_GUI);
+	Uint64 frameStartTime = SDL_GetPerformanceCounter();
+
 	// Start the Dear ImGui frame
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui_ImplSDL2_NewFrame(s_Sdl.Window);
@@ -237,10 +263,20 @@ void Debug_UpdateAndDraw(bool forceUpdate)
 		static const ImVec4 breakedColor(1.f, 0.f, 0.f, 1.f);
 		static const ImVec4 focusedColor(1.f, 1.f, 1.f, 1.f);
 		static const ImVec4 defaultColor(0.f, 0.f, 0.f, 1.f);
+		GLuint displayTexture = s_Sdl.DosBoxRenderTextureId;
+		ImVec2 displaySize((float)s_Sdl.Draw.width, (float)s_Sdl.Draw.height);
+		if (s_Sdl.Opengl.shader != GL_SHADER_NONE && s_Sdl.Opengl.framebuf != nullptr)
+		{
+			if (s_Sdl.Opengl.output_dirty)
+				GFX_RenderShaderOutput();
+			displayTexture = s_Sdl.Opengl.output_texture;
+			displaySize = ImVec2((float)s_Sdl.Opengl.output_width, (float)s_Sdl.Opengl.output_height);
+		}
+
 		// Now that we have an OpenGL texture, assuming our imgui rendering function (imgui_impl_xxx.cpp file) takes GLuint as ImTextureID, we can display it:
 		ImGui::Image(
-			(ImTextureID)s_Sdl.DosBoxRenderTextureId,
-			ImVec2((float)s_Sdl.Draw.width,(float)s_Sdl.Draw.height), // Size
+			(ImTextureID)displayTexture,
+			displaySize, // Size
 			ImVec2(0, 0), // UV0
 			ImVec2(1, 1), // UV1
 			ImVec4(1, 1, 1, s_Sdl.DosBoxRenderTextureAlpha), // Tint color
@@ -257,39 +293,9 @@ void Debug_UpdateAndDraw(bool forceUpdate)
 		ImGui::End();
 	}
 
-	ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
+	static const ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 	if (s_Sdl.active)
 	{
-		bool show_demo_window = true;
-		bool show_another_window = false;
-
-		// 1. Show the big demo window (Most of the sample code is in ImGui::ShowDemoWindow()! You can browse its code to learn more about Dear ImGui!).
-		if (show_demo_window)
-			ImGui::ShowDemoWindow(&show_demo_window);
-
-		// 2. Show a simple window that we create ourselves. We use a Begin/End pair to created a named window.
-		{
-			static float f = 0.0f;
-			static int counter = 0;
-
-			ImGui::Begin("Hello, world!");                          // Create a window called "Hello, world!" and append into it.
-
-			ImGui::Text("This is some useful text.");               // Display some text (you can use a format strings too)
-			ImGui::Checkbox("Demo Window", &show_demo_window);      // Edit bools storing our window open/close state
-			ImGui::Checkbox("Another Window", &show_another_window);
-
-			ImGui::SliderFloat("float", &f, 0.0f, 1.0f);            // Edit 1 float using a slider from 0.0f to 1.0f    
-			ImGui::ColorEdit3("clear color", (float*)&clear_color); // Edit 3 floats representing a color
-
-			if (ImGui::Button("Button"))                            // Buttons return true when clicked (most widgets return true when edited/activated)
-				counter++;
-			ImGui::SameLine();
-			ImGui::Text("counter = %d", counter);
-
-			ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
-			ImGui::End();
-		}
-
 		UpdateDebugWindows();
 		DrawDebugWindows();
 	}
@@ -303,6 +309,8 @@ void Debug_UpdateAndDraw(bool forceUpdate)
 	glClear(GL_COLOR_BUFFER_BIT);
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 	SDL_GL_SwapWindow(s_Sdl.Window);
+
+	ReportDebugFrameCost(SDL_GetPerformanceCounter() - frameStartTime);
 }
 
 void RunDosBox(int argc, char* argv[])
@@ -509,6 +517,12 @@ void Config_Add_SDL()
 	Pstring->Set_help("What video system to use for output.");
 	Pstring->Set_values(outputs);
 
+	const char* glshaders[] = { "none", "nearest", "bilinear", "hqx", "crt", 0 };
+	Pstring = sdl_sec->Add_string("glshader", Property::Changeable::OnlyAtStart, "none");
+	Pstring->Set_help("Scale the screen on the GPU instead of with the render scalers. The CPU then only renders the native frame.\n"
+		"none uses the scaler from the render section, hqx and crt always output at least twice the native size.");
+	Pstring->Set_values(glshaders);
+
 	Pbool = sdl_sec->Add_bool("autolock", Property::Changeable::Always, true);
 	Pbool->Set_help("Mouse will automatically lock, if you click on the screen. (Press CTRL-F10 to unlock)");
 
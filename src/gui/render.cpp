@@ -281,7 +281,11 @@ static void RENDER_Reset( void ) {
 		gfx_scalew = 1;
 		gfx_scaleh = 1;
 	}
-	if ((dblh && dblw) || (render.scale.forced && !dblh && !dblw)) {
+	if (GFX_GetBestMode(GFX_CAN_32) & GFX_SHADER) {
+		/* The output scales on the GPU, only render the native frame */
+		if (dblw) gfx_scalew *= 2;
+		if (dblh) gfx_scaleh *= 2;
+	} else if ((dblh && dblw) || (render.scale.forced && !dblh && !dblw)) {
 		/* Initialize always working defaults */
 		if (render.scale.size == 2)
 			simpleBlock = &ScaleNormal2x;
@@ -25,10 +25,20 @@
 #include "regs.h"
 
 #include <string.h>
+#include <stdlib.h>
+
+#if defined (WIN32)
+#include <windows.h>
+#elif (C_HAVE_MPROTECT)
+#include <sys/mman.h>
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif
 
 #define PAGES_IN_BLOCK	((1024*1024)/MEM_PAGE_SIZE)
 #define SAFE_MEMORY	32
-#define MAX_MEMORY	64
+#define MAX_MEMORY	3584		// Stay below the linear framebuffer at 0xe0000000
 #define MAX_PAGE_ENTRIES (MAX_MEMORY*1024*1024/4096)
 #define LFB_PAGES	512
 #define MAX_LINKS	((MAX_MEMORY*1024/4)+4096)		//Hopefully enough
@@ -167,27 +177,82 @@ Bitu mem_strlen(PhysPt pt) {
 	return 0;		//Hope this doesn't happen
 }
 
+/* The block functions work on spans that stay within one page, so every page
+   is looked up once in the TLB and copied with memcpy when it is host memory.
+   Pages without a host pointer (mmio, vga, code pages...) go through their
+   handler a byte at a time, which also links pages that were not set up yet. */
+static INLINE Bitu MEM_PageSpan(PhysPt pt,Bitu size) {
+	Bitu left=MEM_PAGE_SIZE-(pt & (MEM_PAGE_SIZE-1));
+	return (size<left) ? size : left;
+}
+
 void mem_strcpy(PhysPt dest,PhysPt src) {
-	Bit8u r;
-	while ( (r = mem_readb(src++)) ) mem_writeb_inline(dest++,r);
-	mem_writeb_inline(dest,0);
+	for (;;) {
+		Bitu span=MEM_PageSpan(src,MEM_PAGE_SIZE);
+		HostPt tlb_addr=get_tlb_read(src);
+		if (tlb_addr) {
+			Bit8u const * read=tlb_addr+src;
+			Bit8u const * end=(Bit8u const *)memchr(read,0,span);
+			if (end) span=(Bitu)(end-read)+1;
+			MEM_BlockWrite(dest,read,span);
+			if (end) return;
+			dest+=span;src+=span;
+		} else {
+			Bit8u r=mem_readb(src++);
+			mem_writeb_inline(dest++,r);
+			if (!r) return;
+		}
+	}
 }
 
 void mem_memcpy(PhysPt dest,PhysPt src,Bitu size) {
-	while (size--) mem_writeb_inline(dest++,mem_readb_inline(src++));
+	while (size) {
+		Bitu span=MEM_PageSpan(src,MEM_PageSpan(dest,size));
+		HostPt read=get_tlb_read(src);
+		HostPt write=get_tlb_write(dest);
+		if (read && write) {
+			read+=src;write+=dest;
+			// overlapping spans keep the repeating pattern of a forward byte copy
+			if (write+span<=read || read+span<=write) memcpy(write,read,span);
+			else for (Bitu i=0;i<span;i++) write[i]=read[i];
+			dest+=span;src+=span;
+		} else {
+			mem_writeb_inline(dest++,mem_readb_inline(src++));
+			span=1;
+		}
+		size-=span;
+	}
 }
 
 void MEM_BlockRead(PhysPt pt,void * data,Bitu size) {
 	Bit8u * write=reinterpret_cast<Bit8u *>(data);
-	while (size--) {
-		*write++=mem_readb_inline(pt++);
+	while (size) {
+		Bitu span=MEM_PageSpan(pt,size);
+		HostPt tlb_addr=get_tlb_read(pt);
+		if (tlb_addr) {
+			memcpy(write,tlb_addr+pt,span);
+			write+=span;pt+=span;
+		} else {
+			*write++=mem_readb_inline(pt++);
+			span=1;
+		}
+		size-=span;
 	}
 }
 
 void MEM_BlockWrite(PhysPt pt,void const * const data,Bitu size) {
 	Bit8u const * read = reinterpret_cast<Bit8u const * const>(data);
-	while (size--) {
-		mem_writeb_inline(pt++,*read++);
+	while (size) {
+		Bitu span=MEM_PageSpan(pt,size);
+		HostPt tlb_addr=get_tlb_write(pt);
+		if (tlb_addr) {
+			memcpy(tlb_addr+pt,read,span);
+			read+=span;pt+=span;
+		} else {
+			mem_writeb_inline(pt++,*read++);
+			span=1;
+		}
+		size-=span;
 	}
 }
 
@@ -196,10 +261,24 @@ void MEM_BlockCopy(PhysPt dest,PhysPt src,Bitu size) {
 }
 
 void MEM_StrCopy(PhysPt pt,char * data,Bitu size) {
-	while (size--) {
-		Bit8u r=mem_readb_inline(pt++);
-		if (!r) break;
-		*data++=r;
+	while (size) {
+		Bitu span=MEM_PageSpan(pt,size);
+		HostPt tlb_addr=get_tlb_read(pt);
+		if (tlb_addr) {
+			Bit8u const * read=tlb_addr+pt;
+			Bit8u const * end=(Bit8u const *)memchr(read,0,span);
+			if (end) span=(Bitu)(end-read);
+			memcpy(data,read,span);
+			data+=span;
+			if (end) break;
+			pt+=span;
+		} else {
+			Bit8u r=mem_readb_inline(pt++);
+			if (!r) break;
+			*data++=r;
+			span=1;
+		}
+		size-=span;
 	}
 	*data=0;
 }
@@ -537,6 +616,31 @@ void PreparePCJRCartRom(void) {
 
 HostPt GetMemBase(void) { return MemBase; }
 
+/* The guest memory is one range of zeroed virtual memory, the host only backs
+   the pages that the guest actually touches. Windows commits the whole range
+   up front, so the range stays valid for system calls that are handed a
+   pointer into it, pages are only charged against the pagefile. */
+static HostPt MEM_AllocateBase(Bitu size) {
+#if defined (WIN32)
+	return (HostPt)VirtualAlloc(0,size,MEM_RESERVE|MEM_COMMIT,PAGE_READWRITE);
+#elif (C_HAVE_MPROTECT)
+	void * base=mmap(0,size,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANON|MAP_NORESERVE,-1,0);
+	return (base==MAP_FAILED) ? 0 : (HostPt)base;
+#else
+	return (HostPt)calloc(size,1);
+#endif
+}
+
+static void MEM_FreeBase(HostPt base,Bitu size) {
+#if defined (WIN32)
+	VirtualFree(base,0,MEM_RELEASE);
+#elif (C_HAVE_MPROTECT)
+	munmap(base,size);
+#else
+	free(base);
+#endif
+}
+
 class MEMORY:public Module_base{
 private:
 	IO_ReadHandleObject ReadHandler;
@@ -550,7 +654,6 @@ public:
 		Bitu memsize=section->Get_int("memsize");
 	
 		if (memsize < 1) memsize = 1;
-		/* max 63 to solve problems with certain xms handlers */
 		if (memsize > MAX_MEMORY-1) {
 			LOG_MSG("Maximum memory size is %d MB",MAX_MEMORY - 1);
 			memsize = MAX_MEMORY-1;
@@ -559,11 +662,29 @@ public:
 			LOG_MSG("Memory sizes above %d MB are NOT recommended.",SAFE_MEMORY - 1);
 			LOG_MSG("Stick with the default values unless you are absolutely certain.");
 		}
-		MemBase = new Bit8u[memsize*1024*1024];
-		if (!MemBase) E_Exit("Can't allocate main memory of %d MB",memsize);
-		/* Clear the memory, as new doesn't always give zeroed memory
-		 * (Visual C debug mode). We want zeroed memory though. */
-		memset((void*)MemBase,0,memsize*1024*1024);
+		/* A 32-bit host may not have a free range this large, use less memory then */
+		Bitu wanted = memsize;
+		Bitu failed = 0;
+		MemBase = MEM_AllocateBase(memsize*1024*1024);
+		while (!MemBase && memsize > 1) {
+			failed = memsize;
+			memsize = memsize*3/4;
+			MemBase = MEM_AllocateBase(memsize*1024*1024);
+		}
+		if (!MemBase) E_Exit("Can't allocate main memory of %d MB",wanted);
+		/* and the largest size between that and the one that failed */
+		while (failed > memsize+1) {
+			Bitu size = (memsize+failed)/2;
+			MEM_FreeBase(MemBase,memsize*1024*1024);
+			MemBase = MEM_AllocateBase(size*1024*1024);
+			if (MemBase) memsize = size;
+			else {
+				failed = size;
+				MemBase = MEM_AllocateBase(memsize*1024*1024);
+				if (!MemBase) E_Exit("Can't allocate main memory of %d MB",memsize);
+			}
+		}
+		if (memsize != wanted) LOG_MSG("Main memory is %d MB, %d MB could not be reserved on this host",memsize,wanted);
 		memory.pages = (memsize*1024*1024)/4096;
 		/* Allocate the data for the different page information blocks */
 		memory.phandlers=new  PageHandler * [memory.pages];
@@ -594,7 +715,7 @@ public:
 		MEM_A20_Enable(false);
 	}
 	~MEMORY(){
-		delete [] MemBase;
+		MEM_FreeBase(MemBase,memory.pages*4096);
 		delete [] memory.phandlers;
 		delete [] memory.mhandles;
 	}
@@ -48,6 +48,7 @@
 #include "hardware.h"
 #include "programs.h"
 #include "midi.h"
+#include "perf_stats.h"
 
 #define MIXER_SSIZE 4
 
@@ -78,6 +79,8 @@ static struct {
 	//Write/Read pointers for the buffer
 	Bitu pos,done;
 	Bitu needed, min_needed, max_needed;
+	//Callbacks that ran out of samples, counted with the audio device locked
+	Bitu underruns;
 	//For every millisecond tick how many samples need to be generated
 	Bit32u tick_add;
 	Bit32u tick_counter;
@@ -443,6 +446,7 @@ static void MIXER_MixData(Bitu needed) {
 }
 
 static void MIXER_Mix(void) {
+	PERF_SCOPE(PERF_TIMER_MIXER);
 	SDL_LockAudio();
 	MIXER_MixData(mixer.needed);
 	mixer.tick_counter += mixer.tick_add;
@@ -452,6 +456,7 @@ static void MIXER_Mix(void) {
 }
 
 static void MIXER_Mix_NoSound(void) {
+	PERF_SCOPE(PERF_TIMER_MIXER);
 	MIXER_MixData(mixer.needed);
 	/* Clear piece we've just generated */
 	for (Bitu i=0;i<mixer.needed;i++) {
@@ -472,6 +477,7 @@ static void MIXER_Mix_NoSound(void) {
 }
 
 static void SDLCALL MIXER_CallBack(void * userdata, Uint8 *stream, int len) {
+	PERF_ASYNC_SCOPE(PERF_TIMER_MIXER_CALLBACK);
 	#if SDL_VERSION_ATLEAST(2, 0, 0)
 		memset(stream, 0, len);
 	#endif
@@ -485,6 +491,7 @@ static void SDLCALL MIXER_CallBack(void * userdata, Uint8 *stream, int len) {
 	/* Enough room in the buffer ? */
 	if (mixer.done < need) {
 //		LOG_MSG("Full underrun need %d, have %d, min %d", need, mixer.done, mixer.min_needed);
+		mixer.underruns++;
 		if((need - mixer.done) > (need >>7) ) //Max 1 procent stretch.
 			return;
 		reduce = mixer.done;
@@ -683,6 +690,7 @@ void MIXER_Init(Section* sec) {
 	mixer.channels=0;
 	mixer.pos=0;
 	mixer.done=0;
+	mixer.underruns=0;
 	memset(mixer.work,0,sizeof(mixer.work));
 	mixer.mastervol[0]=1.0f;
 	mixer.mastervol[1]=1.0f;
@@ -746,4 +754,20 @@ void MIXER_CloseAudioDevice(void) {
 			SDL_CloseAudio();
 #endif
 	}
+}
+
+float MIXER_GetBufferFill(void) {
+	if (mixer.nosound || !mixer.max_needed) return 0.0f;
+	SDL_LockAudio();
+	float fill = (float)mixer.done / (float)mixer.max_needed;
+	SDL_UnlockAudio();
+	return fill;
+}
+
+Bitu MIXER_GetUnderruns(void) {
+	if (mixer.nosound) return 0;
+	SDL_LockAudio();
+	Bitu underruns = mixer.underruns;
+	SDL_UnlockAudio();
+	return underruns;
 }
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "pic.h"
 #include "timer.h"
 #include "setup.h"
+#include "perf_stats.h"
 
 #define PIC_QUEUESIZE 512
 
@@ -479,6 +480,7 @@ bool PIC_RunQueue(void) {
 	Bits index_nd=PIC_TickIndexND();
 	InEventService = true;
 	while (pic_queue.next_entry && (pic_queue.next_entry->index*CPU_CycleMax<=index_nd)) {
+		PERF_SCOPE(PERF_TIMER_PIC);
 		PICEntry * entry=pic_queue.next_entry;
 		pic_queue.next_entry=entry->next;
 
@@ -537,6 +539,7 @@ void TIMER_AddTickHandler(TIMER_TickHandler handler) {
 }
 
 void TIMER_AddTick(void) {
+	CPU_TimeStampTick();
 	/* Setup new amount of cycles for PIC */
 	CPU_CycleLeft=CPU_CycleMax;
 	CPU_Cycles=0;
@@ -25,6 +25,7 @@
 #include "../gui/render_scalers.h"
 #include "vga.h"
 #include "pic.h"
+#include "perf_stats.h"
 
 //#undef C_DEBUG
 //#define C_DEBUG 1
@@ -617,6 +618,7 @@ static void VGA_ProcessSplit() {
 
 static Bit8u bg_color_index = 0; // screen-off black index
 static void VGA_DrawSingleLine(Bitu /*blah*/) {
+	PERF_SCOPE(PERF_TIMER_VGA);
 	if (GCC_UNLIKELY(vga.attr.disabled)) {
 		switch(machine) {
 		case MCH_PCJR:
@@ -688,6 +690,7 @@ static void VGA_DrawSingleLine(Bitu /*blah*/) {
 }
 
 static void VGA_DrawEGASingleLine(Bitu /*blah*/) {
+	PERF_SCOPE(PERF_TIMER_VGA);
 	if (GCC_UNLIKELY(vga.attr.disabled)) {
 		memset(TempLine, 0, sizeof(TempLine));
 		RENDER_DrawLine(TempLine);
@@ -711,6 +714,7 @@ static void VGA_DrawEGASingleLine(Bitu /*blah*/) {
 }
 
 static void VGA_DrawPart(Bitu lines) {
+	PERF_SCOPE(PERF_TIMER_VGA);
 	while (lines--) {
 		Bit8u * data=VGA_DrawLine( vga.draw.address, vga.draw.address_line );
 		RENDER_DrawLine(data);
@@ -593,6 +593,27 @@ static Bitu INT16_Handler(void) {
 	return CBRET_NONE;
 }
 
+/* Keyboard polling is served without leaving the cpu core,
+   waiting for a key still goes through the full handler */
+static bool INT16_Leaf(void) {
+	Bit16u temp;
+	switch (reg_ah) {
+	case 0x00: /* GET KEYSTROKE */
+	case 0x10: /* GET KEYSTROKE (enhanced keyboards only) */
+		if (!check_key(temp)) return false;
+		break;
+	case 0x01: /* CHECK FOR KEYSTROKE */
+	case 0x02: /* GET SHIFT FLAGS */
+	case 0x11: /* CHECK FOR KEYSTROKE (enhanced keyboards only) */
+	case 0x12: /* GET EXTENDED SHIFT STATES */
+		break;
+	default:
+		return false;
+	}
+	INT16_Handler();
+	return true;
+}
+
 //Keyboard initialisation. src/gui/sdlmain.cpp
 extern bool startup_state_numlock;
 extern bool startup_state_capslock;
@@ -627,6 +648,7 @@ void BIOS_SetupKeyboard(void) {
 	/* Allocate/setup a callback for int 0x16 and for standard IRQ 1 handler */
 	call_int16=CALLBACK_Allocate();	
 	CALLBACK_Setup(call_int16,&INT16_Handler,CB_INT16,"Keyboard");
+	CALLBACK_SetLeaf(call_int16,&INT16_Leaf);
 	RealSetVec(0x16,CALLBACK_RealPointer(call_int16));
 
 	call_irq1=CALLBACK_Allocate();	
@@ -32,6 +32,7 @@
 #include "support.h"
 #include "cpu.h"
 #include "dma.h"
+#include "perf_stats.h"
 
 #define EMM_PAGEFRAME	0xE000
 #define EMM_PAGEFRAME4K	((EMM_PAGEFRAME*16)/4096)
@@ -196,7 +197,7 @@ bool device_EMM::ReadFromControlChannel(PhysPt bufptr,Bit16u size,Bit16u * retco
 			if (!is_emm386) return false;
 			if (EMM_MINOR_VERSION < 0x2d) return false;
 			if (size!=4) return false;
-			mem_writew(bufptr+0x00,(Bit16u)(MEM_TotalPages()*4));	// max size (kb)
+			mem_writew(bufptr+0x00,(Bit16u)((MEM_TotalPages()>0x3fff) ? 0xffff : MEM_TotalPages()*4));	// max size (kb)
 			mem_writew(bufptr+0x02,0x80);							// min size (kb)
 			*retcode=2;
 			return true;
@@ -291,6 +292,13 @@ static Bit8u EMM_ReallocatePages(Bit16u handle,Bit16u & pages) {
 	return EMM_NO_ERROR;
 }
 
+/* Mapping only points the linear pages somewhere else, PAGING_MapPage already
+   unlinks them. Without paging no other linear page can reach the frame, so the
+   rest of the TLB stays valid, with paging the page tables may alias it. */
+static void EMM_MappingChanged(void) {
+	if (PAGING_Enabled()) PAGING_ClearTLB();
+}
+
 static Bit8u EMM_MapPage(Bitu phys_page,Bit16u handle,Bit16u log_page) {
 //	LOG_MSG("EMS MapPage handle %d phys %d log %d",handle,phys_page,log_page);
 	/* Check for too high physical page */
@@ -303,7 +311,7 @@ static Bit8u EMM_MapPage(Bitu phys_page,Bit16u handle,Bit16u log_page) {
 		emm_mappings[phys_page].page=NULL_PAGE;
 		for (Bitu i=0;i<4;i++)
 			PAGING_MapPage(EMM_PAGEFRAME4K+phys_page*4+i,EMM_PAGEFRAME4K+phys_page*4+i);
-		PAGING_ClearTLB();
+		EMM_MappingChanged();
 		return EMM_NO_ERROR;
 	}
 	/* Check for valid handle */
@@ -319,7 +327,8 @@ static Bit8u EMM_MapPage(Bitu phys_page,Bit16u handle,Bit16u log_page) {
 			PAGING_MapPage(EMM_PAGEFRAME4K+phys_page*4+i,memh);
 			memh=MEM_NextHandle(memh);
 		}
-		PAGING_ClearTLB();
+		PERF_COUNT(PERF_COUNTER_EMS_MAPPED,1);
+		EMM_MappingChanged();
 		return EMM_NO_ERROR;
 	} else  {
 		/* Illegal logical page it is */
@@ -361,7 +370,7 @@ static Bit8u EMM_MapSegment(Bitu segment,Bit16u handle,Bit16u log_page) {
 			}
 			for (Bitu i=0;i<4;i++)
 				PAGING_MapPage(segment*16/4096+i,segment*16/4096+i);
-			PAGING_ClearTLB();
+			EMM_MappingChanged();
 			return EMM_NO_ERROR;
 		}
 		/* Check for valid handle */
@@ -382,7 +391,8 @@ static Bit8u EMM_MapSegment(Bitu segment,Bit16u handle,Bit16u log_page) {
 				PAGING_MapPage(segment*16/4096+i,memh);
 				memh=MEM_NextHandle(memh);
 			}
-			PAGING_ClearTLB();
+			PERF_COUNT(PERF_COUNTER_EMS_MAPPED,1);
+			EMM_MappingChanged();
 			return EMM_NO_ERROR;
 		} else  {
 			/* Illegal logical page it is */
@@ -688,6 +698,7 @@ static Bit8u MemoryRegion(void) {
 		if (!region.dest_type) dest_mem+=toread;
 		else dest_handle=MEM_NextHandle(dest_handle);
 		region.bytes-=toread;
+		PERF_COUNT(PERF_COUNTER_EMS_MOVED,toread);
 	}
 	return EMM_NO_ERROR;
 }
@@ -704,7 +715,7 @@ static Bitu INT67_Handler(void) {
 		reg_ah=EMM_NO_ERROR;
 		break;
 	case 0x42:		/* Get number of pages */
-		reg_dx=(Bit16u)(MEM_TotalPages()/4);		//Not entirely correct but okay
+		reg_dx=(Bit16u)((MEM_TotalPages()/4>0x7fff) ? 0x7fff : MEM_TotalPages()/4);		//Not entirely correct but okay
 		reg_bx=EMM_GetFreePages();
 		reg_ah=EMM_NO_ERROR;
 		break;
@@ -29,6 +29,7 @@
 #include "inout.h"
 #include "xms.h"
 #include "bios.h"
+#include "perf_stats.h"
 
 #define XMS_HANDLES							50		/* 50 XMS Memory Blocks */ 
 #define XMS_VERSION    						0x0300	/* version 3.00 */
@@ -123,10 +124,10 @@ static INLINE bool InvalidHandle(Bitu handle) {
 	return (!handle || (handle>=XMS_HANDLES) || xms_handles[handle].free);
 }
 
-Bitu XMS_QueryFreeMemory(Bit16u& largestFree, Bit16u& totalFree) {
+Bitu XMS_QueryFreeMemory(Bit32u& largestFree, Bit32u& totalFree) {
 	/* Scan the tree for free memory and find largest free block */
-	totalFree=(Bit16u)(MEM_FreeTotal()*4);
-	largestFree=(Bit16u)(MEM_FreeLargest()*4);
+	totalFree=(Bit32u)(MEM_FreeTotal()*4);
+	largestFree=(Bit32u)(MEM_FreeLargest()*4);
 	if (!totalFree) return XMS_OUT_OF_SPACE;
 	return 0;
 }
@@ -205,6 +206,7 @@ Bitu XMS_MoveMemory(PhysPt bpt) {
 	}
 //	LOG_MSG("XMS move src %X dest %X length %X",srcpt,destpt,length);
 	mem_memcpy(destpt,srcpt,length);
+	PERF_COUNT(PERF_COUNTER_XMS_MOVED,length);
 	return 0;
 }
 
@@ -224,7 +226,7 @@ Bitu XMS_UnlockMemory(Bitu handle) {
 	return XMS_BLOCK_NOT_LOCKED;
 }
 
-Bitu XMS_GetHandleInformation(Bitu handle, Bit8u& lockCount, Bit8u& numFree, Bit16u& size) {
+Bitu XMS_GetHandleInformation(Bitu handle, Bit8u& lockCount, Bit8u& numFree, Bit32u& size) {
 	if (InvalidHandle(handle)) return XMS_INVALID_HANDLE;
 	lockCount = xms_handles[handle].locked;
 	/* Find available blocks */
@@ -232,7 +234,7 @@ Bitu XMS_GetHandleInformation(Bitu handle, Bit8u& lockCount, Bit8u& numFree, Bit
 	for (Bitu i=1;i<XMS_HANDLES;i++) {
 		if (xms_handles[i].free) numFree++;
 	}
-	size=(Bit16u)(xms_handles[handle].size);
+	size=(Bit32u)(xms_handles[handle].size);
 	return 0;
 }
 
@@ -296,17 +298,26 @@ Bitu XMS_Handler(void) {
 		reg_bl = 0;
 		break;
 	case XMS_QUERY_FREE_EXTENDED_MEMORY:						/* 08 */
-		reg_bl = XMS_QueryFreeMemory(reg_ax,reg_dx);
+		{
+		/* The 16-bit call can report at most 64 mb */
+		Bit32u largest,total;
+		reg_bl = XMS_QueryFreeMemory(largest,total);
+		reg_ax = (Bit16u)((largest>0xffff) ? 0xffff : largest);
+		reg_dx = (Bit16u)((total>0xffff) ? 0xffff : total);
+		}
 		break;
-	case XMS_ALLOCATE_ANY_MEMORY:								/* 89 */
-		reg_edx &= 0xffff;
-		// fall through
 	case XMS_ALLOCATE_EXTENDED_MEMORY:							/* 09 */
 		{
 		Bit16u handle = 0;
 		SET_RESULT(XMS_AllocateMemory(reg_dx,handle));
 		reg_dx = handle;
 		}; break;
+	case XMS_ALLOCATE_ANY_MEMORY:								/* 89 */
+		{
+		Bit16u handle = 0;
+		SET_RESULT(XMS_AllocateMemory(reg_edx,handle));
+		reg_dx = handle;
+		}; break;
 	case XMS_FREE_EXTENDED_MEMORY:								/* 0a */
 		SET_RESULT(XMS_FreeMemory(reg_dx));
 		break;
@@ -326,12 +337,16 @@ Bitu XMS_Handler(void) {
 	case XMS_UNLOCK_EXTENDED_MEMORY_BLOCK:						/* 0d */
 		SET_RESULT(XMS_UnlockMemory(reg_dx));
 		break;
-	case XMS_GET_EMB_HANDLE_INFORMATION:  						/* 0e */
-		SET_RESULT(XMS_GetHandleInformation(reg_dx,reg_bh,reg_bl,reg_dx),false);
-		break;
+	case XMS_GET_EMB_HANDLE_INFORMATION: {						/* 0e */
+		/* The 16-bit call can report at most 64 mb */
+		Bit32u size;
+		Bitu result = XMS_GetHandleInformation(reg_dx,reg_bh,reg_bl,size);
+		if (result == 0) reg_dx = (Bit16u)((size>0xffff) ? 0xffff : size);
+		SET_RESULT(result,false);
+		}; break;
 	case XMS_RESIZE_ANY_EXTENDED_MEMORY_BLOCK:					/* 0x8f */
-		if(reg_ebx > reg_bx) LOG_MSG("64MB memory limit!");
-		//fall through
+		SET_RESULT(XMS_ResizeMemory(reg_dx, reg_ebx));
+		break;
 	case XMS_RESIZE_EXTENDED_MEMORY_BLOCK:						/* 0f */
 		SET_RESULT(XMS_ResizeMemory(reg_dx, reg_bx));
 		break;
@@ -388,17 +403,21 @@ Bitu XMS_Handler(void) {
 		reg_bl=UMB_NO_BLOCKS_AVAILABLE;
 		break;
 	case XMS_QUERY_ANY_FREE_MEMORY:								/* 88 */
-		reg_bl = XMS_QueryFreeMemory(reg_ax,reg_dx);
-		reg_eax &= 0xffff;
-		reg_edx &= 0xffff;
+		{
+		Bit32u largest,total;
+		reg_bl = XMS_QueryFreeMemory(largest,total);
+		reg_eax = largest;
+		reg_edx = total;
+		}
 		reg_ecx = (MEM_TotalPages()*MEM_PAGESIZE)-1;			// highest known physical memory address
 		break;
 	case XMS_GET_EMB_HANDLE_INFORMATION_EXT: {					/* 8e */
 		Bit8u free_handles;
-		Bitu result = XMS_GetHandleInformation(reg_dx,reg_bh,free_handles,reg_dx);
+		Bit32u size;
+		Bitu result = XMS_GetHandleInformation(reg_dx,reg_bh,free_handles,size);
 		if (result != 0) reg_bl = result;
 		else {
-			reg_edx &= 0xffff;
+			reg_edx = size;
 			reg_cx = free_handles;
 		}
 		reg_ax = (result==0);
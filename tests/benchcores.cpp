@@ -0,0 +1,188 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Microbenchmarks of the cores: small real mode loops run on the normal core,
+   on the threaded core and on the dynamic core, there each one a single block
+   that jumps to itself, with the guest registers kept in host registers
+   within the block (DRC_USE_REGS_CACHE) and with them accessed in cpu_regs.
+   usage: benchcores [instructions]
+   Printed are the accesses to guest registers in memory that the translated
+   loop does per iteration and the host time per guest instruction. The exit
+   code is nonzero when the runs of a loop end with different registers. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "harness.h"
+#include "cpu.h"
+#include "regs.h"
+#include "mem.h"
+
+void CPU_Core_Dynrec_Cache_Init(bool enable_cache);
+void CPU_Core_Dynrec_ReleasePage(Bitu phys_page);
+Bitu CPU_Core_Dynrec_RegsCache(bool enable);
+
+#define BENCH_CODE		0x10000
+#define BENCH_DATA		0x20000
+#define BENCH_SLICE		10000		// iterations of a core call
+#define BENCH_REPEATS	3
+
+struct BenchLoop {
+	const char * name;
+	Bitu instructions;			// per iteration, the jump back included
+	Bitu size;
+	Bit8u code[32];
+};
+
+static const BenchLoop bench_loops[]={
+	{"32bit alu",7,20,{
+		0x66,0x01,0xd8,			// add eax,ebx
+		0x66,0x31,0xc1,			// xor ecx,eax
+		0x66,0x01,0xca,			// add edx,ecx
+		0x66,0x29,0xd3,			// sub ebx,edx
+		0x66,0x89,0xc6,			// mov esi,eax
+		0x66,0x01,0xfe,			// add esi,edi
+		0xeb,0xec}},			// jmp short top
+	{"16bit alu",7,14,{
+		0x01,0xd8,				// add ax,bx
+		0x31,0xc1,				// xor cx,ax
+		0x01,0xca,				// add dx,cx
+		0x29,0xd3,				// sub bx,dx
+		0x89,0xc6,				// mov si,ax
+		0x01,0xfe,				// add si,di
+		0xeb,0xf2}},			// jmp short top
+	{"8bit regs",7,14,{
+		0x88,0xd8,				// mov al,bl
+		0x00,0xc4,				// add ah,al
+		0x30,0xe3,				// xor bl,ah
+		0x00,0xdd,				// add ch,bl
+		0x88,0xea,				// mov dl,ch
+		0x28,0xd6,				// sub dh,dl
+		0xeb,0xf2}},			// jmp short top
+	{"memory",7,20,{
+		0x8b,0x04,				// mov ax,[si]
+		0x01,0x05,				// add [di],ax
+		0x83,0xc6,0x02,			// add si,2
+		0x81,0xe6,0xff,0x03,	// and si,0x3ff
+		0x83,0xc7,0x04,			// add di,4
+		0x81,0xe7,0xff,0x03,	// and di,0x3ff
+		0xeb,0xec}},			// jmp short top
+	{"stack",6,8,{
+		0x50,					// push ax
+		0x53,					// push bx
+		0x59,					// pop cx
+		0x5a,					// pop dx
+		0x01,0xc8,				// add ax,cx
+		0xeb,0xf8}},			// jmp short top
+	{"self-modify",3,11,{
+		0x2e,0x80,0x06,0x07,0x00,0x01,	// add byte [cs:7],1
+		0x05,0x00,0x00,			// add ax,imm, the one written
+		0xeb,0xf5}},			// jmp short top
+};
+
+enum BenchCore {
+	BENCH_NORMAL,
+	BENCH_THREADED,
+	BENCH_DYNREC,
+	BENCH_DYNREC_CACHED
+};
+
+struct BenchRun {
+	Bitu memory;				// guest register accesses in memory per iteration
+	double seconds;
+	Bit32u regs[8];
+};
+
+// a real mode machine at the start of the loop, nothing translated yet
+static void BenchReset(const BenchLoop & loop) {
+	for (Bitu i=0;i<loop.size;i++) mem_writeb(BENCH_CODE+i,loop.code[i]);
+	for (Bitu i=0;i<0x400;i++) mem_writeb(BENCH_DATA+i,(Bit8u)(i*7));
+	CPU_Core_Dynrec_ReleasePage(BENCH_CODE>>12);
+	for (Bitu s=0;s<6;s++) CPU_SetSegGeneral((SegNames)s,BENCH_DATA>>4);
+	Segs.val[cs]=BENCH_CODE>>4;
+	Segs.phys[cs]=BENCH_CODE;
+	cpu.code.big=false;
+	reg_eip=0;
+	for (Bitu r=0;r<8;r++) cpu_regs.regs[r].dword[0]=0x12345678*(Bit32u)(r+1);
+	reg_esp=0xff00;
+	reg_esi=0;
+	reg_edi=0x200;
+}
+
+static void BenchRunLoop(const BenchLoop & loop,Bitu instructions,BenchCore core,BenchRun & run) {
+	BenchReset(loop);
+	CPU_Decoder * decoder=&CPU_Core_Dynrec_Run;
+	if (core==BENCH_NORMAL) decoder=&CPU_Core_Normal_Run;
+	else if (core==BENCH_THREADED) decoder=&CPU_Core_Threaded_Run;
+	cpudecoder=decoder;			// the threaded core stops when it is not the decoder
+	// translate the loop and run it once, the cycles of a block are taken
+	// when it starts so the iterations of all cores end at the same place
+	bool cached=core==BENCH_DYNREC_CACHED;
+	Bitu memory=CPU_Core_Dynrec_RegsCache(cached);
+	CPU_Cycles=loop.instructions;
+	(*decoder)();
+	run.memory=CPU_Core_Dynrec_RegsCache(cached)-memory;
+
+	// the best of some runs, the machine does other things as well
+	run.seconds=0;
+	for (Bitu repeat=0;repeat<BENCH_REPEATS;repeat++) {
+		double start=HARNESS_Time();
+		for (Bitu done=0;done<instructions;done+=BENCH_SLICE*loop.instructions) {
+			CPU_Cycles=BENCH_SLICE*loop.instructions;
+			(*decoder)();
+		}
+		double seconds=HARNESS_Time()-start;
+		if (!repeat || seconds<run.seconds) run.seconds=seconds;
+	}
+	for (Bitu r=0;r<8;r++) run.regs[r]=cpu_regs.regs[r].dword[0];
+}
+
+int main(int argc,char * argv[]) {
+	Bitu instructions=argc>1 ? strtoul(argv[1],0,0) : 100000000;
+	try {
+		static char const * const settings[]={"memsize=4",0};
+		HARNESS_Init(settings);
+		CPU_Core_Dynrec_Cache_Init(true);
+		printf("benchcores: %d guest instructions per loop\n",(int)instructions);
+		printf("%-12s %22s %44s\n","","memory accesses/loop","ns/instruction");
+		printf("%-12s %10s %11s %10s %11s %10s %10s\n","loop","cached","uncached","cached","uncached","threaded","normal");
+		int result=0;
+		for (Bitu l=0;l<sizeof(bench_loops)/sizeof(bench_loops[0]);l++) {
+			const BenchLoop & loop=bench_loops[l];
+			BenchRun with,without,threaded,normal;
+			BenchRunLoop(loop,instructions,BENCH_DYNREC,without);
+			BenchRunLoop(loop,instructions,BENCH_DYNREC_CACHED,with);
+			BenchRunLoop(loop,instructions,BENCH_THREADED,threaded);
+			BenchRunLoop(loop,instructions,BENCH_NORMAL,normal);
+			printf("%-12s %10d %11d %10.2f %11.2f %10.2f %10.2f\n",loop.name,(int)with.memory,(int)without.memory,
+				with.seconds*1e9/instructions,without.seconds*1e9/instructions,
+				threaded.seconds*1e9/instructions,normal.seconds*1e9/instructions);
+			if (memcmp(with.regs,without.regs,sizeof(with.regs)) || memcmp(normal.regs,without.regs,sizeof(normal.regs)) ||
+				memcmp(threaded.regs,without.regs,sizeof(threaded.regs))) {
+				printf("%s: the registers differ\n",loop.name);
+				result=1;
+			}
+		}
+		CPU_Core_Dynrec_RegsCache(true);
+		return result;
+	} catch (char * error) {
+		printf("benchcores: %s\n",error);
+		return 2;
+	}
+}
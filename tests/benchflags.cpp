@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Microbenchmark of the lazy flags over every flag type: FillFlags,
+   FillFlagsNoCFOF and the six get_ functions of flags.cpp.
+   usage: benchflags [calls]
+   Every call is on another random state of the type. Printed is the host
+   time per call. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "harness.h"
+#include "cpu.h"
+#include "regs.h"
+#include "cpu/lazyflags.h"
+
+#define BENCH_STATES	4096		// a power of two
+
+static const char * const flag_types[t_LASTFLAG]={
+	"UNKNOWN",
+	"ADDb","ADDw","ADDd","ORb","ORw","ORd",
+	"ADCb","ADCw","ADCd","SBBb","SBBw","SBBd",
+	"ANDb","ANDw","ANDd","SUBb","SUBw","SUBd",
+	"XORb","XORw","XORd","CMPb","CMPw","CMPd",
+	"INCb","INCw","INCd","DECb","DECw","DECd",
+	"TESTb","TESTw","TESTd","SHLb","SHLw","SHLd",
+	"SHRb","SHRw","SHRd","SARb","SARw","SARd",
+	"ROLb","ROLw","ROLd","RORb","RORw","RORd",
+	"RCLb","RCLw","RCLd","RCRb","RCRw","RCRd",
+	"NEGb","NEGw","NEGd",
+	"DSHLw","DSHLd","DSHRw","DSHRd",
+	"MUL","DIV",
+	"NOTDONE"
+};
+
+struct BenchState {
+	LazyFlags lazy;
+	Bitu flags;
+};
+
+static BenchState states[BENCH_STATES];
+
+static Bit32u BenchRandom(Bit32u & seed) {
+	seed^=seed<<13;
+	seed^=seed>>17;
+	seed^=seed<<5;
+	return seed;
+}
+
+/* Random operands, shift and rotate counts in the range the cores leave,
+   the earlier flags random as well for the flags a type keeps */
+static void BenchFill(Bitu type,Bit32u & seed) {
+	Bitu bits=32;
+	if (type>=t_DSHLw) bits=(type==t_DSHLw || type==t_DSHRw) ? 16 : 32;
+	else if (type!=t_UNKNOWN) bits=8<<((type-1)%3);
+	bool count=(type>=t_SHLb && type<=t_RCRd) || (type>=t_DSHLw && type<=t_DSHRd);
+	for (Bitu i=0;i<BENCH_STATES;i++) {
+		LazyFlags & lazy=states[i].lazy;
+		lazy.var1.dword[0]=BenchRandom(seed);
+		lazy.var2.dword[0]=count ? 1+BenchRandom(seed)%(bits-1) : BenchRandom(seed);
+		// the result is often zero, for ZF and the sign of operands that cancel
+		lazy.res.dword[0]=(BenchRandom(seed)&3) ? BenchRandom(seed) : 0;
+		lazy.type=type;
+		lazy.prev_type=t_UNKNOWN;
+		lazy.oldcf=BenchRandom(seed)&1;
+		states[i].flags=(BenchRandom(seed)&(FMASK_TEST|FLAG_IF|FLAG_DF))|2;
+	}
+}
+
+enum BenchCall {
+	BENCH_FILL,
+	BENCH_NOCFOF,
+	BENCH_GET,
+	BENCH_CALLS
+};
+
+static double BenchRun(BenchCall call,Bitu calls) {
+	double start=HARNESS_Time();
+	for (Bitu i=0;i<calls;i++) {
+		const BenchState & state=states[i&(BENCH_STATES-1)];
+		reg_flags=state.flags;
+		switch (call) {
+		case BENCH_FILL:
+			lflags=state.lazy;
+			FillFlags();
+			break;
+		case BENCH_NOCFOF:
+			lflags=state.lazy;
+			FillFlagsNoCFOF();
+			break;
+		default:
+			lflags=state.lazy;
+			get_CF();get_AF();get_ZF();get_SF();get_OF();get_PF();
+			break;
+		}
+	}
+	return HARNESS_Time()-start;
+}
+
+int main(int argc,char * argv[]) {
+	Bitu calls=argc>1 ? strtoul(argv[1],0,0) : 2000000;
+	try {
+		static char const * const settings[]={"memsize=4",0};
+		HARNESS_Init(settings);
+		printf("benchflags: %d calls per type\n",(int)calls);
+		printf("%-8s %12s %12s %12s\n","","FillFlags","FillFlags","get_ all six");
+		printf("%-8s %12s %12s %12s\n","type","ns/call","NoCFOF","ns/call");
+		double total[BENCH_CALLS]={0};
+		Bit32u seed=1;
+		for (Bitu type=t_UNKNOWN;type<t_NOTDONE;type++) {
+			BenchFill(type,seed);
+			double seconds[BENCH_CALLS];
+			for (Bitu call=0;call<BENCH_CALLS;call++) {
+				seconds[call]=BenchRun((BenchCall)call,calls);
+				total[call]+=seconds[call];
+			}
+			printf("%-8s %12.2f %12.2f %12.2f\n",flag_types[type],
+				seconds[BENCH_FILL]*1e9/calls,seconds[BENCH_NOCFOF]*1e9/calls,
+				seconds[BENCH_GET]*1e9/calls);
+		}
+		Bitu types=t_NOTDONE;
+		printf("%-8s %12.2f %12.2f %12.2f\n","average",
+			total[BENCH_FILL]*1e9/calls/types,total[BENCH_NOCFOF]*1e9/calls/types,
+			total[BENCH_GET]*1e9/calls/types);
+		return 0;
+	} catch (char * error) {
+		printf("benchflags: %s\n",error);
+		return 2;
+	}
+}
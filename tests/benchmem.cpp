@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Microbenchmark of the guest memory block functions on 64 KB blocks:
+   MEM_BlockRead, MEM_BlockWrite and MEM_BlockCopy of memory.cpp, which copy
+   a page span at a time, against the byte at a time loops they replaced.
+   usage: benchmem [blocks]
+   The blocks start page aligned and at an odd address. Printed is the host
+   throughput, the exit code is nonzero when both ways give other bytes. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "harness.h"
+#include "mem.h"
+#include "paging.h"
+
+#define BENCH_SIZE		(64*1024)
+#define BENCH_SRC		0x100000
+#define BENCH_DEST		0x200000
+#define BENCH_NODEVICE	0xC0000000		// pages without a host pointer, see HARNESS_Init
+
+static Bit8u host_src[BENCH_SIZE];
+static Bit8u host_dest[2][BENCH_SIZE];
+
+// the earlier byte at a time versions
+static void BenchBlockRead(PhysPt pt,void * data,Bitu size) {
+	Bit8u * write=reinterpret_cast<Bit8u *>(data);
+	while (size--) {
+		*write++=mem_readb_inline(pt++);
+	}
+}
+
+static void BenchBlockWrite(PhysPt pt,void const * const data,Bitu size) {
+	Bit8u const * read=reinterpret_cast<Bit8u const *>(data);
+	while (size--) {
+		mem_writeb_inline(pt++,*read++);
+	}
+}
+
+static void BenchBlockCopy(PhysPt dest,PhysPt src,Bitu size) {
+	while (size--) mem_writeb_inline(dest++,mem_readb_inline(src++));
+}
+
+enum BenchCall {
+	BENCH_READ,
+	BENCH_WRITE,
+	BENCH_COPY,
+	BENCH_NODEVICE_READ,
+	BENCH_CALLS
+};
+
+static const char * const bench_names[BENCH_CALLS]={
+	"read","write","copy","read mmio"
+};
+
+static void BenchCallOnce(BenchCall call,bool bytes,Bitu offset,Bit8u * dest) {
+	switch (call) {
+	case BENCH_READ:
+		if (bytes) BenchBlockRead(BENCH_SRC+offset,dest,BENCH_SIZE);
+		else MEM_BlockRead(BENCH_SRC+offset,dest,BENCH_SIZE);
+		break;
+	case BENCH_WRITE:
+		if (bytes) BenchBlockWrite(BENCH_DEST+offset,host_src,BENCH_SIZE);
+		else MEM_BlockWrite(BENCH_DEST+offset,host_src,BENCH_SIZE);
+		break;
+	case BENCH_COPY:
+		if (bytes) BenchBlockCopy(BENCH_DEST+offset,BENCH_SRC+offset,BENCH_SIZE);
+		else MEM_BlockCopy(BENCH_DEST+offset,BENCH_SRC+offset,BENCH_SIZE);
+		break;
+	default:
+		if (bytes) BenchBlockRead(BENCH_NODEVICE+offset,dest,BENCH_SIZE);
+		else MEM_BlockRead(BENCH_NODEVICE+offset,dest,BENCH_SIZE);
+		break;
+	}
+}
+
+// MB/s of blocks calls
+static double BenchRun(BenchCall call,bool bytes,Bitu offset,Bitu blocks) {
+	double start=HARNESS_Time();
+	for (Bitu i=0;i<blocks;i++) BenchCallOnce(call,bytes,offset,host_dest[0]);
+	return (double)blocks*BENCH_SIZE/(1024*1024)/(HARNESS_Time()-start);
+}
+
+// the bytes a call leaves, in guest memory or the host buffer
+static void BenchResult(BenchCall call,bool bytes,Bitu offset,Bit8u * result) {
+	memset(result,0,BENCH_SIZE);
+	for (Bitu i=0;i<BENCH_SIZE;i++) mem_writeb(BENCH_DEST+offset+i,0);
+	BenchCallOnce(call,bytes,offset,result);
+	if (call==BENCH_WRITE || call==BENCH_COPY) BenchBlockRead(BENCH_DEST+offset,result,BENCH_SIZE);
+}
+
+int main(int argc,char * argv[]) {
+	Bitu blocks=argc>1 ? strtoul(argv[1],0,0) : 2000;
+	if (!blocks) blocks=1;
+	try {
+		static char const * const settings[]={"memsize=16",0};
+		HARNESS_Init(settings);
+		Bit32u seed=1;
+		for (Bitu i=0;i<BENCH_SIZE+1;i++) {
+			seed=seed*1103515245+12345;
+			mem_writeb(BENCH_SRC+i,(Bit8u)(seed>>16));
+			if (i<BENCH_SIZE) host_src[i]=(Bit8u)(seed>>24);
+		}
+		printf("benchmem: %d blocks of %d KB\n",(int)blocks,BENCH_SIZE/1024);
+		printf("%-10s %25s %25s\n","","aligned MB/s","odd address MB/s");
+		printf("%-10s %12s %12s %12s %12s\n","call","page spans","bytes","page spans","bytes");
+		int result=0;
+		for (Bitu call=0;call<BENCH_CALLS;call++) {
+			double speed[2][2];
+			for (Bitu offset=0;offset<2;offset++) {
+				BenchResult((BenchCall)call,false,offset,host_dest[0]);
+				BenchResult((BenchCall)call,true,offset,host_dest[1]);
+				if (memcmp(host_dest[0],host_dest[1],BENCH_SIZE)) {
+					printf("%s at offset %d: the page spans give other bytes\n",bench_names[call],(int)offset);
+					result=1;
+				}
+				speed[offset][0]=BenchRun((BenchCall)call,false,offset,blocks);
+				speed[offset][1]=BenchRun((BenchCall)call,true,offset,blocks);
+			}
+			printf("%-10s %12.0f %12.0f %12.0f %12.0f\n",bench_names[call],
+				speed[0][0],speed[0][1],speed[1][0],speed[1][1]);
+		}
+		return result;
+	} catch (char * error) {
+		printf("benchmem: %s\n",error);
+		return 2;
+	}
+}
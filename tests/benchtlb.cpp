@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Microbenchmark of the TLB with paging enabled, built as benchtlb with the
+   banked TLB (USE_BANKED_TLB) and as benchtlb-flat with one flat table.
+   usage: benchtlb [repeats]
+   The pages are either 4096 consecutive ones (local) or 32 in every other
+   bank of 16 MB of linear memory (spread). Printed are the bytes the TLB
+   tables take at the start and after the spread pages were linked, and the
+   host time of
+   - fill: linking a page through InitPage, unlinking it again included
+   - read: a mem_readd from a linked page
+   - cr3: a CR3 switch between two directories with 256 pages read after it */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "harness.h"
+#include "cpu.h"
+#include "mem.h"
+#include "paging.h"
+
+#define BENCH_DIR_A		0x100000
+#define BENCH_DIR_B		0x101000
+#define BENCH_TABLES	0x102000
+#define BENCH_PHYS		0x800		// first page the tables map to, 8192 pages from there
+#define BENCH_PAGES		4096
+#define BENCH_BANK		4096		// pages per bank of the banked TLB
+#define BENCH_READS		(16*1024*1024)
+
+static Bitu local_pages[BENCH_PAGES];
+static Bitu spread_pages[BENCH_PAGES];
+
+/* Directory entries 0-3 and the first one of every other bank, all pages
+   present and user writable, in two directories with the same tables */
+static void BenchMapPages(void) {
+	PhysPt table=BENCH_TABLES;
+	for (Bitu dir=0;dir<1024;dir++) {
+		bool used=(dir<4) || ((dir % (2*BENCH_BANK/1024))==0);
+		Bit32u entry=0;
+		if (used) {
+			for (Bitu i=0;i<1024;i++) {
+				phys_writed(table+i*4,(Bit32u)(((BENCH_PHYS+((dir*1024+i) & 0x1fff))<<12) | 7));
+			}
+			entry=(Bit32u)(table | 7);
+			table+=4096;
+		}
+		phys_writed(BENCH_DIR_A+dir*4,entry);
+		phys_writed(BENCH_DIR_B+dir*4,entry);
+	}
+	for (Bitu i=0;i<BENCH_PAGES;i++) {
+		local_pages[i]=i;
+		Bitu bank=(i/32)*2;
+		spread_pages[i]=bank*BENCH_BANK+(i%32)*32;
+	}
+}
+
+static Bitu BenchTLBBytes(void) {
+#if defined(USE_BANKED_TLB)
+	// the banks never linked share one, the last bank is never linked here
+	tlb_bank * unlinked=paging.tlb_dir[TLB_DIR_SIZE-1];
+	Bitu bytes=sizeof(paging.tlb_dir)+sizeof(tlb_bank);
+	for (Bitu i=0;i<TLB_DIR_SIZE;i++) {
+		if (paging.tlb_dir[i]!=unlinked) bytes+=sizeof(tlb_bank);
+	}
+	return bytes;
+#else
+	return sizeof(paging.tlb);
+#endif
+}
+
+static volatile Bit32u bench_sink;
+
+static double BenchFill(const Bitu * pages,Bitu repeats) {
+	double start=HARNESS_Time();
+	for (Bitu r=0;r<repeats;r++) {
+		PAGING_ClearTLB();
+		for (Bitu i=0;i<BENCH_PAGES;i++) bench_sink=mem_readd((PhysPt)(pages[i]<<12));
+	}
+	return (HARNESS_Time()-start)*1e9/(repeats*BENCH_PAGES);
+}
+
+static double BenchRead(const Bitu * pages,Bitu repeats) {
+	PAGING_ClearTLB();
+	Bit32u sum=0;
+	for (Bitu i=0;i<BENCH_PAGES;i++) sum+=mem_readd((PhysPt)(pages[i]<<12));
+	double start=HARNESS_Time();
+	for (Bitu r=0;r<repeats;r++) {
+		for (Bitu i=0;i<BENCH_READS;i++) {
+			// a different page each read, 8 offsets within the page
+			sum+=mem_readd((PhysPt)((pages[i & (BENCH_PAGES-1)]<<12)+((i>>12)&7)*512));
+		}
+	}
+	bench_sink=sum;
+	return (HARNESS_Time()-start)*1e9/((double)repeats*BENCH_READS);
+}
+
+static double BenchSwitch(Bitu repeats) {
+	Bitu switches=repeats*1000;
+	PAGING_ClearTLB();
+	double start=HARNESS_Time();
+	for (Bitu s=0;s<switches;s++) {
+		PAGING_SetDirBase((s&1) ? BENCH_DIR_B : BENCH_DIR_A);
+		for (Bitu i=0;i<256;i++) bench_sink=mem_readd((PhysPt)(spread_pages[i*16]<<12));
+	}
+	return (HARNESS_Time()-start)*1e9/switches;
+}
+
+int main(int argc,char * argv[]) {
+	Bitu repeats=argc>1 ? strtoul(argv[1],0,0) : 10;
+	if (!repeats) repeats=1;
+	try {
+		static char const * const settings[]={"memsize=64",0};
+		HARNESS_Init(settings);
+		BenchMapPages();
+		PAGING_SetDirBase(BENCH_DIR_A);
+		PAGING_Enable(true);
+#if defined(USE_BANKED_TLB)
+		const char * build="banked";
+#else
+		const char * build="flat";
+#endif
+		printf("benchtlb: %s TLB, %d repeats\n",build,(int)repeats);
+		Bitu bytes_start=BenchTLBBytes();
+		double fill_local=BenchFill(local_pages,repeats);
+		double fill_spread=BenchFill(spread_pages,repeats);
+		Bitu bytes_spread=BenchTLBBytes();
+		double read_local=BenchRead(local_pages,repeats);
+		double read_spread=BenchRead(spread_pages,repeats);
+		double cr3=BenchSwitch(repeats);
+		printf("%-8s %25s %25s %25s %12s\n","","TLB tables KB","fill ns/page","read ns/read","cr3 ns");
+		printf("%-8s %12s %12s %12s %12s %12s %12s %12s\n","build","start","spread","local","spread","local","spread","switch");
+		printf("%-8s %12d %12d %12.2f %12.2f %12.2f %12.2f %12.0f\n",build,(int)(bytes_start/1024),(int)(bytes_spread/1024),
+			fill_local,fill_spread,read_local,read_spread,cr3);
+		return 0;
+	} catch (char * error) {
+		printf("benchtlb: %s\n",error);
+		return 2;
+	}
+}
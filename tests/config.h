@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Configuration of the headless test programs, they build the cpu, fpu and
+   memory sources without SDL or a configure run, for the host compiler or
+   for a cross compiler (the aarch64 binaries run under qemu-user). */
+
+#define VERSION "tests"
+
+#define C_DEBUG 1
+#define C_HEAVY_DEBUG 0
+#define C_SSHOT 0
+#define C_OPENGL 0
+#define C_MODEM 0
+#define C_IPX 0
+#define C_PERF_STATS 0
+
+#if defined(__x86_64__)
+#define C_TARGETCPU X86_64
+#define C_DYNREC 1
+#define C_UNALIGNED_MEMORY 1
+#elif defined(__i386__)
+#define C_TARGETCPU X86
+#define C_DYNREC 1
+#define C_UNALIGNED_MEMORY 1
+#elif defined(__aarch64__)
+#define C_TARGETCPU ARMV8LE
+#define C_DYNREC 1
+#define C_UNALIGNED_MEMORY 1
+#else
+#define C_DYNREC 0
+#endif
+#define C_DYNAMIC_X86 0
+#define C_CORE_INLINE 1
+#define C_FPU 1
+#define C_FPU_X86 0
+#define C_HAVE_MPROTECT 1
+
+#define C_HAS_ATTRIBUTE 1
+#define C_HAS_BUILTIN_EXPECT 1
+#define GCC_ATTRIBUTE(x) __attribute__ ((x))
+#define GCC_UNLIKELY(x) __builtin_expect((x),0)
+#define GCC_LIKELY(x) __builtin_expect((x),1)
+#define INLINE inline __attribute__((always_inline))
+#define DB_FASTCALL
+
+#include <stdint.h>
+
+typedef         double     Real64;
+typedef uint8_t  Bit8u;
+typedef  int8_t  Bit8s;
+typedef uint16_t Bit16u;
+typedef  int16_t Bit16s;
+typedef uint32_t Bit32u;
+typedef  int32_t Bit32s;
+typedef uint64_t Bit64u;
+typedef  int64_t Bit64s;
+typedef uintptr_t Bitu;
+typedef  intptr_t Bits;
+
+#if UINTPTR_MAX == 0xffffffffu
+#define SIZEOF_INT_P 4
+#else
+#define SIZEOF_INT_P 8
+#endif
@@ -0,0 +1,317 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Conformance of the softfloat FPU (fpu=softfloat) with the x87.
+   usage: fpuvectors [cases] [seed]
+          fpuvectors -generate [cases] [seed]
+   The vectors in fpuvectors.h are x87 results, every one of them is run as
+   guest code on the normal core. On x86 hosts random cases are compared with
+   the host x87 as well, and -generate prints a new vector table from it.
+   Compared are the result bits and the condition codes of FPREM, FPREM1 and
+   FXAM, the exception flags are not. The exit code is nonzero on a difference. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "harness.h"
+#include "cpu.h"
+#include "regs.h"
+#include "mem.h"
+#include "fpu.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+#define FPU_HOST_X87 1
+#endif
+
+#define FPU_CODE		0x10000
+#define FPU_DATA		0x20000
+#define FPU_DATA_CW		0x00
+#define FPU_DATA_B		0x10
+#define FPU_DATA_A		0x20
+#define FPU_DATA_RESULT	0x30
+#define FPU_DATA_SW		0x40
+
+enum FpuOp {
+	FOP_FADD,FOP_FSUB,FOP_FMUL,FOP_FDIV,FOP_FSQRT,
+	FOP_FPREM,FOP_FPREM1,FOP_FSCALE,FOP_FRNDINT,FOP_FXAM,
+	FOP_FST32,FOP_FST64,FOP_FIST32,FOP_FIST64,FOP_FBST,
+	FOP_COUNT
+};
+
+struct FpuOpInfo {
+	const char * name;
+	Bitu size;					// bytes of the op, none for the stores
+	Bit8u op[2];
+	Bit8u store[2];				// opcode and modrm of the store of st(0) to the result
+	Bit16u cmask;				// condition codes that are compared
+};
+
+static const FpuOpInfo fpu_ops[FOP_COUNT]={
+	{"fadd",	2,{0xd8,0xc1},{0xdb,0x3e},0},
+	{"fsub",	2,{0xd8,0xe1},{0xdb,0x3e},0},
+	{"fmul",	2,{0xd8,0xc9},{0xdb,0x3e},0},
+	{"fdiv",	2,{0xd8,0xf1},{0xdb,0x3e},0},
+	{"fsqrt",	2,{0xd9,0xfa},{0xdb,0x3e},0},
+	{"fprem",	2,{0xd9,0xf8},{0xdb,0x3e},0x4700},
+	{"fprem1",	2,{0xd9,0xf5},{0xdb,0x3e},0x4700},
+	{"fscale",	2,{0xd9,0xfd},{0xdb,0x3e},0},
+	{"frndint",	2,{0xd9,0xfc},{0xdb,0x3e},0},
+	{"fxam",	2,{0xd9,0xe5},{0xdb,0x3e},0x4700},
+	{"fst32",	0,{0,0},{0xd9,0x1e},0},
+	{"fst64",	0,{0,0},{0xdd,0x1e},0},
+	{"fist32",	0,{0,0},{0xdb,0x1e},0},
+	{"fist64",	0,{0,0},{0xdf,0x3e},0},
+	{"fbst",	0,{0,0},{0xdf,0x36},0},
+};
+
+/* st(0)=a and st(1)=b with the control word cw, the result is what the op
+   stores, in the layout of an 80-bit register, with unwritten bytes zero */
+struct FpuVector {
+	Bit8u op;
+	Bit16u cw;
+	FPU_Ext a,b;
+	FPU_Ext result;
+	Bit16u sw;					// status word after the op, the compared codes only
+};
+
+#include "fpuvectors.h"
+
+// fninit, fldcw [cw], fld tbyte [b], fld tbyte [a], op, fnstsw [sw], store [result]
+static void FpuEmulated(const FpuVector & v,FPU_Ext & result,Bit16u & sw) {
+	const FpuOpInfo & info=fpu_ops[v.op];
+	mem_writew(FPU_DATA+FPU_DATA_CW,v.cw);
+	mem_writed(FPU_DATA+FPU_DATA_B,(Bit32u)v.b.mant);
+	mem_writed(FPU_DATA+FPU_DATA_B+4,(Bit32u)(v.b.mant>>32));
+	mem_writew(FPU_DATA+FPU_DATA_B+8,v.b.exp);
+	mem_writed(FPU_DATA+FPU_DATA_A,(Bit32u)v.a.mant);
+	mem_writed(FPU_DATA+FPU_DATA_A+4,(Bit32u)(v.a.mant>>32));
+	mem_writew(FPU_DATA+FPU_DATA_A+8,v.a.exp);
+	for (Bitu i=0;i<10;i++) mem_writeb(FPU_DATA+FPU_DATA_RESULT+i,0);
+
+	Bit8u code[32];
+	Bitu size=0;
+	Bitu instructions=0;
+	static const Bit8u prologue[]={
+		0xdb,0xe3,
+		0xd9,0x2e,FPU_DATA_CW,0,
+		0xdb,0x2e,FPU_DATA_B,0,
+		0xdb,0x2e,FPU_DATA_A,0};
+	memcpy(code,prologue,sizeof(prologue));
+	size+=sizeof(prologue);
+	instructions+=4;
+	if (info.size) {
+		memcpy(code+size,info.op,info.size);
+		size+=info.size;
+		instructions++;
+	}
+	code[size++]=0xdd;code[size++]=0x3e;code[size++]=FPU_DATA_SW;code[size++]=0;
+	code[size++]=info.store[0];code[size++]=info.store[1];code[size++]=FPU_DATA_RESULT;code[size++]=0;
+	instructions+=2;
+	for (Bitu i=0;i<size;i++) mem_writeb(FPU_CODE+i,code[i]);
+
+	for (Bitu s=0;s<6;s++) CPU_SetSegGeneral((SegNames)s,FPU_DATA>>4);
+	Segs.val[cs]=FPU_CODE>>4;
+	Segs.phys[cs]=FPU_CODE;
+	cpu.code.big=false;
+	reg_eip=0;
+	CPU_Cycles=instructions;
+	CPU_Core_Normal_Run();
+	if (reg_eip!=size) E_Exit("FPU vector stopped at %X",(int)reg_eip);
+
+	result.mant=(Bit64u)mem_readd(FPU_DATA+FPU_DATA_RESULT)|((Bit64u)mem_readd(FPU_DATA+FPU_DATA_RESULT+4)<<32);
+	result.exp=mem_readw(FPU_DATA+FPU_DATA_RESULT+8);
+	sw=mem_readw(FPU_DATA+FPU_DATA_SW)&info.cmask;
+}
+
+#ifdef FPU_HOST_X87
+#define FPU_HOST_RUN(op,store) \
+	__asm__ __volatile__("fninit\n\tfldcw %2\n\tfldt %3\n\tfldt %4\n\t" op "\n\tfnstsw %1\n\t" store " %0\n\tfninit" \
+		: "+m"(result),"=m"(sw) : "m"(v.cw),"m"(v.b),"m"(v.a))
+
+static void FpuHost(const FpuVector & v,FPU_Ext & result,Bit16u & sw) {
+	result.mant=0;
+	result.exp=0;
+	switch (v.op) {
+	case FOP_FADD:		FPU_HOST_RUN("fadd %%st(1),%%st","fstpt");break;
+	case FOP_FSUB:		FPU_HOST_RUN("fsub %%st(1),%%st","fstpt");break;
+	case FOP_FMUL:		FPU_HOST_RUN("fmul %%st(1),%%st","fstpt");break;
+	case FOP_FDIV:		FPU_HOST_RUN("fdiv %%st(1),%%st","fstpt");break;
+	case FOP_FSQRT:		FPU_HOST_RUN("fsqrt","fstpt");break;
+	case FOP_FPREM:		FPU_HOST_RUN("fprem","fstpt");break;
+	case FOP_FPREM1:	FPU_HOST_RUN("fprem1","fstpt");break;
+	case FOP_FSCALE:	FPU_HOST_RUN("fscale","fstpt");break;
+	case FOP_FRNDINT:	FPU_HOST_RUN("frndint","fstpt");break;
+	case FOP_FXAM:		FPU_HOST_RUN("fxam","fstpt");break;
+	case FOP_FST32:		FPU_HOST_RUN("","fstps");break;
+	case FOP_FST64:		FPU_HOST_RUN("","fstpl");break;
+	case FOP_FIST32:	FPU_HOST_RUN("","fistpl");break;
+	case FOP_FIST64:	FPU_HOST_RUN("","fistpll");break;
+	case FOP_FBST:		FPU_HOST_RUN("","fbstp");break;
+	}
+	sw&=fpu_ops[v.op].cmask;
+}
+#endif
+
+static Bit32u FpuRandom(Bit32u & seed) {
+	seed^=seed<<13;
+	seed^=seed>>17;
+	seed^=seed<<5;
+	return seed;
+}
+
+static Bit64u FpuRandom64(Bit32u & seed) {
+	Bit64u high=FpuRandom(seed);
+	return (high<<32)|FpuRandom(seed);
+}
+
+// operands of all classes, most of them normal and close enough to interact
+static FPU_Ext FpuRandomOperand(Bit32u & seed,bool small) {
+	FPU_Ext reg;
+	Bit16u sign=(FpuRandom(seed)&1) ? 0x8000 : 0;
+	Bit64u mant=FpuRandom64(seed);
+	switch (FpuRandom(seed)&15) {
+	case 0:	// zero
+		reg.exp=0;reg.mant=0;
+		break;
+	case 1:	// denormal
+		reg.exp=0;reg.mant=(mant>>(1+(FpuRandom(seed)&31)))|1;
+		break;
+	case 2:	// infinity
+		reg.exp=0x7fff;reg.mant=0x8000000000000000ULL;
+		break;
+	case 3:	// quiet and signaling NaNs
+		reg.exp=0x7fff;reg.mant=0x8000000000000000ULL|(mant>>1)|1;
+		break;
+	case 4:	// few significant bits, exact results and ties
+		reg.exp=0x3fff+(FpuRandom(seed)&15)-4;reg.mant=0x8000000000000000ULL|(mant&0x7ff0000000000000ULL);
+		break;
+	case 5:	// the ends of the exponent range
+		reg.exp=(FpuRandom(seed)&1) ? 1+(FpuRandom(seed)&63) : 0x7ffe - (FpuRandom(seed)&63);
+		reg.mant=0x8000000000000000ULL|mant;
+		break;
+	case 6:	// the ends of the float and double exponent ranges and of the integers
+		{
+			static const Bit16u ends[]={0x3fff-126,0x3fff+127,0x3fff-1022,0x3fff+1023,0x3fff+30,0x3fff+62,0x3fff+63};
+			reg.exp=ends[FpuRandom(seed)%7]+(FpuRandom(seed)&3)-1;
+			reg.mant=0x8000000000000000ULL|mant;
+		}
+		break;
+	default:
+		reg.exp=0x3fff+(FpuRandom(seed)%(small ? 8 : 160))-(small ? 0 : 80);
+		reg.mant=0x8000000000000000ULL|mant;
+		break;
+	}
+	reg.exp|=sign;
+	return reg;
+}
+
+static FpuVector FpuRandomVector(Bit32u & seed) {
+	FpuVector v;
+	v.op=(Bit8u)(FpuRandom(seed)%FOP_COUNT);
+	static const Bit16u precisions[]={0x000,0x200,0x300};
+	v.cw=0x7f|precisions[FpuRandom(seed)%3]|((FpuRandom(seed)&3)<<10);
+	v.a=FpuRandomOperand(seed,false);
+	v.b=FpuRandomOperand(seed,v.op==FOP_FSCALE);
+	// equal fractions, for exact cancellation and the order of NaNs
+	if (!(FpuRandom(seed)&15)) v.b.mant=(v.b.mant&0x8000000000000000ULL)|(v.a.mant&0x7fffffffffffffffULL);
+	v.result.mant=0;
+	v.result.exp=0;
+	v.sw=0;
+	return v;
+}
+
+static void FpuPrintReg(const FPU_Ext & reg) {
+	printf(" %04X:%08X%08X",reg.exp,(Bit32u)(reg.mant>>32),(Bit32u)reg.mant);
+}
+
+static Bitu FpuCheck(const FpuVector & v,Bitu & shown) {
+	FPU_Ext result;
+	Bit16u sw;
+	FpuEmulated(v,result,sw);
+	if (result.mant==v.result.mant && result.exp==v.result.exp && sw==v.sw) return 0;
+	if (shown<20) {
+		printf("%-8s cw %04X a",fpu_ops[v.op].name,v.cw);
+		FpuPrintReg(v.a);
+		printf(" b");
+		FpuPrintReg(v.b);
+		printf(": x87");
+		FpuPrintReg(v.result);
+		printf(" sw %04X, softfloat",v.sw);
+		FpuPrintReg(result);
+		printf(" sw %04X\n",sw);
+	}
+	shown++;
+	return 1;
+}
+
+int main(int argc,char * argv[]) {
+	bool generate=argc>1 && !strcmp(argv[1],"-generate");
+	if (generate) {
+		argc--;
+		argv++;
+	}
+	Bitu cases=argc>1 ? strtoul(argv[1],0,0) : (generate ? 1000 : 200000);
+	Bit32u seed=argc>2 ? (Bit32u)strtoul(argv[2],0,0) : 1;
+	if (!seed) seed=1;
+#ifndef FPU_HOST_X87
+	if (generate) {
+		printf("fpuvectors: the vectors are generated on x86 hosts\n");
+		return 2;
+	}
+	cases=0;
+#endif
+	try {
+		static char const * const settings[]={"memsize=4","fpu=softfloat",0};
+		HARNESS_Init(settings);
+#ifdef FPU_HOST_X87
+		if (generate) {
+			printf("/* x87 results, generated with fpuvectors -generate %d %u */\n",(int)cases,seed);
+			printf("static const FpuVector fpu_vectors[]={\n");
+			for (Bitu i=0;i<cases;i++) {
+				FpuVector v=FpuRandomVector(seed);
+				FpuHost(v,v.result,v.sw);
+				char name[16];
+				for (Bitu c=0;c<sizeof(name);c++) name[c]=(char)toupper(fpu_ops[v.op].name[c]);
+				printf("\t{FOP_%s,0x%04X,{0x%016llXULL,0x%04X},{0x%016llXULL,0x%04X},{0x%016llXULL,0x%04X},0x%04X},\n",
+					name,v.cw,(unsigned long long)v.a.mant,v.a.exp,(unsigned long long)v.b.mant,v.b.exp,
+					(unsigned long long)v.result.mant,v.result.exp,v.sw);
+			}
+			printf("};\n");
+			return 0;
+		}
+#endif
+		Bitu failures=0;
+		Bitu shown=0;
+		Bitu vectors=sizeof(fpu_vectors)/sizeof(fpu_vectors[0]);
+		for (Bitu i=0;i<vectors;i++) failures+=FpuCheck(fpu_vectors[i],shown);
+#ifdef FPU_HOST_X87
+		for (Bitu i=0;i<cases;i++) {
+			FpuVector v=FpuRandomVector(seed);
+			FpuHost(v,v.result,v.sw);
+			failures+=FpuCheck(v,shown);
+		}
+#endif
+		printf("fpuvectors: %d vectors, %d random cases against the host x87, %d failures\n",(int)vectors,(int)cases,(int)failures);
+		return failures ? 1 : 0;
+	} catch (char * error) {
+		printf("fpuvectors: %s\n",error);
+		return 2;
+	}
+}
@@ -0,0 +1,1021 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* x87 results, generated with fpuvectors -generate 1000 20181 */
+static const FpuVector fpu_vectors[]={
+	{FOP_FXAM,0x0B7F,{0xA26BDD396056EA3FULL,0xBFFE},{0xC27B034EE040DAA7ULL,0x401A},{0xA26BDD396056EA3FULL,0xBFFE},0x0600},
+	{FOP_FMUL,0x077F,{0xCC8B9AE7C53BC48CULL,0xBFC9},{0xA08E003B71A35F9FULL,0x4040},{0x8048B67046CD9E14ULL,0xC00B},0x0000},
+	{FOP_FSCALE,0x007F,{0x00032F7BE2EE37EFULL,0x0000},{0x0000000000000000ULL,0x8000},{0x00032F7BE2EE37EFULL,0x0000},0x0000},
+	{FOP_FBST,0x087F,{0x8000000000000000ULL,0xFFFF},{0x972194D812E206A5ULL,0x3FD9},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x087F,{0xF01CCD265EBF06BAULL,0xC04E},{0xB7A6368F5F8A28B4ULL,0xBFC4},{0xA75A920000000000ULL,0x4089},0x0000},
+	{FOP_FSUB,0x037F,{0xE7F3B94B8B88B5E6ULL,0xBFB9},{0xE7F3B94B8B88B5E6ULL,0xC01A},{0xE7F3B94B8B88B5E6ULL,0x401A},0x0000},
+	{FOP_FPREM1,0x0C7F,{0x89352D3EBECD9597ULL,0xBFB9},{0x9970000000000000ULL,0xC007},{0x89352D3EBECD9597ULL,0xBFB9},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0xA986702397C65FA2ULL,0xC03B},{0xAB3A978F40A2262AULL,0xBFFE},{0xA986702397C65FA0ULL,0xC03B},0x0000},
+	{FOP_FMUL,0x007F,{0xADC3735E36BAC3CAULL,0xC03C},{0xE53F2BAC091FDAA9ULL,0xBFB0},{0x9B9AB70000000000ULL,0x3FEE},0x0000},
+	{FOP_FPREM1,0x0C7F,{0x869FC73A3167F8C6ULL,0xC04D},{0xDBECBE8ACB86CA14ULL,0x3C00},{0xE60B238DE4A622C0ULL,0xC01E},0x0400},
+	{FOP_FST32,0x0B7F,{0xC6A76B3C53DF255CULL,0x407D},{0xF9C815A294F92B9CULL,0x4043},{0x000000007EC6A76CULL,0x0000},0x0000},
+	{FOP_FST64,0x007F,{0xF2CB141599767A11ULL,0x3FBF},{0xF02B9EAFFC39D550ULL,0xC027},{0x3BFE596282B32ECFULL,0x0000},0x0000},
+	{FOP_FSUB,0x0A7F,{0xF3FAD5F001DCEB12ULL,0xC001},{0xFF769905A693CAEEULL,0x3FD9},{0xF3FAD5F002DC6000ULL,0xC001},0x0000},
+	{FOP_FADD,0x0A7F,{0x0003ADB9AEFF94F9ULL,0x8000},{0x95F04FB51CD29776ULL,0xBFB6},{0x95F04FB51CD29000ULL,0xBFB6},0x0000},
+	{FOP_FXAM,0x077F,{0xE820000000000000ULL,0xC004},{0xE820000000000000ULL,0x402D},{0xE820000000000000ULL,0xC004},0x0600},
+	{FOP_FRNDINT,0x067F,{0xE8874A7238E85856ULL,0xC039},{0xC690000000000000ULL,0x4006},{0xE8874A7238E85860ULL,0xC039},0x0000},
+	{FOP_FDIV,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0xEE3CECCE0707B69CULL,0x403E},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x067F,{0xEBA6DDCFB3F3DDC0ULL,0x8004},{0xCD795814A9068E09ULL,0x3FB1},{0xCD795814A9069000ULL,0xBFB1},0x0000},
+	{FOP_FBST,0x0A7F,{0xB5AFD0BEB8BEDB22ULL,0x3FE9},{0xF5878AB81EC9D2D0ULL,0x3FE6},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0B7F,{0xFE70000000000000ULL,0x4003},{0x9EBF10A569D210F0ULL,0xC01C},{0xFE70000000000000ULL,0x4003},0x0000},
+	{FOP_FSQRT,0x0E7F,{0x0000000000000000ULL,0x8000},{0xC3F9F2624B0C5BB8ULL,0x803B},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST32,0x0C7F,{0x94D7DD5B80EDD645ULL,0xBFD7},{0x0000006DF53D4B01ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x007F,{0xBB1B457AA539F8A0ULL,0xC400},{0x8F34293C48662A95ULL,0xBFD6},{0x00000000FF800000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x087F,{0xAD5A670856D1AD75ULL,0xC02D},{0xA898E93E02510FC1ULL,0x8006},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x007F,{0xE7B83D7D62E203B6ULL,0xC01B},{0xE7B83D7D62E203B6ULL,0xC018},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FBST,0x0B7F,{0xFFA495FDCE7B6D70ULL,0x3FCD},{0xFFA495FDCE7B6D70ULL,0xBFB5},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FADD,0x027F,{0xADF877B0C2CAE0D7ULL,0x3FC5},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xC4342109C2B94163ULL,0xBFD5},{0xF50C07A1CAFBB6FDULL,0x3FB8},{0xE2131D3791C83B00ULL,0xBFB4},0x0000},
+	{FOP_FSUB,0x0C7F,{0xA889B13CCB69F30BULL,0x4012},{0xDD0A0C320D0C4CF4ULL,0xC03C},{0xDD0A0C0000000000ULL,0x403C},0x0000},
+	{FOP_FSUB,0x0B7F,{0x8000000000000000ULL,0xFFFF},{0x00000000EB55023BULL,0x0000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0A7F,{0x16D47FBAFD464E43ULL,0x8000},{0xB6579F4AF2614F35ULL,0x403E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x027F,{0xB620000000000000ULL,0xC004},{0xA6019EDAAE8052D7ULL,0x4015},{0xB800000000000000ULL,0xC004},0x0000},
+	{FOP_FST32,0x0E7F,{0x8000000000000000ULL,0x7FFF},{0x91B5046C962342F0ULL,0xC032},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0F7F,{0xB360000000000000ULL,0x4004},{0xFE9A5CC11546EE40ULL,0x4015},{0xB360000000000000ULL,0x4004},0x0000},
+	{FOP_FPREM,0x0E7F,{0x8567D14596A692A2ULL,0x3FE5},{0x0000000000000000ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x067F,{0xE3FA271C44276690ULL,0x3FE8},{0x06236BA0E9B99661ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x027F,{0xBA7E06362DA7962AULL,0x3FBD},{0xD4CD46C77EAEC16DULL,0xBFD3},{0xE0598305FA7DF800ULL,0xBFE8},0x0000},
+	{FOP_FRNDINT,0x007F,{0xDC8FEABC9ADF7050ULL,0xC022},{0x80B048F9BC4AA9EEULL,0x7FDC},{0xDC8FEABCA0000000ULL,0xC022},0x0000},
+	{FOP_FSCALE,0x027F,{0xF4E0000000000000ULL,0x3FFE},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FBST,0x027F,{0xD9C0000000000000ULL,0x3FFE},{0x9B2D34CB8B3D0831ULL,0xBFF7},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FBST,0x0B7F,{0xE4241170A74E6CD5ULL,0xBFCE},{0xAEE227442B58DA61ULL,0x404E},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST32,0x037F,{0xEB297CA1D312A11FULL,0xBFB8},{0xEB297CA1D312A11FULL,0x3FD6},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x077F,{0xF95C86BE58E53D0BULL,0xFFFF},{0xA50E06805E10F98FULL,0x4002},{0x00000000FFF95C86ULL,0x0000},0x0000},
+	{FOP_FSUB,0x047F,{0xF5D9D1F43301F6E7ULL,0xBFF3},{0xBE1D1CA7ACB7BE03ULL,0x4046},{0xBE1D1D0000000000ULL,0xC046},0x0000},
+	{FOP_FDIV,0x027F,{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x037F,{0xA3C89DB83F8F3567ULL,0x403E},{0x8C2901D4AE616C7DULL,0x4028},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x0B7F,{0xC9F4C0886D58E73AULL,0x8025},{0xB86954F44C0C6C6FULL,0xBFD4},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSCALE,0x007F,{0xCB69C1B098A2EBFFULL,0x7FFF},{0x4B69C1B098A2EBFFULL,0x8000},{0xCB69C1B098A2EBFFULL,0x7FFF},0x0000},
+	{FOP_FMUL,0x037F,{0x95C90E7AB4CCDB59ULL,0x400A},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FPREM,0x0B7F,{0xB8C0000000000000ULL,0xC00A},{0xDE56EFA677E7E097ULL,0xC01E},{0xB8C0000000000000ULL,0xC00A},0x0000},
+	{FOP_FSUB,0x0F7F,{0x0000000000000000ULL,0x8000},{0xAC0541FD036EDFE0ULL,0xBFB2},{0xAC0541FD036EDFE0ULL,0x3FB2},0x0000},
+	{FOP_FST32,0x087F,{0xFD1BF7747D5BA74EULL,0xC00E},{0x00000055F2CED009ULL,0x0000},{0x00000000C77D1BF7ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0E7F,{0x95ECBB11535DD097ULL,0xFFFF},{0xA386E12C8BC8815DULL,0x3FC8},{0xD5ECBB11535DD097ULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x0F7F,{0xDDEA78B04D72480EULL,0xBFCA},{0x923E814B80E78840ULL,0x402D},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x027F,{0x83338D48A1CE24B5ULL,0x7FFF},{0xE73593C17CFEB597ULL,0x7FFF},{0x7FF86671A91439C4ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x087F,{0xF5DEFE18E9A8C9D6ULL,0x4045},{0x0D3EB977681A5F97ULL,0x8000},{0xBAF2E9673BAB8E50ULL,0x401D},0x0400},
+	{FOP_FSCALE,0x0A7F,{0x8D3257F1BE46D6F7ULL,0x4019},{0xFA003BE152F0CEBFULL,0xC004},{0x8D3257F1BE46D6F7ULL,0x3FDB},0x0000},
+	{FOP_FPREM,0x047F,{0xCA785DB0F80997B7ULL,0x4049},{0x8B4D01C945F2BA13ULL,0x404B},{0xCA785DB0F80997B7ULL,0x4049},0x0000},
+	{FOP_FPREM1,0x067F,{0xD4DDCB6ADBA70BF2ULL,0x3FE1},{0xBC5E4B91D0A671E7ULL,0xBFDF},{0xB4C0985B49481376ULL,0xBFDE},0x0300},
+	{FOP_FBST,0x027F,{0xFD83F1F8F420E4F7ULL,0xFFFF},{0xA397DF27D61930DEULL,0x3FB4},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x007F,{0x8000000000000000ULL,0xFFFF},{0xEAD4C500BCE33B7AULL,0x4037},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST64,0x027F,{0xB75D2CC7CA753105ULL,0xC042},{0x375D2CC7CA753105ULL,0x0000},{0xC426EBA598F94EA6ULL,0x0000},0x0000},
+	{FOP_FST32,0x087F,{0xBEC7FB1DF523422FULL,0x401F},{0xB27BE0C0021379D1ULL,0x000F},{0x000000004FBEC7FCULL,0x0000},0x0000},
+	{FOP_FST32,0x0B7F,{0xC290DE86714676E6ULL,0xC01B},{0x929166CB7743640FULL,0x3FB4},{0x00000000CDC290DEULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0A7F,{0xA58F7B17175A7241ULL,0x4049},{0xFEC5898A31616070ULL,0xC003},{0xA58F7B17175A7241ULL,0x402A},0x0000},
+	{FOP_FRNDINT,0x007F,{0xADD0000000000000ULL,0xBFFE},{0x8C8B3BBE14650640ULL,0x401F},{0x8000000000000000ULL,0xBFFF},0x0000},
+	{FOP_FIST64,0x0B7F,{0x974F63269E5008D3ULL,0x401D},{0x866A74F65666810CULL,0x4013},{0x000000004BA7B194ULL,0x0000},0x0000},
+	{FOP_FIST32,0x037F,{0x8000000000000000ULL,0xFFFF},{0x01EE18BC5DCBA9D1ULL,0x0000},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0C7F,{0xD500000000000000ULL,0x3FFD},{0x9F19E670592904EBULL,0x7FFF},{0x000000003ED50000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x067F,{0xC70B6418DA8E0A5CULL,0xBFF2},{0x0000000000000000ULL,0x8000},{0xC70B6418DA8E0A5CULL,0xBFF2},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xB0D6559AB6C87DA8ULL,0xC03E},{0xE89276C36F02F926ULL,0x0040},{0xED348A7B886D9120ULL,0xBFFF},0x0400},
+	{FOP_FIST64,0x0A7F,{0xA1BB8958C28CC310ULL,0xBFE5},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x0C7F,{0x84FD567D68668DE4ULL,0xC032},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x027F,{0xE96C12870CA42439ULL,0x402E},{0x8F3ACA7118E4A82BULL,0x4037},{0xF473576039E59000ULL,0x4016},0x0000},
+	{FOP_FADD,0x007F,{0xAACB043783FDA331ULL,0xBFCE},{0x0000000000000000ULL,0x8000},{0xAACB040000000000ULL,0xBFCE},0x0000},
+	{FOP_FSQRT,0x0C7F,{0x97F0000000000000ULL,0x3FFD},{0xDA171E3383F579BBULL,0xBFC1},{0x8B74C20000000000ULL,0x3FFE},0x0000},
+	{FOP_FST32,0x0B7F,{0xF1E8746513F1D137ULL,0xC00F},{0xABF32E970A149967ULL,0x3FDC},{0x00000000C7F1E874ULL,0x0000},0x0000},
+	{FOP_FMUL,0x007F,{0xE1513A2A849F7D20ULL,0xBFF4},{0xC37F614E45882A45ULL,0x0039},{0xAC10FC0000000000ULL,0x802F},0x0000},
+	{FOP_FST64,0x0C7F,{0xC6D41C666E4F678AULL,0x0017},{0x0000000139572B57ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x007F,{0x0000000000000000ULL,0x8000},{0xFBECEBB335C5E73EULL,0x4003},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FBST,0x027F,{0x88FF7703A5FBA58CULL,0xBFD7},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FPREM1,0x047F,{0x80B7F4893AF3D8DAULL,0x401E},{0x818CE75EB180044DULL,0xFFFF},{0xC18CE75EB180044DULL,0xFFFF},0x0000},
+	{FOP_FBST,0x087F,{0x8000000000000000ULL,0x7FFF},{0xC63F5B750764167DULL,0x4047},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x067F,{0xAA414FAE752540F4ULL,0x4009},{0xADE9B9AE4152ECC0ULL,0xFFFE},{0xAA414FAE752540F4ULL,0x4009},0x0000},
+	{FOP_FXAM,0x0A7F,{0xDF154DA7A2934817ULL,0xBFD7},{0xEA9ECF4DDD91E836ULL,0xC04D},{0xDF154DA7A2934817ULL,0xBFD7},0x0600},
+	{FOP_FRNDINT,0x067F,{0xF5C533C5240AF97BULL,0x3FEC},{0xA339B2013A42CF1DULL,0x3FCD},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x067F,{0xC3D94D3825B178E7ULL,0x7FFF},{0xBBA6C16692CE34D3ULL,0xFFFF},{0xC3D94D3825B178E7ULL,0x7FFF},0x0000},
+	{FOP_FPREM1,0x0B7F,{0x000373E1025D26CFULL,0x8000},{0xAFBD209AFE6A8CEDULL,0xC03F},{0x000373E1025D26CFULL,0x8000},0x0000},
+	{FOP_FPREM1,0x027F,{0xE55E7AC46ADB1727ULL,0x402A},{0xE55E7AC46ADB1727ULL,0xC01C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0C7F,{0xA340B5D88A8E4B85ULL,0x4029},{0xAEF515C985CA4E0FULL,0xBFF6},{0x0005609322628180ULL,0x0000},0x0000},
+	{FOP_FST64,0x077F,{0xA652C3BB3A9E4989ULL,0xC010},{0xEEC2C1B2E867C3C8ULL,0x4045},{0xC104CA58776753CAULL,0x0000},0x0000},
+	{FOP_FADD,0x0F7F,{0xE6A0000000000000ULL,0x3FFC},{0xADC80C7924A8311AULL,0xBFE6},{0xE69FFD48DFCE1B6DULL,0x3FFC},0x0000},
+	{FOP_FDIV,0x077F,{0xEF0B493843AD4FEEULL,0xBF80},{0xB6E055B0B69F38FBULL,0x3FD8},{0xA750360ADB47A6B6ULL,0xBFA7},0x0000},
+	{FOP_FSQRT,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0xC63063D0830AD855ULL,0x8036},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FXAM,0x0B7F,{0xEC358EB2E19FE823ULL,0xC030},{0xC05C7405154ADE0BULL,0xC029},{0xEC358EB2E19FE823ULL,0xC030},0x0600},
+	{FOP_FIST32,0x047F,{0x8CF8A7629A81C668ULL,0x4018},{0x0000000000000000ULL,0x0000},{0x000000000233E29DULL,0x0000},0x0000},
+	{FOP_FST64,0x087F,{0xAE7242152022B0ADULL,0xBF80},{0xA59DF589FEBF9BFFULL,0xC046},{0xB805CE4842A40456ULL,0x0000},0x0000},
+	{FOP_FMUL,0x047F,{0xD6E0FB5778CDCDD2ULL,0xBFB7},{0x81ECB5BA7C2C7CF7ULL,0x3FE6},{0xDA1C1E0000000000ULL,0xBF9E},0x0000},
+	{FOP_FPREM,0x027F,{0x8000000000000000ULL,0xFFFF},{0xA08F9F613F114CD0ULL,0x8037},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x0A7F,{0xA9CA5B30372126A6ULL,0x3FE4},{0xDFB4B7DFE0A95C78ULL,0x4022},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FXAM,0x027F,{0xCAC5BBDACA6665A5ULL,0x402C},{0xD890000000000000ULL,0x3FFC},{0xCAC5BBDACA6665A5ULL,0x402C},0x0400},
+	{FOP_FADD,0x087F,{0xC8D8772001BE93FEULL,0xC01F},{0xBCD747BBD021B8CBULL,0xC009},{0xC8D87A0000000000ULL,0xC01F},0x0000},
+	{FOP_FRNDINT,0x0E7F,{0xBA0F7572C082FB62ULL,0x7FEC},{0xB59B417A6B399BA0ULL,0xC07E},{0xBA0F7572C082FB62ULL,0x7FEC},0x0000},
+	{FOP_FST64,0x067F,{0xFB676F63C7EB80E6ULL,0x404B},{0x0000068822FAD039ULL,0x8000},{0x44BF6CEDEC78FD70ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0E7F,{0x9D27FA652F060150ULL,0x3F83},{0xED3286DF00CE3D4BULL,0x4036},{0xA99D2A7E3C265800ULL,0x3F4B},0x0000},
+	{FOP_FIST64,0x0F7F,{0xE22FA40F436FE458ULL,0xC04C},{0x99BD793465EFED59ULL,0x3FDF},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x047F,{0x96F9DBF89D5D7A4BULL,0x7FFF},{0xA5F4B7EED22CE32AULL,0xBFDD},{0xD6F9DBF89D5D7A4BULL,0x7FFF},0x0000},
+	{FOP_FMUL,0x047F,{0xFBD162F8A6457ECFULL,0xFFFF},{0xB3A14EFE55AEFBE1ULL,0x3FBF},{0xFBD162F8A6457ECFULL,0xFFFF},0x0000},
+	{FOP_FPREM,0x0B7F,{0x9C9ED46E8475DB87ULL,0x8020},{0x90576BAAD960B25BULL,0x3FCF},{0x9C9ED46E8475DB87ULL,0x8020},0x0000},
+	{FOP_FST32,0x0B7F,{0xC57135891BC4A949ULL,0xBFF7},{0xCF73484FE92DD532ULL,0xBFF7},{0x00000000BBC57135ULL,0x0000},0x0000},
+	{FOP_FST32,0x007F,{0xDC22671F88F8209FULL,0xBFCC},{0xDEA25266893D9A31ULL,0xBFB2},{0x00000000A65C2267ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x027F,{0xF9060F97266A8E4DULL,0x3FEC},{0xB9C1659BBB33EB62ULL,0x3FAF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x0E7F,{0xC8930DD30C0651A7ULL,0xBFEC},{0xB56D9AE9402FC7D1ULL,0xBFF6},{0xB59FBFACB4F2C800ULL,0xBFF6},0x0000},
+	{FOP_FPREM1,0x0C7F,{0xAD1FD2A2BE3C99E7ULL,0xC008},{0xD4B0000000000000ULL,0xC003},{0xA1A5457C7933CE00ULL,0xBFFF},0x4000},
+	{FOP_FST64,0x0A7F,{0x8BF0000000000000ULL,0xC001},{0xFB2207EF4020BA11ULL,0x7FFF},{0xC0117E0000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0A7F,{0xD18A3C40D644DF61ULL,0x0005},{0xC52A3344EB1CAE45ULL,0xC039},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FST32,0x0B7F,{0xC9EC579AA0F1B4B5ULL,0x401D},{0x000015E5417B248FULL,0x8000},{0x000000004EC9EC58ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0F7F,{0xBFC1B9BA162945E1ULL,0x3FD9},{0x95C00A4805A9019DULL,0x7FFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x077F,{0x0000000000000000ULL,0x0000},{0xBA5A9C13D2C9971FULL,0xC00A},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x067F,{0xFDC66CE9BB398C44ULL,0xC048},{0x97DF6B062D4D5D69ULL,0xFFFF},{0xD7DF6B062D4D5D69ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x0E7F,{0xE8144192E4E841A1ULL,0xC011},{0xFA2815B86B7A1717ULL,0x3FE1},{0xED8011D47D6C2000ULL,0xC02E},0x0000},
+	{FOP_FXAM,0x047F,{0x8000000000000000ULL,0xFFFF},{0xFBCAFE3D25AC8B5BULL,0x4032},{0x8000000000000000ULL,0xFFFF},0x0700},
+	{FOP_FSCALE,0x037F,{0x89E236562A3AA982ULL,0xBFB0},{0xC25D81FEBE25212FULL,0x4006},{0x89E236562A3AA982ULL,0xC072},0x0000},
+	{FOP_FRNDINT,0x087F,{0xCDE7FF5AF3902DDCULL,0x402E},{0xDD416B6DF5BADC1BULL,0x3FCA},{0xCDE7FF5AF3910000ULL,0x402E},0x0000},
+	{FOP_FMUL,0x067F,{0x8000000000000000ULL,0x7FFF},{0xBAE0000000000000ULL,0x3FFC},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FST64,0x077F,{0xF3BEAC75E033F2CDULL,0xC032},{0xB69DA12ED5BC2E32ULL,0xC037},{0xC32E77D58EBC067FULL,0x0000},0x0000},
+	{FOP_FMUL,0x007F,{0xE13F22462B83BF5DULL,0x4029},{0xB4FDE22B1FA84897ULL,0xC004},{0x9F3FC60000000000ULL,0xC02F},0x0000},
+	{FOP_FSQRT,0x0B7F,{0xCE6647CD556B34C2ULL,0x4000},{0xC4386D507BDB7AB9ULL,0x403C},{0xE5DDA447B417A72EULL,0x3FFF},0x0000},
+	{FOP_FSUB,0x047F,{0xC9AC06646574F854ULL,0xBFE3},{0xE449B0671AEA51E5ULL,0xC01B},{0xE449B00000000000ULL,0x401B},0x0000},
+	{FOP_FST64,0x0B7F,{0xF86343B192B05CDBULL,0xC043},{0x8000000000000000ULL,0x7FFF},{0xC43F0C687632560BULL,0x0000},0x0000},
+	{FOP_FPREM,0x087F,{0xB614BCD8107A2FFFULL,0x3FD7},{0x8000000000000000ULL,0xFFFF},{0xB614BCD8107A2FFFULL,0x3FD7},0x0000},
+	{FOP_FADD,0x0B7F,{0x9666A24407EE6933ULL,0x402D},{0x95430D96EACF0A2EULL,0xC019},{0x966698EFD714FA87ULL,0x402D},0x0000},
+	{FOP_FRNDINT,0x067F,{0xEDD8EDDE7C01A80FULL,0x3FCE},{0xED89395F9EF53DCEULL,0xBFB5},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0F7F,{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0x4021},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x037F,{0x0000000000000000ULL,0x8000},{0xFA64C8428EF3C774ULL,0x4023},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x047F,{0xE9556130EB1B32A9ULL,0x3FDF},{0x84179309B8A78E72ULL,0xBC02},{0xE9556130EB1B32A9ULL,0x3FDF},0x0400},
+	{FOP_FST64,0x007F,{0xA8B76A54FA44DDEAULL,0x407F},{0xA33AE1231CC12B2CULL,0x3FB3},{0x47F516ED4A9F489CULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0E7F,{0xBBC58815D22AC3B6ULL,0x403A},{0xFE8EC6406E943903ULL,0xC005},{0xBBC58815D22AC3B6ULL,0x3FBB},0x0000},
+	{FOP_FPREM1,0x0F7F,{0xEE5711388270E711ULL,0x7FFF},{0x0000000000000000ULL,0x8000},{0xEE5711388270E711ULL,0x7FFF},0x0000},
+	{FOP_FSCALE,0x0F7F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x087F,{0xFBAB11FDAB0B5BD7ULL,0xBFB9},{0xA99E291FFB021761ULL,0xBF81},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x0B7F,{0xF17CC8BCE50CADA9ULL,0x0008},{0x9B81614EC2BFE9DAULL,0xBFCF},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0A7F,{0xFC3C4C27C2AA499BULL,0x4015},{0xCE86BD42BCF88B75ULL,0x4044},{0x00000000007E1E27ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0C7F,{0xD4C2D060571C77E7ULL,0x4046},{0x9494A3549F32064BULL,0xC03E},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xDCF414B212254BE3ULL,0x401D},{0xB4E1682CA5703F1EULL,0xC006},{0xDCF414B212254BE3ULL,0x3F69},0x0000},
+	{FOP_FPREM,0x0E7F,{0xC3B0000000000000ULL,0x4004},{0x9C56F5AC9E818F7DULL,0x4031},{0xC3B0000000000000ULL,0x4004},0x0000},
+	{FOP_FDIV,0x0F7F,{0x9714E02EE93DD166ULL,0xBFF6},{0xBE4845EFE8426C35ULL,0xBFCE},{0xCB42AF05B2EDA8CFULL,0x4026},0x0000},
+	{FOP_FDIV,0x027F,{0x9900000000000000ULL,0xC006},{0x918E4155ED353D67ULL,0xBFFB},{0x868BE3DE5275B000ULL,0x400A},0x0000},
+	{FOP_FRNDINT,0x037F,{0xABCB056027833AB3ULL,0xBFCA},{0xB960473F8178007CULL,0x4011},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FMUL,0x047F,{0xFADA9438A3E5C2D6ULL,0x4033},{0xD52CAD2AD1B820AEULL,0x4010},{0xD0E3A40000000000ULL,0x4045},0x0000},
+	{FOP_FSQRT,0x0E7F,{0xA7588CEC6E6FA64EULL,0x4036},{0xFE407D8FCFCD4B97ULL,0x3FE1},{0xCEFAC66129979800ULL,0x401A},0x0000},
+	{FOP_FSQRT,0x027F,{0xE13FF9FDDE0A895DULL,0xC02C},{0xAB10000000000000ULL,0x4007},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x007F,{0xE14C2564D9F26514ULL,0xC04C},{0x915B0DFE6C7A440DULL,0x7FFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x077F,{0xACE0E8828FEEFF3AULL,0xC01B},{0xDB6CBEA25BAB873EULL,0x3FB1},{0xACE0E8828FEEFF3AULL,0xC01B},0x0600},
+	{FOP_FPREM,0x0A7F,{0x980265C8C3D2BD35ULL,0x3FCD},{0xC37E2457F96C320DULL,0xC047},{0x980265C8C3D2BD35ULL,0x3FCD},0x0000},
+	{FOP_FSQRT,0x0F7F,{0x80A6AD9AF7AD2510ULL,0x3FB6},{0x8861B58664F4772EULL,0xBF83},{0xB57AA8E63925F981ULL,0x3FDA},0x0000},
+	{FOP_FSUB,0x067F,{0x8000000000000000ULL,0x7FFF},{0xB3B563ACE7DD65CCULL,0x3FEA},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FIST64,0x0A7F,{0x8816E18250F7F9B1ULL,0xFFFF},{0xD268EA95287F8C08ULL,0xBFB6},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x007F,{0xFA175059139372B7ULL,0xFFE1},{0xFE00D67BFD3F079CULL,0x4006},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x087F,{0x88E1B5AF74D55A25ULL,0x3FC7},{0x88E1B5AF74D55A25ULL,0x4004},{0x88E1B5AF74D55A25ULL,0x3FE9},0x0000},
+	{FOP_FXAM,0x0B7F,{0x96305CFCA855974BULL,0x8022},{0x95E0A21FB5C35B0EULL,0x4029},{0x96305CFCA855974BULL,0x8022},0x0600},
+	{FOP_FSQRT,0x0C7F,{0x8000000000000000ULL,0x7FFF},{0x000008CB1F03AE47ULL,0x8000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FIST32,0x0A7F,{0xB2B83C5E13477E27ULL,0x403F},{0xA65FB560CE887E39ULL,0x400E},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x007F,{0xB16A3A7AB28D6C68ULL,0x400F},{0x8FB31F3AE6D94B10ULL,0x4003},{0xB16A3A7AB28D6C68ULL,0x4020},0x0000},
+	{FOP_FPREM,0x0A7F,{0x0000000000000000ULL,0x8000},{0xC800000000000000ULL,0xC006},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x047F,{0x8354358EB95B18FCULL,0xC041},{0x8354358EB95B18FCULL,0xFFFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST64,0x0B7F,{0xBC762D02431C6CC9ULL,0xBFE4},{0xEF53FF8704C1ED16ULL,0xC040},{0xBE478EC5A048638DULL,0x0000},0x0000},
+	{FOP_FSCALE,0x077F,{0xAC9C192F588C7093ULL,0xC020},{0x85E0000000000000ULL,0x4000},{0xAC9C192F588C7093ULL,0xC022},0x0000},
+	{FOP_FIST32,0x027F,{0xBA5C07FBEEC46FEAULL,0x43FF},{0xDF143A50539CD99FULL,0xC015},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x047F,{0xAE2B24C31CDF52DAULL,0xC004},{0xED1D12ADA65A3429ULL,0x401F},{0xC045C56498639BEBULL,0x0000},0x0000},
+	{FOP_FPREM1,0x087F,{0xCEEF5B8C164FA123ULL,0x3F80},{0xCEEF5B8C164FA123ULL,0xBFD1},{0xCEEF5B8C164FA123ULL,0x3F80},0x0000},
+	{FOP_FBST,0x067F,{0xEE60000000000000ULL,0x4005},{0xFABC487605E4844FULL,0xBFCF},{0x0000000000000119ULL,0x0000},0x0000},
+	{FOP_FXAM,0x0E7F,{0x9AD128ED4656366BULL,0xBF81},{0x8000000000000000ULL,0x7FFF},{0x9AD128ED4656366BULL,0xBF81},0x0600},
+	{FOP_FSUB,0x047F,{0xD58DE250D13F10D3ULL,0xFFFF},{0xB890000000000000ULL,0xC007},{0xD58DE250D13F10D3ULL,0xFFFF},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0x9EE0000000000000ULL,0x4005},{0xA409BD84E497FF58ULL,0xBC00},{0xA000000000000000ULL,0x4005},0x0000},
+	{FOP_FST64,0x0F7F,{0xB897175B95FF56C5ULL,0xC03E},{0xBA0CDFEF9FDC8DF7ULL,0x3F81},{0xC3E712E2EB72BFEAULL,0x0000},0x0000},
+	{FOP_FST64,0x027F,{0x9C7B9544B4B7678DULL,0xC014},{0xF54A026495D58407ULL,0x3FCF},{0xC1438F72A89696EDULL,0x0000},0x0000},
+	{FOP_FPREM,0x027F,{0xDD1B41DD913F92EDULL,0x402F},{0xC94B68F22EFA21D8ULL,0x4041},{0xDD1B41DD913F92EDULL,0x402F},0x0000},
+	{FOP_FST32,0x0A7F,{0x8000000000000000ULL,0x7FFF},{0xD4452EFBC2DCF0F6ULL,0x3FDF},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x0C7F,{0x0000015AE205B651ULL,0x0000},{0xF5F724AB3D2BCF5AULL,0xC046},{0xA6A4980000000000ULL,0x8032},0x0000},
+	{FOP_FSUB,0x037F,{0xF4D0E3BF7C41CA6CULL,0xBFBF},{0xAB6FA136B6609CD2ULL,0x3FB5},{0xF4FBBFA7C9EF6293ULL,0xBFBF},0x0000},
+	{FOP_FXAM,0x067F,{0xD6F7E6E3EF51AD36ULL,0xC047},{0xF4375D066D6D8B6DULL,0xBFF4},{0xD6F7E6E3EF51AD36ULL,0xC047},0x0600},
+	{FOP_FSQRT,0x027F,{0xF492391145B019E9ULL,0xBFDB},{0xCF258D7B2FD8D5FEULL,0xC02F},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x0F7F,{0xB7C3AE2202FE2B01ULL,0xC026},{0x91D1018B0DEF561BULL,0x3FEC},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x0F7F,{0xEF2B56A63A0D1F69ULL,0x7FFF},{0xD8884AF3EB1E0118ULL,0x403E},{0xEF2B56A63A0D1F69ULL,0x7FFF},0x0000},
+	{FOP_FMUL,0x0C7F,{0xEEC7FB022551C9F1ULL,0x407E},{0x967AC41D91D12F41ULL,0xC02A},{0x8C5BAF0000000000ULL,0xC0AA},0x0000},
+	{FOP_FST64,0x027F,{0x0000C726EB0B52B7ULL,0x0000},{0xFCC0030FE89A76BFULL,0x3FF7},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x037F,{0xBB8E0FD234FA2FE8ULL,0x4028},{0x87A9E4CBDD2BF333ULL,0x7FC5},{0xBB8E0FD234FA2FE8ULL,0x4028},0x0400},
+	{FOP_FSQRT,0x0B7F,{0x881A068BD1AB5F2EULL,0xBFBF},{0xA26815BE3B277FF1ULL,0xC030},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x047F,{0xE5B0000000000000ULL,0xC006},{0xAE143208A2F9A262ULL,0xC002},{0xE5B0000000000000ULL,0xBFFC},0x0000},
+	{FOP_FADD,0x0F7F,{0x8000000000000000ULL,0xFFFF},{0xD02758AA5D72A353ULL,0xC04B},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x047F,{0x8000000000000000ULL,0xFFFF},{0x00000655FA789A47ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x027F,{0xC1F0000000000000ULL,0xBFFB},{0xC1F0000000000000ULL,0xC01D},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FBST,0x087F,{0x970C4C6ECEB1E6EEULL,0xBFB5},{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST64,0x027F,{0x94D4066E17204033ULL,0x7FFF},{0x96DEAACFB3624A8CULL,0x7FE7},{0x7FFA9A80CDC2E408ULL,0x0000},0x0000},
+	{FOP_FIST64,0x007F,{0xB1A0000000000000ULL,0x4002},{0x001EBAE268DC0899ULL,0x8000},{0x000000000000000BULL,0x0000},0x0000},
+	{FOP_FMUL,0x0B7F,{0x00002E4925FC9421ULL,0x0000},{0x958E2F69DC0F8C58ULL,0x3FBB},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0B7F,{0xADE8B2094E98747DULL,0x43FF},{0x8D2344D0D297B78CULL,0x3FBA},{0xBECEF875E551BA90ULL,0x43D9},0x0400},
+	{FOP_FDIV,0x067F,{0xACE58083824A21D9ULL,0xFFFF},{0xF4BAF072FC284028ULL,0x3FD3},{0xECE58083824A21D9ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x027F,{0xB75CFD7636B708EFULL,0x400F},{0x86BB7B4353B6DAEAULL,0xBFFF},{0xB75CFD7636B708EFULL,0x400E},0x0000},
+	{FOP_FXAM,0x077F,{0xE850000000000000ULL,0x4000},{0xE5A1BC20969F7372ULL,0xBFD5},{0xE850000000000000ULL,0x4000},0x0400},
+	{FOP_FPREM,0x0E7F,{0xA1415F1CDEF1D3EDULL,0x3FB0},{0x8000000000000000ULL,0xFFFF},{0xA1415F1CDEF1D3EDULL,0x3FB0},0x0000},
+	{FOP_FIST64,0x007F,{0xCDCC902526C3A7E1ULL,0xBFF7},{0xC86A1E82FCF970BFULL,0xC04B},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x0A7F,{0xE85F3BDF6BB715EDULL,0xBFF3},{0xE85F3BDF6BB715EDULL,0x3FE4},{0xE85F3BDF6BB715EDULL,0xBFF3},0x0600},
+	{FOP_FMUL,0x007F,{0x00028EFC1C3CA24BULL,0x0000},{0xD6F6EEBEEF0C0EEEULL,0xC3FE},{0x897FA20000000000ULL,0x83F3},0x0000},
+	{FOP_FMUL,0x0F7F,{0x0004D135E5F7DCD1ULL,0x0000},{0xF53434E086A1EBB4ULL,0x3FEB},{0x0000000093A68258ULL,0x0000},0x0000},
+	{FOP_FADD,0x0C7F,{0xB328C333C2902414ULL,0xC042},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xE9E2357146C41837ULL,0xBF83},{0x013FDA4DA0BBA0A5ULL,0x8000},{0xE9E2357146C41837ULL,0xBF83},0x0000},
+	{FOP_FDIV,0x087F,{0xF175A7ECF488A028ULL,0x403E},{0xFD833AFFC14E65B1ULL,0xC00A},{0xF3D4260000000000ULL,0xC032},0x0000},
+	{FOP_FSCALE,0x0B7F,{0x9592C7B0E1F8C142ULL,0x3FF2},{0xF5F0E180D1D23960ULL,0xBFFF},{0x9592C7B0E1F8C142ULL,0x3FF1},0x0000},
+	{FOP_FSCALE,0x0C7F,{0xC7193DB2F54EB145ULL,0x3F83},{0xDC52D6555596D639ULL,0xFFFF},{0xDC52D6555596D639ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x037F,{0xC38FD4889ACF88E7ULL,0xBFED},{0xAA20000000000000ULL,0x4000},{0xAA201871FA91135AULL,0xC000},0x0000},
+	{FOP_FPREM,0x047F,{0xB8C956E050BEA2AAULL,0x4032},{0x0000000000000000ULL,0x8000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x067F,{0xD9DACA0713DF630AULL,0xFFCA},{0x0000000000000000ULL,0x8000},{0xD9DACA0713DF630AULL,0xFFCA},0x0000},
+	{FOP_FST64,0x027F,{0xF9EEFE22E37F0BD7ULL,0x7FD6},{0xC0747CCFB25ADC19ULL,0x7FE2},{0x7FF0000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x087F,{0x98BAD6B40FE287C2ULL,0x3FC5},{0xD0AA1D38F2A7C37EULL,0x3FFA},{0x3C53175AD681FC51ULL,0x0000},0x0000},
+	{FOP_FADD,0x047F,{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST32,0x007F,{0x8000000000000000ULL,0xFFFF},{0x8923D0D91421E1E5ULL,0x4047},{0x00000000FF800000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0E7F,{0xB8E697272A4A06E6ULL,0x4018},{0x9C0BDE1A1ED5523EULL,0x3FCA},{0x0000000048470620ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0x0000000000000000ULL,0x8000},{0x000003FD7C13A39DULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST32,0x077F,{0x86851466A5310A22ULL,0x3FD2},{0xEB23CCF7C511D089ULL,0x4012},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0E7F,{0x90C41817EB108F74ULL,0xBFF4},{0xC368BE18C1D91DEDULL,0xC021},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x067F,{0x96ED071677F45E21ULL,0x7FFF},{0x8193DE00302F8609ULL,0x3FED},{0xD6ED071677F45E21ULL,0x7FFF},0x0000},
+	{FOP_FSCALE,0x007F,{0xA0E915044B7B1020ULL,0x3FB6},{0x0000000000000000ULL,0x8000},{0xA0E915044B7B1020ULL,0x3FB6},0x0000},
+	{FOP_FBST,0x027F,{0xB668681A560D804FULL,0x3FEF},{0xD8AAC2899F85AC75ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x067F,{0x0000000000000000ULL,0x0000},{0xFAAC2B6087C28480ULL,0x401D},{0xFAAC2B6087C28800ULL,0xC01D},0x0000},
+	{FOP_FBST,0x067F,{0x81A818AA55166774ULL,0x3FC5},{0x90879622AA374763ULL,0x403E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0x0000000112700FADULL,0x8000},{0x8C946DD924C6E48EULL,0x0028},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x0E7F,{0xCF03B0BA1B896A30ULL,0xC00B},{0x00000F433E5C999DULL,0x8000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x037F,{0xFD2B15396E03251FULL,0xC018},{0x8000000000000000ULL,0xFFFF},{0xFFFFFFFFFC0B53ABULL,0x0000},0x0000},
+	{FOP_FIST64,0x0C7F,{0xF990000000000000ULL,0xC007},{0xD6FBB75322292C3BULL,0xC008},{0xFFFFFFFFFFFFFE0DULL,0x0000},0x0000},
+	{FOP_FADD,0x0A7F,{0xD799C6B586A57352ULL,0x8003},{0xD799C6B586A57352ULL,0xC03B},{0xD799C6B586A57000ULL,0xC03B},0x0000},
+	{FOP_FIST64,0x0E7F,{0x9215DF931512C760ULL,0xBFF8},{0x845FD94C11B2F817ULL,0xC04D},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x087F,{0xFF40000000000000ULL,0xBFFB},{0x00000021ACCCD73FULL,0x8000},{0x00000000BDFF4000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x027F,{0xECDE97DFFA88716DULL,0xC049},{0xA257FB2B7B6C43F2ULL,0xBFD3},{0x9419E7439958B8D6ULL,0xC013},0x0400},
+	{FOP_FDIV,0x0A7F,{0xCBEB573E009C70B8ULL,0xBFBD},{0xE1A4CCC4FFBA2B9AULL,0x3FC9},{0xE75A5918E9AB2800ULL,0xBFF2},0x0000},
+	{FOP_FSQRT,0x087F,{0x8F70254870FD3424ULL,0x4027},{0xBF50AF68FD02BCF6ULL,0x402E},{0x877FD60000000000ULL,0x4013},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0xBB20000000000000ULL,0x3FFE},{0xF48E10F76485DC5FULL,0xC006},{0x8000000000000000ULL,0x3FFF},0x0000},
+	{FOP_FXAM,0x087F,{0xD45F3DFB4FE8C56BULL,0x7FFF},{0xC951E9D1F9179F65ULL,0x7FFF},{0xD45F3DFB4FE8C56BULL,0x7FFF},0x0100},
+	{FOP_FIST32,0x047F,{0x0000000000000000ULL,0x8000},{0xDB832B73634F94A5ULL,0x4035},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0E7F,{0xAD9B8D245BD3045BULL,0x3FFC},{0xAD9B8D245BD3045BULL,0x7FFF},{0xED9B8D245BD3045BULL,0x7FFF},0x0000},
+	{FOP_FST64,0x0F7F,{0xAA6370054815F4B4ULL,0x0003},{0xF63380DE43287A8AULL,0xC03D},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0A7F,{0xDF80000000000000ULL,0xC00A},{0x0000000000000000ULL,0x8000},{0xFFFFFFFFFFFFF208ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0F7F,{0xEDE0000000000000ULL,0x4005},{0xF40432FBB93E5116ULL,0xBFD4},{0xB4578AF0B5FD4510ULL,0x3FD2},0x4000},
+	{FOP_FPREM1,0x0F7F,{0xB27EFDB9D4F480FDULL,0x4024},{0xF6AEB9889262C1A7ULL,0xBFC2},{0xCA181CAF121A6D22ULL,0x4002},0x0400},
+	{FOP_FRNDINT,0x0B7F,{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FMUL,0x047F,{0xE1CBE024242AF6A3ULL,0x3FDB},{0xE1CBE024242AF6A3ULL,0xFFC7},{0xC728030000000000ULL,0xFFA4},0x0000},
+	{FOP_FIST32,0x037F,{0xEFC4CCB73C18A45EULL,0xC015},{0xAF45E77266DE7A47ULL,0x404A},{0x00000000FF881D9AULL,0x0000},0x0000},
+	{FOP_FIST32,0x0F7F,{0xE16BB1547F666465ULL,0x7FFF},{0x8E2C3D0C383A808AULL,0x3FF1},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x027F,{0x8000000000000000ULL,0x7FFF},{0xD310A734B9369D2FULL,0xBC02},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x007F,{0x9BB234057B6DA91CULL,0x403C},{0x984F5BAE946CF443ULL,0x7FFF},{0xC7A52B0000000000ULL,0x401D},0x0000},
+	{FOP_FADD,0x0F7F,{0xFA20000000000000ULL,0xC007},{0xC900000000000000ULL,0x3FFB},{0xFA13700000000000ULL,0xC007},0x0000},
+	{FOP_FSCALE,0x007F,{0x97D25D6653A09879ULL,0xBFCD},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x087F,{0xCF611B32ECEACB11ULL,0x8034},{0xCA2C6B182EAE1F5FULL,0x4011},{0xA3C69A0000000000ULL,0x8047},0x0000},
+	{FOP_FIST32,0x0E7F,{0x8000000000000000ULL,0x7FFF},{0xD3BA53DBA1EE985BULL,0x3FF6},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x027F,{0x0097E0A4C0EC644BULL,0x8000},{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSUB,0x0B7F,{0xBB54B08585C4C2C7ULL,0x4006},{0xDD48FB418637F071ULL,0x4022},{0xDD48FB35D0ECE818ULL,0xC022},0x0000},
+	{FOP_FIST32,0x087F,{0x94727C4C2481E791ULL,0xBFD6},{0xE7947110DF76BCABULL,0xC01E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x0B7F,{0xB570EEA93C1E859BULL,0x3FB3},{0xB570EEA93C1E859BULL,0x802D},{0x000000010131C69AULL,0x8000},0x0000},
+	{FOP_FXAM,0x077F,{0xAEC46B145779A227ULL,0xBFE8},{0xACA141BA96567DD1ULL,0xC039},{0xAEC46B145779A227ULL,0xBFE8},0x0600},
+	{FOP_FDIV,0x0B7F,{0x8387538B5736E970ULL,0x3FD4},{0xFD144D26E2A658BEULL,0xC03C},{0x850BEA43080C8600ULL,0xBF96},0x0000},
+	{FOP_FIST32,0x077F,{0x8000000000000000ULL,0x7FFF},{0xAF275226E915A277ULL,0xBFC7},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0F7F,{0x000000007431DD6BULL,0x8000},{0x00000F1BE41B0089ULL,0x0000},{0x000000007431DD6BULL,0x8000},0x0000},
+	{FOP_FSCALE,0x0F7F,{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FST32,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0xD0776D57866FE499ULL,0xBFD5},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FADD,0x0F7F,{0x00418906F14BB5DDULL,0x0000},{0x80418906F14BB5DDULL,0x4009},{0x80418906F14BB5DDULL,0x4009},0x0000},
+	{FOP_FST32,0x077F,{0x8A584AC3E30D0323ULL,0x3FFF},{0x000000021290EC21ULL,0x8000},{0x000000003F8A584AULL,0x0000},0x0000},
+	{FOP_FXAM,0x0E7F,{0xF9EF3A134B0FBDE5ULL,0xBFE1},{0x062365E4816161C5ULL,0x0000},{0xF9EF3A134B0FBDE5ULL,0xBFE1},0x0600},
+	{FOP_FDIV,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0xD4AB5C38DAA4366EULL,0x4011},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FBST,0x0F7F,{0x901755862E52B275ULL,0x3FF5},{0xFEA59699C2A484E2ULL,0xBFDE},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0F7F,{0x9266DDFE72FE1B52ULL,0x404A},{0xBE3AE7CF3AA5E36EULL,0x400B},{0x9266DDFE72FE1B50ULL,0x404A},0x0000},
+	{FOP_FIST32,0x077F,{0xEA599844F37FE96CULL,0x7FCA},{0xB829F29AC92C8547ULL,0x0040},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x087F,{0xD48FFF6FC72B111EULL,0x3FEA},{0xC2FD8281271EE137ULL,0x3FDB},{0xD491860000000000ULL,0x3FEA},0x0000},
+	{FOP_FADD,0x0F7F,{0x9A62641A8AC2F22BULL,0x7FFF},{0x844BEE5CC982411CULL,0x3FEF},{0xDA62641A8AC2F22BULL,0x7FFF},0x0000},
+	{FOP_FXAM,0x0E7F,{0xAECE45162BF23220ULL,0x4028},{0xCB80000000000000ULL,0xC008},{0xAECE45162BF23220ULL,0x4028},0x0400},
+	{FOP_FSUB,0x0C7F,{0xD95A0D7806552142ULL,0xBFDD},{0x857B9CAFAB26BCD8ULL,0xC400},{0x857B9C0000000000ULL,0x4400},0x0000},
+	{FOP_FIST64,0x0F7F,{0x9ABDE786EFEBA0A0ULL,0x4024},{0x80E0000000000000ULL,0xC008},{0x00000026AF79E1BBULL,0x0000},0x0000},
+	{FOP_FPREM1,0x027F,{0xAAB728903B04E713ULL,0x7FFF},{0xBC571FADABF09FFCULL,0xBFF0},{0xEAB728903B04E713ULL,0x7FFF},0x0000},
+	{FOP_FADD,0x067F,{0xA7F84ED5EA7DC144ULL,0xBFD7},{0xEF67457C7ED01599ULL,0x7FFF},{0xEF67457C7ED01599ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x087F,{0x92D5D274BBFBC119ULL,0x7FD8},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x0A7F,{0xB06082AF269B2415ULL,0xBFFB},{0xED9D7534A4490189ULL,0x7FC5},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0B7F,{0xD597C60F07986424ULL,0xBFB3},{0xE3BDA16AA5899EE2ULL,0x3FC6},{0xD597C60F07986424ULL,0xBFB3},0x0600},
+	{FOP_FST64,0x0E7F,{0xF0CD427FC8DB09FEULL,0x404E},{0xD89776E5FF3275C0ULL,0xFFE9},{0x44EE19A84FF91B61ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x037F,{0x0000000000000000ULL,0x0000},{0xE3049897F2D6131CULL,0x403E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x037F,{0xC2F7E4C0F3908517ULL,0x3FF1},{0xA76DB09ABEA9BC85ULL,0x4032},{0xC2F7E4C0F3908517ULL,0x3FF1},0x0000},
+	{FOP_FST64,0x0A7F,{0x8F383BA101CFEF67ULL,0xBF81},{0xE37AFFDA2CBDD2DAULL,0xBFEE},{0xB811E707742039FDULL,0x0000},0x0000},
+	{FOP_FMUL,0x0F7F,{0x8000000000000000ULL,0xFFFF},{0x83A6D969C9F930ACULL,0xBFB0},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FPREM1,0x047F,{0x87754E3B78FD5522ULL,0xBFF8},{0x87754E3B78FD5522ULL,0xBFC6},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST32,0x0A7F,{0xDC00310C9E1A5F9CULL,0x4010},{0x00028E13B1DFFD53ULL,0x8000},{0x00000000485C0032ULL,0x0000},0x0000},
+	{FOP_FADD,0x0B7F,{0x98817F82D955A37AULL,0x3FF6},{0xE81AB20CF53E8901ULL,0xC035},{0xE81AB20CF53E88FFULL,0xC035},0x0000},
+	{FOP_FRNDINT,0x037F,{0x84E6E9EEE2B9B563ULL,0x7FFF},{0xC388F997CBFCCE8AULL,0x3FE0},{0xC4E6E9EEE2B9B563ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x047F,{0xEFED6F9081FEDD7FULL,0xBFB4},{0xA5702895AC39CC24ULL,0xBFFE},{0xA570280000000000ULL,0x3FFE},0x0000},
+	{FOP_FST32,0x087F,{0xE4E83194398A9FD9ULL,0x7FFF},{0x0000000000000000ULL,0x8000},{0x000000007FE4E831ULL,0x0000},0x0000},
+	{FOP_FST32,0x0C7F,{0xA2F902D2D6C373E3ULL,0xC003},{0xC84A37F0D83225EAULL,0xBFE7},{0x00000000C1A2F902ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0A7F,{0x9F418F6D7B237F5BULL,0x4026},{0xAB07BD7E49AA766AULL,0xC005},{0x0000009F418F6D7CULL,0x0000},0x0000},
+	{FOP_FSCALE,0x077F,{0xDB8E655573B55627ULL,0xBFFC},{0xFA8BB4EE0ED06E45ULL,0x4006},{0xDB8E655573B55627ULL,0xC0F6},0x0000},
+	{FOP_FPREM1,0x0F7F,{0x8692C8DF2EA9E46BULL,0xFFFF},{0xA120B0ECD0984532ULL,0xBFCB},{0xC692C8DF2EA9E46BULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0C7F,{0x000284C0257A8D07ULL,0x0000},{0xFC1B62C71832D626ULL,0x4019},{0x000284C0257A8D07ULL,0x0000},0x4400},
+	{FOP_FST64,0x037F,{0xD990000000000000ULL,0xC006},{0x0000025811D63C39ULL,0x0000},{0xC06B320000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x027F,{0xAAEE7DA64E032E6BULL,0x3FDD},{0x8571BB687188EEA6ULL,0xC02E},{0xAAEE7DA64E032E6BULL,0x3FDD},0x0000},
+	{FOP_FBST,0x0E7F,{0x94B8BAF47F215BE7ULL,0xBFDF},{0x0000000384A2CE85ULL,0x8000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST64,0x087F,{0x8A8CE577D263C2A6ULL,0x4041},{0xB180114C46989B98ULL,0x3FFE},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x047F,{0x9230000000000000ULL,0x4002},{0x054AC83165D0A0F5ULL,0x8000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xAC12C02676D93F8DULL,0x3FF4},{0xDA578655F933107BULL,0xFFC3},{0xAC12C02676D93F8DULL,0x3FF4},0x0000},
+	{FOP_FST64,0x0C7F,{0x8000000000000000ULL,0xFFFF},{0xB5A7B036B7832D26ULL,0x8040},{0xFFF0000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x007F,{0x0000000000000000ULL,0x8000},{0xBA490048D249E068ULL,0x4030},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FBST,0x027F,{0xB306001913A62AFBULL,0x402E},{0x8000000000000000ULL,0x7FFF},{0x0196838352819110ULL,0x0000},0x0000},
+	{FOP_FST64,0x0C7F,{0xBF84C7384B1105A9ULL,0x3FE8},{0xDCE5BDFB800FA296ULL,0xC007},{0x3E87F098E7096220ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x007F,{0xF07D54E406DECB14ULL,0xC01D},{0xD65D0D558905436EULL,0x3FBD},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x037F,{0x8000000000000000ULL,0xFFFF},{0x923D7ACB91E48B59ULL,0xBFBD},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x027F,{0xBDE750112B466783ULL,0xC040},{0xC531C968FF821BA6ULL,0x3FB8},{0xF688EC5F41F89000ULL,0xC086},0x0000},
+	{FOP_FDIV,0x047F,{0xAD8A5C6FA6F662ECULL,0x4047},{0xFF54AE37B8D554BEULL,0x3FBF},{0xADFECD0000000000ULL,0x4086},0x0000},
+	{FOP_FPREM1,0x037F,{0x0000000000000000ULL,0x0000},{0xB10A366E8F3C6C2DULL,0xFFFF},{0xF10A366E8F3C6C2DULL,0xFFFF},0x0000},
+	{FOP_FADD,0x0E7F,{0xA41345615B5F64FEULL,0x404B},{0x95DCB4BBEA3936DEULL,0xBFB2},{0xA41345615B5F6000ULL,0x404B},0x0000},
+	{FOP_FSQRT,0x0A7F,{0xDF867A2888A57B69ULL,0x400E},{0xF6D45074E7872D39ULL,0x3FF8},{0xEF3652D09917E800ULL,0x4006},0x0000},
+	{FOP_FPREM,0x077F,{0x96C0000000000000ULL,0xC008},{0xAF6A84F2816B9A08ULL,0x3FBC},{0x9B6484AA50C54308ULL,0xBFDC},0x0400},
+	{FOP_FIST64,0x077F,{0x880A8F03E4BAFD36ULL,0x403A},{0xE310000000000000ULL,0xC005},{0x0880A8F03E4BAFD3ULL,0x0000},0x0000},
+	{FOP_FDIV,0x077F,{0xD5E2B9335A5FD271ULL,0xC04D},{0xD0AEA73C8D6D8618ULL,0x3FB2},{0x83310E3896BC62A4ULL,0xC09A},0x0000},
+	{FOP_FBST,0x0C7F,{0xCE0BDC5705ADB477ULL,0x403E},{0x935F44DE835BDEBCULL,0xBFB4},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0B7F,{0xAA6602A72C68207EULL,0x3FCE},{0xB790000000000000ULL,0xC008},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FXAM,0x0B7F,{0xF977F616711BCC4CULL,0xFFF6},{0x8000000000000000ULL,0x7FFF},{0xF977F616711BCC4CULL,0xFFF6},0x0600},
+	{FOP_FIST32,0x0F7F,{0x0000962226368E7DULL,0x8000},{0x8000962226368E7DULL,0x403E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0F7F,{0xE49813C63AF4B676ULL,0xC013},{0xBE2D2C176E57F9C0ULL,0x4011},{0x99DB790166EFCAE2ULL,0xC001},0x0000},
+	{FOP_FST32,0x0F7F,{0x98F8C9D0399BEF11ULL,0xC016},{0xFE49DDC6FBD6D8FEULL,0xBFE2},{0x00000000CB18F8C9ULL,0x0000},0x0000},
+	{FOP_FPREM,0x077F,{0xE13D73EF275E7DAFULL,0x3FC7},{0xEA989225635DC72BULL,0xC015},{0xE13D73EF275E7DAFULL,0x3FC7},0x0000},
+	{FOP_FIST32,0x087F,{0xF0C7C2D79B31B5B9ULL,0x4025},{0xCAD98A368879C8D9ULL,0xC013},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x087F,{0xB5CDDC77C6245196ULL,0xC00D},{0x0000BF1188FF4FE7ULL,0x0000},{0xFFFFFF0000000000ULL,0xFFFE},0x0000},
+	{FOP_FPREM1,0x0B7F,{0x0000000000000000ULL,0x0000},{0xBEA0000000000000ULL,0x3FFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x067F,{0xDAE36858CAE6062CULL,0xC00C},{0x90095512EFC240A7ULL,0xBFB3},{0xF64FCADC9FC77800ULL,0x3FC0},0x0000},
+	{FOP_FIST32,0x0A7F,{0xF14E57ED4DCEACB4ULL,0xC01A},{0x0000000000000000ULL,0x8000},{0x00000000F0EB1A82ULL,0x0000},0x0000},
+	{FOP_FSUB,0x087F,{0xDC2FF2936DCDF60DULL,0x400F},{0x0000000000000000ULL,0x8000},{0xDC2FF30000000000ULL,0x400F},0x0000},
+	{FOP_FPREM1,0x087F,{0x88D2EFA771EAC3B4ULL,0x4021},{0xA32EFA75F06CECE5ULL,0x4028},{0x88D2EFA771EAC3B4ULL,0x4021},0x0000},
+	{FOP_FRNDINT,0x0E7F,{0xB8BF404A46732A31ULL,0xBFFB},{0xFFC18D2982F5C97BULL,0xC040},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x007F,{0xDF44DFDA53404D25ULL,0x4031},{0xF08C54053B95E963ULL,0xC011},{0xDF44DFDA53404D25ULL,0x4031},0x0400},
+	{FOP_FMUL,0x087F,{0x8B563CA6D4998227ULL,0x402F},{0x90387DA2EE0A7EE4ULL,0x403F},{0x9CFE830000000000ULL,0x406F},0x0000},
+	{FOP_FMUL,0x037F,{0xB05F436DDE6361F4ULL,0xC005},{0xA3F810CF9DD5A7DFULL,0x3FCD},{0xE1EF1F9A8A09754FULL,0xBFD3},0x0000},
+	{FOP_FMUL,0x067F,{0xA495B6245876DE8CULL,0x4025},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FBST,0x0F7F,{0x8E061FA5F3A3A2CDULL,0x7FFF},{0xBD60000000000000ULL,0xC005},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x067F,{0xF1213635AB100506ULL,0xC02D},{0x0000000000000000ULL,0x8000},{0xF1213635AB100506ULL,0xC02D},0x0600},
+	{FOP_FPREM,0x0B7F,{0xE4948DEFD003B81BULL,0xC00B},{0x8000000000000000ULL,0x7FFF},{0xE4948DEFD003B81BULL,0xC00B},0x0000},
+	{FOP_FST64,0x047F,{0x8000000000000000ULL,0x7FFF},{0xB3FE5CD774F49C45ULL,0xC017},{0x7FF0000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0C7F,{0xB5F0000000000000ULL,0xC008},{0xBA7B88C2A7160313ULL,0x3FFD},{0x0000000000000727ULL,0x8000},0x0000},
+	{FOP_FSUB,0x047F,{0xC1FA25762FC05C5CULL,0x4044},{0xB0424499E2F206D1ULL,0xFFF8},{0xB042440000000000ULL,0x7FF8},0x0000},
+	{FOP_FST64,0x067F,{0x8F4E5D1759773341ULL,0x3FF4},{0x9BE0000000000000ULL,0xBFFE},{0x3F41E9CBA2EB2EE6ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xB1C7425EE8113D98ULL,0x403A},{0x00643759876FD55FULL,0x0000},{0xB1C7425EE8113D98ULL,0x403A},0x0000},
+	{FOP_FBST,0x0B7F,{0x94B57D1759E7931CULL,0xC038},{0xAEDC10BE35BB5DBBULL,0xC01A},{0x7431381681937996ULL,0x8016},0x0000},
+	{FOP_FBST,0x0C7F,{0xE009A64B4CD5294BULL,0x803A},{0xF5EE00B08AFB53CCULL,0x4033},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSUB,0x007F,{0xA06E00126DE274A4ULL,0xBFD4},{0x000052C36A89CDDBULL,0x8000},{0xA06E000000000000ULL,0xBFD4},0x0000},
+	{FOP_FMUL,0x067F,{0xD48DAF27CC4ECDF3ULL,0x3FCE},{0xCCA1D5D33562151EULL,0xC002},{0xA9E746381EAC9000ULL,0xBFD2},0x0000},
+	{FOP_FPREM1,0x0E7F,{0xE1219FED895686E3ULL,0x3C02},{0xA43251EE2FFB7BD9ULL,0x7FFF},{0xE43251EE2FFB7BD9ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x067F,{0x97512F64650B716BULL,0xFFFF},{0xCC6AE921B89EB146ULL,0x4008},{0xD7512F64650B716BULL,0xFFFF},0x0000},
+	{FOP_FRNDINT,0x047F,{0xF71F6D03CD574BDCULL,0x3FE8},{0xF71F6D03CD574BDCULL,0xBFF6},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x037F,{0xD0CE4AF9ABB5E011ULL,0xBFF4},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x047F,{0xD125C4265D872E36ULL,0xC07E},{0x0000000000000000ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x0F7F,{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x8000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x0F7F,{0x8000000000000000ULL,0x7FFF},{0x95D6260173D3FFCAULL,0x4011},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FBST,0x037F,{0x8A819266A16CCE00ULL,0x43FD},{0x96715E8809A00B58ULL,0x4030},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FADD,0x077F,{0xF7517D28C6763B12ULL,0xBFEB},{0xAC3C40A5213EE491ULL,0xBFBF},{0xF7517D28C680FED7ULL,0xBFEB},0x0000},
+	{FOP_FST32,0x0E7F,{0xFB41C2092318B2A9ULL,0xC03E},{0xB5DB9A191583F3F5ULL,0xBFC4},{0x00000000DF7B41C2ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x037F,{0xB131A6ADB9648FBFULL,0xC07D},{0xCDD0000000000000ULL,0x4001},{0xB131A6ADB9648FBFULL,0xC07D},0x0000},
+	{FOP_FPREM,0x087F,{0x8000000000000000ULL,0xFFFF},{0xE3D6BC663F1EEF2BULL,0xC080},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x027F,{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0A7F,{0xA95C874B0F0A89B1ULL,0xBFBC},{0xB3475DF4C7CF8088ULL,0x4028},{0xA95C874B0F0A89B1ULL,0xBFBC},0x0000},
+	{FOP_FSCALE,0x047F,{0xD6B59B4F5E5D3D81ULL,0xBFFD},{0xB2D5C31DDC72EE86ULL,0x4002},{0xD6B59B4F5E5D3D81ULL,0xC008},0x0000},
+	{FOP_FDIV,0x027F,{0xD39A66B976EC2AFFULL,0xBF81},{0xEA7F49666922912FULL,0x3FFA},{0xE701AFC20E369000ULL,0xBF85},0x0000},
+	{FOP_FMUL,0x0E7F,{0xEA86F04A2572ABADULL,0x4047},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x0A7F,{0xEBA7540225C586B1ULL,0x400B},{0xAEF4EE4854830D16ULL,0x403F},{0xADAD4908595A7800ULL,0x4005},0x0000},
+	{FOP_FMUL,0x0C7F,{0xC63D2BA30A663AE7ULL,0x400E},{0xD20E0E516B40D1D3ULL,0x4040},{0xA2A9100000000000ULL,0x4050},0x0000},
+	{FOP_FIST32,0x0B7F,{0xE533475EB6C8B7F2ULL,0x4043},{0xA2421A25C1DF9E66ULL,0x4049},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x027F,{0x9F66B016E5E68024ULL,0xFFFE},{0xC0168EF9A8F525BDULL,0xC023},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x047F,{0xCAB31FB681F4E994ULL,0x3FD2},{0x8DFAB92F8139BC40ULL,0x4006},{0xCAB31FB681F4E994ULL,0x405F},0x0000},
+	{FOP_FDIV,0x047F,{0xEC00000000000000ULL,0xBFFD},{0xEEDE3504A7A2C65BULL,0xBFB5},{0xFCED220000000000ULL,0x4046},0x0000},
+	{FOP_FSQRT,0x047F,{0xE57999B41FA120F3ULL,0xBFDB},{0xD7498188886EF4B4ULL,0xC02C},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0F7F,{0x8A138F47849945FAULL,0xC042},{0xC5432C65B9345C42ULL,0xBFBA},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x087F,{0xF1A07F77B79AAA50ULL,0xBFCD},{0xFBEE3C45B0B6CCB6ULL,0x401D},{0xEDC9390000000000ULL,0xBFEC},0x0000},
+	{FOP_FST64,0x0C7F,{0xBF9832AC0078670AULL,0xBC03},{0x8F90000000000000ULL,0xC002},{0x8037F30655800F0CULL,0x0000},0x0000},
+	{FOP_FST32,0x0B7F,{0xDA8EF69B0FE74215ULL,0x3FCD},{0xF88A9A5653C9B976ULL,0xFFF1},{0x0000000026DA8EF7ULL,0x0000},0x0000},
+	{FOP_FST32,0x007F,{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x007F,{0xE42DBFF3A9A5755AULL,0xC01D},{0x84B4867E1B12C433ULL,0x7FFF},{0xC4B4867E1B12C433ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x007F,{0x8000000000000000ULL,0x7FFF},{0xA63EA511A10377BFULL,0x7FFC},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0x97B8A498665F04ADULL,0xC03E},{0x0000000000000000ULL,0x8000},{0x97B8A498665F04ADULL,0xC03E},0x0000},
+	{FOP_FMUL,0x0A7F,{0xAC7A45207F18DEAFULL,0xBFB0},{0xF46FE2D30E855FE9ULL,0xFFDD},{0xA4AFEBB915D10800ULL,0x7F8F},0x0000},
+	{FOP_FPREM1,0x0F7F,{0xCAE1A95186BD6034ULL,0xC03E},{0x8000000000000000ULL,0x7FFF},{0xCAE1A95186BD6034ULL,0xC03E},0x0000},
+	{FOP_FSUB,0x077F,{0xBA80000000000000ULL,0xBFFB},{0xC72BC7C5C5BC7DACULL,0x3FFA},{0x8F0AF1F1716F1F6BULL,0xBFFC},0x0000},
+	{FOP_FST32,0x007F,{0xE10071C00838CDDCULL,0x3FF2},{0x0000000000000000ULL,0x8000},{0x0000000039610072ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0B7F,{0xBC2FB73D93C63979ULL,0x3FCF},{0x8967FF59A71067FFULL,0xC001},{0xAF4DD04371B2FC6AULL,0xBFCD},0x0000},
+	{FOP_FIST64,0x067F,{0xBFA71B03C42FE961ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0E7F,{0xD79BF76907AEB992ULL,0xC02D},{0xE156358D5B1F09BEULL,0xC038},{0xFFFF9432044B7C29ULL,0x0000},0x0000},
+	{FOP_FXAM,0x0B7F,{0x894DC9863FDF26B8ULL,0x3FE6},{0xA6CCAC98D8A153D7ULL,0xBFC3},{0x894DC9863FDF26B8ULL,0x3FE6},0x0400},
+	{FOP_FST32,0x067F,{0x8330000000000000ULL,0x3FFF},{0xB6A86E80D47E54BCULL,0xC03C},{0x000000003F833000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0B7F,{0xF8060043B9C9B4C4ULL,0x3FEC},{0xAAD5E0AE4ECD120EULL,0x403F},{0xAAD5E0AE4ECD120DULL,0xC03F},0x0000},
+	{FOP_FMUL,0x0E7F,{0xDE3CDF55FF1DEA7EULL,0xBFB4},{0xAFBD8CFCDA627E4DULL,0x3FFC},{0x98902A0177870000ULL,0xBFB2},0x0000},
+	{FOP_FMUL,0x027F,{0xB890000000000000ULL,0xC004},{0xAB6A65F81D77D452ULL,0x401D},{0xF729CA47617D6800ULL,0xC022},0x0000},
+	{FOP_FST32,0x007F,{0xC1621F15D29F34F5ULL,0x7FC3},{0xE54D9C350FA1BD50ULL,0x8015},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0C7F,{0xC92C94102E798127ULL,0x7FFF},{0xE0131E6AF81DEF25ULL,0x404B},{0x000000007FC92C94ULL,0x0000},0x0000},
+	{FOP_FIST64,0x087F,{0xF761C24EAA2C9E9AULL,0xFFC8},{0xCAFCD82F6EDB0AB3ULL,0xFFD3},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0A7F,{0xA7121EDF7DF81BDBULL,0xBFC1},{0x9689A3B1FD058B0EULL,0x4002},{0xA7121EDF7DF81BDBULL,0xBFCA},0x0000},
+	{FOP_FSUB,0x077F,{0xA138E918BF6515B5ULL,0x3FD2},{0xBFE664491E80C23EULL,0x4030},{0xBFE664491E80C23EULL,0xC030},0x0000},
+	{FOP_FADD,0x0C7F,{0xCF70000000000000ULL,0x4002},{0xE28D07480EE0E93BULL,0x7FFF},{0xE28D07480EE0E93BULL,0x7FFF},0x0000},
+	{FOP_FMUL,0x0C7F,{0xA9E47216D3729965ULL,0x3FB1},{0xE8277273CB4929A7ULL,0x7FFF},{0xE8277273CB4929A7ULL,0x7FFF},0x0000},
+	{FOP_FADD,0x037F,{0x8C6271D3095E2F1FULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},{0xCC6271D3095E2F1FULL,0x7FFF},0x0000},
+	{FOP_FPREM1,0x037F,{0xE6D0000000000000ULL,0xBFFB},{0xDA5ED6D1901264F3ULL,0x7FEC},{0xE6D0000000000000ULL,0xBFFB},0x0000},
+	{FOP_FSUB,0x027F,{0xF218728FF57C39CBULL,0x3FD0},{0xD264666A8B882EFEULL,0x0012},{0xF218728FF57C3800ULL,0x3FD0},0x0000},
+	{FOP_FDIV,0x067F,{0xF44A31E0FCB123ABULL,0x7FFF},{0xDC718F5EDED54BF3ULL,0xC07F},{0xF44A31E0FCB123ABULL,0x7FFF},0x0000},
+	{FOP_FMUL,0x047F,{0x8000000000000000ULL,0xFFFF},{0xEBD34A6E514FEF01ULL,0x403F},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0C7F,{0xF1EB2548BD07D2C9ULL,0xC400},{0xEBDB2B4F58E30ED6ULL,0xC04A},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x007F,{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FADD,0x047F,{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST32,0x087F,{0xF562B86F6F866258ULL,0x3FDB},{0x000058115C72007BULL,0x8000},{0x000000002DF562B9ULL,0x0000},0x0000},
+	{FOP_FDIV,0x027F,{0x9D30000000000000ULL,0xC009},{0x971CEDCBDE1CDBB9ULL,0x3FDB},{0x8525385F867D3800ULL,0xC02D},0x0000},
+	{FOP_FXAM,0x0A7F,{0xFD6D63F9F3574570ULL,0x4043},{0x80DB0FECC5F9109FULL,0xBFC4},{0xFD6D63F9F3574570ULL,0x4043},0x0400},
+	{FOP_FBST,0x0C7F,{0x028D828C815E6FB3ULL,0x0000},{0xB974E917AE957CBCULL,0x4039},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x087F,{0xB5A09B4DFFEC2D09ULL,0xBFD5},{0x8416A88E71EF41BDULL,0x7FFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0A7F,{0xFF242258168CE20FULL,0x402E},{0xFF242258168CE20FULL,0xC005},{0xFF242258168CE20FULL,0x3FAF},0x0000},
+	{FOP_FIST32,0x0C7F,{0xC605DA51D4B75A36ULL,0x3FDD},{0x90C983023593B996ULL,0x403E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x047F,{0x891F0580DC4B0BB7ULL,0x7FFF},{0xAC554A95A5FAEAD6ULL,0xC3FF},{0xC91F0580DC4B0BB7ULL,0x7FFF},0x0000},
+	{FOP_FSQRT,0x047F,{0xDBCA93F63F3EB2ADULL,0x7FFF},{0x0CA52E7DB43905D7ULL,0x8000},{0xDBCA93F63F3EB2ADULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x067F,{0x8F6FF1865ABE2C09ULL,0x4400},{0xCB21F95A755AE8BFULL,0x7FFF},{0xCB21F95A755AE8BFULL,0x7FFF},0x0000},
+	{FOP_FBST,0x0E7F,{0xE045A34F51A90279ULL,0x3FD3},{0xED3F7C43D45CFE18ULL,0xC045},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x037F,{0x873BE4790D2BCDC3ULL,0x4025},{0x98E7EC62C8184437ULL,0xC003},{0x873BE4790D2BCDC3ULL,0x4012},0x0000},
+	{FOP_FSUB,0x047F,{0xB783E270B27D7556ULL,0xBFB3},{0xC47BD2B3FB981905ULL,0x403D},{0xC47BD30000000000ULL,0xC03D},0x0000},
+	{FOP_FPREM1,0x077F,{0xEE977EA529381E95ULL,0x7FFF},{0x858AE63370D9F835ULL,0x401A},{0xEE977EA529381E95ULL,0x7FFF},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xFE3180E78B85B9D1ULL,0xC01C},{0xEAFC5EA3C42188D7ULL,0xC005},{0xFE3180E78B85B9D1ULL,0xBFA7},0x0000},
+	{FOP_FST32,0x0B7F,{0xF980DEB4289B9C7FULL,0x8037},{0xDB52DA6203CDD7CDULL,0x3FC3},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0F7F,{0xE3CA5A78382C897AULL,0x3FB9},{0xF0F24DC110045DE4ULL,0xC04D},{0xF205A1BF0B3DE4E6ULL,0xBF6A},0x0000},
+	{FOP_FRNDINT,0x0C7F,{0xFADFFB7933A3AD81ULL,0xC012},{0x81F773449C6755EBULL,0xBC01},{0xFADFF00000000000ULL,0xC012},0x0000},
+	{FOP_FPREM1,0x0F7F,{0xB32B87713B7554F3ULL,0x407D},{0x936BB7B956004B97ULL,0x3FB0},{0x8B1C022CA550557EULL,0x4050},0x0400},
+	{FOP_FPREM1,0x0E7F,{0xBE40C4DD7DBDC1B0ULL,0x803F},{0x8B3FB3AA541B2CEFULL,0xC007},{0xBE40C4DD7DBDC1B0ULL,0x803F},0x0000},
+	{FOP_FPREM,0x0E7F,{0xE69FEEFD734828FDULL,0x3C01},{0x8934146E7C83E7F2ULL,0x3FBB},{0xE69FEEFD734828FDULL,0x3C01},0x0000},
+	{FOP_FST32,0x037F,{0xADFAAD52724AFE3AULL,0xBFE6},{0xEFF20C1BE05E1F43ULL,0x402B},{0x00000000B32DFAADULL,0x0000},0x0000},
+	{FOP_FSQRT,0x087F,{0xE138F68E82C8263AULL,0xC010},{0x9E1F8F211080C35CULL,0x3FB7},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FADD,0x0A7F,{0xF3FCD7D7C9CE29D4ULL,0x3FC7},{0xCF9965F007CDD803ULL,0x8033},{0xF3FCD7D7C9CE3000ULL,0x3FC7},0x0000},
+	{FOP_FIST64,0x0E7F,{0xEC4831B725A27589ULL,0xFFFF},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0C7F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0x7FFF},{0xFFF0000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x047F,{0x8A3EB4B349BFE607ULL,0x3FD8},{0xE420000000000000ULL,0x400A},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0A7F,{0x8000000000000000ULL,0xFFFF},{0xA2E5ABEE649C2462ULL,0x4000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0C7F,{0xE1AFC32F208FD68AULL,0x800C},{0x61AFC32F208FD68AULL,0x8000},{0xE1AFC32F208FD68AULL,0x800C},0x0600},
+	{FOP_FIST32,0x0B7F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0x7FFF},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x0A7F,{0xD8563BF6FA367822ULL,0x400C},{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x0F7F,{0x0000000000000000ULL,0x8000},{0x000003899038605DULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FADD,0x067F,{0x0000000000000000ULL,0x8000},{0xEFE7E01E6F61146CULL,0x4029},{0xEFE7E01E6F611000ULL,0x4029},0x0000},
+	{FOP_FPREM,0x047F,{0xF556D4EFD6AF424AULL,0xBFF9},{0xEF93667EE8CA4DC1ULL,0x7FFF},{0xEF93667EE8CA4DC1ULL,0x7FFF},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0xBF471934D0575784ULL,0xC02A},{0x99D80CF3108A7AD0ULL,0x3FC5},{0xBF471934D0500000ULL,0xC02A},0x0000},
+	{FOP_FXAM,0x0B7F,{0x8000000000000000ULL,0xFFFF},{0xFA0B028D510F5BA0ULL,0x4012},{0x8000000000000000ULL,0xFFFF},0x0700},
+	{FOP_FMUL,0x027F,{0xD57A6B071B4A664AULL,0xBFC3},{0x9BC0EF844035BF1CULL,0x4028},{0x81E202592570C000ULL,0xBFED},0x0000},
+	{FOP_FST32,0x047F,{0x8000000000000000ULL,0xFFFF},{0xDA710F71087D457EULL,0xC03B},{0x00000000FF800000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FADD,0x007F,{0xE246E7D6E93B2988ULL,0xBFBB},{0xE402134BEB076FBEULL,0xC03E},{0xE402130000000000ULL,0xC03E},0x0000},
+	{FOP_FXAM,0x077F,{0xEDD0000000000000ULL,0x3FFC},{0x0000006D486C0AF9ULL,0x8000},{0xEDD0000000000000ULL,0x3FFC},0x0400},
+	{FOP_FRNDINT,0x0F7F,{0xF9B0F0CB929DC0FFULL,0xC02A},{0x0000000032673855ULL,0x0000},{0xF9B0F0CB92900000ULL,0xC02A},0x0000},
+	{FOP_FDIV,0x047F,{0x00003D5230BA13E9ULL,0x8000},{0x887207C859EF523DULL,0xFFFF},{0xC87207C859EF523DULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x007F,{0xC7095246C5753826ULL,0x4026},{0x88AC1ACFF5425995ULL,0x3FDE},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x047F,{0xD8035CBAC11CEB70ULL,0xC049},{0xE1CC1EF02057D0D9ULL,0x4000},{0xD8035D0000000000ULL,0xC049},0x0000},
+	{FOP_FIST32,0x067F,{0xA6D2C9F1027E56E7ULL,0xBC02},{0xE303D719A5F7C6C9ULL,0xC00B},{0x00000000FFFFFFFFULL,0x0000},0x0000},
+	{FOP_FST32,0x007F,{0xAF05E0F0F06E86DDULL,0xBFD7},{0x85D8484E16E80AE6ULL,0xBFF0},{0x00000000ABAF05E1ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0B7F,{0xADE0000000000000ULL,0xC002},{0x0000000000000000ULL,0x8000},{0xFFFFFFFFFFFFFFF6ULL,0x0000},0x0000},
+	{FOP_FIST32,0x067F,{0x8BA88517FA4F3AD2ULL,0x403F},{0x9788F09A3AED3EB7ULL,0x4047},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x087F,{0xE307DF59857AD6CFULL,0xC006},{0x9CD9C8DD1D857DBCULL,0xFFEC},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x087F,{0xBC86ABA1D7AD1458ULL,0xC00F},{0xAC256C8A3731A650ULL,0xBFF9},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST64,0x037F,{0xC0266F4FB43EBCA8ULL,0xBFCC},{0x0000000000000000ULL,0x0000},{0xBCC804CDE9F687D8ULL,0x0000},0x0000},
+	{FOP_FADD,0x0F7F,{0xA666DE434876D214ULL,0xBFE8},{0xC5C271F57466556BULL,0xBFB0},{0xA666DE434876D2D9ULL,0xBFE8},0x0000},
+	{FOP_FMUL,0x087F,{0xD8CEA7908BA8904EULL,0x3FD9},{0xDFBB66815E00B9B4ULL,0xC008},{0xBD7AB90000000000ULL,0xBFE3},0x0000},
+	{FOP_FDIV,0x0B7F,{0xB4008D08919264D8ULL,0x4004},{0x864BC179B2FF172BULL,0x407E},{0xAB90402E2D56F2D3ULL,0x3F85},0x0000},
+	{FOP_FXAM,0x067F,{0x000004045C1AE767ULL,0x0000},{0x8000000000000000ULL,0xFFFF},{0x000004045C1AE767ULL,0x0000},0x4400},
+	{FOP_FSCALE,0x077F,{0xF6C498525C1BFC15ULL,0xC01D},{0xD266A4735BF867E7ULL,0x000C},{0xF6C498525C1BFC15ULL,0xC01D},0x0000},
+	{FOP_FIST64,0x067F,{0xD93F7FEAEE86B5EBULL,0xC07D},{0xC2F8EFF03FD68E13ULL,0xC028},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0F7F,{0x0000000000000000ULL,0x8000},{0xC87311D8E340DB7CULL,0xBFFD},{0xC87311D8E340DB7CULL,0x3FFD},0x0000},
+	{FOP_FST32,0x0E7F,{0xE5DFAB2D07FA6D70ULL,0xBFD4},{0xD953C31D87364325ULL,0xBFE8},{0x00000000AA65DFABULL,0x0000},0x0000},
+	{FOP_FIST32,0x007F,{0x000FDAD650170A0DULL,0x8000},{0x89010BE2A7DEE45CULL,0xC07E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x027F,{0x8000000000000000ULL,0x7FFF},{0xADACB29A440203D5ULL,0xFFFF},{0xEDACB29A440203D5ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x077F,{0xD31F290571C5915AULL,0xBFD0},{0x9752029DB730AABDULL,0x3FFB},{0xD31F290571C5915AULL,0xBFD0},0x0600},
+	{FOP_FSCALE,0x067F,{0x8B0223F1A0F8ADAFULL,0xBFEB},{0xF250000000000000ULL,0x4004},{0x8B0223F1A0F8ADAFULL,0xC027},0x0000},
+	{FOP_FSCALE,0x027F,{0xCCAB4312BDEB3FB6ULL,0xBFC3},{0xCCAB4312BDEB3FB6ULL,0x4005},{0xCCAB4312BDEB3FB6ULL,0xC029},0x0000},
+	{FOP_FMUL,0x0E7F,{0xDC5C2AD2F9CC9C61ULL,0x7FFF},{0xE07ADEA34E7ACDF4ULL,0x401C},{0xDC5C2AD2F9CC9C61ULL,0x7FFF},0x0000},
+	{FOP_FST64,0x067F,{0xA795FE1712B555BCULL,0xC044},{0xE461EFAFEB180FC5ULL,0x802A},{0xC444F2BFC2E256ABULL,0x0000},0x0000},
+	{FOP_FSUB,0x007F,{0x001ED5154D327923ULL,0x0000},{0x801ED5154D327923ULL,0x0006},{0x801DDE0000000000ULL,0x8006},0x0000},
+	{FOP_FSUB,0x077F,{0xC6DC551043B856CFULL,0xBFBE},{0xA637EB8733A3E2A4ULL,0x400A},{0xA637EB8733A3E2A5ULL,0xC00A},0x0000},
+	{FOP_FST32,0x037F,{0xF0AE97FBE8657CB3ULL,0x3FCF},{0xB79EFBA675ABF5B3ULL,0x4022},{0x0000000027F0AE98ULL,0x0000},0x0000},
+	{FOP_FIST64,0x067F,{0xDE7259483E396F45ULL,0x3FB8},{0x5E7259483E396F45ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0A7F,{0xE9321A3C64C46FC6ULL,0xBFFD},{0xD11D7904B985055AULL,0x4027},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x027F,{0xA9ACA90EAD239E48ULL,0xBFBD},{0x99A0EE1D080289ACULL,0x4002},{0xA9ACA90EAD239E48ULL,0xBFC6},0x0000},
+	{FOP_FPREM,0x0F7F,{0x8200000000000000ULL,0xC007},{0x000064C80A67D50BULL,0x8000},{0x882F75A901B60000ULL,0xBFD0},0x0400},
+	{FOP_FXAM,0x087F,{0xF49ECDCC09C470BFULL,0xC01C},{0xF5F99636A0D1C089ULL,0x404E},{0xF49ECDCC09C470BFULL,0xC01C},0x0600},
+	{FOP_FSCALE,0x037F,{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0x7FFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x0B7F,{0x8741BEEFA31CD281ULL,0x3FB2},{0xB335060A6D7DB1F1ULL,0x7FFF},{0xF335060A6D7DB1F1ULL,0x7FFF},0x0000},
+	{FOP_FPREM,0x067F,{0x947F5FA80ECE2DCDULL,0xC07F},{0x947F5FA80ECE2DCDULL,0x402F},{0x0000000000000000ULL,0x8000},0x0400},
+	{FOP_FIST64,0x047F,{0x00000001A341ECF7ULL,0x8000},{0x8000000000000000ULL,0xFFFF},{0xFFFFFFFFFFFFFFFFULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x047F,{0x9AA61109C86CF40AULL,0xBFCB},{0x0003AF114C395447ULL,0x0000},{0x8000000000000000ULL,0xBFFF},0x0000},
+	{FOP_FBST,0x0C7F,{0xB420000000000000ULL,0x3FFB},{0xBAD3DE0E6355EE67ULL,0xC044},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x027F,{0xD7A0000000000000ULL,0xC004},{0xBFE8AA427EBF1D52ULL,0x401D},{0xBFE8A9D6AEBF2000ULL,0x401D},0x0000},
+	{FOP_FADD,0x087F,{0x8489A81F80C80B9AULL,0x3FFF},{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0C7F,{0xD58B015301864BE3ULL,0x3FD1},{0xB7B7C619A1ECF5C3ULL,0x404E},{0xB7B7C60000000000ULL,0xC04E},0x0000},
+	{FOP_FXAM,0x0B7F,{0xE5FDDAA58B83EBD1ULL,0x3FE9},{0xDACFA801D63C6326ULL,0x3FE9},{0xE5FDDAA58B83EBD1ULL,0x3FE9},0x0400},
+	{FOP_FSCALE,0x077F,{0xA89A17E0A6AA38B3ULL,0xBFDC},{0xA1C3FA480FD834ADULL,0x4001},{0xA89A17E0A6AA38B3ULL,0xBFE1},0x0000},
+	{FOP_FXAM,0x067F,{0x00550C78539AC8DFULL,0x0000},{0xA5D0000000000000ULL,0xC001},{0x00550C78539AC8DFULL,0x0000},0x4400},
+	{FOP_FIST64,0x047F,{0x00000030E9134403ULL,0x0000},{0xE2672136CE7DA0D6ULL,0x002C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0B7F,{0xD90F700B56C73A0CULL,0xBFBF},{0xF1960967A7EC967AULL,0xBFCD},{0xE602CBE72DD65E91ULL,0x3FF0},0x0000},
+	{FOP_FMUL,0x037F,{0xDE3C411495C3A97BULL,0xBFC9},{0xA4D0000000000000ULL,0xC001},{0x8F132AA610AB078CULL,0x3FCC},0x0000},
+	{FOP_FPREM,0x047F,{0xE0D639C4DA3BEC53ULL,0x400F},{0xAEDCD53D3B1ECF00ULL,0xBFE1},{0x93C457C5B3851600ULL,0x3FE1},0x4100},
+	{FOP_FSUB,0x0A7F,{0xD4C286DB87257E37ULL,0xC01D},{0x0000000000000000ULL,0x0000},{0xD4C286DB87257800ULL,0xC01D},0x0000},
+	{FOP_FBST,0x077F,{0xF5E4EBF7FBD588FAULL,0xBFC2},{0xA301088BC01519E3ULL,0x402D},{0x0000000000000001ULL,0x8000},0x0000},
+	{FOP_FXAM,0x0C7F,{0xB5BCD3015448390FULL,0x401C},{0x9ED4ECA26B550D42ULL,0xBFBA},{0xB5BCD3015448390FULL,0x401C},0x0400},
+	{FOP_FIST32,0x027F,{0xAA0EA7EB2084AAD2ULL,0xC00F},{0x0000000000000000ULL,0x0000},{0x00000000FFFEABE3ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0E7F,{0x8124662831C53BD8ULL,0x3FE8},{0xFD90DD9A225E3FEBULL,0x4005},{0x8124662831C53BD8ULL,0x4066},0x0000},
+	{FOP_FIST32,0x047F,{0x8C25304C6FB80E1AULL,0x3FC0},{0xC241C7AE2C336474ULL,0x404D},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0F7F,{0xD0D19336B4536FCDULL,0x4015},{0xCAFC9318CB6015B7ULL,0xC002},{0xD0D1AC9646B68939ULL,0x4015},0x0000},
+	{FOP_FST32,0x047F,{0x82C29AAD63755EA6ULL,0xC01F},{0xB4ACA530A1545395ULL,0x3C03},{0x00000000CF82C29BULL,0x0000},0x0000},
+	{FOP_FPREM1,0x067F,{0xE4A4E9B1CBC41A78ULL,0x3FC1},{0xAF0B1BBE43E34D81ULL,0xFFFF},{0xEF0B1BBE43E34D81ULL,0xFFFF},0x0000},
+	{FOP_FPREM,0x037F,{0xED0DCF4FC864A29DULL,0x43FE},{0x85723D831A8DE0A2ULL,0x3FCE},{0x8FFCA70A5CAEFBA4ULL,0x43CD},0x0400},
+	{FOP_FIST64,0x067F,{0x86B7FBC540238362ULL,0x8024},{0xD5582C9AC9AB9B1FULL,0xBFBB},{0xFFFFFFFFFFFFFFFFULL,0x0000},0x0000},
+	{FOP_FST32,0x047F,{0x884EEE34E480DAF0ULL,0x4004},{0x9210000000000000ULL,0x3FFE},{0x0000000042084EEEULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x087F,{0xEBE422141B7C6D27ULL,0xBFC8},{0xCA613198661AB191ULL,0x0001},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FPREM1,0x047F,{0x90C0000000000000ULL,0x400A},{0xAD7AAB9BF93F447FULL,0xBFC0},{0xE30904A013446800ULL,0x3FD9},0x0400},
+	{FOP_FST32,0x077F,{0xFB7BC8CECE2B761FULL,0xC032},{0xB42C61B4BB4D0A99ULL,0x3F81},{0x00000000D97B7BC9ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x027F,{0x8000000000000000ULL,0x7FFF},{0xFCAB8E4A2133979BULL,0xC036},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FST32,0x077F,{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x8000},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0A7F,{0xDF20000000000000ULL,0x3FFD},{0xC19C4694E09AE453ULL,0x401C},{0xC19C4693225AE000ULL,0xC01C},0x0000},
+	{FOP_FST64,0x0C7F,{0xDB609379E8F5283EULL,0x401F},{0xD5D8AAF8D07E9DDBULL,0xC024},{0x41FB6C126F3D1EA5ULL,0x0000},0x0000},
+	{FOP_FDIV,0x077F,{0xEFBD233B3096BC16ULL,0xBFC6},{0xCD2A3D245B59B403ULL,0xBFDC},{0x9591F87027B4F0E0ULL,0x3FE9},0x0000},
+	{FOP_FIST64,0x0E7F,{0xB3D86E427C1E580AULL,0x7FF7},{0xF957A8F4856CF4D0ULL,0xBFEA},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0E7F,{0xF1767620C9FF56D9ULL,0x3FCC},{0xF9DE51DB4F402D09ULL,0x401D},{0xF1767620C9FF56D9ULL,0x3FCC},0x0000},
+	{FOP_FDIV,0x037F,{0x00003199B4BFE6F9ULL,0x8000},{0x80003199B4BFE6F9ULL,0x401A},{0x0000000000063334ULL,0x8000},0x0000},
+	{FOP_FST64,0x067F,{0xE35C4061015AECE9ULL,0xC03A},{0xB000000000000000ULL,0x4000},{0xC3AC6B880C202B5EULL,0x0000},0x0000},
+	{FOP_FBST,0x047F,{0xC4AC2A607DE15890ULL,0x3FBA},{0x44AC2A607DE15890ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x087F,{0xAB5339934046CBC3ULL,0x3FCF},{0x0000000000000000ULL,0x8000},{0x9416260000000000ULL,0x3FE7},0x0000},
+	{FOP_FXAM,0x0C7F,{0x84878327E8887396ULL,0xBFB1},{0x002C33AE84E5815DULL,0x8000},{0x84878327E8887396ULL,0xBFB1},0x0600},
+	{FOP_FPREM1,0x027F,{0xEDC0000000000000ULL,0x4005},{0xB21A84B0B3124B36ULL,0x3FB0},{0xF995CBFBED65DBE0ULL,0x3FCC},0x0400},
+	{FOP_FSUB,0x0E7F,{0xE48DCDA0FA0584BCULL,0x8003},{0xB05799B3AF529863ULL,0x3FE6},{0xB05799B3AF529800ULL,0xBFE6},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xCE9F0D9E4ABFDB08ULL,0xBFBF},{0xD1ED93BC10DE6C51ULL,0xC001},{0xCE9F0D9E4ABFDB08ULL,0xBFB9},0x0000},
+	{FOP_FRNDINT,0x077F,{0xA01463F4A1344DE1ULL,0x7FFE},{0xA0B7D93EA99EEA36ULL,0xBFF5},{0xA01463F4A1344DE1ULL,0x7FFE},0x0000},
+	{FOP_FST32,0x037F,{0xFA3E41B3730F2E57ULL,0xFFEF},{0x9C5B6C464BA1014FULL,0x3FEB},{0x00000000FF800000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0E7F,{0xE6A7E18A484334E1ULL,0x3FE4},{0xC34D6E30BFE077D5ULL,0x4007},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x007F,{0x9CB8DADAFB90BC4BULL,0x3FCA},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0E7F,{0x0000000000000000ULL,0x0000},{0x9EB4E278DD8FC3A5ULL,0x4026},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0F7F,{0x8000000000000000ULL,0x7FFF},{0xA9A7CD91D2A536FBULL,0xBF82},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x087F,{0xD4B0000000000000ULL,0xC009},{0x0000000000000000ULL,0x8000},{0xFFFFFFFFFFFFF95BULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x007F,{0x0000000000000000ULL,0x8000},{0xAA9D3309937CAB87ULL,0x7FFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FDIV,0x047F,{0xDEF7AD3EC1572A56ULL,0x3FEB},{0x00008FCD88FEE481ULL,0x8000},{0xC6770B0000000000ULL,0xFFF9},0x0000},
+	{FOP_FXAM,0x0E7F,{0xB5C10568B8EDF41EULL,0x3FCC},{0xE5EE79927159B37CULL,0xBFEC},{0xB5C10568B8EDF41EULL,0x3FCC},0x0400},
+	{FOP_FSUB,0x037F,{0x8467E504602C7587ULL,0x4026},{0xAA99F08305BAC237ULL,0x7FFF},{0xEA99F08305BAC237ULL,0x7FFF},0x0000},
+	{FOP_FXAM,0x0E7F,{0xBE0C3535ADF3E560ULL,0xC009},{0xAB30000000000000ULL,0x4007},{0xBE0C3535ADF3E560ULL,0xC009},0x0600},
+	{FOP_FIST32,0x0A7F,{0xE45DDD9DA2241F2AULL,0x3FE5},{0xB142A259C43FAB7DULL,0x000A},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FXAM,0x047F,{0xDA968861F8C7582CULL,0x4036},{0xE9063838EE24C838ULL,0x3FDE},{0xDA968861F8C7582CULL,0x4036},0x0400},
+	{FOP_FPREM1,0x077F,{0xBC74B2BA6E5F12DBULL,0xFFFF},{0xD52300C69242813BULL,0x7FFF},{0xD52300C69242813BULL,0x7FFF},0x0000},
+	{FOP_FPREM,0x037F,{0xDB6D371A4C4F327DULL,0xC02B},{0xDB6D371A4C4F327DULL,0xC000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST32,0x0C7F,{0xCAF7298B5705D368ULL,0xBFF6},{0xAA50D4152A9FE3FCULL,0xBFBB},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x067F,{0xC1A4E988CE2D3F82ULL,0xC007},{0x9327B954E5AC6112ULL,0xFFDD},{0xC1A4E988CE2D3F82ULL,0xC007},0x0000},
+	{FOP_FIST64,0x0E7F,{0xF7647A147CFE06E7ULL,0x3C00},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x067F,{0xDF034920F2CF0453ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x037F,{0xDC684FF8E77BC353ULL,0xBFC5},{0x865959B2808EEFA5ULL,0x4011},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x077F,{0x0000000000000000ULL,0x0000},{0x000000325273ECF9ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0A7F,{0xA03FB9A036719685ULL,0x800A},{0xFAE13C57701DEEA2ULL,0xBC02},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x067F,{0xF2ECE91396196074ULL,0xBFB5},{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0xBFFF},0x0000},
+	{FOP_FXAM,0x007F,{0xBD7420CF14D65359ULL,0xC035},{0x0000000000000000ULL,0x0000},{0xBD7420CF14D65359ULL,0xC035},0x0600},
+	{FOP_FIST64,0x037F,{0x8000000000000000ULL,0x7FFF},{0x000C607390C05F39ULL,0x8000},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0F7F,{0xF3C0000000000000ULL,0x4001},{0xC858B81934250134ULL,0x0003},{0x401E780000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0E7F,{0xB0D17D8B736A155BULL,0xC02F},{0xE2E6F8FE82DDE642ULL,0x3FCC},{0xFFFE9E5D04E9192CULL,0x0000},0x0000},
+	{FOP_FIST64,0x0F7F,{0x0000000000000000ULL,0x0000},{0xE212F696A4C53636ULL,0x3FE3},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x007F,{0x0000000000000000ULL,0x8000},{0xC31E271EF84178E0ULL,0x3FE8},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x0C7F,{0xC732289446359904ULL,0xBFC5},{0xC732289446359904ULL,0xC011},{0xC732289446359904ULL,0xBFC5},0x0600},
+	{FOP_FST64,0x067F,{0xA3C1604A76C4926EULL,0x4039},{0x9733D8B168945AC3ULL,0x0028},{0x4394782C094ED892ULL,0x0000},0x0000},
+	{FOP_FST32,0x0F7F,{0x0000007EFD96DC49ULL,0x0000},{0xF1844CB17A5847B8ULL,0x3FEE},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x027F,{0xA860000000000000ULL,0x3FFF},{0xE820000000000000ULL,0xC000},{0x9E28000000000000ULL,0x4001},0x0000},
+	{FOP_FST64,0x0A7F,{0xF50CB6C299446228ULL,0x4013},{0xAFA0000000000000ULL,0x3FFE},{0x413EA196D853288DULL,0x0000},0x0000},
+	{FOP_FIST64,0x0B7F,{0xB16F3045BB90C536ULL,0x4032},{0xBE5ED0B76D4010F3ULL,0xC049},{0x000B16F3045BB90DULL,0x0000},0x0000},
+	{FOP_FPREM,0x047F,{0xEC26A657A56F5E01ULL,0xC400},{0xAE3A682804D46F57ULL,0xBFC6},{0xB76486C12E8E2BEEULL,0xC3C5},0x0400},
+	{FOP_FIST64,0x0C7F,{0x0000000000000000ULL,0x8000},{0xAF294702FEEB8827ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0F7F,{0x0000000000000000ULL,0x0000},{0xB4D6C141732C70FEULL,0x3FF9},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0A7F,{0x0000000000000000ULL,0x0000},{0x9FE5C561CE753E65ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x007F,{0xBE45087576371DD0ULL,0x401E},{0x0000019AFED74C43ULL,0x8000},{0xBE45080000000000ULL,0x401E},0x0000},
+	{FOP_FST32,0x037F,{0x8000000000000000ULL,0x7FFF},{0xAEADBD33B879A776ULL,0x3FBC},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FST64,0x077F,{0x969F94B5E529D091ULL,0xBFCF},{0x0000000000000000ULL,0x0000},{0xBCF2D3F296BCA53BULL,0x0000},0x0000},
+	{FOP_FSUB,0x047F,{0x860A9EE36F041508ULL,0x4006},{0xDFFFA54FC1940C64ULL,0xBFE7},{0x860A9E0000000000ULL,0x4006},0x0000},
+	{FOP_FXAM,0x037F,{0x0000000000000000ULL,0x8000},{0x00000036C3797965ULL,0x8000},{0x0000000000000000ULL,0x8000},0x4200},
+	{FOP_FBST,0x077F,{0xFE129A0C073AD805ULL,0xBFC0},{0x8000000000000000ULL,0x7FFF},{0x0000000000000001ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x0F7F,{0x000ACBF35D90A823ULL,0x0000},{0xE3A0EDBCBCFD0457ULL,0x4026},{0x94B32081C4E38274ULL,0x1FFA},0x0000},
+	{FOP_FST64,0x0C7F,{0x9D5669ED5D17DAD8ULL,0x3FE2},{0xAF7CDA9031FE9067ULL,0x3FD1},{0x3E23AACD3DABA2FBULL,0x0000},0x0000},
+	{FOP_FSQRT,0x067F,{0xBEADD2DC1A340447ULL,0xBFBD},{0xD5ADE284D65FD93AULL,0x403D},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x037F,{0xE1641AA7A421FC5FULL,0x4005},{0xEBF85A0477A5A158ULL,0x4012},{0xA9DA6039689D527DULL,0x4002},0x0000},
+	{FOP_FXAM,0x077F,{0xAE1E98C0DDD26E23ULL,0xC024},{0x8000000000000000ULL,0xFFFF},{0xAE1E98C0DDD26E23ULL,0xC024},0x0600},
+	{FOP_FBST,0x0A7F,{0xCB3C0D2A19B464A6ULL,0x3C00},{0x0000000000000000ULL,0x8000},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x077F,{0xBAC0000000000000ULL,0x4007},{0x0000000000000000ULL,0x0000},{0xBAC0000000000000ULL,0x4007},0x0000},
+	{FOP_FSUB,0x0A7F,{0x9F2B24F88D3F7D62ULL,0x4035},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x027F,{0xE8A5D7A8184F2E80ULL,0x3FBE},{0x0000000123015479ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xEC4D4F84F200461AULL,0x3FFB},{0xC3F19CD17D1B1864ULL,0xC004},{0xEC4D4F84F200461AULL,0x3FCB},0x0000},
+	{FOP_FPREM,0x077F,{0xD51048C05D0CFE44ULL,0xBF83},{0xFA4482B9A86921B0ULL,0x3FF0},{0xD51048C05D0CFE44ULL,0xBF83},0x0000},
+	{FOP_FIST32,0x0A7F,{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0xBFF1},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x087F,{0x0000000000000000ULL,0x0000},{0xB92D58ED542ECF55ULL,0x4031},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x067F,{0xA31CA1E5D32354D5ULL,0xC00C},{0x863D8EA64ACBBF12ULL,0x4080},{0xA320000000000000ULL,0xC00C},0x0000},
+	{FOP_FPREM,0x0A7F,{0xA4D557EDCB36EFD9ULL,0x403F},{0x8000000000000000ULL,0x7FFF},{0xA4D557EDCB36EFD9ULL,0x403F},0x0000},
+	{FOP_FBST,0x047F,{0x8C57A0AEF0018D6FULL,0xBFB5},{0xE3C6A3C5C07F0B4BULL,0x7FFF},{0x0000000000000001ULL,0x8000},0x0000},
+	{FOP_FST64,0x0E7F,{0xF0C458E500C06429ULL,0x3FBA},{0xA74438FFAB2A9292ULL,0x3FD5},{0x3BAE188B1CA0180CULL,0x0000},0x0000},
+	{FOP_FMUL,0x0A7F,{0x0000000000000000ULL,0x8000},{0xC23E64E05AE65591ULL,0x3FEE},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x027F,{0x84950AE69CF2D842ULL,0x4037},{0x0000000000000000ULL,0x8000},{0x82455D332270E800ULL,0x401B},0x0000},
+	{FOP_FBST,0x037F,{0xE598CAFBE4350798ULL,0x4002},{0xB923C0DE663C2802ULL,0xC031},{0x0000000000000014ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x027F,{0x92A946D8F43167C1ULL,0x800F},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST64,0x0C7F,{0x856A49F346DDB4F9ULL,0xC019},{0x0000000000000000ULL,0x8000},{0xFFFFFFFFFBD4ADB1ULL,0x0000},0x0000},
+	{FOP_FBST,0x077F,{0xAF46C5310BF346E1ULL,0x407F},{0xCDC349923ADA26AAULL,0x3FCE},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST32,0x047F,{0xC9C4F1392B94E3C8ULL,0x3FFB},{0x0000000000000000ULL,0x8000},{0x000000003DC9C4F1ULL,0x0000},0x0000},
+	{FOP_FXAM,0x077F,{0xCFCF7D10ADC889E6ULL,0x3FD5},{0x000000118E77FAF1ULL,0x8000},{0xCFCF7D10ADC889E6ULL,0x3FD5},0x0400},
+	{FOP_FPREM,0x0F7F,{0xA17041B5019857D6ULL,0xC046},{0xFBE2AA6B7B5C3ABCULL,0x3FE8},{0xDAAA7D50EBC31648ULL,0xC008},0x0400},
+	{FOP_FRNDINT,0x077F,{0xCFBE4270F9F87088ULL,0xC026},{0xF4747484A675B736ULL,0xBFB7},{0xCFBE4270FA000000ULL,0xC026},0x0000},
+	{FOP_FADD,0x027F,{0xC250000000000000ULL,0xC001},{0xD4E3A1ECBB1A11F3ULL,0xFFFF},{0xD4E3A1ECBB1A11F3ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x067F,{0xFB046A4E3FF7FC68ULL,0xFFC9},{0xB3E0FB033C912523ULL,0x7FFF},{0xFB046A4E3FF7FC68ULL,0xFFC9},0x0600},
+	{FOP_FST32,0x0C7F,{0xC2D9F5B2719EFB35ULL,0x7FFF},{0x9E0512AB3655BCE3ULL,0xC023},{0x000000007FC2D9F5ULL,0x0000},0x0000},
+	{FOP_FIST64,0x067F,{0xCE3554CB7124953DULL,0xC04D},{0xCD392AFD64B1670EULL,0xBF81},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x067F,{0xB1E90F0411396700ULL,0xC000},{0xD6C08E14A7479F35ULL,0xFFDE},{0xB1E90F0411396700ULL,0xC000},0x0000},
+	{FOP_FXAM,0x077F,{0xB108D49958E7CBD4ULL,0xBFAF},{0xB704286CF337DC68ULL,0xFFEB},{0xB108D49958E7CBD4ULL,0xBFAF},0x0600},
+	{FOP_FIST32,0x0B7F,{0xC247CEB8C982FD70ULL,0x407F},{0xCD2D0F9F770DA7F0ULL,0xBFCD},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x007F,{0xFBC1F13E792C2A6DULL,0x3FDC},{0xD68B7257A0F808D7ULL,0x4080},{0xFDDEB40000000000ULL,0x3FED},0x0000},
+	{FOP_FRNDINT,0x0E7F,{0xACE1D931EF39A892ULL,0x3FCB},{0xA50172B2E1B99439ULL,0x401C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x007F,{0xEF633B3588BE39D7ULL,0x0004},{0xBFE5CF9944C33ED2ULL,0x3FFC},{0xEF633B3588BE39D7ULL,0x0004},0x0400},
+	{FOP_FRNDINT,0x0E7F,{0xEAEB08AA7437E7F5ULL,0xFFFF},{0xE57524F2FC81D4E7ULL,0x7FFF},{0xEAEB08AA7437E7F5ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0F7F,{0xCFDC76C36182FE61ULL,0xBC02},{0xCFDC76C36182FE61ULL,0xC07D},{0xCFDC76C36182FE60ULL,0x407D},0x0000},
+	{FOP_FIST64,0x0C7F,{0xDC067BE5FC28D958ULL,0xBFEC},{0xD764100779F7CC15ULL,0xC02A},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x067F,{0xB49F46C754BED464ULL,0x3FD7},{0x8000000000000000ULL,0x7FFF},{0x980D2AB476AB7800ULL,0x3FEB},0x0000},
+	{FOP_FRNDINT,0x0A7F,{0x91BE041B7694DC25ULL,0x4004},{0x00000A32F091E039ULL,0x0000},{0x9400000000000000ULL,0x4004},0x0000},
+	{FOP_FST64,0x0A7F,{0xA00D015B04EA4849ULL,0xFFFF},{0x811145229F1F6EF8ULL,0x4023},{0xFFFC01A02B609D49ULL,0x0000},0x0000},
+	{FOP_FADD,0x047F,{0x93FA9A15D7B31369ULL,0x401F},{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x0E7F,{0x8EE12012768DD903ULL,0x0039},{0xD28359060DD33F37ULL,0xC000},{0x8EE12012768DD903ULL,0x0036},0x0000},
+	{FOP_FSUB,0x037F,{0xC7A52ACABD7F6D34ULL,0xC03C},{0xE75AC5AB4210B1DCULL,0xC032},{0xC76B541952AEE908ULL,0xC03C},0x0000},
+	{FOP_FSCALE,0x077F,{0xBE039C097DD983C8ULL,0xC032},{0x8D3299711D86199FULL,0xFFCA},{0x0000000000000001ULL,0x8000},0x0000},
+	{FOP_FDIV,0x077F,{0xEA8CB0FCEEF2D815ULL,0xC012},{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FBST,0x037F,{0xFBC16386A180839EULL,0x4026},{0xC6DFFB140E119E8AULL,0xBFC3},{0x0001081281316514ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x087F,{0x9A90000000000000ULL,0xC007},{0x8EB5BA76869FF7EBULL,0x3FFF},{0x9A90000000000000ULL,0xC008},0x0000},
+	{FOP_FPREM,0x027F,{0x8000000000000000ULL,0x7FFF},{0x90D93BF6C359F485ULL,0xFFFF},{0xD0D93BF6C359F485ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0E7F,{0x87CA6DAD0582FAD2ULL,0x3FEB},{0xA0EA9692B52D5E4EULL,0xBFFB},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x027F,{0xE9EE2A8F3B4C06D0ULL,0x4041},{0xB8E5032008A0E360ULL,0x43FD},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x037F,{0xA210DD368F7E7C4DULL,0x43FD},{0x8EC4DEF1364C3BFCULL,0xFFDD},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0A7F,{0x0000000000000000ULL,0x0000},{0xF7E676F09E3D67ECULL,0xBFC2},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xE0EB752647B1B221ULL,0xC02F},{0xD3F2C6BF6F81468DULL,0x002E},{0xFC2F67EFD7B00116ULL,0xC00D},0x0400},
+	{FOP_FBST,0x047F,{0x9DF7DF1A24896E10ULL,0x002A},{0x81A60E7FCD58472BULL,0xFFD2},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x007F,{0xAC7306ECD97AB7DBULL,0xC024},{0xCC440254CDDA2E33ULL,0xBFB9},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x047F,{0xCB9C3216F6044BD9ULL,0x43FD},{0xE5A2DF18F679C738ULL,0x400A},{0xD167989BAC3E1B40ULL,0x43CA},0x0400},
+	{FOP_FST32,0x0C7F,{0xF3C5B802DC7E9660ULL,0xC017},{0x0000000000000000ULL,0x0000},{0x00000000CBF3C5B8ULL,0x0000},0x0000},
+	{FOP_FADD,0x047F,{0x9B5C81ECE749CFDCULL,0x7FD7},{0xC726DF0384109D60ULL,0xBFE9},{0x9B5C810000000000ULL,0x7FD7},0x0000},
+	{FOP_FADD,0x047F,{0x00051C07EC11D165ULL,0x0000},{0xA86781D0D3E0523EULL,0x4024},{0xA867810000000000ULL,0x4024},0x0000},
+	{FOP_FXAM,0x047F,{0x9E45E32B6632D55BULL,0xBFED},{0xD593D795C34D6485ULL,0xC009},{0x9E45E32B6632D55BULL,0xBFED},0x0600},
+	{FOP_FSCALE,0x077F,{0xC684E74D17C0251BULL,0x3FE0},{0x0000E522C57F0C23ULL,0x8000},{0xC684E74D17C0251BULL,0x3FE0},0x0000},
+	{FOP_FADD,0x0B7F,{0x80C0000000000000ULL,0x4002},{0x8B20000000000000ULL,0xBFFB},{0xFF53800000000000ULL,0x4001},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xB155237DB26BB5E0ULL,0x4042},{0xB155237DB26BB5E0ULL,0xBFBA},{0x0000000000000000ULL,0x0000},0x0400},
+	{FOP_FSUB,0x087F,{0x0000000000000000ULL,0x0000},{0xBB2C73E11F512069ULL,0xC029},{0xBB2C740000000000ULL,0x4029},0x0000},
+	{FOP_FRNDINT,0x0C7F,{0xCE66497FEE7CF1BBULL,0xC013},{0x8A211ABA07BF8E21ULL,0x4044},{0xCE66480000000000ULL,0xC013},0x0000},
+	{FOP_FIST32,0x0A7F,{0xE171E94D575CCB41ULL,0x4049},{0xD8387D45A58E272DULL,0xC04E},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x0A7F,{0xDC5459C33AE61CD5ULL,0xBFD8},{0xDC5459C33AE61CD5ULL,0x8021},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x0B7F,{0x0002FA9EEE21CC15ULL,0x8000},{0xC172496C83AE2523ULL,0x407F},{0x901191C206C8BA94ULL,0x8074},0x0000},
+	{FOP_FRNDINT,0x047F,{0xACD12F6DAEA5B593ULL,0x3FB6},{0xDB897C497404EF69ULL,0x3FC0},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x0C7F,{0x9EEFC1B2BDEFE91EULL,0x3FC8},{0x8278A7F6464BFA15ULL,0x7FFF},{0x9EEFC1B2BDEFE91EULL,0x3FC8},0x0400},
+	{FOP_FIST64,0x0A7F,{0xA71E246A91F1A1C3ULL,0xC015},{0xC072C4F4856D18C2ULL,0xBFC8},{0xFFFFFFFFFFAC70EEULL,0x0000},0x0000},
+	{FOP_FPREM1,0x047F,{0xA285455CCFFE892BULL,0xBF80},{0x0000000000000000ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0F7F,{0xA3CD5363BD8F81D3ULL,0x403C},{0x96CD2D7CDF3C6D6DULL,0x8008},{0xA3CD5363BD8F81D3ULL,0x403C},0x0400},
+	{FOP_FSQRT,0x027F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0x4048},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x077F,{0xA171B6DFE2E1FC4AULL,0x4043},{0xD81F9081EBF35546ULL,0x4022},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x087F,{0x97B0000000000000ULL,0x3FFD},{0x0000003A8C35823BULL,0x0000},{0xE5F1015A34000000ULL,0x3FC7},0x0400},
+	{FOP_FIST32,0x027F,{0xBBB0000000000000ULL,0xBFFC},{0xF3E50E9594CF364EULL,0xC03B},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0B7F,{0xE889A64F5445258FULL,0x000D},{0xEFC99256EDECEE77ULL,0x403D},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x007F,{0xB8DF0B37EE897A8BULL,0xC033},{0x808962BBB71C8E54ULL,0x3FFF},{0xB8DF0B37EE897A8BULL,0xC034},0x0000},
+	{FOP_FMUL,0x037F,{0xE0A49B4D8A6517CBULL,0x8009},{0xC18419E195B34F1DULL,0x8034},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0B7F,{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST32,0x047F,{0xC3C64217FB181D75ULL,0xBFC6},{0xB20120DE554FD1B3ULL,0x4002},{0x00000000A343C643ULL,0x0000},0x0000},
+	{FOP_FPREM,0x087F,{0xF190B33C99171827ULL,0x4004},{0x0000000000000000ULL,0x8000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x027F,{0x91BF33990E41679FULL,0x3C00},{0xB8B2835EF3FFD172ULL,0x3FD5},{0xCA033F8B858DB800ULL,0x3C29},0x0000},
+	{FOP_FRNDINT,0x0C7F,{0xBEEFA8BE34F1E502ULL,0xC00D},{0xBD4ABFC2BCE989EBULL,0x7FFF},{0xBEEE000000000000ULL,0xC00D},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0x9621E232E6991721ULL,0x402A},{0x9621E232E6991721ULL,0x4040},{0x9621E232E6900000ULL,0x402A},0x0000},
+	{FOP_FMUL,0x067F,{0xDAB9697F8540E434ULL,0x4044},{0xD5BAFA34D57BD60AULL,0xC004},{0xB69C0543F59BD800ULL,0xC04A},0x0000},
+	{FOP_FBST,0x047F,{0xC83BB3FA76D137D8ULL,0xC02E},{0xC83BB3FA76D137D8ULL,0xC00C},{0x0220158748161746ULL,0x8000},0x0000},
+	{FOP_FST64,0x067F,{0xE75D096B08714033ULL,0xBFBF},{0xDE852EBC1100F1B5ULL,0x403D},{0xBBFCEBA12D610E29ULL,0x0000},0x0000},
+	{FOP_FSUB,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FIST64,0x077F,{0xD5AED89E5916A7C0ULL,0x4042},{0xCBFF7292100168C4ULL,0xBFBE},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x047F,{0xFAE809EF816D44A5ULL,0x7FFF},{0xFAE809EF816D44A5ULL,0xBFFE},{0x000000007FFAE809ULL,0x0000},0x0000},
+	{FOP_FPREM,0x087F,{0xE412BAA5DB8E23C6ULL,0xBFE0},{0x000000D6C41C42FDULL,0x0000},{0xBEF86E392A000000ULL,0xBFA9},0x0400},
+	{FOP_FIST64,0x047F,{0xF260000000000000ULL,0x4005},{0xF260000000000000ULL,0xC012},{0x0000000000000079ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0A7F,{0x932D2176577CA407ULL,0xFFFF},{0xBA016DB1E15F8B2AULL,0x4002},{0xD32D2176577CA407ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x037F,{0xEDB8B4159C775888ULL,0xBFFA},{0xDC21063BE02D5148ULL,0xBFCE},{0x8A3AC96C5F5B5BB5ULL,0x402B},0x0000},
+	{FOP_FPREM,0x0A7F,{0xA0FC18B25EA361A7ULL,0x4037},{0x0000000000000000ULL,0x8000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x027F,{0xD3C4089A88331FD1ULL,0xFFED},{0xADAE6A317DE732E5ULL,0x400A},{0x8FABC0E6634EB800ULL,0xFFF9},0x0000},
+	{FOP_FPREM,0x037F,{0xFE42C1526B729EA6ULL,0x802E},{0xB3F3D095F5C398C5ULL,0xBFC7},{0xFE42C1526B729EA6ULL,0x802E},0x0000},
+	{FOP_FST64,0x007F,{0xEC8BBA25622DEF82ULL,0x402F},{0xEBA0739A5FBB6F13ULL,0x404E},{0x42FD917744AC45BEULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x077F,{0x8D23BAD43559FAE8ULL,0x3FFC},{0x00068124D18179AFULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x027F,{0xE02EBB08DEBBB54FULL,0x43FF},{0xA160000000000000ULL,0xBFFC},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x077F,{0x96C45EB9BF7D7630ULL,0xC022},{0xFAAF06EE542BB137ULL,0xFFFF},{0xFAAF06EE542BB137ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x0C7F,{0xEF47B832907D6653ULL,0x7FFF},{0xA7F17CE885EB231EULL,0x3FCD},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x087F,{0xB44858B7D48A4418ULL,0x3FE0},{0x8770000000000000ULL,0xC00A},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FIST64,0x047F,{0xC3CC77346878A581ULL,0x7FEC},{0xC3CC77346878A581ULL,0xBFD9},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x007F,{0xDDABF5CE4156ACA7ULL,0x3C01},{0xC3D23E9584130E35ULL,0xBFCA},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x047F,{0x933E2DFC86B1513CULL,0xBFFC},{0xD90E58BC5123E7B0ULL,0x3FFD},{0x8000000000000000ULL,0xBFFF},0x0000},
+	{FOP_FMUL,0x0B7F,{0xDA05E14AA3BED9DCULL,0x3FFE},{0xD0FAEC482306F4D1ULL,0xBFB3},{0xB1FA7A05831BDFC5ULL,0xBFB3},0x0000},
+	{FOP_FSUB,0x007F,{0xB75234D448D90A30ULL,0x3FC1},{0xD274959D5825AA3EULL,0x4038},{0xD274960000000000ULL,0xC038},0x0000},
+	{FOP_FST32,0x027F,{0xC2CF04D2E8F7AAF8ULL,0x4037},{0xC2CF04D2E8F7AAF8ULL,0xBFB8},{0x000000005BC2CF05ULL,0x0000},0x0000},
+	{FOP_FIST32,0x047F,{0x8A330A65048C649AULL,0x8040},{0xB0BD54F55E5CC564ULL,0x3FEE},{0x00000000FFFFFFFFULL,0x0000},0x0000},
+	{FOP_FPREM1,0x007F,{0x967535732BB2EEDEULL,0x3FD4},{0x967535732BB2EEDEULL,0x0025},{0x0000000000000000ULL,0x0000},0x0400},
+	{FOP_FXAM,0x0E7F,{0xCF485CC05ED7EBA8ULL,0x4025},{0xC9556727D3870A1FULL,0x3FEC},{0xCF485CC05ED7EBA8ULL,0x4025},0x0400},
+	{FOP_FDIV,0x087F,{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0C7F,{0xE15EAB4032E8DA3BULL,0xBFC6},{0xE472A59FA8E2A21FULL,0x3FC5},{0xA9CBFF0000000000ULL,0xBFC7},0x0000},
+	{FOP_FRNDINT,0x047F,{0xF0CEA12AB99598BFULL,0xC04A},{0xDD54EA9E40E6593DULL,0x4040},{0xF0CEA12AB99598BFULL,0xC04A},0x0000},
+	{FOP_FST64,0x027F,{0xA87413CAEBADDF4CULL,0x3FF0},{0xA6862B159F7BA607ULL,0xBFEC},{0x3F050E82795D75BCULL,0x0000},0x0000},
+	{FOP_FXAM,0x027F,{0xA79A4EA4A791C9E3ULL,0xFFC0},{0x86BBF4767E9405ECULL,0xBFFB},{0xA79A4EA4A791C9E3ULL,0xFFC0},0x0600},
+	{FOP_FPREM1,0x047F,{0x03D680E62682F5E3ULL,0x8000},{0xBBC2F8AFFE327244ULL,0xC04A},{0x03D680E62682F5E3ULL,0x8000},0x0000},
+	{FOP_FRNDINT,0x0E7F,{0xA8BF7469807E8961ULL,0xFFFF},{0x0000000000000000ULL,0x0000},{0xE8BF7469807E8961ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x037F,{0xDA50000000000000ULL,0x3FFB},{0x0000000000000000ULL,0x8000},{0xDA50000000000000ULL,0x3FFB},0x0000},
+	{FOP_FADD,0x047F,{0xF01F30D8568B009AULL,0xBF80},{0x8240000000000000ULL,0xBFFD},{0x8240010000000000ULL,0xBFFD},0x0000},
+	{FOP_FDIV,0x087F,{0x0000000000000000ULL,0x8000},{0xAAF738ACF1B155FDULL,0x4016},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FRNDINT,0x037F,{0xD85F58215837500CULL,0xC00A},{0xD392A61EED7DD376ULL,0x3FE3},{0xD860000000000000ULL,0xC00A},0x0000},
+	{FOP_FPREM1,0x047F,{0xDC2610E5596500F8ULL,0x803B},{0x8000000000000000ULL,0xFFFF},{0xDC2610E5596500F8ULL,0x803B},0x0000},
+	{FOP_FBST,0x047F,{0x97E0000000000000ULL,0xC001},{0xA5E562A8BFBEB861ULL,0x7FFF},{0x0000000000000005ULL,0x8000},0x0000},
+	{FOP_FBST,0x067F,{0xAC29CF8E2ED0E922ULL,0x4003},{0xD5B553D3862E8AB4ULL,0xBFC5},{0x0000000000000021ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x007F,{0xAFCE9D8673B21499ULL,0x7FFF},{0x0000000000000000ULL,0x0000},{0xEFCE9D8673B21499ULL,0x7FFF},0x0000},
+	{FOP_FPREM1,0x0F7F,{0xD14A2C8F8FA31AA2ULL,0x401E},{0x844765B476CBE84CULL,0xBFD9},{0xD1FD5B2DAC48FB00ULL,0x3FF4},0x0400},
+	{FOP_FBST,0x0F7F,{0xC4BDF9CB8B186529ULL,0xC047},{0xD1FD10F18F8A6900ULL,0x8005},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0C7F,{0xE299A04184A4CA29ULL,0xBFB7},{0xF598C647C7520D0FULL,0x4400},{0xF598C60000000000ULL,0xC400},0x0000},
+	{FOP_FST64,0x067F,{0xBC86918F3857DC54ULL,0xBFD7},{0xD2EAE7FC4CB13E36ULL,0xBFF7},{0xBD7790D231E70AFCULL,0x0000},0x0000},
+	{FOP_FBST,0x047F,{0xDF84FE4FC9E8E349ULL,0x7FFF},{0xBA1212C4F11732C1ULL,0x3C00},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FRNDINT,0x067F,{0xC080000000000000ULL,0xC007},{0xC080000000000000ULL,0xBFC8},{0xC080000000000000ULL,0xC007},0x0000},
+	{FOP_FSCALE,0x007F,{0xA56DE46DA5E11B3DULL,0x4038},{0xC750000000000000ULL,0x4006},{0xA56DE46DA5E11B3DULL,0x40FF},0x0000},
+	{FOP_FST32,0x087F,{0xE0DF1776C4035BAEULL,0x8035},{0xA1E4C86925D777BDULL,0xBFBD},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x047F,{0xA6E819519D875DB0ULL,0x3FEB},{0x8733E70381ACA7AAULL,0x401D},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x087F,{0x94FAA4C4CC2ADA55ULL,0xFFD2},{0x0000000000000000ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST64,0x0B7F,{0x8000000000000000ULL,0x7FFF},{0xF24B9BD7A71652AFULL,0xBFBA},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0C7F,{0xCE669616882F50C4ULL,0xBFC8},{0xA2E18A1367DF9B82ULL,0xFFF0},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FIST32,0x087F,{0x8E35A25E75B19341ULL,0xC017},{0x9C0124C0ABB6690CULL,0xBFCA},{0x00000000FEE394BCULL,0x0000},0x0000},
+	{FOP_FADD,0x0B7F,{0x86427D8A77903713ULL,0xC02A},{0x0000000000000000ULL,0x8000},{0x86427D8A77903713ULL,0xC02A},0x0000},
+	{FOP_FSQRT,0x0F7F,{0xC30DDC90EB6BBB3FULL,0x402E},{0xD2C814C3DA53818BULL,0xBFEE},{0xDF7577C5948A24F5ULL,0x4016},0x0000},
+	{FOP_FRNDINT,0x037F,{0xBEAB24939D1C186FULL,0xBFF7},{0xD257184B1A927C64ULL,0xC020},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x027F,{0x9999AD892933A83DULL,0x4002},{0x8900CBD99F0FDF64ULL,0x0031},{0xC64C048050C42800ULL,0x4000},0x0000},
+	{FOP_FSCALE,0x087F,{0xE93113F5A2B51C12ULL,0x3FEC},{0x979ADA8BD5BA112FULL,0xFFFF},{0xD79ADA8BD5BA112FULL,0xFFFF},0x0000},
+	{FOP_FST64,0x087F,{0xEDC9D50F3A6389DBULL,0xC00D},{0xD338CEB1973FF306ULL,0x3FED},{0xC0DDB93AA1E74C71ULL,0x0000},0x0000},
+	{FOP_FIST64,0x037F,{0xA2CC962BB13C6BCFULL,0x4041},{0xB20ED384E7BAD0DBULL,0x4002},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x007F,{0xC369A5828CE213AEULL,0x8032},{0x8C459B7D5A66F9E8ULL,0x8022},{0xC369190000000000ULL,0x8032},0x0000},
+	{FOP_FADD,0x067F,{0x9699B17CB67A45C7ULL,0x3C02},{0x9699B17CB67A45C7ULL,0x3FDA},{0x9699B17CB67A4000ULL,0x3FDA},0x0000},
+	{FOP_FXAM,0x077F,{0xB20D42BD51071D90ULL,0xC00B},{0xBFB02670D4BB523FULL,0x7FFF},{0xB20D42BD51071D90ULL,0xC00B},0x0600},
+	{FOP_FST64,0x0F7F,{0xFDA1A636E58D0225ULL,0xFFFF},{0xC2782F3AB476D255ULL,0x3FC2},{0xFFFFB434C6DCB1A0ULL,0x0000},0x0000},
+	{FOP_FPREM,0x037F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x067F,{0xAE220160AFC8FA87ULL,0xC028},{0xC489D19A29E73627ULL,0x3C02},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0E7F,{0xCE562C8DF33EE4AEULL,0x400B},{0xA17366FDF830E54BULL,0x4019},{0x00000000000019CAULL,0x0000},0x0000},
+	{FOP_FXAM,0x027F,{0xBC367CD18622D5F7ULL,0xFFFF},{0xBC367CD18622D5F7ULL,0xBFBF},{0xBC367CD18622D5F7ULL,0xFFFF},0x0300},
+	{FOP_FRNDINT,0x077F,{0xE8D9AFC779050BB7ULL,0xC01A},{0xC94CD1DA3D80B441ULL,0x0028},{0xE8D9AFD000000000ULL,0xC01A},0x0000},
+	{FOP_FMUL,0x067F,{0x00000001B04B5FC1ULL,0x8000},{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x067F,{0xCE3ACCA4626EE913ULL,0x8033},{0xA7F810D119AE2620ULL,0x803D},{0xCE3ACCA4626EE913ULL,0x8033},0x0600},
+	{FOP_FDIV,0x067F,{0xD9B99ECE266D143EULL,0xC014},{0xEB9E38E6BCDF3A47ULL,0x4047},{0xEC8F282A4CAD4000ULL,0xBFCB},0x0000},
+	{FOP_FSCALE,0x067F,{0x8000000000000000ULL,0xFFFF},{0xF725F8C44F96C79AULL,0xC003},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x087F,{0xBEC0000000000000ULL,0x3FFD},{0xCE544923A97159FBULL,0xC018},{0xECAB970000000000ULL,0xBFE3},0x0000},
+	{FOP_FXAM,0x027F,{0xE9B49D30B84EE719ULL,0xBFBB},{0xE0FA0DEA89A4B469ULL,0x3FC4},{0xE9B49D30B84EE719ULL,0xBFBB},0x0600},
+	{FOP_FPREM1,0x0E7F,{0xC98A44A2A2D6C18DULL,0x3FDA},{0xF12025BA4774F151ULL,0xC008},{0xC98A44A2A2D6C18DULL,0x3FDA},0x0000},
+	{FOP_FADD,0x067F,{0xBFCC33DD8F4E2FC6ULL,0x4048},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FST32,0x0E7F,{0x8000000000000000ULL,0x7FFF},{0x005ECEF436894CA7ULL,0x0000},{0x000000007F800000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x0C7F,{0xB4F63D8F1BBB61ACULL,0xBFC0},{0xFB06978697366CDDULL,0x3FFC},{0xB172170000000000ULL,0xBFBE},0x0000},
+	{FOP_FXAM,0x087F,{0xFA1F85F85EB095A8ULL,0x3FCC},{0xC610000000000000ULL,0x3FFF},{0xFA1F85F85EB095A8ULL,0x3FCC},0x0400},
+	{FOP_FXAM,0x037F,{0xA6BBA0628446AE19ULL,0xC047},{0xCE10000000000000ULL,0xC006},{0xA6BBA0628446AE19ULL,0xC047},0x0600},
+	{FOP_FSUB,0x037F,{0x81154DFE3DF9ACCBULL,0x402D},{0xC3DF5E02ABFC5BADULL,0x7FFF},{0xC3DF5E02ABFC5BADULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x027F,{0xE9D598BE028CCE3FULL,0xBFF3},{0xE9D598BE028CCE3FULL,0xC01D},{0x8000000000000000ULL,0x3FD5},0x0000},
+	{FOP_FRNDINT,0x087F,{0xD3D1435E0CED6EE3ULL,0xBFB6},{0x9E88C383D9ECBF1FULL,0x4048},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FPREM1,0x037F,{0xFBDDB006767FCBE8ULL,0x3FC3},{0x8456D5D4036B6EE2ULL,0x4009},{0xFBDDB006767FCBE8ULL,0x3FC3},0x0000},
+	{FOP_FADD,0x077F,{0x000000011853DE27ULL,0x0000},{0xAFA2A9C529DCA588ULL,0x4027},{0xAFA2A9C529DCA588ULL,0x4027},0x0000},
+	{FOP_FDIV,0x007F,{0xA3847F04A0F9CFF6ULL,0x002F},{0xE6B6A958402BA256ULL,0xBC00},{0xB570750000000000ULL,0x842D},0x0000},
+	{FOP_FADD,0x0F7F,{0xD12EFABAC14E0D46ULL,0x801C},{0xF693E2D853D4103CULL,0x7FFC},{0xF693E2D853D4103BULL,0x7FFC},0x0000},
+	{FOP_FIST64,0x067F,{0xB3F197CAA01A7E8EULL,0x4041},{0xDF7382F5CA8B9903ULL,0x403C},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0B7F,{0x8D4300B9C7D6D473ULL,0xC01A},{0xE1E0000000000000ULL,0xC009},{0xC1A1A8601738FADAULL,0x0000},0x0000},
+	{FOP_FPREM1,0x047F,{0xA34D4ED0D87678FBULL,0xBFEF},{0xBE0B5D0860ECCC7DULL,0x4047},{0xA34D4ED0D87678FBULL,0xBFEF},0x0000},
+	{FOP_FST64,0x027F,{0xD3EADB71181B1953ULL,0xBFEC},{0x950D3D61E6839211ULL,0x7FFF},{0xBECA7D5B6E230363ULL,0x0000},0x0000},
+	{FOP_FDIV,0x007F,{0x0000000000000000ULL,0x8000},{0xE050B8829F58A762ULL,0x4042},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST32,0x0E7F,{0x8D4CC53728A79782ULL,0x4030},{0x929FB92C52F335D1ULL,0xFFEC},{0x00000000580D4CC5ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0xFEE0000000000000ULL,0xBFFC},{0x975D4AA0FF23E124ULL,0xBFE1},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FRNDINT,0x067F,{0xB6821AF34E5C03BDULL,0x400A},{0xF1FF9C73CC46142BULL,0xC00B},{0xB680000000000000ULL,0x400A},0x0000},
+	{FOP_FXAM,0x0F7F,{0xB9ADF60DEAE6E2DBULL,0xFFC7},{0xB613BB2EEFB56935ULL,0xC023},{0xB9ADF60DEAE6E2DBULL,0xFFC7},0x0600},
+	{FOP_FBST,0x077F,{0xBF60462443372336ULL,0xC007},{0x001B8B735FC9F0B5ULL,0x0000},{0x0000000000000383ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x037F,{0xE4C0000000000000ULL,0x3FFD},{0xF43C64BBEDC4652EULL,0x3FE1},{0xAB1D2EE9CBED3E76ULL,0x3FFE},0x0000},
+	{FOP_FBST,0x037F,{0xD653C4FFF74A40B9ULL,0x3FE4},{0xC08BB85BC798B0FBULL,0xC022},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0F7F,{0xE37D7667FB87A75FULL,0xBFF6},{0x931BDF297727A196ULL,0xC00C},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x0E7F,{0x8000000000000000ULL,0xFFFF},{0xA014F7B86296B1E9ULL,0x4005},{0x8000000000000000ULL,0xFFFF},0x0700},
+	{FOP_FST64,0x077F,{0xE9CCDCF4381EDE7DULL,0xFFD5},{0xFB2FA961CE724260ULL,0x4018},{0xFFF0000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x067F,{0xAA4FE01C9FC52C7AULL,0x4005},{0xA65D57231B975E9FULL,0x4031},{0x0000000000000085ULL,0x0000},0x0000},
+	{FOP_FIST32,0x047F,{0x8DD4A22C2BB4F275ULL,0x7FFF},{0xB74FAB57068822E5ULL,0xC03A},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x007F,{0xB170DD2A70648040ULL,0xBC02},{0xB5E4C76B0C3F8C1FULL,0x7FFF},{0xF5E4C76B0C3F8C1FULL,0x7FFF},0x0000},
+	{FOP_FSCALE,0x047F,{0xCA50AADB3E7F0E9EULL,0x3FBF},{0xAC4E95812127953EULL,0x4005},{0xCA50AADB3E7F0E9EULL,0x4015},0x0000},
+	{FOP_FSCALE,0x087F,{0xE9BB5E1ECD633B62ULL,0xFFD1},{0xFD38C397CC0A2763ULL,0x7FFF},{0xFD38C397CC0A2763ULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x0B7F,{0x8020000000000000ULL,0x4002},{0xD53B00B890AF5FEEULL,0x403D},{0x99D2FC52DD873F10ULL,0x3FC3},0x0000},
+	{FOP_FBST,0x0E7F,{0xBCDC9340782C475AULL,0xBFDB},{0xD9E754885DBFEB53ULL,0xC03E},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST32,0x0E7F,{0xC570ABD4D14239F1ULL,0x3FF5},{0xEDBF50A572DDDD70ULL,0xBFF4},{0x000000003AC570ABULL,0x0000},0x0000},
+	{FOP_FDIV,0x0B7F,{0xE9B4F31F8D323674ULL,0xBFE4},{0x9BA38ED0254EC66CULL,0x401E},{0xC03450F9447681E5ULL,0xBFC5},0x0000},
+	{FOP_FPREM,0x067F,{0x8185EB2920F23E79ULL,0xC02A},{0xA10C6E5C3430BFDFULL,0xBFEB},{0xFD0B78941A9299C0ULL,0xBFE5},0x4300},
+	{FOP_FSQRT,0x007F,{0xF957142A619961A3ULL,0x7FF5},{0xD1B0D0423CAE065EULL,0xBFEA},{0xB2A6320000000000ULL,0x5FFA},0x0000},
+	{FOP_FST64,0x0C7F,{0xF88058E0801804EEULL,0x4033},{0x87A0000000000000ULL,0x4007},{0x433F100B1C100300ULL,0x0000},0x0000},
+	{FOP_FSUB,0x047F,{0x9AAFB979DD955899ULL,0xC023},{0x8EFE5C46EBA1615DULL,0xC01D},{0x9873C10000000000ULL,0xC023},0x0000},
+	{FOP_FDIV,0x037F,{0x86836CCE0849B123ULL,0xFFF1},{0xC0B1B2842AC87774ULL,0xC031},{0xB2B481D8A5B2A552ULL,0x7FBE},0x0000},
+	{FOP_FPREM,0x007F,{0xE8178BFFB46CCE2BULL,0x4030},{0xD1AAFC69CADCB43AULL,0xBFB7},{0xA3B323C3DA3DF7FCULL,0x3FF6},0x0400},
+	{FOP_FRNDINT,0x0C7F,{0xED8198BC0C588917ULL,0xC00E},{0xCB6CCD9289027B5DULL,0xBFE1},{0xED81000000000000ULL,0xC00E},0x0000},
+	{FOP_FPREM,0x047F,{0xDD594CB9ED048D1EULL,0x4016},{0x0000000000000000ULL,0x0000},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x0B7F,{0xC2EC6E8128B90AFFULL,0x4018},{0xB49DA3F61C8F1367ULL,0x407F},{0x8A23C575E72BD29DULL,0x3F98},0x0000},
+	{FOP_FST64,0x087F,{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x077F,{0x8000000000000000ULL,0xFFFF},{0x8000000000000000ULL,0x7FFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x027F,{0xC59D46CCC5DAFDAEULL,0x4031},{0xC59D46CCC5DAFDAEULL,0x3FBB},{0x988B6F9713425800ULL,0x3FEE},0x0000},
+	{FOP_FIST64,0x047F,{0x0000000000000000ULL,0x0000},{0xC9ECA0BD6296A640ULL,0xBFF6},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x007F,{0x000074ED5E2A3A37ULL,0x8000},{0xD7896B1F27BC7B2AULL,0x403F},{0x000074ED5E2A3A37ULL,0x8000},0x0000},
+	{FOP_FIST32,0x037F,{0xE675771FDA42C9C5ULL,0xFFFF},{0x0000000000000000ULL,0x8000},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x027F,{0xD5D86D9CD51BB489ULL,0x4018},{0xD9660D1C807DEEBEULL,0x3FBC},{0xD5D86D8000000000ULL,0x4018},0x0000},
+	{FOP_FPREM,0x0C7F,{0xD1BA2E9F995151CBULL,0x4023},{0x00478325EB44F4DBULL,0x8000},{0xB0910B26B1798000ULL,0x3FF6},0x0400},
+	{FOP_FSQRT,0x0E7F,{0xC3E5FBD56F7B96DAULL,0x4032},{0x0000000000000000ULL,0x8000},{0xDFF121B27ED64000ULL,0x4018},0x0000},
+	{FOP_FPREM,0x067F,{0x804FCA775923C817ULL,0xC019},{0xA33E31DF45B1C8FDULL,0xBFD5},{0xAC5D958F348F027CULL,0xBFF4},0x0400},
+	{FOP_FXAM,0x047F,{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x0000},0x4000},
+	{FOP_FSCALE,0x0B7F,{0xDD60000000000000ULL,0x3FFD},{0x0000E887C0A102EFULL,0x8000},{0xDD60000000000000ULL,0x3FFD},0x0000},
+	{FOP_FIST64,0x0F7F,{0x93CEBA735497BE53ULL,0xC03D},{0xFE9C0DDE1BD1FBEDULL,0x3FD3},{0xB618A2C655B420D7ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x027F,{0x80ED74F6E007DA2FULL,0xC017},{0x9D3EDD76149FB9FEULL,0xBFCF},{0x97D50772F10319B4ULL,0xBFEE},0x0400},
+	{FOP_FSCALE,0x027F,{0xDC05051AE8691269ULL,0x3FDC},{0xFA33B8BE29A3FBACULL,0x4002},{0xDC05051AE8691269ULL,0x3FEB},0x0000},
+	{FOP_FMUL,0x0C7F,{0x8000000000000000ULL,0x7FFF},{0x837642782C159B64ULL,0xBFBB},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST32,0x087F,{0xDEEDF5FE6A12BF37ULL,0xC044},{0x0000000000000000ULL,0x8000},{0x00000000E25EEDF5ULL,0x0000},0x0000},
+	{FOP_FBST,0x0B7F,{0xB330000000000000ULL,0x4004},{0x8000000000000000ULL,0xFFFF},{0x0000000000000045ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0A7F,{0xBCA1EE002D5C38B0ULL,0x003D},{0xC1E0000000000000ULL,0x3FFB},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0C7F,{0xC2111F24DF48141EULL,0x402B},{0xE9953A81166AC183ULL,0xBFCC},{0xD4B10B0000000000ULL,0xC05D},0x0000},
+	{FOP_FIST64,0x007F,{0xDBA9E2AC98767B12ULL,0x3FF9},{0x913C5D554848F3DEULL,0xC01C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x077F,{0x0000000000000000ULL,0x0000},{0xA44815F0783E97EBULL,0x403C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x0E7F,{0x85F24ABF581C514DULL,0x3FEE},{0xE2C0000000000000ULL,0xC002},{0x85F24ABF581C514DULL,0x3FE0},0x0000},
+	{FOP_FDIV,0x007F,{0x98E66827E9B6F816ULL,0xC007},{0xC12394CBC4EF0FD6ULL,0x4035},{0xCAAA190000000000ULL,0xBFD0},0x0000},
+	{FOP_FRNDINT,0x0E7F,{0x0000000000000000ULL,0x0000},{0x85853AA878D553C0ULL,0x4080},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0B7F,{0xD2C786266269B3C7ULL,0x4001},{0xB14CD1E2C5684F1AULL,0x4016},{0xD2C786266269B3C7ULL,0x4001},0x0000},
+	{FOP_FST32,0x087F,{0x5EA0C542871E7E97ULL,0x8000},{0xBA6C4AFFD54D9FA6ULL,0xBFFA},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0F7F,{0xFFD0000000000000ULL,0xC009},{0xFBF6A1A357905E02ULL,0xBFC6},{0xDEB4885B4F97DC30ULL,0xBFE5},0x0400},
+	{FOP_FST32,0x0A7F,{0xFD2D9F3717A81212ULL,0xBFE6},{0x9FDB856B81AC88D0ULL,0x3FD5},{0x00000000B37D2D9FULL,0x0000},0x0000},
+	{FOP_FBST,0x047F,{0xF4A0253270CDFB11ULL,0x3C03},{0xA2EA3885DAAFE578ULL,0xBFCF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0A7F,{0xF8EB55305BE6DEC7ULL,0xFFFF},{0x9201DB830744485BULL,0xBFF1},{0x00000000FFF8EB55ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x027F,{0xF5426F7AAD0316ACULL,0xBFC8},{0xC413A0C7B1680082ULL,0x3FEB},{0xF5426F7AAD0316ACULL,0xBFC8},0x0000},
+	{FOP_FIST32,0x027F,{0x92C7944CE982E90BULL,0xC006},{0x8000000000000000ULL,0x7FFF},{0x00000000FFFFFF6DULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x047F,{0xC8F5087CD6A56CA1ULL,0xC006},{0xA3C47FF7AB6BB4AAULL,0x7FEC},{0xC900000000000000ULL,0xC006},0x0000},
+	{FOP_FRNDINT,0x067F,{0xD060000000000000ULL,0xC004},{0xD381B9A8722DB5B2ULL,0x4039},{0xD400000000000000ULL,0xC004},0x0000},
+	{FOP_FXAM,0x0E7F,{0xA4275FD7B46E9F19ULL,0xC001},{0x00392B91542B65AFULL,0x8000},{0xA4275FD7B46E9F19ULL,0xC001},0x0600},
+	{FOP_FST32,0x077F,{0xE29814A5E19E00D3ULL,0xFFFF},{0xC8D4816647F5CE5AULL,0x803E},{0x00000000FFE29814ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0B7F,{0xC3C0000000000000ULL,0x4005},{0xB7106EA6E250DB55ULL,0xFFFF},{0xF7106EA6E250DB55ULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x067F,{0xC9E70B4DB9511E4AULL,0xC01C},{0x0000000000000000ULL,0x8000},{0x00000000CD863D2CULL,0x0000},0x0000},
+	{FOP_FPREM,0x047F,{0xDA03DD8197C60658ULL,0x3FBA},{0x8000000000000000ULL,0x7FFF},{0xDA03DD8197C60658ULL,0x3FBA},0x0000},
+	{FOP_FSCALE,0x007F,{0xC6928F807B3A4211ULL,0x4005},{0xFB0F708236F03BADULL,0xC004},{0xC6928F807B3A4211ULL,0x3FC7},0x0000},
+	{FOP_FDIV,0x077F,{0xE96E9C3367F4C9A7ULL,0xC00F},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FBST,0x0C7F,{0x82139732EE4A1649ULL,0xFFFF},{0xC52360358D970047ULL,0xC011},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0E7F,{0xF69891497289A131ULL,0x4040},{0xD078BC56B9B9AA4FULL,0x4031},{0xF696F057F9DC2800ULL,0x4040},0x0000},
+	{FOP_FSQRT,0x027F,{0xF72F18A01359450DULL,0x7FFF},{0xBA5F129B59878D3DULL,0x3FC1},{0xF72F18A01359450DULL,0x7FFF},0x0000},
+	{FOP_FADD,0x0C7F,{0xD470000000000000ULL,0x4008},{0xF3B0A2BB1B19D859ULL,0xFFFF},{0xF3B0A2BB1B19D859ULL,0xFFFF},0x0000},
+	{FOP_FST64,0x087F,{0xC7FE8627707F9AFAULL,0xBFE0},{0x803DA16F36137787ULL,0x403C},{0xBE08FFD0C4EE0FF3ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0E7F,{0xBD20FAD8ED0ED745ULL,0x403D},{0xEEF99D4CF7564F64ULL,0x3FE7},{0xAF7C8DBBECB67770ULL,0x4007},0x0400},
+	{FOP_FRNDINT,0x067F,{0x8000000000000000ULL,0x7FFF},{0x000525C8DF3BF8EFULL,0x0000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x0E7F,{0x8000000000000000ULL,0xFFFF},{0xA6C29423FC9F0E00ULL,0xC013},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FXAM,0x0C7F,{0xF0DBD05250E3327AULL,0x3FE5},{0xF845C869E859916DULL,0xBFB2},{0xF0DBD05250E3327AULL,0x3FE5},0x0400},
+	{FOP_FST64,0x087F,{0xDE65757769BE0F43ULL,0xFFFF},{0xD3D4BF1542F9DCCEULL,0xBFE6},{0xFFFBCCAEAEED37C1ULL,0x0000},0x0000},
+	{FOP_FDIV,0x087F,{0xCDCFCB0F21681A59ULL,0xFFFF},{0x90F53E8853A8C65AULL,0x3FB7},{0xCDCFCB0F21681A59ULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x0F7F,{0xF803B0234EF57320ULL,0xC005},{0xF587DE0346B8DD20ULL,0xC000},{0xF803B0234EF57320ULL,0xC002},0x0000},
+	{FOP_FSQRT,0x027F,{0xC5A35931FE28A013ULL,0xC3FD},{0xAC896DE02798C23AULL,0xFFF8},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x087F,{0xBD98065B973C66B2ULL,0xBFB9},{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x027F,{0xD3FFDF55AAB040BFULL,0x3FF5},{0xE7E84FAE2DA2ECA0ULL,0x3FDF},{0xEA061973CD0CA000ULL,0x4014},0x0000},
+	{FOP_FIST64,0x077F,{0x8000000000000000ULL,0x7FFF},{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x087F,{0xAA08F5B0A363120FULL,0x3FC2},{0xC45360B220E3A690ULL,0x3FDF},{0xAA08F5B0A363120FULL,0x3FC2},0x0000},
+	{FOP_FIST64,0x037F,{0xB7558E2354A4000BULL,0xBFDB},{0xCC972E89818D1F6AULL,0xC00E},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x037F,{0xD5FE041DBAC87AC3ULL,0xC000},{0xB7A468DBED55E504ULL,0x4002},{0xD5FE041DBAC87AC3ULL,0xC00B},0x0000},
+	{FOP_FIST64,0x0F7F,{0x8000000000000000ULL,0xFFFF},{0xA58C4C5AACE45179ULL,0x3FE5},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x007F,{0xDCADF5E3A02D798BULL,0xFFFC},{0xCCD6BE827BD89321ULL,0xC017},{0xFFF0000000000000ULL,0x0000},0x0000},
+	{FOP_FSUB,0x007F,{0xDFF6D9841C0D2707ULL,0xFFFF},{0x83B22CB98280DACBULL,0xC027},{0xDFF6D9841C0D2707ULL,0xFFFF},0x0000},
+	{FOP_FMUL,0x047F,{0x840ED0429ED15761ULL,0x3FC9},{0x0C068B9493F6B0FFULL,0x8000},{0x0000010000000000ULL,0x8000},0x0000},
+	{FOP_FST64,0x0C7F,{0xF6BFD6AB813CA35EULL,0x0019},{0xF68EBDE4077782DDULL,0x4029},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x087F,{0xB54A5E7CAE39C6FEULL,0xBFC7},{0xBB8321C228DACDFFULL,0x3FEF},{0xBC76A94BCF95C738ULL,0x0000},0x0000},
+	{FOP_FDIV,0x0A7F,{0x00028BD6CCFA1B75ULL,0x8000},{0xC379DFF668635515ULL,0x8004},{0xD56A77BF5CE91000ULL,0x3FED},0x0000},
+	{FOP_FPREM,0x0C7F,{0xA5A155D46C69D979ULL,0xC03C},{0x8000000000000000ULL,0xFFFF},{0xA5A155D46C69D979ULL,0xC03C},0x0000},
+	{FOP_FIST64,0x0F7F,{0xFE061F9103784C0BULL,0x3FCF},{0xD3B0D272F620272DULL,0xC037},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x067F,{0x0000000000000000ULL,0x8000},{0xE7F88BDEA6ED637FULL,0x3FD7},{0x0000000000000000ULL,0x8000},0x4200},
+	{FOP_FSCALE,0x087F,{0xF98B6292AEFC27BEULL,0x3FEB},{0xD7AA83AAFC27C8E5ULL,0x4003},{0xF98B6292AEFC27BEULL,0x4005},0x0000},
+	{FOP_FBST,0x0A7F,{0xD6B67CD2BCA278C4ULL,0xC03E},{0xCF3454F4F0F43201ULL,0xC02F},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0B7F,{0x99B0000000000000ULL,0x3FFE},{0xC1D389AFAC200A5CULL,0x402C},{0x99B0000000000000ULL,0x3FFE},0x0400},
+	{FOP_FPREM1,0x087F,{0xA72B23CE290A8E87ULL,0xC007},{0xDE9DEF558D9AB32FULL,0x7FFF},{0xDE9DEF558D9AB32FULL,0x7FFF},0x0000},
+	{FOP_FIST64,0x0B7F,{0xAD47B761AED4AC34ULL,0xBFC3},{0xAD47B761AED4AC34ULL,0x7FFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0E7F,{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x0C7F,{0x921D8CE753AED9C7ULL,0xBFAF},{0x0000000000000000ULL,0x8000},{0x921D8CE753AED9C7ULL,0xBFAF},0x0600},
+	{FOP_FRNDINT,0x0A7F,{0xE2A702545F5DE762ULL,0x3FAF},{0xB91C1BD6F6B65A45ULL,0xC023},{0x8000000000000000ULL,0x3FFF},0x0000},
+	{FOP_FPREM,0x007F,{0x8000000000000000ULL,0xFFFF},{0xCAC1E1352A007286ULL,0x4029},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FST64,0x007F,{0xE01711C3C7C92A54ULL,0x7FFE},{0xAD15120565EB404FULL,0xBFC1},{0x7FF0000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x047F,{0xA24F0C9AB85983F4ULL,0x401F},{0xA24F0C9AB85983F4ULL,0x400A},{0xA24F0C9AB85983F4ULL,0x4A43},0x0000},
+	{FOP_FST32,0x087F,{0x0000000000000000ULL,0x0000},{0x8AAAC39589D955D9ULL,0x401C},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0A7F,{0xDF8B8975FA02FAC7ULL,0xBFC0},{0x8000000000000000ULL,0x7FFF},{0xDF8B8975FA02FAC7ULL,0xBFC0},0x0000},
+	{FOP_FPREM,0x067F,{0x9568C452B1B2D6C3ULL,0x407E},{0xFA9EA7B5E36A00A1ULL,0x3FFA},{0x97331D33D3A9E0B3ULL,0x405A},0x0400},
+	{FOP_FXAM,0x027F,{0x93457BED3B283BD1ULL,0x402D},{0xD64E92CD06F96806ULL,0xBFC5},{0x93457BED3B283BD1ULL,0x402D},0x0400},
+	{FOP_FMUL,0x037F,{0x0002A0C9FCE075D3ULL,0x0000},{0xACABF7711AFA3433ULL,0xBFFD},{0x0000E2E5D38F6E12ULL,0x8000},0x0000},
+	{FOP_FPREM,0x047F,{0xB911A218A7063291ULL,0x4015},{0x9CA0000000000000ULL,0xC004},{0xCD45383194880000ULL,0x4002},0x4200},
+	{FOP_FMUL,0x047F,{0xFE74B51E723F6FD5ULL,0x3FAF},{0xEDE31C0C4239BC9DULL,0xC01A},{0xEC73CA0000000000ULL,0xBFCB},0x0000},
+	{FOP_FDIV,0x0E7F,{0xBE60786F1CDD9BF9ULL,0xC014},{0xBE60786F1CDD9BF9ULL,0xFFFF},{0xFE60786F1CDD9BF9ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x0F7F,{0x001E5527B72EDA13ULL,0x8000},{0x80A1D130EA760213ULL,0xBFC5},{0x001E5527B72EDA13ULL,0x8000},0x4600},
+	{FOP_FSUB,0x0A7F,{0xF43D853657FFC81BULL,0xFFF4},{0x9E6205A2841B33E9ULL,0x3FE5},{0xF43D853657FFC800ULL,0xFFF4},0x0000},
+	{FOP_FST32,0x0F7F,{0x1A0CA1D9C8C54E83ULL,0x0000},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x037F,{0xA2BAD9794B2D73D3ULL,0xBFD1},{0x89EFEEC1F2C96F9AULL,0xC01F},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x087F,{0xFA49737A50ED7449ULL,0xC039},{0x8286CAEE20BFC763ULL,0xBFEE},{0xF82DB4642D78945EULL,0x0000},0x0000},
+	{FOP_FIST32,0x047F,{0xE3036B904054B9A8ULL,0x3FB3},{0xD7C51DEBFB70BD37ULL,0xC007},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x067F,{0xB545BBA8C42FACB0ULL,0x3FE4},{0xA1AA0E5FEC52538FULL,0xC033},{0x3E46A8B7751885F5ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x047F,{0x8000000000000000ULL,0xFFFF},{0xB0AC82A0BFE2895CULL,0xC027},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x027F,{0x8000000000000000ULL,0x7FFF},{0xFF0D0E8F054CBDC1ULL,0xBFE0},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FPREM,0x027F,{0x8C296FA09A7AD68EULL,0xBFF1},{0xBBEE53E4C3C7CE8DULL,0x43FD},{0x8C296FA09A7AD68EULL,0xBFF1},0x0000},
+	{FOP_FIST32,0x087F,{0xC03E81F490097774ULL,0xBFEF},{0x898BC3364C4A43C0ULL,0x3FDA},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x077F,{0x938CD619A0B9E57EULL,0x0009},{0x940AB3CE0C190C17ULL,0x3FE0},{0x896D8894C318ADC6ULL,0x2004},0x0000},
+	{FOP_FSCALE,0x027F,{0xACEADB7E0729773CULL,0xC008},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FXAM,0x0B7F,{0x96D16474F1A2C23BULL,0xFFFF},{0xA523C9D4DF359CD8ULL,0xBFD3},{0x96D16474F1A2C23BULL,0xFFFF},0x0300},
+	{FOP_FRNDINT,0x077F,{0xCA9798FF888CA35BULL,0xC014},{0xF63FAF92FA7860F4ULL,0x3FFE},{0xCA979C0000000000ULL,0xC014},0x0000},
+	{FOP_FMUL,0x087F,{0x8000000000000000ULL,0x7FFF},{0xD60319B71381C68DULL,0xFFF3},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FDIV,0x077F,{0xE8ECE1F0EE89A8B9ULL,0xC080},{0xF93586D5F4070662ULL,0xC027},{0xEF45C2CCB60AFB29ULL,0x4057},0x0000},
+	{FOP_FMUL,0x087F,{0xB6ECB95D992E7E7EULL,0xC03A},{0xB6ECB95D992E7E7EULL,0x4005},{0x82B5720000000000ULL,0xC041},0x0000},
+	{FOP_FST64,0x037F,{0xC8D1BB2889241AB2ULL,0xC008},{0xB60DF7CB1666E591ULL,0xBFB1},{0xC0891A3765112483ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0F7F,{0xBDA096784297F82FULL,0xC07E},{0x9AA938C10B998539ULL,0xC3FF},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0E7F,{0xC9006CBAD676D0D1ULL,0xC00D},{0x0000000000000000ULL,0x0000},{0x00000000C6C9006CULL,0x0000},0x0000},
+	{FOP_FADD,0x0E7F,{0xF02F453A898B36AFULL,0xFFFF},{0xF0BA4494BD3B8880ULL,0x8038},{0xF02F453A898B36AFULL,0xFFFF},0x0000},
+	{FOP_FIST32,0x0A7F,{0xC45B63B82DA2826EULL,0x3FF1},{0xECA31A5972E7C80DULL,0xBFDB},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FST32,0x0E7F,{0x000381C4AA398529ULL,0x0000},{0xC8AECD0D30E3D4CAULL,0xC03F},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x007F,{0xF070000000000000ULL,0xC002},{0x8000000000000000ULL,0xFFFF},{0xF000000000000000ULL,0xC002},0x0000},
+	{FOP_FPREM,0x077F,{0x8DF4DA9BC25188C8ULL,0xBFF8},{0x80E6EACBEA4B2694ULL,0xC016},{0x8DF4DA9BC25188C8ULL,0xBFF8},0x0000},
+	{FOP_FDIV,0x0F7F,{0xD2411E3AC142F9D9ULL,0xFFE8},{0x856741DD46CE7913ULL,0x7FFD},{0xC9BCFE67483C0A06ULL,0xBFEA},0x0000},
+	{FOP_FDIV,0x0B7F,{0x0000000000000000ULL,0x8000},{0x9FD0000000000000ULL,0xC002},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0E7F,{0x8000000000000000ULL,0x7FFF},{0x83F5EC8EF2E2443CULL,0x3FD8},{0x7FF0000000000000ULL,0x0000},0x0000},
+	{FOP_FMUL,0x087F,{0x97579428DF867EE1ULL,0x3FFF},{0xF30E4684C007A61BULL,0xFFFF},{0xF30E4684C007A61BULL,0xFFFF},0x0000},
+	{FOP_FSCALE,0x047F,{0xD260D4A0566AEB9AULL,0x43FE},{0x0000000000000000ULL,0x8000},{0xD260D4A0566AEB9AULL,0x43FE},0x0000},
+	{FOP_FST64,0x007F,{0x808492FF49B409D2ULL,0x0004},{0xD9365E83CE2889F0ULL,0x3FFE},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FSCALE,0x087F,{0xDDD8F61820612535ULL,0xBC02},{0xFAF28B965B8B9496ULL,0xC006},{0xDDD8F61820612535ULL,0xBB08},0x0000},
+	{FOP_FDIV,0x0E7F,{0xA95FA8EB54167F8AULL,0xBFF7},{0x9EBE9CE1E971D470ULL,0x403C},{0x88920D8EB704A800ULL,0xBFBA},0x0000},
+	{FOP_FST32,0x087F,{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0xC001},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FADD,0x0C7F,{0x87870BF3B9D0596FULL,0xFFFF},{0x97410EFCE54C23D3ULL,0x403F},{0xC7870BF3B9D0596FULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x037F,{0x0000000000000000ULL,0x8000},{0x96D0000000000000ULL,0xBFFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSQRT,0x047F,{0xEC3129F668F66351ULL,0x404E},{0x8000000000000000ULL,0x7FFF},{0xF5E58B0000000000ULL,0x4026},0x0000},
+	{FOP_FXAM,0x077F,{0xC621FA755483BE82ULL,0xC047},{0xC838512E01ABB420ULL,0x401C},{0xC621FA755483BE82ULL,0xC047},0x0600},
+	{FOP_FMUL,0x047F,{0x82808FB47DB6C7EFULL,0x4007},{0xF7806953AFE4F4C6ULL,0xBFC2},{0xFC57020000000000ULL,0xBFCA},0x0000},
+	{FOP_FPREM1,0x027F,{0x804EB5B309EF672FULL,0x401D},{0xC45714727DF9E4DEULL,0x3FF5},{0x98174E8E55754FA4ULL,0x3FF4},0x0200},
+	{FOP_FIST32,0x087F,{0x8B696902EF6E7EE6ULL,0x3FC8},{0xC68D11D1F25772CAULL,0xC00E},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FSQRT,0x0C7F,{0xBF683CF7A626910CULL,0x401F},{0x8000000000000000ULL,0xFFFF},{0x9C866F0000000000ULL,0x400F},0x0000},
+	{FOP_FADD,0x077F,{0x8C0935BEFD6ABCC1ULL,0xBFF5},{0xBFC7D7EDE270FB70ULL,0xBFE8},{0x8C0F33FDBCD9D049ULL,0xBFF5},0x0000},
+	{FOP_FST32,0x0E7F,{0x8000000000000000ULL,0xFFFF},{0x91A05D83D81E61EBULL,0xBFBF},{0x00000000FF800000ULL,0x0000},0x0000},
+	{FOP_FST64,0x007F,{0xA10297370F6D9665ULL,0x7FD3},{0x8000000000000000ULL,0x7FFF},{0x7FF0000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0C7F,{0xD9B7A5298F40E7A0ULL,0x4008},{0xA90BEE2F4D0AAD49ULL,0xFFFF},{0xE90BEE2F4D0AAD49ULL,0xFFFF},0x0000},
+	{FOP_FXAM,0x047F,{0xCDA638B05CB780E8ULL,0xC023},{0xB8187A935E0267F6ULL,0xC033},{0xCDA638B05CB780E8ULL,0xC023},0x0600},
+	{FOP_FDIV,0x0C7F,{0x889B0CF2C9A23670ULL,0x3C03},{0x889B0CF2C9A23670ULL,0x7FFF},{0xC89B0CF2C9A23670ULL,0x7FFF},0x0000},
+	{FOP_FIST64,0x0F7F,{0xDAE7505BAD6B3D9DULL,0x7FFF},{0xCCD7D4F4FF60B5D0ULL,0x4024},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x047F,{0x893A7094A230A311ULL,0xFFFF},{0x8000000000000000ULL,0xFFFF},{0x893A7094A230A311ULL,0xFFFF},0x0300},
+	{FOP_FMUL,0x037F,{0xF9671C4547199772ULL,0x3FF5},{0xBF80000000000000ULL,0x3FFF},{0xBA90A1A5D2AFA4CAULL,0x3FF6},0x0000},
+	{FOP_FDIV,0x0E7F,{0xB5E1E48CA77426B4ULL,0x0033},{0xB01E13E43E37F075ULL,0x3FE1},{0x84309AA1144DA000ULL,0x0051},0x0000},
+	{FOP_FBST,0x007F,{0xB5DBB2B9B2129C9FULL,0x3FC3},{0x0000000000000000ULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FXAM,0x067F,{0x8F40000000000000ULL,0x3FFF},{0xF371C3C3AA310EA7ULL,0x7FCA},{0x8F40000000000000ULL,0x3FFF},0x0400},
+	{FOP_FSQRT,0x0B7F,{0x84FC2BB3B0CB65B6ULL,0x3FD1},{0xB1ADD116FA6F9EF1ULL,0xFFFF},{0x8277FDA57762B169ULL,0x3FE8},0x0000},
+	{FOP_FIST32,0x007F,{0xB20018B913F32672ULL,0xC010},{0xF2D0ECB307999910ULL,0x3FB5},{0x00000000FFFD3800ULL,0x0000},0x0000},
+	{FOP_FBST,0x087F,{0x813E088AC5CA3B3DULL,0x3FBF},{0xCBA62B1AD668E378ULL,0xBFC0},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FIST64,0x077F,{0x8000000000000000ULL,0xFFFF},{0x907B9645B4DBA49CULL,0x4012},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0F7F,{0xF6CE6394ED2B678AULL,0xC023},{0x0001B78A68E7A855ULL,0x8000},{0xFFFFFFE126338D63ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x0B7F,{0xA3E8BD0C3D658228ULL,0x402E},{0x875FDB19FBA465E7ULL,0xC00B},{0x88C754E0E679FA00ULL,0x4009},0x0000},
+	{FOP_FIST64,0x0E7F,{0xD83F8273264F3F2BULL,0x3FFA},{0xD4431B3F53B0B50DULL,0x7FD7},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x067F,{0x00000BA06FE6FDCBULL,0x0000},{0x00000BA06FE6FDCBULL,0x0000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FST32,0x0C7F,{0xD77DEB29A90F7A85ULL,0xBFE3},{0xFF00DBA96AC4BBF3ULL,0xC006},{0x00000000B1D77DEBULL,0x0000},0x0000},
+	{FOP_FSUB,0x0A7F,{0x0010A72D61146BFBULL,0x0000},{0xA0D6B8F68EC02152ULL,0x400B},{0xA0D6B8F68EC02000ULL,0xC00B},0x0000},
+	{FOP_FMUL,0x027F,{0xC8D88173462F6C08ULL,0xBFB7},{0xACF345514F71A8CDULL,0x7FFF},{0xECF345514F71A8CDULL,0x7FFF},0x0000},
+	{FOP_FBST,0x047F,{0x8000000000000000ULL,0xFFFF},{0xA2E366840843B23DULL,0xBFC1},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSUB,0x0C7F,{0x000000023A846DC9ULL,0x8000},{0xDD14F9D787E160C0ULL,0x4007},{0xDD14F90000000000ULL,0xC007},0x0000},
+	{FOP_FSCALE,0x047F,{0x8000000000000000ULL,0xFFFF},{0xA8728AD9DC131FEDULL,0xC005},{0x8000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FSQRT,0x027F,{0xF296B02736DA0FAFULL,0xFFFF},{0xBD548814A695D9DFULL,0xBFCB},{0xF296B02736DA0FAFULL,0xFFFF},0x0000},
+	{FOP_FBST,0x0B7F,{0xEEE67668A54FE9DDULL,0x3FFA},{0x9E65B0E7A7599FBBULL,0x4045},{0x0000000000000001ULL,0x0000},0x0000},
+	{FOP_FPREM,0x0C7F,{0xEB0D9D79CCF8F428ULL,0x3F83},{0xE870000000000000ULL,0x4001},{0xEB0D9D79CCF8F428ULL,0x3F83},0x0000},
+	{FOP_FXAM,0x027F,{0x983B3D788D1454F2ULL,0x3FBD},{0x9BE177D31672E69EULL,0xC03D},{0x983B3D788D1454F2ULL,0x3FBD},0x0400},
+	{FOP_FPREM1,0x0B7F,{0xCD93ED6337CD3AFCULL,0x7FDC},{0xE9B284389F8ECCE2ULL,0xBFAF},{0xDD6F7FF5E3569650ULL,0x7FAE},0x0400},
+	{FOP_FBST,0x067F,{0x0000000000000000ULL,0x8000},{0xC650000000000000ULL,0x4008},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FST64,0x027F,{0x8000000000000000ULL,0xFFFF},{0xA66C53D9AEFBDF92ULL,0xC03C},{0xFFF0000000000000ULL,0x0000},0x0000},
+	{FOP_FST64,0x0A7F,{0xFF803707D575DD57ULL,0xBFC3},{0xE1152B72CB1260AFULL,0x3FC8},{0xBC3FF006E0FAAEBBULL,0x0000},0x0000},
+	{FOP_FXAM,0x027F,{0x8B0349B4A482AD6EULL,0xBFC1},{0x8836366311BC12DEULL,0xC01E},{0x8B0349B4A482AD6EULL,0xBFC1},0x0600},
+	{FOP_FPREM,0x077F,{0xF2376F5D644C96D3ULL,0xC001},{0xB61D286DF102AD55ULL,0x7FFF},{0xF61D286DF102AD55ULL,0x7FFF},0x0000},
+	{FOP_FDIV,0x027F,{0x9C510581A0C645D1ULL,0x4043},{0xDEB629426852F52DULL,0xBC02},{0xB3AE516EF0A8C800ULL,0xC43F},0x0000},
+	{FOP_FMUL,0x0C7F,{0x0000000000000000ULL,0x8000},{0xB2DCC40A61EFB5A4ULL,0x4030},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FRNDINT,0x0F7F,{0xE53EFF4AE021F601ULL,0x7FFF},{0xEE64959BE62EB5F0ULL,0xBFE0},{0xE53EFF4AE021F601ULL,0x7FFF},0x0000},
+	{FOP_FIST64,0x087F,{0xEBB1D6B8FDB17F6BULL,0x7FE6},{0x8000000000000000ULL,0x7FFF},{0x8000000000000000ULL,0x0000},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0xE6AAA72BFBBC5F8CULL,0x404B},{0x0000000018226231ULL,0x0000},{0xE6AAA72BFBBC5F8CULL,0x404B},0x0000},
+	{FOP_FXAM,0x077F,{0xCF50000000000000ULL,0xC00A},{0x8AD2EC53BC4C581FULL,0x3FBD},{0xCF50000000000000ULL,0xC00A},0x0600},
+	{FOP_FRNDINT,0x067F,{0xA1023838A6A46C7AULL,0x3FB8},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST32,0x0A7F,{0x852B0F277D3C3540ULL,0xC047},{0xA8AB19EAB951B801ULL,0xC04B},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FBST,0x0F7F,{0xE8DD42E7D0B99647ULL,0xBFCD},{0x9BE1E2F9D064F5E6ULL,0x404A},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FPREM1,0x0E7F,{0x0000000014CD7057ULL,0x0000},{0xDE6F1C9302596FCDULL,0x404A},{0x0000000014CD7057ULL,0x0000},0x0000},
+	{FOP_FST32,0x007F,{0xB75A990BEB02ADF6ULL,0xBFFE},{0xA0B09DEA52B549FDULL,0xFFFF},{0x00000000BF375A99ULL,0x0000},0x0000},
+	{FOP_FSUB,0x077F,{0xC9066EA51E83154CULL,0x3FD0},{0x8EE243B69400BF7CULL,0xBFC4},{0xC90F5CC959EC5557ULL,0x3FD0},0x0000},
+	{FOP_FST32,0x037F,{0xA2FFCA682DEE1191ULL,0xBFFB},{0x00000041FDE1BAC5ULL,0x8000},{0x00000000BDA2FFCAULL,0x0000},0x0000},
+	{FOP_FDIV,0x087F,{0xCF7E93C1BDD11502ULL,0x403B},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x8000},0x0000},
+	{FOP_FSUB,0x007F,{0x9391AFE3EBD64675ULL,0x4026},{0x8D06C34E788256D9ULL,0x7FF4},{0x8D06C30000000000ULL,0xFFF4},0x0000},
+	{FOP_FSQRT,0x0E7F,{0x92D8E11AD18D7A87ULL,0x7FFF},{0xF7C70828CE826A69ULL,0xBFCC},{0xD2D8E11AD18D7A87ULL,0x7FFF},0x0000},
+	{FOP_FRNDINT,0x0B7F,{0xA6FF34BC4D7A0588ULL,0x3FC3},{0x9062D199006B4291ULL,0x4025},{0x8000000000000000ULL,0x3FFF},0x0000},
+	{FOP_FSQRT,0x067F,{0xDAAB7AF78B4581ADULL,0x8016},{0x8843B793A88CF1ABULL,0x4021},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FPREM1,0x0C7F,{0x8A3D2687F357EFD1ULL,0xBFBA},{0xEF9B4A1CDDC1E770ULL,0x4028},{0x8A3D2687F357EFD1ULL,0xBFBA},0x0000},
+	{FOP_FXAM,0x0C7F,{0xA0C6FF261B6A5657ULL,0xC027},{0xBDD5765EF0C105F1ULL,0x3FD4},{0xA0C6FF261B6A5657ULL,0xC027},0x0600},
+	{FOP_FADD,0x007F,{0xE710235F0C05AEA2ULL,0x3FD8},{0x0000000000000000ULL,0x0000},{0xE710230000000000ULL,0x3FD8},0x0000},
+	{FOP_FST64,0x0E7F,{0x86ADD676300A40A7ULL,0x3FC3},{0x881FFB5199C9FD8BULL,0xC031},{0x3C30D5BACEC60148ULL,0x0000},0x0000},
+	{FOP_FDIV,0x077F,{0x9F7EBE08DF4490B7ULL,0x403E},{0xE8CB5E93E0369CFFULL,0x3FDC},{0xAF64DCF89AFD9805ULL,0x4060},0x0000},
+	{FOP_FXAM,0x0E7F,{0x8A70D05A9F00D487ULL,0xC049},{0x8C3EA5DDC8220A7FULL,0x7FFF},{0x8A70D05A9F00D487ULL,0xC049},0x0600},
+	{FOP_FBST,0x067F,{0x91B2B30BBDADECA2ULL,0xBFBE},{0xF2171C9A210EDF58ULL,0xBFC3},{0x0000000000000001ULL,0x8000},0x0000},
+	{FOP_FIST32,0x037F,{0xF879CA6D67BD1417ULL,0x4025},{0xD1C3C57F84E248E9ULL,0xBF82},{0x0000000080000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x0F7F,{0xAE1944E556315347ULL,0xC00E},{0xAE1944E556315347ULL,0xFFFF},{0xFFFFFFFFFFFF51E7ULL,0x0000},0x0000},
+	{FOP_FMUL,0x0C7F,{0xC0A1599E19C726B7ULL,0xBFC0},{0x989112B6E2367575ULL,0xC047},{0xE599ED0000000000ULL,0x4008},0x0000},
+	{FOP_FBST,0x077F,{0xC05D75BF33B6BB8AULL,0x404D},{0xC05D75BF33B6BB8AULL,0x3FFF},{0xC000000000000000ULL,0xFFFF},0x0000},
+	{FOP_FADD,0x067F,{0xF3A87648514017F8ULL,0xBFB6},{0x0000000000000000ULL,0x8000},{0xF3A8764851401800ULL,0xBFB6},0x0000},
+	{FOP_FMUL,0x077F,{0xE230000000000000ULL,0xC005},{0x81A5BC9D70FEB746ULL,0x4009},{0xE5193F2CB68C1B1DULL,0xC00F},0x0000},
+	{FOP_FSQRT,0x077F,{0x0000000000000000ULL,0x0000},{0x8000000000000000ULL,0xFFFF},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FDIV,0x067F,{0xDEF6C02758BE089EULL,0xC041},{0x0000000000000000ULL,0x8000},{0x8000000000000000ULL,0x7FFF},0x0000},
+	{FOP_FSUB,0x037F,{0xA56DAAF11643DFE8ULL,0x3FCA},{0xA036F2E73327D792ULL,0xBFB9},{0xA56DFB0C8FB7797CULL,0x3FCA},0x0000},
+	{FOP_FIST64,0x007F,{0x9A3BEB360CF64B98ULL,0x3FBA},{0xEC56B5A266BFF2B3ULL,0xBFBB},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FPREM1,0x077F,{0x9F1B81D08B177E40ULL,0x3FF7},{0x8D075099859C2173ULL,0x4048},{0x9F1B81D08B177E40ULL,0x3FF7},0x0000},
+	{FOP_FST64,0x0C7F,{0x82701DE4385F3D43ULL,0x7FFF},{0xB029EEA0B240E39EULL,0xBFFE},{0x7FF84E03BC870BE7ULL,0x0000},0x0000},
+	{FOP_FPREM,0x027F,{0xD671370B629D8723ULL,0x3FF3},{0x8A80C22B4A70C269ULL,0xBFBB},{0xF1138F8CE6DD4A70ULL,0x3FB8},0x4000},
+	{FOP_FIST64,0x037F,{0xD98F97A8442AC0B5ULL,0xBFBE},{0x0000000000000000ULL,0x8000},{0x0000000000000000ULL,0x0000},0x0000},
+	{FOP_FIST64,0x077F,{0x8CF4EEFB345B4BAEULL,0x4014},{0xB4A0B00376B8EB33ULL,0x3FBC},{0x0000000000233D3BULL,0x0000},0x0000},
+	{FOP_FSUB,0x007F,{0x994C2CF2069671FBULL,0xBFD7},{0x994C2CF2069671FBULL,0x3FB5},{0x994C2D0000000000ULL,0xBFD7},0x0000},
+	{FOP_FSQRT,0x077F,{0xD26405C1095D994FULL,0x7FEC},{0xD26405C1095D994FULL,0xBFDA},{0xE813DF03680BB51BULL,0x5FF5},0x0000},
+	{FOP_FIST64,0x0B7F,{0xD673603C74EB5DC6ULL,0x3FD6},{0xF470000000000000ULL,0x400A},{0x0000000000000001ULL,0x0000},0x0000},
+};
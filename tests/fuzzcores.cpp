@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Headless run of the core fuzzer of the debugger (FUZZCORES).
+   usage: fuzzcores [cases] [seed] [workers] [cputype]
+   Every worker is a forked process fuzzing its share of the cases from its
+   own seed, the exit code is nonzero when a core differed. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string>
+
+#include "harness.h"
+#include "debug.h"
+
+static Bit32u first_seed;
+
+static void FuzzPrint(char const* format,...) {
+	va_list msg;
+	va_start(msg,format);
+	vfprintf(stdout,format,msg);
+	va_end(msg);
+}
+
+static Bitu FuzzWorker(Bitu index,Bitu count) {
+	Bit32u seed=first_seed+(Bit32u)index*0x9e3779b9;
+	if (!seed) seed=1;
+	Bit32u start=seed;
+	Bitu failures=FUZZ_Cores(count,seed,&FuzzPrint);
+	printf("worker %d: seed %08X, %d cases, %d failures\n",(int)index,start,(int)count,(int)failures);
+	return failures;
+}
+
+int main(int argc,char * argv[]) {
+	Bitu cases=argc>1 ? strtoul(argv[1],0,0) : 20000;
+	first_seed=argc>2 ? (Bit32u)strtoul(argv[2],0,0) : 1;
+	Bitu workers=argc>3 ? strtoul(argv[3],0,0) : 4;
+	char const * cputype=argc>4 ? argv[4] : "auto";
+	std::string cputype_setting=std::string("cputype=")+cputype;
+	try {
+		char const * const settings[]={"memsize=4",cputype_setting.c_str(),0};
+		HARNESS_Init(settings);
+		double start=HARNESS_Time();
+		Bitu failures=HARNESS_RunWorkers(workers,cases,&FuzzWorker);
+		printf("fuzzcores: %d cases on %d workers (%s), %d failures, %.1f s\n",(int)cases,(int)workers,cputype,(int)failures,HARNESS_Time()-start);
+		return failures ? 1 : 0;
+	} catch (char * error) {
+		printf("fuzzcores: %s\n",error);
+		return 2;
+	}
+}
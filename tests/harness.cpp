@@ -0,0 +1,167 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "harness.h"
+#include "setup.h"
+#include "cross.h"
+#include "inout.h"
+#include "mapper.h"
+#include "debug.h"
+#include "pic.h"
+#include "paging.h"
+
+void MEM_Init(Section *);
+void PAGING_Init(Section *);
+void CALLBACK_Init(Section*);
+void CPU_Init(Section*);
+void FPU_Init(Section*);
+
+/* The parts of the emulator the cpu sources reach into, a machine without
+   devices, gui or debugger window */
+
+MachineType machine=MCH_VGA;
+Bit32s ticksDone;
+Bit32u ticksScheduled;
+Bitu PIC_IRQCheck;
+Bitu cycle_count;
+Bitu debugCallback;
+
+// the emulator log (illegal reads and writes of the random code) is dropped
+void DEBUG_ShowMsg(char const* /*format*/,...) {
+}
+
+void LOG::operator() (char const* /*format*/, ...) {
+}
+
+bool DEBUG_Breakpoint(void) { return false; }
+bool DEBUG_IntBreakpoint(Bit8u /*intNum*/) { return false; }
+void CallFunction::AddCall(Bitu /*fromSegment*/,Bitu /*fromOff*/,Bitu /*toSegment*/,Bitu /*toOff*/,Bitu /*retOff*/) { }
+void CallFunction::NotifyReturn(Bitu /*seg*/,Bitu /*off*/) { }
+
+void IO_WriteB(Bitu /*port*/,Bitu /*val*/) { }
+void IO_WriteW(Bitu /*port*/,Bitu /*val*/) { }
+void IO_WriteD(Bitu /*port*/,Bitu /*val*/) { }
+Bitu IO_ReadB(Bitu /*port*/) { return 0xff; }
+Bitu IO_ReadW(Bitu /*port*/) { return 0xffff; }
+Bitu IO_ReadD(Bitu /*port*/) { return 0xffffffff; }
+void IO_ReadHandleObject::Install(Bitu /*port*/,IO_ReadHandler * /*handler*/,Bitu /*mask*/,Bitu /*range*/) { }
+void IO_WriteHandleObject::Install(Bitu /*port*/,IO_WriteHandler * /*handler*/,Bitu /*mask*/,Bitu /*range*/) { }
+IO_ReadHandleObject::~IO_ReadHandleObject() { }
+IO_WriteHandleObject::~IO_WriteHandleObject() { }
+
+void MAPPER_AddHandler(MAPPER_Handler * /*handler*/,MapKeys /*key*/,Bitu /*mods*/,char const * const /*eventname*/,char const * const /*buttonname*/) { }
+void GFX_SetTitle(Bit32s /*cycles*/,Bits /*frameskip*/,bool /*paused*/) { }
+void DOSBOX_RunMachine(void) { }
+void MSG_Add(const char* /*name*/,const char* /*msg*/) { }
+const char* MSG_Get(char const * msg) { return msg; }
+
+void Cross::ResolveHomedir(std::string & /*temp_line*/) { }
+bool Cross::IsPathAbsolute(std::string const& in) { return !in.empty() && in[0]=='/'; }
+
+// the bus where the video card would have its linear frame buffer and mmio,
+// reads give 0xff like the pages without memory
+class NoDevicePageHandler : public PageHandler {
+public:
+	NoDevicePageHandler() {
+		flags=PFLAG_INIT|PFLAG_NOCODE;
+	}
+	Bitu readb(PhysPt /*addr*/) {
+		return 0xff;
+	}
+	void writeb(PhysPt /*addr*/,Bitu /*val*/) {
+	}
+};
+
+static NoDevicePageHandler nodevice_page_handler;
+
+static Section_prop dosbox_section("dosbox");
+static Section_prop cpu_section("cpu");
+
+void HARNESS_Init(char const * const * settings) {
+	Prop_int * Pint;
+	Pint = dosbox_section.Add_int("memsize",Property::Changeable::WhenIdle,16);
+	Pint->SetMinMax(1,3583);
+
+	cpu_section.Add_string("core",Property::Changeable::WhenIdle,"normal");
+	cpu_section.Add_string("cputype",Property::Changeable::Always,"auto");
+	Prop_multival_remain * Pmulti_remain = cpu_section.Add_multiremain("cycles",Property::Changeable::Always," ");
+	Pmulti_remain->GetSection()->Add_string("type",Property::Changeable::Always,"fixed");
+	Pmulti_remain->GetSection()->Add_string("parameters",Property::Changeable::Always,"");
+	Pmulti_remain->SetValue("fixed 10000");
+	cpu_section.Add_int("cycleup",Property::Changeable::Always,10);
+	cpu_section.Add_int("cycledown",Property::Changeable::Always,20);
+	cpu_section.Add_int("dynrec_cache",Property::Changeable::OnlyAtStart,8);
+	cpu_section.Add_string("fpu",Property::Changeable::OnlyAtStart,"double");
+
+	for (;settings && *settings;settings++) {
+		std::string line(*settings);
+		if (!dosbox_section.HandleInputline(line) && !cpu_section.HandleInputline(line)) {
+			E_Exit("Unknown setting %s",*settings);
+		}
+	}
+
+	PAGING_Init(&dosbox_section);
+	MEM_Init(&dosbox_section);
+	MEM_SetLFB(0xC0000000 >> 12,0,&nodevice_page_handler,&nodevice_page_handler);	// S3_LFB_BASE
+	CALLBACK_Init(&dosbox_section);
+	CPU_Init(&cpu_section);
+	FPU_Init(&cpu_section);
+}
+
+Bitu HARNESS_RunWorkers(Bitu workers,Bitu count,HARNESS_Worker * worker) {
+	if (workers<2) return worker(0,count);
+	fflush(stdout);
+	Bitu failures=0;
+	Bitu started=0;
+	for (Bitu i=0;i<workers;i++) {
+		Bitu share=count/workers+(i<count%workers ? 1 : 0);
+		pid_t pid=fork();
+		if (pid==0) {
+			Bitu result=worker(i,share);
+			fflush(stdout);
+			_exit(result>254 ? 254 : (int)result);
+		}
+		if (pid<0) {
+			// no more processes, do the share here
+			failures+=worker(i,share);
+			continue;
+		}
+		started++;
+	}
+	for (;started>0;started--) {
+		int status;
+		if (wait(&status)<0) break;
+		if (WIFEXITED(status)) failures+=WEXITSTATUS(status);
+		else failures++;		// a crashed worker
+	}
+	return failures;
+}
+
+double HARNESS_Time(void) {
+	struct timeval tv;
+	gettimeofday(&tv,0);
+	return tv.tv_sec+tv.tv_usec/1000000.0;
+}
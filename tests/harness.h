@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2002-2018  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOSBOX_TESTS_HARNESS_H
+#define DOSBOX_TESTS_HARNESS_H
+
+#include "dosbox.h"
+
+/* A machine without a gui: memory, paging, callbacks, cpu and fpu set up
+   from settings in the dosbox.conf syntax, e.g. "core=dynamic" */
+void HARNESS_Init(char const * const * settings);
+
+/* Splits count into workers forked processes, worker(index,count) runs in
+   each of them and returns its failures. The total is returned. */
+typedef Bitu (HARNESS_Worker)(Bitu index,Bitu count);
+Bitu HARNESS_RunWorkers(Bitu workers,Bitu count,HARNESS_Worker * worker);
+
+/* Seconds since an arbitrary start */
+double HARNESS_Time(void);
+
+#endif